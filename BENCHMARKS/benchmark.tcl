@@ -0,0 +1,321 @@
+# OpenSees -- Open System for Earthquake Engineering Simulation
+# Pacific Earthquake Engineering Research Center
+# http://opensees.berkeley.edu/
+#
+# Benchmark Driver
+# ----------------
+#
+# usage: OpenSees benchmark.tcl <-size small|medium|large> <-models {m1 m2 ..}>
+#                  <-repeat n> <-numThreads n> <-out results.txt>
+#                  <-baseline baseline.txt> <-tolerance tol> <-minTime t>
+#                  <-checkTolerance tol> <-profile dir>
+#
+# Runs the canonical models found in the models directory. Each model file
+# defines a namespace with the same name holding:
+#
+#   build size    - builds the model for the given size, returns {count unit check}
+#   runs          - a list of runs, each a list of the phases done one after
+#                   the other on a freshly built model, e.g. {{gravity eigen}}
+#   <phase>       - does the phase, returns {count unit check}
+#
+# Every phase of a run is timed with the wall clock, a run is repeated
+# -repeat times and the fastest time of each phase kept. The results are
+# written one phase per line to the -out file:
+#
+#   model phase seconds count unit rate check
+#
+# where rate is the throughput count/seconds (elements/s, steps/s, ..) and
+# check a response value of the phase (a displacement, a period, ..) used
+# to make sure that the same work was timed. With -baseline the results
+# are compared against a file written by an earlier run: a phase slower
+# than the baseline by more than -tolerance (a fraction), or whose check
+# value differs by more than -checkTolerance, is reported and the script
+# exits with 1. Phases taking less than -minTime seconds in both runs are
+# too short to time reliably and only have their check values compared.
+#
+# With -profile the profiler is run on each phase and its report written
+# to dir/model-phase.txt; the timings then include the profiling overhead.
+#
+# Written: agent
+# Date: October 2026
+
+set benchDir [file dirname [info script]]
+
+# ##############################################################
+# Options
+# ##############################################################
+
+set size medium
+set models {frame soil wall truss dambreak}
+set repeat 3
+set numThreads 1
+set outFile results.txt
+set baselineFile ""
+set tolerance 0.10
+set minTime 0.01
+set checkTolerance 1.0e-4
+set profileDir ""
+
+for {set i 0} {$i < [llength $argv]} {incr i} {
+    set opt [lindex $argv $i]
+    set val [lindex $argv [incr i]]
+    switch -- $opt {
+	-size           {set size $val}
+	-models         {set models $val}
+	-repeat         {set repeat $val}
+	-numThreads     {set numThreads $val}
+	-out            {set outFile $val}
+	-baseline       {set baselineFile $val}
+	-tolerance      {set tolerance $val}
+	-minTime        {set minTime $val}
+	-checkTolerance {set checkTolerance $val}
+	-profile        {set profileDir $val}
+	default {
+	    puts stderr "benchmark.tcl - unknown option $opt"
+	    exit 2
+	}
+    }
+}
+
+if {[lsearch {small medium large} $size] < 0} {
+    puts stderr "benchmark.tcl - size must be small, medium or large"
+    exit 2
+}
+if {$profileDir != ""} {
+    file mkdir $profileDir
+}
+
+# ##############################################################
+# Helpers used by the models
+# ##############################################################
+
+# groundMotion tsTag dt duration pga
+#   defines Path time series tsTag with a synthetic acceleration record: 20
+#   harmonics log spaced between 0.5 and 10 Hz with fixed pseudo random
+#   phases, shaped by a rise, strong motion and decay envelope and scaled
+#   to the peak ground acceleration pga. The record is the same on every
+#   machine, no record file is needed.
+proc groundMotion {tsTag dt duration pga} {
+    set pi [expr {acos(-1.0)}]
+    set numHarmonics 20
+
+    set seed 12345
+    set freqs {}
+    set phases {}
+    for {set k 0} {$k < $numHarmonics} {incr k} {
+	set seed [expr {(1103515245*$seed + 12345) % 2147483648}]
+	lappend freqs [expr {0.5*pow(20.0, double($k)/($numHarmonics-1))}]
+	lappend phases [expr {2.0*$pi*$seed/2147483648.0}]
+    }
+
+    set tRise [expr {0.1*$duration}]
+    set tDecay [expr {0.5*$duration}]
+    set numPoints [expr {int($duration/$dt + 0.5) + 1}]
+    set values {}
+    set peak 0.0
+    for {set i 0} {$i < $numPoints} {incr i} {
+	set t [expr {$i*$dt}]
+	if {$t < $tRise} {
+	    set env [expr {($t/$tRise)*($t/$tRise)}]
+	} elseif {$t < $tDecay} {
+	    set env 1.0
+	} else {
+	    set env [expr {exp(-4.0*($t-$tDecay)/($duration-$tDecay))}]
+	}
+	set a 0.0
+	foreach f $freqs phi $phases {
+	    set a [expr {$a + sin(2.0*$pi*$f*$t + $phi)}]
+	}
+	set a [expr {$env*$a}]
+	if {abs($a) > $peak} {set peak [expr {abs($a)}]}
+	lappend values $a
+    }
+
+    set scaled {}
+    foreach a $values {
+	lappend scaled [expr {$pga*$a/$peak}]
+    }
+
+    timeSeries Path $tsTag -dt $dt -values {*}$scaled
+
+    return [expr {$numPoints-1}]
+}
+
+# ##############################################################
+# Timing
+# ##############################################################
+
+set results {}
+
+# runPhase model phase script
+#   evaluates the script of the phase, keeping the fastest time of all
+#   the repetitions; returns 0 if the phase succeeded and -1 if not
+proc runPhase {model phase script} {
+    global seconds count unit check failed results profileDir
+
+    set key "$model $phase"
+    if {[lsearch -exact $results $key] < 0} {
+	lappend results $key
+    }
+
+    if {$profileDir != ""} {
+	profile reset
+	profile start
+    }
+
+    set t0 [clock microseconds]
+    set ok [catch {uplevel #0 $script} res]
+    set t1 [clock microseconds]
+
+    if {$profileDir != ""} {
+	profile stop
+	profile report [file join $profileDir "$model-$phase.txt"]
+    }
+
+    if {$ok != 0 || [llength $res] != 3} {
+	puts stderr "benchmark.tcl - $model $phase failed: $res"
+	set failed($key) 1
+	return -1
+    }
+
+    set t [expr {($t1-$t0)*1.0e-6}]
+    if {![info exists seconds($key)] || $t < $seconds($key)} {
+	set seconds($key) $t
+    }
+    set count($key) [lindex $res 0]
+    set unit($key) [lindex $res 1]
+    set check($key) [lindex $res 2]
+
+    return 0
+}
+
+# ##############################################################
+# Run the models
+# ##############################################################
+
+foreach model $models {
+    set modelFile [file join $benchDir models $model.tcl]
+    if {![file exists $modelFile]} {
+	puts stderr "benchmark.tcl - no model $model ($modelFile)"
+	exit 2
+    }
+    source $modelFile
+
+    puts "benchmark: $model ($size)"
+
+    foreach run [set ${model}::runs] {
+	for {set r 0} {$r < $repeat} {incr r} {
+	    wipe
+	    integrator -numThreads $numThreads
+
+	    if {[runPhase $model build [list ${model}::build $size]] < 0} {
+		break
+	    }
+	    foreach phase $run {
+		if {[runPhase $model $phase ${model}::$phase] < 0} {
+		    break
+		}
+	    }
+	}
+    }
+    wipe
+}
+
+# ##############################################################
+# Write the results
+# ##############################################################
+
+set fileId [open $outFile w]
+puts $fileId "# OpenSees benchmark results"
+puts $fileId "# version [version]"
+puts $fileId "# date [clock format [clock seconds] -format {%Y-%m-%d %H:%M:%S}]"
+puts $fileId "# host [info hostname] $tcl_platform(os) $tcl_platform(osVersion) $tcl_platform(machine)"
+puts $fileId "# size $size repeat $repeat numThreads $numThreads"
+puts $fileId "# model phase seconds count unit rate check"
+foreach key $results {
+    if {[info exists failed($key)] || ![info exists seconds($key)]} {
+	puts $fileId "$key FAILED"
+	continue
+    }
+    set t $seconds($key)
+    set rate [expr {$t > 0.0 ? $count($key)/$t : 0.0}]
+    puts $fileId [format "%s %.6f %s %s %.6g %.10g" $key $t $count($key) \
+		      $unit($key) $rate $check($key)]
+}
+close $fileId
+
+puts "benchmark: results written to $outFile"
+
+# ##############################################################
+# Compare against the baseline
+# ##############################################################
+
+set numFailed 0
+foreach key $results {
+    if {[info exists failed($key)]} {
+	incr numFailed
+    }
+}
+
+if {$baselineFile != ""} {
+    set fileId [open $baselineFile r]
+    set baseSize ""
+    while {[gets $fileId line] >= 0} {
+	if {[string index $line 0] == "#"} {
+	    if {[lindex $line 1] == "size"} {
+		set baseSize [lindex $line 2]
+	    }
+	    continue
+	}
+	if {[llength $line] < 7} continue
+	set key "[lindex $line 0] [lindex $line 1]"
+	set baseSeconds($key) [lindex $line 2]
+	set baseCheck($key) [lindex $line 6]
+    }
+    close $fileId
+
+    if {$baseSize != $size} {
+	puts stderr "benchmark.tcl - baseline $baselineFile was run with -size $baseSize"
+	exit 2
+    }
+
+    puts [format "%-10s %-10s %12s %12s %8s  %s" model phase baseline current ratio status]
+    foreach key $results {
+	if {[info exists failed($key)]} continue
+	set model [lindex $key 0]
+	set phase [lindex $key 1]
+	if {![info exists baseSeconds($key)]} {
+	    puts [format "%-10s %-10s %12s %12.4f %8s  %s" $model $phase - \
+		      $seconds($key) - new]
+	    continue
+	}
+
+	set ratio [expr {$baseSeconds($key) > 0.0 ? $seconds($key)/$baseSeconds($key) : 1.0}]
+	set status ok
+	if {$seconds($key) < $minTime && $baseSeconds($key) < $minTime} {
+	    set status short
+	} elseif {$ratio > 1.0 + $tolerance} {
+	    set status SLOWER
+	    incr numFailed
+	} elseif {$ratio < 1.0/(1.0 + $tolerance)} {
+	    set status faster
+	}
+
+	set c0 $baseCheck($key)
+	set c1 $check($key)
+	if {abs($c1-$c0) > $checkTolerance*(abs($c0) > 1.0e-12 ? abs($c0) : 1.0)} {
+	    set status "$status, check $c1 != $c0"
+	    incr numFailed
+	}
+
+	puts [format "%-10s %-10s %12.4f %12.4f %8.3f  %s" $model $phase \
+		  $baseSeconds($key) $seconds($key) $ratio $status]
+    }
+}
+
+if {$numFailed > 0} {
+    puts stderr "benchmark: $numFailed phase(s) failed, slower than the baseline or with changed results"
+    exit 1
+}
+
+exit 0
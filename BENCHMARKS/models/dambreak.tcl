@@ -0,0 +1,114 @@
+# OpenSees -- Open System for Earthquake Engineering Simulation
+# Pacific Earthquake Engineering Research Center
+# http://opensees.berkeley.edu/
+#
+# Benchmark: PFEM dam break
+# -------------------------
+#
+# The collapse of a water column a wide and 2a high in a tank 4a wide
+# (Martin and Moyce). The tank walls are a line mesh and the water a
+# triangle mesh of size h; the water is remeshed every step into
+# PFEMElement2DBubble elements with the alpha shape method.
+#
+#   transient - numSteps PFEM steps, remesh and analysis, of dtmax
+#
+# Units: N, m, s, kg
+#
+# Written: agent
+# Date: October 2026
+
+namespace eval dambreak {
+
+    # mesh size, number of steps
+    variable sizes
+    array set sizes {
+	small  {0.01 100}
+	medium {0.005 200}
+	large  {0.0025 300}
+    }
+
+    variable runs {{transient}}
+
+    variable a 0.146
+    variable rho 1000.0
+    variable mu 1.0e-3
+    variable g 9.81
+    variable alpha 1.2
+    variable dtmax 1.0e-3
+    variable dtmin 1.0e-6
+
+    variable h
+    variable numSteps
+
+    proc build {size} {
+	variable sizes
+	variable a
+	variable h
+	variable numSteps
+
+	foreach {h numSteps} $sizes($size) {}
+
+	model basic -ndm 2 -ndf 2
+
+	set L [expr {4.0*$a}]
+	set H [expr {3.0*$a}]
+
+	# tank walls: region 1
+	node 1 0.0 $H
+	node 2 0.0 0.0
+	node 3 $L 0.0
+	node 4 $L $H
+	mesh line 1 2 $h 4 1 2 3 4 1 1 1 1
+
+	# water column: region 2, the sides on the walls are not meshed
+	node 5 $a 0.0
+	node 6 $a [expr {2.0*$a}]
+	node 7 0.0 [expr {2.0*$a}]
+	mesh tri 2 2 $h 4 2 5 6 7 0 1 1 0
+
+	fixX 0.0 1 1
+	fixX $L 1 1
+	fixY 0.0 1 1
+
+	set numNodes [llength [getNodeTags]]
+
+	return [list $numNodes nodes $numNodes]
+    }
+
+    proc remesh {} {
+	variable alpha
+	variable rho
+	variable mu
+	variable g
+
+	::remesh tri $alpha 1 2 1 1 PFEMElement2DBubble $rho $mu 0.0 [expr {-$g}]
+    }
+
+    proc transient {} {
+	variable g
+	variable dtmax
+	variable dtmin
+	variable numSteps
+
+	remesh
+	analysis PFEM $dtmax $dtmin $g
+
+	for {set step 0} {$step < $numSteps} {incr step} {
+	    if {[analyze] < 0} {
+		error "PFEM analysis failed at step $step"
+	    }
+	    remesh
+	}
+
+	# position of the water front, the walls do not move
+	set front 0.0
+	foreach tag [getNodeTags] {
+	    set u [nodeDisp $tag 1]
+	    if {$u == 0.0} continue
+	    set x [expr {[nodeCoord $tag 1] + $u}]
+	    if {$x > $front} {set front $x}
+	}
+
+	return [list $numSteps steps $front]
+    }
+}
@@ -0,0 +1,251 @@
+# OpenSees -- Open System for Earthquake Engineering Simulation
+# Pacific Earthquake Engineering Research Center
+# http://opensees.berkeley.edu/
+#
+# Benchmark: 3d reinforced concrete moment frame
+# ----------------------------------------------
+#
+# A regular space frame of numBayX x numBayY bays and numStory stories,
+# all beams and columns forceBeamColumn (ForceBeamColumn3d) elements with
+# 5 Lobatto points of Concrete01/Steel01 fiber sections. Gravity loads and
+# floor masses are lumped at the beam-column joints.
+#
+#   gravity  - 10 load controlled steps of the floor loads
+#   eigen    - the first 3 modes
+#   pushover - displacement control of a roof node to 2% drift
+#   transient - Newmark analysis of the synthetic ground motion in X
+#
+# Units: kN, m, s
+#
+# Written: agent
+# Date: October 2026
+
+namespace eval frame {
+
+    # numBayX numBayY numStory pushover steps, motion duration
+    variable sizes
+    array set sizes {
+	small  {2 2 3 50 5.0}
+	medium {3 3 6 100 10.0}
+	large  {6 6 12 200 10.0}
+    }
+
+    variable runs {{gravity eigen pushover} {gravity transient}}
+
+    variable bay 6.0
+    variable story 3.5
+    variable floorLoad 8.0
+    variable g 9.81
+
+    variable numBayX
+    variable numBayY
+    variable numStory
+    variable numPushover
+    variable duration
+    variable roof
+
+    proc nodeTag {i j k} {
+	return [expr {$k*10000 + $j*100 + $i + 1}]
+    }
+
+    proc build {size} {
+	variable sizes
+	variable bay
+	variable story
+	variable floorLoad
+	variable g
+	variable numBayX
+	variable numBayY
+	variable numStory
+	variable numPushover
+	variable duration
+	variable roof
+
+	foreach {numBayX numBayY numStory numPushover duration} $sizes($size) {}
+
+	model basic -ndm 3 -ndf 6
+
+	# joints, floor weight shared equally by the joints of a floor
+	set numFloorNodes [expr {($numBayX+1)*($numBayY+1)}]
+	set P [expr {$floorLoad*$numBayX*$bay*$numBayY*$bay/$numFloorNodes}]
+	set m [expr {$P/$g}]
+	for {set k 0} {$k <= $numStory} {incr k} {
+	    for {set j 0} {$j <= $numBayY} {incr j} {
+		for {set i 0} {$i <= $numBayX} {incr i} {
+		    set tag [nodeTag $i $j $k]
+		    node $tag [expr {$i*$bay}] [expr {$j*$bay}] [expr {$k*$story}]
+		    if {$k == 0} {
+			fix $tag 1 1 1 1 1 1
+		    } else {
+			mass $tag $m $m 0.0 0.0 0.0 0.0
+		    }
+		}
+	    }
+	}
+	set roof [nodeTag $numBayX $numBayY $numStory]
+
+	# materials: concrete, steel
+	uniaxialMaterial Concrete01 1 -30000.0 -0.002 -6000.0 -0.006
+	uniaxialMaterial Steel01 2 420000.0 2.0e8 0.01
+
+	# column section 0.5 x 0.5, 4 + 4 bars
+	set As 4.9e-4
+	section Fiber 1 -GJ 1.0e5
+	patch rect 1 10 10 -0.25 -0.25 0.25 0.25
+	layer straight 2 4 $As -0.21 -0.21 -0.21 0.21
+	layer straight 2 4 $As 0.21 -0.21 0.21 0.21
+
+	# beam section 0.6 deep x 0.4 wide, 3 + 3 bars
+	section Fiber 2 -GJ 1.0e5
+	patch rect 1 12 4 -0.30 -0.20 0.30 0.20
+	layer straight 2 3 $As -0.25 -0.15 -0.25 0.15
+	layer straight 2 3 $As 0.25 -0.15 0.25 0.15
+
+	beamIntegration Lobatto 1 1 5
+	beamIntegration Lobatto 2 2 5
+
+	# columns, beams in X, beams in Y
+	geomTransf PDelta 1 1.0 0.0 0.0
+	geomTransf Linear 2 0.0 0.0 1.0
+	geomTransf Linear 3 0.0 0.0 1.0
+
+	set eleTag 0
+	for {set k 1} {$k <= $numStory} {incr k} {
+	    for {set j 0} {$j <= $numBayY} {incr j} {
+		for {set i 0} {$i <= $numBayX} {incr i} {
+		    element forceBeamColumn [incr eleTag] [nodeTag $i $j [expr {$k-1}]] \
+			[nodeTag $i $j $k] 1 1
+		    if {$i < $numBayX} {
+			element forceBeamColumn [incr eleTag] [nodeTag $i $j $k] \
+			    [nodeTag [expr {$i+1}] $j $k] 2 2
+		    }
+		    if {$j < $numBayY} {
+			element forceBeamColumn [incr eleTag] [nodeTag $i $j $k] \
+			    [nodeTag $i [expr {$j+1}] $k] 3 2
+		    }
+		}
+	    }
+	}
+
+	return [list $eleTag elements [llength [getNodeTags]]]
+    }
+
+    proc gravity {} {
+	variable bay
+	variable floorLoad
+	variable numBayX
+	variable numBayY
+	variable numStory
+	variable roof
+
+	set numFloorNodes [expr {($numBayX+1)*($numBayY+1)}]
+	set P [expr {$floorLoad*$numBayX*$bay*$numBayY*$bay/$numFloorNodes}]
+
+	timeSeries Linear 1
+	pattern Plain 1 1
+	for {set k 1} {$k <= $numStory} {incr k} {
+	    for {set j 0} {$j <= $numBayY} {incr j} {
+		for {set i 0} {$i <= $numBayX} {incr i} {
+		    load [nodeTag $i $j $k] 0.0 0.0 [expr {-$P}] 0.0 0.0 0.0
+		}
+	    }
+	}
+
+	constraints Plain
+	numberer RCM
+	system Umfpack
+	test NormDispIncr 1.0e-8 10
+	algorithm Newton
+	integrator LoadControl 0.1
+	analysis Static
+	if {[analyze 10] < 0} {
+	    error "gravity analysis failed"
+	}
+	loadConst -time 0.0
+
+	return [list 10 steps [nodeDisp $roof 3]]
+    }
+
+    proc eigen {} {
+	set lambda [::eigen 3]
+	set T1 [expr {2.0*acos(-1.0)/sqrt([lindex $lambda 0])}]
+
+	return [list 3 modes $T1]
+    }
+
+    proc pushover {} {
+	variable story
+	variable numBayX
+	variable numBayY
+	variable numStory
+	variable numPushover
+	variable roof
+
+	# lateral loads in X proportional to the floor height
+	timeSeries Linear 2
+	pattern Plain 2 2
+	for {set k 1} {$k <= $numStory} {incr k} {
+	    for {set j 0} {$j <= $numBayY} {incr j} {
+		for {set i 0} {$i <= $numBayX} {incr i} {
+		    load [nodeTag $i $j $k] [expr {double($k)/$numStory}] 0.0 0.0 0.0 0.0 0.0
+		}
+	    }
+	}
+
+	set du [expr {0.02*$numStory*$story/$numPushover}]
+	test NormDispIncr 1.0e-6 50
+	integrator DisplacementControl $roof 1 $du
+	for {set step 0} {$step < $numPushover} {incr step} {
+	    if {[analyze 1] < 0} {
+		algorithm KrylovNewton
+		set ok [analyze 1]
+		algorithm Newton
+		if {$ok < 0} {
+		    error "pushover failed at step $step"
+		}
+	    }
+	}
+
+	return [list $numPushover steps [getLoadFactor 2]]
+    }
+
+    proc transient {} {
+	variable duration
+	variable roof
+
+	set dt 0.01
+	set numSteps [::groundMotion 3 $dt $duration 3.0]
+	pattern UniformExcitation 3 1 -accel 3
+
+	# 5% damping at 1.0 and 0.2 s
+	set pi [expr {acos(-1.0)}]
+	set w1 [expr {2.0*$pi/1.0}]
+	set w2 [expr {2.0*$pi/0.2}]
+	rayleigh [expr {2.0*0.05*$w1*$w2/($w1+$w2)}] 0.0 0.0 [expr {2.0*0.05/($w1+$w2)}]
+
+	wipeAnalysis
+	constraints Plain
+	numberer RCM
+	system Umfpack
+	test NormDispIncr 1.0e-6 20
+	algorithm Newton
+	integrator Newmark 0.5 0.25
+	analysis Transient
+
+	set maxDisp 0.0
+	for {set step 0} {$step < $numSteps} {incr step} {
+	    if {[analyze 1 $dt] < 0} {
+		algorithm KrylovNewton
+		set ok [analyze 1 $dt]
+		algorithm Newton
+		if {$ok < 0} {
+		    error "transient analysis failed at step $step"
+		}
+	    }
+	    set u [expr {abs([nodeDisp $roof 1])}]
+	    if {$u > $maxDisp} {set maxDisp $u}
+	}
+
+	return [list $numSteps steps $maxDisp]
+    }
+}
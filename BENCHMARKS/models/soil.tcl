@@ -0,0 +1,192 @@
+# OpenSees -- Open System for Earthquake Engineering Simulation
+# Pacific Earthquake Engineering Research Center
+# http://opensees.berkeley.edu/
+#
+# Benchmark: 3d soil column
+# -------------------------
+#
+# A block of numX x numY x numZ one meter SSPbrick elements of medium
+# dense sand (PressureDependMultiYield), fixed at the base. The nodes of
+# each horizontal layer are tied in X and Y (equalDOF) so the block
+# deforms as a shear column. The model is built with the bulk nodes and
+# elements commands.
+#
+#   gravity   - self weight with the material elastic, then plastic
+#   eigen     - the first 3 modes
+#   transient - Newmark analysis of the synthetic ground motion in X
+#
+# Units: kN, m, s, t
+#
+# Written: agent
+# Date: October 2026
+
+namespace eval soil {
+
+    # numX numY numZ, motion duration
+    variable sizes
+    array set sizes {
+	small  {4 4 10 5.0}
+	medium {8 8 20 10.0}
+	large  {12 12 40 10.0}
+    }
+
+    variable runs {{gravity eigen} {gravity transient}}
+
+    variable rho 1.9
+    variable g 9.81
+
+    variable numX
+    variable numY
+    variable numZ
+    variable duration
+    variable top
+
+    proc nodeTag {i j k} {
+	variable numX
+	variable numY
+	return [expr {($k*($numY+1) + $j)*($numX+1) + $i + 1}]
+    }
+
+    proc build {size} {
+	variable sizes
+	variable rho
+	variable g
+	variable numX
+	variable numY
+	variable numZ
+	variable duration
+	variable top
+
+	foreach {numX numY numZ duration} $sizes($size) {}
+
+	model basic -ndm 3 -ndf 3
+
+	# nodes
+	set tags {}
+	set crds {}
+	for {set k 0} {$k <= $numZ} {incr k} {
+	    for {set j 0} {$j <= $numY} {incr j} {
+		for {set i 0} {$i <= $numX} {incr i} {
+		    lappend tags [nodeTag $i $j $k]
+		    lappend crds [expr {double($i)}] [expr {double($j)}] [expr {double($k)}]
+		}
+	    }
+	}
+	nodes [llength $tags] {*}$tags {*}$crds
+	set top [nodeTag 0 0 $numZ]
+
+	# base fixed, layers tied to their first node
+	for {set j 0} {$j <= $numY} {incr j} {
+	    for {set i 0} {$i <= $numX} {incr i} {
+		fix [nodeTag $i $j 0] 1 1 1
+	    }
+	}
+	for {set k 1} {$k <= $numZ} {incr k} {
+	    set master [nodeTag 0 0 $k]
+	    for {set j 0} {$j <= $numY} {incr j} {
+		for {set i 0} {$i <= $numX} {incr i} {
+		    if {$i != 0 || $j != 0} {
+			equalDOF $master [nodeTag $i $j $k] 1 2
+		    }
+		}
+	    }
+	}
+
+	# medium dense sand
+	nDMaterial PressureDependMultiYield 1 3 $rho 7.5e4 2.0e5 33.0 0.1 80.0 0.5 \
+	    26.5 0.07 0.4 2.0 10.0 0.015 1.0
+
+	# bricks
+	set eleTags {}
+	set eleNodes {}
+	set eleTag 0
+	for {set k 0} {$k < $numZ} {incr k} {
+	    set k1 [expr {$k+1}]
+	    for {set j 0} {$j < $numY} {incr j} {
+		set j1 [expr {$j+1}]
+		for {set i 0} {$i < $numX} {incr i} {
+		    set i1 [expr {$i+1}]
+		    lappend eleTags [incr eleTag]
+		    lappend eleNodes [nodeTag $i $j $k] [nodeTag $i1 $j $k] \
+			[nodeTag $i1 $j1 $k] [nodeTag $i $j1 $k] \
+			[nodeTag $i $j $k1] [nodeTag $i1 $j $k1] \
+			[nodeTag $i1 $j1 $k1] [nodeTag $i $j1 $k1]
+		}
+	    }
+	}
+	elements SSPbrick $eleTag 8 {*}$eleTags {*}$eleNodes 1 0.0 0.0 [expr {-$g*$rho}]
+
+	return [list $eleTag elements [llength $tags]]
+    }
+
+    proc gravity {} {
+	variable top
+
+	constraints Transformation
+	numberer RCM
+	system Umfpack
+	test NormDispIncr 1.0e-6 30
+	algorithm Newton
+	integrator LoadControl 1.0
+	analysis Static
+
+	# elastic, then elastoplastic
+	if {[analyze 2] < 0} {
+	    error "elastic gravity analysis failed"
+	}
+	updateMaterialStage -material 1 -stage 1
+	if {[analyze 4] < 0} {
+	    error "plastic gravity analysis failed"
+	}
+	setTime 0.0
+
+	return [list 6 steps [nodeDisp $top 3]]
+    }
+
+    proc eigen {} {
+	set lambda [::eigen 3]
+	set T1 [expr {2.0*acos(-1.0)/sqrt([lindex $lambda 0])}]
+
+	return [list 3 modes $T1]
+    }
+
+    proc transient {} {
+	variable duration
+	variable top
+
+	set dt 0.01
+	set numSteps [::groundMotion 1 $dt $duration 2.0]
+	pattern UniformExcitation 1 1 -accel 1
+
+	# 2% damping at 1.0 and 0.1 s
+	set pi [expr {acos(-1.0)}]
+	set w1 [expr {2.0*$pi/1.0}]
+	set w2 [expr {2.0*$pi/0.1}]
+	rayleigh [expr {2.0*0.02*$w1*$w2/($w1+$w2)}] [expr {2.0*0.02/($w1+$w2)}] 0.0 0.0
+
+	wipeAnalysis
+	constraints Transformation
+	numberer RCM
+	system Umfpack
+	test NormDispIncr 1.0e-5 30
+	algorithm Newton
+	integrator Newmark 0.5 0.25
+	analysis Transient
+
+	set maxDisp 0.0
+	for {set step 0} {$step < $numSteps} {incr step} {
+	    if {[analyze 1 $dt] < 0} {
+		algorithm ModifiedNewton -initial
+		set ok [analyze 1 $dt]
+		algorithm Newton
+		if {$ok < 0} {
+		    error "transient analysis failed at step $step"
+		}
+	    }
+	    set u [expr {abs([nodeDisp $top 1])}]
+	    if {$u > $maxDisp} {set maxDisp $u}
+	}
+
+	return [list $numSteps steps $maxDisp]
+    }
+}
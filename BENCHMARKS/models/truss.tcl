@@ -0,0 +1,220 @@
+# OpenSees -- Open System for Earthquake Engineering Simulation
+# Pacific Earthquake Engineering Research Center
+# http://opensees.berkeley.edu/
+#
+# Benchmark: large elastic space truss
+# ------------------------------------
+#
+# A cantilever lattice of numX x numY x numZ one meter cubic cells, bars
+# along all the cell edges and a diagonal in every cell face, fixed at
+# X = 0. All bars are elastic Truss elements with a distributed mass. The
+# model is built with the bulk nodes and elements commands.
+#
+#   eigen     - the first 6 modes
+#   static    - 10 linear steps of a vertical load on the free end
+#   transient - Newmark analysis of a half sine pulse on the free end
+#   explicit  - the same pulse with the explicit (central difference)
+#               analysis, substepped to its stable time step
+#
+# Units: kN, m, s, t
+#
+# Written: agent
+# Date: October 2026
+
+namespace eval truss {
+
+    # numX numY numZ
+    variable sizes
+    array set sizes {
+	small  {10 4 4}
+	medium {40 8 8}
+	large  {100 10 10}
+    }
+
+    variable runs {{eigen static} {transient} {explicit}}
+
+    variable E 2.0e8
+    variable A 0.01
+    variable rho 0.0785
+    variable tipLoad 100.0
+
+    variable numX
+    variable numY
+    variable numZ
+    variable tip
+
+    proc nodeTag {i j k} {
+	variable numY
+	variable numZ
+	return [expr {($i*($numY+1) + $j)*($numZ+1) + $k + 1}]
+    }
+
+    proc build {size} {
+	variable sizes
+	variable E
+	variable A
+	variable rho
+	variable numX
+	variable numY
+	variable numZ
+	variable tip
+
+	foreach {numX numY numZ} $sizes($size) {}
+
+	model basic -ndm 3 -ndf 3
+
+	# nodes
+	set tags {}
+	set crds {}
+	for {set i 0} {$i <= $numX} {incr i} {
+	    for {set j 0} {$j <= $numY} {incr j} {
+		for {set k 0} {$k <= $numZ} {incr k} {
+		    lappend tags [nodeTag $i $j $k]
+		    lappend crds [expr {double($i)}] [expr {double($j)}] [expr {double($k)}]
+		}
+	    }
+	}
+	nodes [llength $tags] {*}$tags {*}$crds
+	set tip [nodeTag $numX 0 0]
+
+	for {set j 0} {$j <= $numY} {incr j} {
+	    for {set k 0} {$k <= $numZ} {incr k} {
+		fix [nodeTag 0 $j $k] 1 1 1
+	    }
+	}
+
+	uniaxialMaterial Elastic 1 $E
+
+	# from every node the bars in +X, +Y, +Z and the diagonals of the
+	# faces in the XY, YZ and XZ planes
+	set eleTags {}
+	set eleNodes {}
+	set eleTag 0
+	for {set i 0} {$i <= $numX} {incr i} {
+	    set i1 [expr {$i+1}]
+	    for {set j 0} {$j <= $numY} {incr j} {
+		set j1 [expr {$j+1}]
+		for {set k 0} {$k <= $numZ} {incr k} {
+		    set k1 [expr {$k+1}]
+		    set nd [nodeTag $i $j $k]
+		    if {$i < $numX} {
+			lappend eleTags [incr eleTag]
+			lappend eleNodes $nd [nodeTag $i1 $j $k]
+		    }
+		    if {$j < $numY} {
+			lappend eleTags [incr eleTag]
+			lappend eleNodes $nd [nodeTag $i $j1 $k]
+		    }
+		    if {$k < $numZ} {
+			lappend eleTags [incr eleTag]
+			lappend eleNodes $nd [nodeTag $i $j $k1]
+		    }
+		    if {$i < $numX && $j < $numY} {
+			lappend eleTags [incr eleTag]
+			lappend eleNodes $nd [nodeTag $i1 $j1 $k]
+		    }
+		    if {$j < $numY && $k < $numZ} {
+			lappend eleTags [incr eleTag]
+			lappend eleNodes $nd [nodeTag $i $j1 $k1]
+		    }
+		    if {$i < $numX && $k < $numZ} {
+			lappend eleTags [incr eleTag]
+			lappend eleNodes $nd [nodeTag $i1 $j $k1]
+		    }
+		}
+	    }
+	}
+	elements Truss $eleTag 2 {*}$eleTags {*}$eleNodes $A 1 -rho $rho
+
+	return [list $eleTag elements [llength $tags]]
+    }
+
+    # the vertical load on the nodes of the free end
+    proc endLoad {patternTag tsTag} {
+	variable numX
+	variable numY
+	variable numZ
+	variable tipLoad
+
+	set P [expr {-$tipLoad/(($numY+1)*($numZ+1))}]
+	pattern Plain $patternTag $tsTag
+	for {set j 0} {$j <= $numY} {incr j} {
+	    for {set k 0} {$k <= $numZ} {incr k} {
+		load [nodeTag $numX $j $k] 0.0 0.0 $P
+	    }
+	}
+    }
+
+    proc eigen {} {
+	set lambda [::eigen 6]
+	set T1 [expr {2.0*acos(-1.0)/sqrt([lindex $lambda 0])}]
+
+	return [list 6 modes $T1]
+    }
+
+    proc static {} {
+	variable tip
+
+	timeSeries Linear 1
+	endLoad 1 1
+
+	constraints Plain
+	numberer RCM
+	system Umfpack
+	test NormUnbalance 1.0e-6 10
+	algorithm Linear
+	integrator LoadControl 0.1
+	analysis Static
+	if {[analyze 10] < 0} {
+	    error "static analysis failed"
+	}
+
+	return [list 10 steps [nodeDisp $tip 3]]
+    }
+
+    # half sine pulse of 0.1 s, followed for 0.5 s
+    proc pulse {} {
+	timeSeries Trig 1 0.0 0.1 0.2
+	endLoad 1 1
+
+	return [list 0.002 250]
+    }
+
+    proc transient {} {
+	variable tip
+
+	foreach {dt numSteps} [pulse] {}
+
+	constraints Plain
+	numberer RCM
+	system Umfpack
+	test NormUnbalance 1.0e-6 10
+	algorithm Linear
+	integrator Newmark 0.5 0.25
+	analysis Transient
+
+	set maxDisp 0.0
+	for {set step 0} {$step < $numSteps} {incr step} {
+	    if {[analyze 1 $dt] < 0} {
+		error "transient analysis failed at step $step"
+	    }
+	    set u [expr {abs([nodeDisp $tip 3])}]
+	    if {$u > $maxDisp} {set maxDisp $u}
+	}
+
+	return [list $numSteps steps $maxDisp]
+    }
+
+    proc explicit {} {
+	variable tip
+
+	foreach {dt numSteps} [pulse] {}
+
+	analysis Explicit
+	if {[analyze $numSteps $dt] < 0} {
+	    error "explicit analysis failed"
+	}
+
+	return [list $numSteps steps [nodeDisp $tip 3]]
+    }
+}
@@ -0,0 +1,218 @@
+# OpenSees -- Open System for Earthquake Engineering Simulation
+# Pacific Earthquake Engineering Research Center
+# http://opensees.berkeley.edu/
+#
+# Benchmark: steel plate shear wall
+# ---------------------------------
+#
+# A cantilever wall in the XZ plane, 6 m long and 3.5 m per story, meshed
+# with numX x numZ ShellMITC4 elements of a layered shell section of 5
+# J2PlateFibre layers. The floors brace the wall out of plane; the story
+# weights are carried and the story masses lumped at the floor lines.
+#
+#   gravity   - 10 load controlled steps of the floor loads
+#   eigen     - the first 3 modes
+#   pushover  - displacement control of the top corner to 1% drift
+#   transient - Newmark analysis of the synthetic ground motion in X
+#
+# Units: kN, m, s, t
+#
+# Written: agent
+# Date: October 2026
+
+namespace eval wall {
+
+    # numStory, elements along the length and per story, pushover steps,
+    # motion duration
+    variable sizes
+    array set sizes {
+	small  {3 8 4 50 5.0}
+	medium {6 16 6 100 10.0}
+	large  {12 32 8 200 10.0}
+    }
+
+    variable runs {{gravity eigen pushover} {gravity transient}}
+
+    variable length 6.0
+    variable story 3.5
+    variable floorWeight 300.0
+    variable g 9.81
+
+    variable numStory
+    variable numX
+    variable numZ
+    variable numPerStory
+    variable numPushover
+    variable duration
+    variable top
+
+    proc nodeTag {i k} {
+	variable numX
+	return [expr {$k*($numX+1) + $i + 1}]
+    }
+
+    proc build {size} {
+	variable sizes
+	variable length
+	variable story
+	variable floorWeight
+	variable g
+	variable numStory
+	variable numX
+	variable numZ
+	variable numPerStory
+	variable numPushover
+	variable duration
+	variable top
+
+	foreach {numStory numX numPerStory numPushover duration} $sizes($size) {}
+	set numZ [expr {$numStory*$numPerStory}]
+
+	model basic -ndm 3 -ndf 6
+
+	set dx [expr {$length/$numX}]
+	set dz [expr {$story/$numPerStory}]
+	set m [expr {$floorWeight/$g/($numX+1)}]
+	for {set k 0} {$k <= $numZ} {incr k} {
+	    for {set i 0} {$i <= $numX} {incr i} {
+		set tag [nodeTag $i $k]
+		node $tag [expr {$i*$dx}] 0.0 [expr {$k*$dz}]
+		if {$k == 0} {
+		    fix $tag 1 1 1 1 1 1
+		} elseif {$k % $numPerStory == 0} {
+		    fix $tag 0 1 0 0 0 0
+		    mass $tag $m 0.0 $m 0.0 0.0 0.0
+		}
+	    }
+	}
+	set top [nodeTag $numX $numZ]
+
+	# 10 mm plate of 5 layers
+	nDMaterial J2PlateFibre 1 2.0e8 0.3 2.5e5 1.0e6 0.0 7.85
+	section LayeredShell 1 5 1 0.002 1 0.002 1 0.002 1 0.002 1 0.002
+
+	set eleTag 0
+	for {set k 0} {$k < $numZ} {incr k} {
+	    for {set i 0} {$i < $numX} {incr i} {
+		element ShellMITC4 [incr eleTag] [nodeTag $i $k] [nodeTag [expr {$i+1}] $k] \
+		    [nodeTag [expr {$i+1}] [expr {$k+1}]] [nodeTag $i [expr {$k+1}]] 1
+	    }
+	}
+
+	return [list $eleTag elements [llength [getNodeTags]]]
+    }
+
+    proc gravity {} {
+	variable floorWeight
+	variable numX
+	variable numZ
+	variable numPerStory
+	variable top
+
+	set P [expr {$floorWeight/($numX+1)}]
+
+	timeSeries Linear 1
+	pattern Plain 1 1
+	for {set k $numPerStory} {$k <= $numZ} {incr k $numPerStory} {
+	    for {set i 0} {$i <= $numX} {incr i} {
+		load [nodeTag $i $k] 0.0 0.0 [expr {-$P}] 0.0 0.0 0.0
+	    }
+	}
+
+	constraints Plain
+	numberer RCM
+	system Umfpack
+	test NormDispIncr 1.0e-8 10
+	algorithm Newton
+	integrator LoadControl 0.1
+	analysis Static
+	if {[analyze 10] < 0} {
+	    error "gravity analysis failed"
+	}
+	loadConst -time 0.0
+
+	return [list 10 steps [nodeDisp $top 3]]
+    }
+
+    proc eigen {} {
+	set lambda [::eigen 3]
+	set T1 [expr {2.0*acos(-1.0)/sqrt([lindex $lambda 0])}]
+
+	return [list 3 modes $T1]
+    }
+
+    proc pushover {} {
+	variable story
+	variable numStory
+	variable numX
+	variable numZ
+	variable numPerStory
+	variable numPushover
+	variable top
+
+	# lateral loads in X proportional to the floor height
+	timeSeries Linear 2
+	pattern Plain 2 2
+	for {set k $numPerStory} {$k <= $numZ} {incr k $numPerStory} {
+	    for {set i 0} {$i <= $numX} {incr i} {
+		load [nodeTag $i $k] [expr {double($k)/$numZ}] 0.0 0.0 0.0 0.0 0.0
+	    }
+	}
+
+	set du [expr {0.01*$numStory*$story/$numPushover}]
+	test NormDispIncr 1.0e-6 50
+	integrator DisplacementControl $top 1 $du
+	for {set step 0} {$step < $numPushover} {incr step} {
+	    if {[analyze 1] < 0} {
+		algorithm KrylovNewton
+		set ok [analyze 1]
+		algorithm Newton
+		if {$ok < 0} {
+		    error "pushover failed at step $step"
+		}
+	    }
+	}
+
+	return [list $numPushover steps [getLoadFactor 2]]
+    }
+
+    proc transient {} {
+	variable duration
+	variable top
+
+	set dt 0.01
+	set numSteps [::groundMotion 3 $dt $duration 3.0]
+	pattern UniformExcitation 3 1 -accel 3
+
+	# 5% damping at 1.0 and 0.1 s
+	set pi [expr {acos(-1.0)}]
+	set w1 [expr {2.0*$pi/1.0}]
+	set w2 [expr {2.0*$pi/0.1}]
+	rayleigh [expr {2.0*0.05*$w1*$w2/($w1+$w2)}] 0.0 0.0 [expr {2.0*0.05/($w1+$w2)}]
+
+	wipeAnalysis
+	constraints Plain
+	numberer RCM
+	system Umfpack
+	test NormDispIncr 1.0e-6 20
+	algorithm Newton
+	integrator Newmark 0.5 0.25
+	analysis Transient
+
+	set maxDisp 0.0
+	for {set step 0} {$step < $numSteps} {incr step} {
+	    if {[analyze 1 $dt] < 0} {
+		algorithm KrylovNewton
+		set ok [analyze 1 $dt]
+		algorithm Newton
+		if {$ok < 0} {
+		    error "transient analysis failed at step $step"
+		}
+	    }
+	    set u [expr {abs([nodeDisp $top 1])}]
+	    if {$u > $maxDisp} {set maxDisp $u}
+	}
+
+	return [list $numSteps steps $maxDisp]
+    }
+}
@@ -61,6 +61,13 @@ class Element;
 
 #define MAX_FILENAMELENGTH 50
 
+// storage class for the static work areas of classes whose objects may be
+// updated and formed by a number of threads at the same time (see
+// Domain::setNumThreads() and ThreadSubdomain); each thread then gets a 
+// copy of the work area. ThreadSubdomain creates threads whether or not
+// OpenMP is used, so the work areas are always thread local.
+#define OPS_THREAD_LOCAL thread_local
+
 extern double   ops_Dt;                // current delta T for current domain doing an update
 // extern double  *ops_Gravity;        // gravity factors for current domain undergoing an update
 extern Domain  *ops_TheActiveDomain;   // current domain undergoing an update
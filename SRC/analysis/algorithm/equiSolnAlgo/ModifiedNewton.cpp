@@ -47,6 +47,7 @@
 #include <FEM_ObjectBroker.h>
 #include <ConvergenceTest.h>
 #include <Timer.h>
+#include <Profiler.h>
 #include <elementAPI.h>
 
 void* OPS_ModifiedNewton()
@@ -157,7 +158,10 @@ ModifiedNewton::solveCurrentStep(void)
 	}	
 
 	this->record(numIterations++);
-	result = theTest->test();
+	{
+	    OPS_PROFILE("ConvergenceTest::test");
+	    result = theTest->test();
+	}
 
 	if(((theIncIntegratorr->activateSensitivity())==true) && (theIncIntegratorr->computeSensitivityAtEachIteration())==true)
 	{
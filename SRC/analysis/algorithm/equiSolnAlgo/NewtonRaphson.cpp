@@ -47,6 +47,7 @@
 #include <FEM_ObjectBroker.h>
 #include <ConvergenceTest.h>
 #include <ID.h>
+#include <Profiler.h>
 #include <elementAPI.h>
 #include <string>
 
@@ -177,7 +178,10 @@ NewtonRaphson::solveCurrentStep(void)
      
 
 
-      result = theTest->test();
+      {
+	OPS_PROFILE("ConvergenceTest::test");
+	result = theTest->test();
+      }
        numIterations++;
       this->record(numIterations);
 
@@ -55,6 +55,7 @@
 #include <Matrix.h>
 #include <ID.h>
 #include <Graph.h>
+#include <Profiler.h>
 // AddingSensitivity:BEGIN //////////////////////////////////
 #ifdef _RELIABILITY
 #include <SensitivityAlgorithm.h>
@@ -178,6 +179,8 @@ DirectIntegrationAnalysis::initialize(void)
 int 
 DirectIntegrationAnalysis::analyze(int numSteps, double dT)
 {
+  OPS_PROFILE("Analysis::analyze");
+
   int result = 0;
   Domain *the_Domain = this->getDomainPtr();
  // if (theEigenSOE != 0)
@@ -210,7 +213,10 @@ DirectIntegrationAnalysis::analyze(int numSteps, double dT)
       return -2;
     }
     
-    result = theAlgorithm->solveCurrentStep();
+    {
+      OPS_PROFILE("EquiSolnAlgo::solveCurrentStep");
+      result = theAlgorithm->solveCurrentStep();
+    }
     if (result < 0) {
       opserr << "DirectIntegrationAnalysis::analyze() - the Algorithm failed";
       opserr << " at time " << the_Domain->getCurrentTime() << endln;
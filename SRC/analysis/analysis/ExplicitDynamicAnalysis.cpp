@@ -0,0 +1,870 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the implementation of the
+// ExplicitDynamicAnalysis class.
+//
+// What: "@(#) ExplicitDynamicAnalysis.cpp, revA"
+
+#include <ExplicitDynamicAnalysis.h>
+#include <Domain.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <SP_Constraint.h>
+#include <SP_ConstraintIter.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <OPS_Globals.h>
+#include <Profiler.h>
+#include <math.h>
+#include <float.h>
+#include <map>
+
+#define MAX_NUM_LEVELS 16
+
+// the number of substeps between estimates of the stable time step
+#define EXPLICIT_DT_CHECK 100
+
+// order the items by decreasing level, numAbove[L] is then the number
+// of items of level L or finer
+static void
+orderByLevel(int num, const int *level, int numLevels, int *order, int *numAbove)
+{
+  for (int L=0; L<=numLevels+1; L++)
+    numAbove[L] = 0;
+  for (int i=0; i<num; i++)
+    numAbove[level[i]]++;
+  for (int L=numLevels-1; L>=0; L--)
+    numAbove[L] += numAbove[L+1];
+
+  int next[MAX_NUM_LEVELS+2];
+  for (int L=0; L<=numLevels; L++)
+    next[L] = numAbove[L+1];
+  for (int i=0; i<num; i++)
+    order[next[level[i]]++] = i;
+}
+
+ExplicitDynamicAnalysis::ExplicitDynamicAnalysis(Domain &the_Domain,
+						 int nThreads,
+						 double factor,
+						 double aM,
+						 int levels)
+  :TransientAnalysis(the_Domain),
+   domainStamp(0), numThreads(nThreads), dtFactor(factor), alphaM(aM),
+   maxLevels(levels), dtStable(0.0),
+   numNodes(0), theNodes(0), nodeStart(0), theViews(0),
+   numDOF(0), U(0), V(0), A(0), U0(0), Vh(0), M(0), 
+   Fext(0), Fint(0), FextOld(0), FintOld(0), Fext0(0), Fext1(0), fixed(0),
+   numEle(0), theEles(0), eleStart(0), eleDOF(0), eleForce(0),
+   numSPs(0), theSPs(0), spDOF(0), spValues(0),
+   numLevels(0), nodeDt(0), nodeLevel(0), touchLevel(0), eleLevel(0),
+   nodeOrder(0), touchOrder(0), eleOrder(0),
+   numNodesAbove(0), numTouchedAbove(0), numEleAbove(0),
+   initialKinetic(0.0)
+{
+  if (numThreads < 1)
+    numThreads = 1;
+  if (dtFactor <= 0.0 || dtFactor > 1.0)
+    dtFactor = 0.9;
+  if (maxLevels < 0)
+    maxLevels = 0;
+  if (maxLevels > MAX_NUM_LEVELS)
+    maxLevels = MAX_NUM_LEVELS;
+
+  for (int i=0; i<4; i++)
+    energy[i] = 0.0;
+}
+
+ExplicitDynamicAnalysis::~ExplicitDynamicAnalysis()
+{
+  this->clear();
+}
+
+void
+ExplicitDynamicAnalysis::clear(void)
+{
+  if (theViews != 0) {
+    for (int i=0; i<3*numNodes; i++)
+      delete theViews[i];
+    delete [] theViews;
+  }
+  if (theNodes != 0) delete [] theNodes;
+  if (nodeStart != 0) delete [] nodeStart;
+  if (U != 0) delete [] U;
+  if (V != 0) delete [] V;
+  if (A != 0) delete [] A;
+  if (U0 != 0) delete [] U0;
+  if (Vh != 0) delete [] Vh;
+  if (M != 0) delete [] M;
+  if (Fext != 0) delete [] Fext;
+  if (Fint != 0) delete [] Fint;
+  if (FextOld != 0) delete [] FextOld;
+  if (FintOld != 0) delete [] FintOld;
+  if (Fext0 != 0) delete [] Fext0;
+  if (Fext1 != 0) delete [] Fext1;
+  if (fixed != 0) delete [] fixed;
+  if (theEles != 0) delete [] theEles;
+  if (eleStart != 0) delete [] eleStart;
+  if (eleDOF != 0) delete [] eleDOF;
+  if (eleForce != 0) delete [] eleForce;
+  if (theSPs != 0) delete [] theSPs;
+  if (spDOF != 0) delete [] spDOF;
+  if (spValues != 0) delete [] spValues;
+  if (nodeDt != 0) delete [] nodeDt;
+  if (nodeLevel != 0) delete [] nodeLevel;
+  if (touchLevel != 0) delete [] touchLevel;
+  if (eleLevel != 0) delete [] eleLevel;
+  if (nodeOrder != 0) delete [] nodeOrder;
+  if (touchOrder != 0) delete [] touchOrder;
+  if (eleOrder != 0) delete [] eleOrder;
+  if (numNodesAbove != 0) delete [] numNodesAbove;
+  if (numTouchedAbove != 0) delete [] numTouchedAbove;
+  if (numEleAbove != 0) delete [] numEleAbove;
+
+  numNodes = 0; theNodes = 0; nodeStart = 0; theViews = 0;
+  numDOF = 0; U = 0; V = 0; A = 0; U0 = 0; Vh = 0; M = 0; 
+  Fext = 0; Fint = 0; FextOld = 0; FintOld = 0; Fext0 = 0; Fext1 = 0; fixed = 0;
+  numEle = 0; theEles = 0; eleStart = 0; eleDOF = 0; eleForce = 0;
+  numSPs = 0; theSPs = 0; spDOF = 0; spValues = 0;
+  numLevels = 0; nodeDt = 0; nodeLevel = 0; touchLevel = 0; eleLevel = 0;
+  nodeOrder = 0; touchOrder = 0; eleOrder = 0;
+  numNodesAbove = 0; numTouchedAbove = 0; numEleAbove = 0;
+}
+
+int
+ExplicitDynamicAnalysis::domainChanged(void)
+{
+  Domain *theDomain = this->getDomainPtr();
+
+  this->clear();
+
+  if (theDomain->getNumMPs() != 0) {
+    opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - MP_Constraints are not handled\n";
+    return -1;
+  }
+
+  //
+  // number the nodal dofs in the flat arrays & get the state of the nodes
+  //
+
+  numNodes = theDomain->getNumNodes();
+  theNodes = new Node *[numNodes+1];
+  nodeStart = new int[numNodes+1];
+  std::map<int,int> nodeIndex;
+
+  NodeIter &theNodeIter = theDomain->getNodes();
+  Node *theNode;
+  int i = 0;
+  numDOF = 0;
+  while ((theNode = theNodeIter()) != 0) {
+    theNodes[i] = theNode;
+    nodeStart[i] = numDOF;
+    nodeIndex[theNode->getTag()] = i;
+    numDOF += theNode->getNumberDOF();
+    i++;
+  }
+  nodeStart[numNodes] = numDOF;
+
+  U = new double[numDOF+1];
+  V = new double[numDOF+1];
+  A = new double[numDOF+1];
+  U0 = new double[numDOF+1];
+  Vh = new double[numDOF+1];
+  M = new double[numDOF+1];
+  Fext = new double[numDOF+1];
+  Fint = new double[numDOF+1];
+  FextOld = new double[numDOF+1];
+  FintOld = new double[numDOF+1];
+  Fext0 = new double[numDOF+1];
+  Fext1 = new double[numDOF+1];
+  fixed = new char[numDOF+1];
+  theViews = new Vector *[3*numNodes+1];
+
+  for (i=0; i<numNodes; i++) {
+    theNode = theNodes[i];
+    int start = nodeStart[i];
+    int ndf = nodeStart[i+1] - start;
+    theViews[3*i] = new Vector(&U[start], ndf);
+    theViews[3*i+1] = new Vector(&V[start], ndf);
+    theViews[3*i+2] = new Vector(&A[start], ndf);
+
+    const Vector &disp = theNode->getDisp();
+    const Vector &vel = theNode->getVel();
+    const Matrix &mass = theNode->getMass();
+    for (int j=0; j<ndf; j++) {
+      U[start+j] = disp(j);
+      V[start+j] = vel(j);
+      A[start+j] = 0.0;
+      U0[start+j] = disp(j);
+      Vh[start+j] = vel(j);
+      fixed[start+j] = 0;
+      double m = 0.0;
+      for (int k=0; k<ndf; k++)
+	m += mass(j,k);
+      M[start+j] = m;
+    }
+  }
+
+  //
+  // locate the element dofs in the flat arrays & lump their mass
+  //
+
+  numEle = theDomain->getNumElements();
+  theEles = new Element *[numEle+1];
+  eleStart = new int[numEle+1];
+
+  ElementIter &theEleIter = theDomain->getElements();
+  Element *theEle;
+  int numEleDOF = 0;
+  i = 0;
+  while ((theEle = theEleIter()) != 0) {
+    theEles[i] = theEle;
+    eleStart[i] = numEleDOF;
+    numEleDOF += theEle->getNumDOF();
+    i++;
+  }
+  eleStart[numEle] = numEleDOF;
+
+  eleDOF = new int[numEleDOF+1];
+  eleForce = new double[numEleDOF+1];
+
+  for (i=0; i<numEle; i++) {
+    theEle = theEles[i];
+    const ID &eleNodes = theEle->getExternalNodes();
+    int loc = eleStart[i];
+    for (int j=0; j<eleNodes.Size(); j++) {
+      std::map<int,int>::iterator theIndex = nodeIndex.find(eleNodes(j));
+      if (theIndex == nodeIndex.end()) {
+	opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - element " << theEle->getTag();
+	opserr << " node " << eleNodes(j) << " not in domain\n";
+	return -1;
+      }
+      int n = theIndex->second;
+      for (int k=nodeStart[n]; k<nodeStart[n+1]; k++)
+	eleDOF[loc++] = k;
+    }
+    if (loc != eleStart[i+1]) {
+      opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - element " << theEle->getTag();
+      opserr << " dofs do not match those of its nodes\n";
+      return -1;
+    }
+
+    const Matrix &mass = theEle->getMass();
+    int numDOFe = eleStart[i+1] - eleStart[i];
+    if (mass.noRows() == numDOFe) {
+      for (int j=0; j<numDOFe; j++) {
+	double m = 0.0;
+	for (int k=0; k<numDOFe; k++)
+	  m += mass(j,k);
+	M[eleDOF[eleStart[i]+j]] += m;
+      }
+    }
+  }
+
+  //
+  // the single point constraints
+  //
+
+  SP_ConstraintIter &theSPIter = theDomain->getDomainAndLoadPatternSPs();
+  SP_Constraint *theSP;
+  while ((theSP = theSPIter()) != 0)
+    numSPs++;
+
+  theSPs = new SP_Constraint *[numSPs+1];
+  spDOF = new int[numSPs+1];
+  spValues = new double[2*numSPs+1];
+
+  SP_ConstraintIter &theSPIter2 = theDomain->getDomainAndLoadPatternSPs();
+  i = 0;
+  while ((theSP = theSPIter2()) != 0) {
+    std::map<int,int>::iterator theIndex = nodeIndex.find(theSP->getNodeTag());
+    int dof = theSP->getDOF_Number();
+    if (theIndex == nodeIndex.end() || dof < 0 ||
+	dof >= nodeStart[theIndex->second+1] - nodeStart[theIndex->second]) {
+      opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - invalid node or dof in SP_Constraint ";
+      opserr << theSP->getTag() << "\n";
+      return -1;
+    }
+    theSPs[i] = theSP;
+    spDOF[i] = nodeStart[theIndex->second] + dof;
+    fixed[spDOF[i]] = 1;
+    i++;
+  }
+
+  // every free dof needs a mass
+  for (i=0; i<numNodes; i++) {
+    for (int j=nodeStart[i]; j<nodeStart[i+1]; j++) {
+      if (fixed[j] == 0 && M[j] <= 0.0) {
+	opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - no mass at node ";
+	opserr << theNodes[i]->getTag() << " dof " << j-nodeStart[i]+1 << "\n";
+	return -1;
+      }
+    }
+  }
+
+  //
+  // the levels, all nodes and elements on level 0 until the first step
+  //
+
+  nodeDt = new double[numNodes+1];
+  nodeLevel = new int[numNodes+1];
+  touchLevel = new int[numNodes+1];
+  eleLevel = new int[numEle+1];
+  nodeOrder = new int[numNodes+1];
+  touchOrder = new int[numNodes+1];
+  eleOrder = new int[numEle+1];
+  numNodesAbove = new int[MAX_NUM_LEVELS+2];
+  numTouchedAbove = new int[MAX_NUM_LEVELS+2];
+  numEleAbove = new int[MAX_NUM_LEVELS+2];
+
+  for (i=0; i<numNodes; i++) {
+    nodeDt[i] = DBL_MAX;
+    nodeLevel[i] = 0;
+    touchLevel[i] = 0;
+  }
+  for (i=0; i<numEle; i++)
+    eleLevel[i] = 0;
+  numLevels = 0;
+  orderByLevel(numNodes, nodeLevel, 0, nodeOrder, numNodesAbove);
+  orderByLevel(numNodes, touchLevel, 0, touchOrder, numTouchedAbove);
+  orderByLevel(numEle, eleLevel, 0, eleOrder, numEleAbove);
+
+  //
+  // the acceleration at the start
+  //
+
+  theDomain->applyLoad(theDomain->getCurrentTime());
+  for (i=0; i<numNodes; i++) {
+    const Vector &load = theNodes[i]->getUnbalancedLoad();
+    int start = nodeStart[i];
+    for (int j=0; j<load.Size(); j++)
+      Fext0[start+j] = load(j);
+  }
+  if (this->formForces(numEle, numNodes) < 0) {
+    opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - failed to form the element forces\n";
+    return -1;
+  }
+  initialKinetic = 0.0;
+  for (i=0; i<numDOF; i++) {
+    if (fixed[i] == 0) {
+      A[i] = (Fext0[i] - Fint[i])/M[i] - alphaM*V[i];
+      initialKinetic += 0.5*M[i]*V[i]*V[i];
+    }
+    Fext[i] = Fext0[i];
+    FextOld[i] = Fext0[i];
+    FintOld[i] = Fint[i];
+  }
+  for (i=0; i<numNodes; i++)
+    theNodes[i]->setTrialAccel(*theViews[3*i+2]);
+
+  for (i=0; i<4; i++)
+    energy[i] = 0.0;
+  energy[0] = initialKinetic;
+
+  return 0;
+}
+
+int
+ExplicitDynamicAnalysis::formForces(int numActiveEle, int numTouched)
+{
+  OPS_PROFILE("ExplicitDynamicAnalysis::formForces");
+
+  int ok = 0;
+
+  // the element resisting forces, those elements which can not share the
+  // loop are formed first
+  ops_TheActiveDomain = this->getDomainPtr();
+  bool threaded = (numThreads > 1);
+  for (int i=0; i<numActiveEle; i++) {
+    Element *theEle = theEles[eleOrder[i]];
+    if (threaded == false || theEle->isThreadSafe() == false) {
+      OPS_PROFILE_CLASS(theEle);
+      ops_TheActiveElement = theEle;
+      ok += theEle->update();
+      const Vector &force = theEle->getResistingForce();
+      double *eleF = &eleForce[eleStart[eleOrder[i]]];
+      for (int j=0; j<force.Size(); j++)
+	eleF[j] = force(j);
+    }
+  }
+
+  if (threaded == true) {
+#pragma omp parallel for num_threads(numThreads) schedule(dynamic,16) reduction(+:ok)
+    for (int i=0; i<numActiveEle; i++) {
+      Element *theEle = theEles[eleOrder[i]];
+      if (theEle->isThreadSafe() == true) {
+	OPS_PROFILE_CLASS(theEle);
+	ok += theEle->update();
+	const Vector &force = theEle->getResistingForce();
+	double *eleF = &eleForce[eleStart[eleOrder[i]]];
+	for (int j=0; j<force.Size(); j++)
+	  eleF[j] = force(j);
+      }
+    }
+  }
+
+  // sum them at the nodes the elements use
+  for (int i=0; i<numTouched; i++) {
+    int n = touchOrder[i];
+    for (int j=nodeStart[n]; j<nodeStart[n+1]; j++)
+      Fint[j] = 0.0;
+  }
+  for (int i=0; i<numActiveEle; i++) {
+    int e = eleOrder[i];
+    for (int j=eleStart[e]; j<eleStart[e+1]; j++)
+      Fint[eleDOF[j]] += eleForce[j];
+  }
+
+  if (ok != 0) {
+    opserr << "ExplicitDynamicAnalysis::formForces() - element update failed\n";
+    return -1;
+  }
+
+  return 0;
+}
+
+int
+ExplicitDynamicAnalysis::computeStableTimeStep(void)
+{
+  // the largest eigenvalue of M^-1 K is bounded by the largest row sum of
+  // |K| over the mass (Gershgorin) taken over the free dofs, the element 
+  // row sums are used for K; for a truss this gives the time the wave 
+  // takes to cross the element. Fint and eleForce are used as scratch,
+  // which is safe between steps as step() forms them again for the 
+  // nodes and elements before they are used
+  double *R = Fint;
+  for (int i=0; i<numDOF; i++)
+    R[i] = 0.0;
+
+  bool threaded = (numThreads > 1);
+  for (int i=0; i<numEle; i++) {
+    Element *theEle = theEles[i];
+    if (threaded == false || theEle->isThreadSafe() == false) {
+      const Matrix &K = theEle->getTangentStiff();
+      int numDOFe = eleStart[i+1] - eleStart[i];
+      const int *dofs = &eleDOF[eleStart[i]];
+      double *eleK = &eleForce[eleStart[i]];
+      for (int j=0; j<numDOFe; j++) {
+	double sum = 0.0;
+	for (int k=0; k<numDOFe; k++)
+	  if (fixed[dofs[k]] == 0)
+	    sum += fabs(K(j,k));
+	eleK[j] = sum;
+      }
+    }
+  }
+
+  if (threaded == true) {
+#pragma omp parallel for num_threads(numThreads) schedule(dynamic,16)
+    for (int i=0; i<numEle; i++) {
+      Element *theEle = theEles[i];
+      if (theEle->isThreadSafe() == true) {
+	const Matrix &K = theEle->getTangentStiff();
+	int numDOFe = eleStart[i+1] - eleStart[i];
+	const int *dofs = &eleDOF[eleStart[i]];
+	double *eleK = &eleForce[eleStart[i]];
+	for (int j=0; j<numDOFe; j++) {
+	  double sum = 0.0;
+	  for (int k=0; k<numDOFe; k++)
+	    if (fixed[dofs[k]] == 0)
+	      sum += fabs(K(j,k));
+	  eleK[j] = sum;
+	}
+      }
+    }
+  }
+
+  int numEleDOF = eleStart[numEle];
+  for (int i=0; i<numEleDOF; i++)
+    R[eleDOF[i]] += eleForce[i];
+
+  // the stable step of each node
+  dtStable = DBL_MAX;
+  for (int n=0; n<numNodes; n++) {
+    double omega2 = 0.0;
+    for (int i=nodeStart[n]; i<nodeStart[n+1]; i++) {
+      if (fixed[i] == 0 && R[i] > omega2*M[i])
+	omega2 = R[i]/M[i];
+    }
+    if (omega2 > 0.0) {
+      nodeDt[n] = 2.0/sqrt(omega2);
+      if (nodeDt[n] < dtStable)
+	dtStable = nodeDt[n];
+    } else
+      nodeDt[n] = DBL_MAX;
+  }
+
+  if (dtStable == DBL_MAX)
+    dtStable = 0.0;
+
+  return 0;
+}
+
+int
+ExplicitDynamicAnalysis::setLevels(double dT)
+{
+  // the level of a node is the number of times dT is halved to get 
+  // within its stable step
+  numLevels = 0;
+  for (int n=0; n<numNodes; n++) {
+    int L = 0;
+    double dtNode = dtFactor*nodeDt[n];
+    if (nodeDt[n] != DBL_MAX) {
+      double dt = dT;
+      while (dt > dtNode*(1.0+1.0e-12) && L < maxLevels) {
+	dt *= 0.5;
+	L++;
+      }
+    }
+    nodeLevel[n] = L;
+    touchLevel[n] = L;
+    if (L > numLevels)
+      numLevels = L;
+  }
+
+  // elements go at the finest step of their nodes, which in turn need
+  // displacements at the steps of all their elements
+  int *dofNode = new int[numDOF+1];
+  for (int n=0; n<numNodes; n++)
+    for (int i=nodeStart[n]; i<nodeStart[n+1]; i++)
+      dofNode[i] = n;
+
+  for (int e=0; e<numEle; e++) {
+    int L = 0;
+    for (int j=eleStart[e]; j<eleStart[e+1]; j++) {
+      int n = dofNode[eleDOF[j]];
+      if (nodeLevel[n] > L)
+	L = nodeLevel[n];
+    }
+    eleLevel[e] = L;
+    for (int j=eleStart[e]; j<eleStart[e+1]; j++) {
+      int n = dofNode[eleDOF[j]];
+      if (L > touchLevel[n])
+	touchLevel[n] = L;
+    }
+  }
+  delete [] dofNode;
+
+  orderByLevel(numNodes, nodeLevel, numLevels, nodeOrder, numNodesAbove);
+  orderByLevel(numNodes, touchLevel, numLevels, touchOrder, numTouchedAbove);
+  orderByLevel(numEle, eleLevel, numLevels, eleOrder, numEleAbove);
+
+  // start the first step of each node
+  for (int n=0; n<numNodes; n++) {
+    double halfDt = 0.5*dT/(1 << nodeLevel[n]);
+    for (int i=nodeStart[n]; i<nodeStart[n+1]; i++) {
+      U0[i] = U[i];
+      if (fixed[i] == 0)
+	Vh[i] = V[i] + halfDt*A[i];
+      else
+	Vh[i] = 0.0;
+    }
+  }
+
+  return 0;
+}
+
+void
+ExplicitDynamicAnalysis::setNumThreads(int num)
+{
+  numThreads = (num < 1) ? 1 : num;
+}
+
+double
+ExplicitDynamicAnalysis::getStableTimeStep(void)
+{
+  Domain *theDomain = this->getDomainPtr();
+  int stamp = theDomain->hasDomainChanged();
+  if (stamp != domainStamp) {
+    domainStamp = stamp;
+    if (this->domainChanged() < 0)
+      return 0.0;
+  }
+
+  this->computeStableTimeStep();
+  return dtStable;
+}
+
+int
+ExplicitDynamicAnalysis::getNumLevels(void)
+{
+  return numLevels + 1;
+}
+
+int
+ExplicitDynamicAnalysis::getEnergy(double *data)
+{
+  double kinetic = 0.0;
+  for (int i=0; i<numDOF; i++)
+    if (fixed[i] == 0)
+      kinetic += 0.5*M[i]*V[i]*V[i];
+  energy[0] = kinetic;
+
+  for (int i=0; i<4; i++)
+    data[i] = energy[i];
+  data[4] = kinetic + energy[1] + energy[3] - energy[2] - initialKinetic;
+
+  return 0;
+}
+
+int
+ExplicitDynamicAnalysis::step(double dT)
+{
+  Domain *theDomain = this->getDomainPtr();
+
+  // the step is taken in 2^numLevels ticks, at tick k the nodes and 
+  // elements of level numLevels - (trailing zeros of k) or finer are due
+  int numTicks = 1 << numLevels;
+  double h = dT/numTicks;
+  double t0 = theDomain->getCurrentTime();
+
+  // the loads and constraint values at the end of the step; with 
+  // subcycling they are interpolated for the ticks within the step 
+  // (element loads are taken at the end of the step)
+  for (int i=0; i<numSPs; i++)
+    spValues[2*i] = U[spDOF[i]];
+
+  theDomain->applyLoad(t0 + dT);
+
+  for (int n=0; n<numNodes; n++) {
+    const Vector &load = theNodes[n]->getUnbalancedLoad();
+    int start = nodeStart[n];
+    for (int j=0; j<load.Size(); j++)
+      Fext1[start+j] = load(j);
+  }
+  for (int i=0; i<numSPs; i++)
+    spValues[2*i+1] = theSPs[i]->getValue();
+
+  for (int k=1; k<=numTicks; k++) {
+
+    int Lk = numLevels;
+    for (int kk=k; (kk & 1) == 0 && Lk > 0; kk >>= 1)
+      Lk--;
+    int numActiveNodes = numNodesAbove[Lk];
+    int numActiveEle = numEleAbove[Lk];
+    int numTouched = numTouchedAbove[Lk];
+
+    double frac = (double)k/numTicks;
+    if (k < numTicks)
+      theDomain->setCurrentTime(t0 + k*h);
+
+    // the displacements of the nodes the elements use, along the 
+    // current step of each node
+    for (int i=0; i<numTouched; i++) {
+      int n = touchOrder[i];
+      int s = 1 << (numLevels - nodeLevel[n]);
+      double tau = (k - ((k-1)/s)*s)*h;
+      for (int j=nodeStart[n]; j<nodeStart[n+1]; j++)
+	U[j] = U0[j] + tau*Vh[j];
+    }
+
+    for (int i=0; i<numSPs; i++)
+      U[spDOF[i]] = spValues[2*i] + frac*(spValues[2*i+1] - spValues[2*i]);
+
+    for (int i=0; i<numTouched; i++) {
+      int n = touchOrder[i];
+      for (int j=nodeStart[n]; j<nodeStart[n+1]; j++)
+	V[j] = Vh[j];
+      theNodes[n]->setTrialDisp(*theViews[3*n]);
+      theNodes[n]->setTrialVel(*theViews[3*n+1]);
+    }
+
+    for (int i=0; i<numActiveNodes; i++) {
+      int n = nodeOrder[i];
+      for (int j=nodeStart[n]; j<nodeStart[n+1]; j++)
+	Fext[j] = Fext0[j] + frac*(Fext1[j] - Fext0[j]);
+    }
+
+    if (this->formForces(numActiveEle, numTouched) < 0)
+      return -1;
+
+    // the new accelerations at the nodes at the end of their step, with
+    // damping from the velocities at the end; then start the next step
+    for (int i=0; i<numActiveNodes; i++) {
+      int n = nodeOrder[i];
+      double dt = dT/(1 << nodeLevel[n]);
+      double halfDt = 0.5*dt;
+      double c = 1.0/(1.0 + halfDt*alphaM);
+      for (int j=nodeStart[n]; j<nodeStart[n+1]; j++) {
+	double du = U[j] - U0[j];
+	double fint = 0.5*(Fint[j] + FintOld[j]);
+	energy[1] += du*fint;
+	if (fixed[j] == 0) {
+	  A[j] = ((Fext[j] - Fint[j])/M[j] - alphaM*Vh[j])*c;
+	  V[j] = Vh[j] + halfDt*A[j];
+	  energy[2] += du*0.5*(Fext[j] + FextOld[j]);
+	  energy[3] += du*alphaM*M[j]*0.5*(Vh[j] + V[j]);
+	  Vh[j] = V[j] + halfDt*A[j];
+	} else {
+	  // the reaction does the work of the internal force
+	  A[j] = 0.0;
+	  V[j] = du/dt;
+	  energy[2] += du*fint;
+	}
+	U0[j] = U[j];
+	FintOld[j] = Fint[j];
+	FextOld[j] = Fext[j];
+      }
+      theNodes[n]->setTrialVel(*theViews[3*n+1]);
+      theNodes[n]->setTrialAccel(*theViews[3*n+2]);
+    }
+
+    // within the step the state of the elements formed is committed 
+    // so that the next tick starts from it
+    if (k < numTicks) {
+      for (int i=0; i<numTouched; i++)
+	theNodes[touchOrder[i]]->commitState();
+      for (int i=0; i<numActiveEle; i++)
+	theEles[eleOrder[i]]->commitState();
+    }
+  }
+
+  double *F = Fext0;
+  Fext0 = Fext1;
+  Fext1 = F;
+
+  theDomain->setCurrentTime(t0 + dT);
+  return theDomain->commit();
+}
+
+int
+ExplicitDynamicAnalysis::getNumSubsteps(double dT)
+{
+  // the substeps for each step: without subcycling the step is that of 
+  // the stiffest node; with subcycling the step of the stiffest node is 
+  // doubled up to maxLevels times, keeping the step that needs the fewest
+  // node updates
+  int numSub = 1;
+  if (dtStable > 0.0) {
+    double dtMax = dtFactor*dtStable;
+    numSub = (int)ceil(dT/dtMax*(1.0-1.0e-12));
+    if (numSub < 1)
+      numSub = 1;
+
+    if (maxLevels > 0) {
+      double minCost = (double)numSub*numNodes;
+      for (int L=1; L<=maxLevels; L++) {
+	dtMax *= 2.0;
+	int num = (int)ceil(dT/dtMax*(1.0-1.0e-12));
+	if (num < 1)
+	  num = 1;
+	double dt = dT/num;
+	double cost = 0.0;
+	for (int n=0; n<numNodes; n++) {
+	  int level = 0;
+	  if (nodeDt[n] != DBL_MAX)
+	    while (dt > dtFactor*nodeDt[n]*(1.0+1.0e-12)*(1 << level) && level < L)
+	      level++;
+	  cost += (1 << level);
+	}
+	cost *= num;
+	if (cost < minCost) {
+	  minCost = cost;
+	  numSub = num;
+	}
+	if (num == 1)
+	  break;
+      }
+    }
+  }
+
+  return numSub;
+}
+
+int 
+ExplicitDynamicAnalysis::analyze(int numSteps, double dT)
+{
+  OPS_PROFILE("Analysis::analyze");
+
+  Domain *theDomain = this->getDomainPtr();
+
+  if (dT <= 0.0) {
+    opserr << "WARNING ExplicitDynamicAnalysis::analyze() - dT must be positive\n";
+    return -1;
+  }
+
+  int stamp = theDomain->hasDomainChanged();
+  if (stamp != domainStamp) {
+    domainStamp = stamp;
+    if (this->domainChanged() < 0) {
+      opserr << "ExplicitDynamicAnalysis::analyze() - domainChanged() failed\n";
+      return -1;
+    }
+  }
+
+  this->computeStableTimeStep();
+  int numSub = this->getNumSubsteps(dT);
+  double dt = dT/numSub;
+  this->setLevels(dt);
+
+  // the stiffness changes as the elements yield, harden or take contact;
+  // the stable step is estimated again every EXPLICIT_DT_CHECK substeps,
+  // between steps, and the substeps made finer if it has dropped
+  int numSinceCheck = 0;
+
+  for (int i=0; i<numSteps; i++) {
+
+    if (numSinceCheck >= EXPLICIT_DT_CHECK && i > 0) {
+      numSinceCheck = 0;
+      this->computeStableTimeStep();
+      int num = this->getNumSubsteps(dT);
+      if (num > numSub) {
+	opserr << "WARNING ExplicitDynamicAnalysis::analyze() - stable time step reduced to ";
+	opserr << dtStable << " at time " << theDomain->getCurrentTime();
+	opserr << ", using " << num << " substeps per step\n";
+      }
+      numSub = num;
+      dt = dT/numSub;
+      this->setLevels(dt);
+    }
+    numSinceCheck += numSub;
+
+    for (int j=0; j<numSub; j++) {
+
+      int stamp = theDomain->hasDomainChanged();
+      if (stamp != domainStamp) {
+	domainStamp = stamp;
+	if (this->domainChanged() < 0) {
+	  opserr << "ExplicitDynamicAnalysis::analyze() - domainChanged() failed\n";
+	  return -1;
+	}
+	this->computeStableTimeStep();
+	this->setLevels(dt);
+      }
+
+      if (this->step(dt) < 0) {
+	opserr << "ExplicitDynamicAnalysis::analyze() - failed";
+	opserr << " at time " << theDomain->getCurrentTime() << endln;
+	theDomain->revertToLastCommit();
+	domainStamp = 0;   // get the state from the nodes again
+	return -2;
+      }
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,141 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+#ifndef ExplicitDynamicAnalysis_h
+#define ExplicitDynamicAnalysis_h
+
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// ExplicitDynamicAnalysis. ExplicitDynamicAnalysis is a subclass of 
+// TransientAnalysis which performs a central difference analysis with a
+// lumped (row sum) mass directly on the Domain, without an AnalysisModel,
+// integrator or LinearSOE. The mass is assembled once when the domain 
+// changes; each step the element resisting forces are then formed (shared
+// among numThreads threads) and the nodal kinematics updated in flat 
+// arrays. Each step requested of analyze() is divided into as many equal
+// substeps as needed to keep within dtFactor times the stable time step,
+// which is estimated from the element stiffness row sums over the lumped 
+// nodal masses at the start of each analyze() and again every 100 
+// substeps, between steps, as the stiffness changes; if it has dropped 
+// below the substep in use a warning is printed and the substeps are
+// made finer for the remaining steps. Mass proportional damping
+// alphaM may be given; MP_Constraints are not handled.
+//
+// With maxLevels > 0 the analysis subcycles: each node advances with the
+// largest step dT/2^level (level <= maxLevels) that is stable for it, and
+// each element is formed at the finest step of its nodes, taking the 
+// displacements of coarser nodes along their current step. A few stiff
+// or small elements then no longer set the step of the whole mesh. The
+// kinetic energy and the internal, external and damping work are kept to 
+// check the energy balance. The loads and the values of the 
+// SP_Constraints are evaluated once per step and interpolated within it.
+//
+// What: "@(#) ExplicitDynamicAnalysis.h, revA"
+
+#include <TransientAnalysis.h>
+
+class Node;
+class Element;
+class SP_Constraint;
+class Vector;
+
+class ExplicitDynamicAnalysis: public TransientAnalysis
+{
+  public:
+    ExplicitDynamicAnalysis(Domain &theDomain, int numThreads = 1,
+			    double dtFactor = 0.9, double alphaM = 0.0,
+			    int maxLevels = 0);
+    ~ExplicitDynamicAnalysis();
+
+    int analyze(int numSteps, double dT);
+    int domainChanged(void);
+
+    void setNumThreads(int numThreads);
+    double getStableTimeStep(void);
+    int getNumLevels(void);
+
+    // kinetic energy, internal, external and damping work and the 
+    // energy balance: kinetic + internal + damping - external - initial 
+    // kinetic energy
+    int getEnergy(double *energy);
+    
+  protected:
+    int formForces(int numActiveEle, int numTouched);
+    int computeStableTimeStep(void);
+    int getNumSubsteps(double dT);
+    int setLevels(double dT);
+    int step(double dT);
+    
+  private:
+    void clear(void);
+
+    int domainStamp;
+    int numThreads;
+    double dtFactor;
+    double alphaM;
+    int maxLevels;
+    double dtStable;
+
+    // nodes and their dofs in the flat arrays
+    int numNodes;
+    Node **theNodes;
+    int *nodeStart;
+    Vector **theViews;           // U, V and A of each node
+    
+    int numDOF;
+    double *U, *V, *A;           // state at the last update of the node
+    double *U0, *Vh;             // start of the current node step and the
+                                 // velocity over it
+    double *M;                   // lumped mass
+    double *Fext, *Fint;         // forces at the last update of the node
+    double *FextOld, *FintOld;
+    double *Fext0, *Fext1;       // loads at the start and end of the step
+    char *fixed;
+
+    // elements, the location of their dofs in the flat arrays and 
+    // the space for their resisting forces
+    int numEle;
+    Element **theEles;
+    int *eleStart;
+    int *eleDOF;
+    double *eleForce;
+
+    int numSPs;
+    SP_Constraint **theSPs;
+    int *spDOF;
+    double *spValues;            // at the start and end of the step
+
+    // subcycling: the level of the nodes and elements, the nodes are also
+    // given the finest level of their elements (touchLevel); the orders 
+    // list them by decreasing level and numAbove[L] counts those >= L
+    int numLevels;
+    double *nodeDt;
+    int *nodeLevel, *touchLevel, *eleLevel;
+    int *nodeOrder, *touchOrder, *eleOrder;
+    int *numNodesAbove, *numTouchedAbove, *numEleAbove;
+
+    double energy[4];
+    double initialKinetic;
+};
+
+#endif
@@ -47,6 +47,7 @@
 #include <ID.h>
 #include <Graph.h>
 #include <Timer.h>
+#include <Profiler.h>
 #include <Integrator.h>//Abbas
 
 // AddingSensitivity:BEGIN //////////////////////////////////
@@ -146,6 +147,8 @@ StaticAnalysis::clearAll(void)
 int 
 StaticAnalysis::analyze(int numSteps)
 {
+    OPS_PROFILE("Analysis::analyze");
+
     int result = 0;
     Domain *the_Domain = this->getDomainPtr();
 
@@ -192,7 +195,10 @@ StaticAnalysis::analyze(int numSteps)
 	    return -2;
 	}
 
-           result = theAlgorithm->solveCurrentStep();
+	{
+	    OPS_PROFILE("EquiSolnAlgo::solveCurrentStep");
+	    result = theAlgorithm->solveCurrentStep();
+	}
 	if (result < 0) {
 	    opserr << "StaticAnalysis::analyze() - the Algorithm failed";
 	    opserr << " at iteration: " << i << " with domain at load factor ";
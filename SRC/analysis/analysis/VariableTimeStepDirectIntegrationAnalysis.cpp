@@ -41,6 +41,7 @@
 #include <ConvergenceTest.h>
 #include <float.h>
 #include <AnalysisModel.h>
+#include <Profiler.h>
 
 // Constructor
 VariableTimeStepDirectIntegrationAnalysis::VariableTimeStepDirectIntegrationAnalysis(
@@ -67,6 +68,8 @@ VariableTimeStepDirectIntegrationAnalysis::~VariableTimeStepDirectIntegrationAna
 int 
 VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double dT, double dtMin, double dtMax, int Jd)
 {
+  OPS_PROFILE("Analysis::analyze");
+
   // get some pointers
   Domain *theDom = this->getDomainPtr();
   EquiSolnAlgo *theAlgo = this->getAlgorithm();
@@ -108,6 +111,7 @@ VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double dT, doub
 
 
     if (result >= 0) {
+      OPS_PROFILE("EquiSolnAlgo::solveCurrentStep");
       result = theAlgo->solveCurrentStep();
       if (result < 0) 
 	result = -3;
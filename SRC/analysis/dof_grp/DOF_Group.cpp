@@ -42,6 +42,8 @@
 #include <Vector.h>
 #include <Matrix.h>
 #include <TransientIntegrator.h>
+#include <FE_Element.h>
+#include <mutex>
 
 #define MAX_NUM_DOF 256
 
@@ -53,6 +55,11 @@ Matrix **DOF_Group::theMatrices; // array of pointers to class wide matrices
 Vector **DOF_Group::theVectors;  // array of pointers to class widde vectors
 int DOF_Group::numDOFs(0);           // number of objects
 
+// DOF_Groups may be created and destroyed by a number of threads
+// (ThreadSubdomain); the mutex guards the count and class wide objects
+static std::mutex theDOF_Mutex;
+static thread_local int theThreadSlot = -1;
+
 
 //  DOF_Group(Node *);
 //	construictor that take the corresponding model node.
@@ -61,9 +68,12 @@ DOF_Group::DOF_Group(int tag, Node *node)
 :TaggedObject(tag),
  unbalance(0), tangent(0), myNode(node), 
  myID(node->getNumberDOF()), 
- numDOF(node->getNumberDOF())
+ numDOF(node->getNumberDOF()),
+ myUnbalance(0), myTangent(0)
 {
     // get number of DOF & verify valid
+    std::lock_guard<std::mutex> lock(theDOF_Mutex);
+
     int numDOF = node->getNumberDOF();
     if (numDOF <= 0) {
 	opserr << "DOF_Group::DOF_Group(Node *) ";
@@ -86,14 +96,15 @@ DOF_Group::DOF_Group(int tag, Node *node)
     // create the arrays used to store pointers to class wide
     // matrix and vector objects used to return tangent and residual
     if (numDOFs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
+	int numTables = (MAX_NUM_DOF+1)*MAX_NUM_FE_THREADS;
+	theMatrices = new Matrix *[numTables];
+	theVectors  = new Vector *[numTables];
 	
 	if (theMatrices == 0 || theVectors == 0) {
 	    opserr << "DOF_Group::DOF_Group(Node *) ";
 	    opserr << " ran out of memory";	    
 	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
+	for (int i=0; i<numTables; i++) {
 	    theMatrices[i] = 0;
 	    theVectors[i] = 0;
 	}
@@ -101,13 +112,14 @@ DOF_Group::DOF_Group(int tag, Node *node)
     
     // set the pointers for the tangent and residual
     if (numDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (theVectors[numDOF] == 0) {
+	// use class wide objects, those of the thread's slot if it has one
+	int loc = (theThreadSlot < 0) ? numDOF : theThreadSlot*(MAX_NUM_DOF+1) + numDOF;
+	if (theVectors[loc] == 0) {
 	    // have to create matrix and vector of size as none yet created
-	    theVectors[numDOF] = new Vector(numDOF);
-	    theMatrices[numDOF] = new Matrix(numDOF,numDOF);
-	    unbalance = theVectors[numDOF];
-	    tangent = theMatrices[numDOF];
+	    theVectors[loc] = new Vector(numDOF);
+	    theMatrices[loc] = new Matrix(numDOF,numDOF);
+	    unbalance = theVectors[loc];
+	    tangent = theMatrices[loc];
 	    if (unbalance == 0 || unbalance->Size() != numDOF ||	
 		tangent == 0 || tangent->noCols() != numDOF)	{  
 		opserr << "DOF_Group::DOF_Group(Node *) ";
@@ -116,8 +128,8 @@ DOF_Group::DOF_Group(int tag, Node *node)
 		exit(-1);
 	    }
 	} else {
-	    unbalance = theVectors[numDOF];
-	    tangent = theMatrices[numDOF];
+	    unbalance = theVectors[loc];
+	    tangent = theMatrices[loc];
 	}
     } else {
 	// create matrices and vectors for each object instance
@@ -141,9 +153,12 @@ DOF_Group::DOF_Group(int tag, int ndof)
 :TaggedObject(tag),
  unbalance(0), tangent(0), myNode(0), 
  myID(ndof), 
- numDOF(ndof)
+ numDOF(ndof),
+ myUnbalance(0), myTangent(0)
 {
     // get number of DOF & verify valid
+    std::lock_guard<std::mutex> lock(theDOF_Mutex);
+
     int numDOF = ndof;
     if (numDOF <= 0) {
 	opserr << "DOF_Group::DOF_Group(int, int ndof) ";
@@ -166,14 +181,15 @@ DOF_Group::DOF_Group(int tag, int ndof)
     // create the arrays used to store pointers to class wide
     // matrix and vector objects used to return tangent and residual
     if (numDOFs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
+	int numTables = (MAX_NUM_DOF+1)*MAX_NUM_FE_THREADS;
+	theMatrices = new Matrix *[numTables];
+	theVectors  = new Vector *[numTables];
 	
 	if (theMatrices == 0 || theVectors == 0) {
 	    opserr << "DOF_Group::DOF_Group(int, int ndof) ";
 	    opserr << " ran out of memory";	    
 	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
+	for (int i=0; i<numTables; i++) {
 	    theMatrices[i] = 0;
 	    theVectors[i] = 0;
 	}
@@ -181,13 +197,14 @@ DOF_Group::DOF_Group(int tag, int ndof)
 
     // set the pointers for the tangent and residual
     if (numDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (theVectors[numDOF] == 0) {
+	// use class wide objects, those of the thread's slot if it has one
+	int loc = (theThreadSlot < 0) ? numDOF : theThreadSlot*(MAX_NUM_DOF+1) + numDOF;
+	if (theVectors[loc] == 0) {
 	    // have to create matrix and vector of size as none yet created
-	    theVectors[numDOF] = new Vector(numDOF);
-	    theMatrices[numDOF] = new Matrix(numDOF,numDOF);
-	    unbalance = theVectors[numDOF];
-	    tangent = theMatrices[numDOF];
+	    theVectors[loc] = new Vector(numDOF);
+	    theMatrices[loc] = new Matrix(numDOF,numDOF);
+	    unbalance = theVectors[loc];
+	    tangent = theMatrices[loc];
 	    if (unbalance == 0 || unbalance->Size() != numDOF ||	
 		tangent == 0 || tangent->noCols() != numDOF)	{  
 		opserr << "DOF_Group::DOF_Group(int, int ndof) ";
@@ -196,8 +213,8 @@ DOF_Group::DOF_Group(int tag, int ndof)
 		exit(-1);
 	    }
 	} else {
-	    unbalance = theVectors[numDOF];
-	    tangent = theMatrices[numDOF];
+	    unbalance = theVectors[loc];
+	    tangent = theMatrices[loc];
 	}
     } else {
 	// create matrices and vectors for each object instance
@@ -221,6 +238,7 @@ DOF_Group::DOF_Group(int tag, int ndof)
 
 DOF_Group::~DOF_Group()
 {
+    std::lock_guard<std::mutex> lock(theDOF_Mutex);
     numDOFs--;
 
     int numDOF = unbalance->Size();
@@ -236,10 +254,15 @@ DOF_Group::~DOF_Group()
 	if (unbalance != 0) delete unbalance;
     }
 
+    // the objects using the storage given by the AnalysisModel
+    if (myTangent != 0) delete myTangent;
+    if (myUnbalance != 0) delete myUnbalance;
+
     // if this is the last FE_Element, clean up the
     // storage for the matrix and vector objects
     if (numDOFs == 0) {
-	for (int i=0; i<MAX_NUM_DOF; i++) {
+	int numTables = (MAX_NUM_DOF+1)*MAX_NUM_FE_THREADS;
+	for (int i=0; i<numTables; i++) {
 	    if (theVectors[i] != 0)
 		delete theVectors[i];
 	    if (theMatrices[i] != 0)
@@ -335,6 +358,7 @@ DOF_Group::getNumConstrainedDOF(void) const
 const Matrix &
 DOF_Group::getTangent(Integrator *theIntegrator) 
 {	
+    this->setThreadStorage();
     if (theIntegrator != 0)
 	theIntegrator->formNodTangent(this);    
     return *tangent;
@@ -390,6 +414,7 @@ DOF_Group::zeroUnbalance(void)
 const Vector &
 DOF_Group::getUnbalance(Integrator *theIntegrator)
 {
+    this->setThreadStorage();
     if (theIntegrator != 0)
 	theIntegrator->formNodUnbalance(this);
 
@@ -773,6 +798,12 @@ DOF_Group::getT(void)
     return 0;
 }
 
+bool
+DOF_Group::isTimeVarying(void) const
+{
+    return false;
+}
+
 
 
 void  
@@ -976,6 +1007,92 @@ DOF_Group::resetNodePtr(void)
 }
 
 
+// void setThreadStorage(void);
+//	Method invoked from getTangent() and getUnbalance() to point the 
+//	tangent & unbalance at the class wide objects of the calling thread's
+//	slot, if it has been given one.
+
+void
+DOF_Group::setThreadStorage(void)
+{
+    if (theThreadSlot < 0 || numDOF > MAX_NUM_DOF || myTangent != 0)
+	return;
+
+    int loc = theThreadSlot*(MAX_NUM_DOF+1) + numDOF;
+    if (theVectors[loc] == 0) {
+	theVectors[loc] = new Vector(numDOF);
+	theMatrices[loc] = new Matrix(numDOF,numDOF);
+    }
+
+    unbalance = theVectors[loc];
+    tangent = theMatrices[loc];
+}
+
+void
+DOF_Group::setThreadSlot(int slot)
+{
+    if (slot >= MAX_NUM_FE_THREADS)
+	slot = -1;
+    theThreadSlot = slot;
+}
+
+
+// int getStorageSize(void) const;
+//	Method to return the number of doubles the object needs for its own 
+//	tangent & unbalance, none if it has more than MAX_NUM_DOF dof as it
+//	then already has its own.
+
+int
+DOF_Group::getStorageSize(void) const
+{
+    if (numDOF > MAX_NUM_DOF)
+	return 0;
+
+    return numDOF*numDOF + numDOF;
+}
+
+// int setStorage(double *data);
+//	Method to point the tangent & unbalance at the storage given, the 
+//	tangent first, or at the class wide objects again if data is 0.
+
+int
+DOF_Group::setStorage(double *data)
+{
+    if (this->getStorageSize() == 0)
+	return 0;
+
+    if (data == 0) {
+	if (myTangent != 0) {
+	    delete myTangent;
+	    delete myUnbalance;
+	    myTangent = 0;
+	    myUnbalance = 0;
+	}
+	std::lock_guard<std::mutex> lock(theDOF_Mutex);
+	int loc = (theThreadSlot < 0) ? numDOF : theThreadSlot*(MAX_NUM_DOF+1) + numDOF;
+	if (theVectors[loc] == 0) {
+	    theVectors[loc] = new Vector(numDOF);
+	    theMatrices[loc] = new Matrix(numDOF,numDOF);
+	}
+	tangent = theMatrices[loc];
+	unbalance = theVectors[loc];
+	return 0;
+    }
+
+    if (myTangent == 0) {
+	myTangent = new Matrix(data, numDOF, numDOF);
+	myUnbalance = new Vector(data + numDOF*numDOF, numDOF);
+    } else {
+	myTangent->setData(data, numDOF, numDOF);
+	myUnbalance->setData(data + numDOF*numDOF, numDOF);
+    }
+
+    tangent = myTangent;
+    unbalance = myUnbalance;
+    return 0;
+}
+
+
 double 
 DOF_Group::getDampingBetaFactor(int mode, double ratio, double wn)
 {
@@ -107,6 +107,7 @@ class DOF_Group: public TaggedObject
 	
     // method added for TransformationDOF_Groups
     virtual Matrix *getT(void);
+    virtual bool isTimeVarying(void) const;
 
 // AddingSensitivity:BEGIN ////////////////////////////////////
     virtual void addM_ForceSensitivity(const Vector &Udotdot, double fact = 1.0);        
@@ -127,6 +128,16 @@ class DOF_Group: public TaggedObject
 // AddingSensitivity:END //////////////////////////////////////
     virtual void  Print(OPS_Stream&, int = 0) {return;};
     virtual void resetNodePtr(void);
+
+    // method to give a thread its own class wide tangent and unbalance
+    // objects (see ThreadSubdomain), -1 to stop using them
+    static void setThreadSlot(int slot);
+
+    // methods to give the object its own tangent and unbalance, laid out
+    // at data (getStorageSize() doubles) by the AnalysisModel; data = 0
+    // returns it to the class wide objects
+    virtual int getStorageSize(void) const;
+    virtual int setStorage(double *data);
   
    protected:
     void  addLocalM_Force(const Vector &Udotdot, double fact = 1.0);     
@@ -137,9 +148,13 @@ class DOF_Group: public TaggedObject
     Node *myNode;
     
   private:
+    void setThreadStorage(void);
+
     // private variables - a copy for each object of the class        
     ID 	myID;
     int numDOF;
+    Vector *myUnbalance;         // the objects own storage, if given
+    Matrix *myTangent;
 
     // static variables - single copy for all objects of the class	    
     static Matrix errMatrix;
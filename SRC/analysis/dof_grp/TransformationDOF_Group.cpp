@@ -711,6 +711,13 @@ TransformationDOF_Group::setEigenvector(int mode, const Vector &u)
 }
 
 
+// T is formed again by getT() if the constraint is time varying
+bool
+TransformationDOF_Group::isTimeVarying(void) const
+{
+    return theMP != 0 && theMP->isTimeVarying();
+}
+
 Matrix *
 TransformationDOF_Group::getT(void)
 {
@@ -42,6 +42,10 @@
 #include <AnalysisModel.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <mutex>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #define MAX_NUM_DOF 64
 
@@ -52,14 +56,22 @@ Matrix **FE_Element::theMatrices; // pointers to class wide matrices
 Vector **FE_Element::theVectors;  // pointers to class widde vectors
 int FE_Element::numFEs(0);           // number of objects
 
+// FE_Elements may be created and destroyed by a number of threads
+// (ThreadSubdomain); the mutex guards the count and class wide objects
+static std::mutex theFE_Mutex;
+static thread_local int theThreadSlot = -1;
+
 //  FE_Element(Element *, Integrator *theIntegrator);
 //	construictor that take the corresponding model element.
 FE_Element::FE_Element(int tag, Element *ele)
   :TaggedObject(tag),
    myDOF_Groups((ele->getExternalNodes()).Size()), myID(ele->getNumDOF()), 
    numDOF(ele->getNumDOF()), theModel(0), myEle(ele), 
-   theResidual(0), theTangent(0), theIntegrator(0)
+   theResidual(0), theTangent(0), theIntegrator(0),
+   myResidual(0), myTangent(0)
 {
+  std::lock_guard<std::mutex> lock(theFE_Mutex);
+
   if (numDOF <= 0) {
     opserr << "FE_Element::FE_Element(Element *) ";
     opserr << " element must have 1 dof " << *ele;
@@ -100,14 +112,15 @@ FE_Element::FE_Element(int tag, Element *ele)
     // create the arrays used to store pointers to class wide
     // matrix and vector objects used to return tangent and residual
     if (numFEs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
+	int numTables = (MAX_NUM_DOF+1)*MAX_NUM_FE_THREADS;
+	theMatrices = new Matrix *[numTables];
+	theVectors  = new Vector *[numTables];
 	
 	if (theMatrices == 0 || theVectors == 0) {
 	    opserr << "FE_Element::FE_Element(Element *) ";
 	    opserr << " ran out of memory";	    
 	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
+	for (int i=0; i<numTables; i++) {
 	    theMatrices[i] = 0;
 	    theVectors[i] = 0;
 	}
@@ -158,6 +171,10 @@ FE_Element::FE_Element(int tag, Element *ele)
 	Subdomain *theSub = (Subdomain *)ele;
 	theSub->setFE_ElementPtr(this);
     }
+
+    // a thread with a slot uses its own class wide objects
+    if (ele->isSubdomain() == false && theThreadSlot >= 0)
+	this->setThreadStorage();
  
     // increment number of FE_Elements by 1
     numFEs++;
@@ -167,23 +184,26 @@ FE_Element::FE_Element(int tag, Element *ele)
 FE_Element::FE_Element(int tag, int numDOF_Group, int ndof)
   :TaggedObject(tag),
    myDOF_Groups(numDOF_Group), myID(ndof), numDOF(ndof), theModel(0),
-   myEle(0), theResidual(0), theTangent(0), theIntegrator(0)
+   myEle(0), theResidual(0), theTangent(0), theIntegrator(0),
+   myResidual(0), myTangent(0)
 {
     // this is for a subtype, the subtype must set the myDOF_Groups ID array
+    std::lock_guard<std::mutex> lock(theFE_Mutex);
     numFEs++;
 
     // if this is the first FE_Element we now
     // create the arrays used to store pointers to class wide
     // matrix and vector objects used to return tangent and residual
     if (numFEs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
+	int numTables = (MAX_NUM_DOF+1)*MAX_NUM_FE_THREADS;
+	theMatrices = new Matrix *[numTables];
+	theVectors  = new Vector *[numTables];
 	
 	if (theMatrices == 0 || theVectors == 0) {
 	    opserr << "FE_Element::FE_Element(Element *) ";
 	    opserr << " ran out of memory";	    
 	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
+	for (int i=0; i<numTables; i++) {
 	    theMatrices[i] = 0;
 	    theVectors[i] = 0;
 	}
@@ -199,6 +219,7 @@ FE_Element::FE_Element(int tag, int numDOF_Group, int ndof)
 //	destructor.
 FE_Element::~FE_Element()
 {
+    std::lock_guard<std::mutex> lock(theFE_Mutex);
 
     // decrement number of FE_Elements
     numFEs--;
@@ -209,10 +230,15 @@ FE_Element::~FE_Element()
 	if (theResidual != 0) delete theResidual;
     }
 
+    // the objects using the storage given by the AnalysisModel
+    if (myTangent != 0) delete myTangent;
+    if (myResidual != 0) delete myResidual;
+
     // if this is the last FE_Element, clean up the
     // storage for the matrix and vector objects
     if (numFEs == 0) {
-	for (int i=0; i<MAX_NUM_DOF; i++) {
+	int numTables = (MAX_NUM_DOF+1)*MAX_NUM_FE_THREADS;
+	for (int i=0; i<numTables; i++) {
 	    if (theVectors[i] != 0)
 		delete theVectors[i];
 	    if (theMatrices[i] != 0)
@@ -297,6 +323,7 @@ FE_Element::getTangent(Integrator *theNewIntegrator)
     }
 
     if (myEle->isSubdomain() == false) {
+      this->setThreadStorage();
       if (theNewIntegrator != 0)
 	theNewIntegrator->formEleTangent(this);	    	    
 
@@ -324,6 +351,7 @@ FE_Element::getResidual(Integrator *theNewIntegrator)
     }    
 
     if (myEle->isSubdomain() == false) {
+      this->setThreadStorage();
       theNewIntegrator->formEleResidual(this);
       return *theResidual;
     } else {
@@ -335,6 +363,137 @@ FE_Element::getResidual(Integrator *theNewIntegrator)
 
 
 
+bool
+FE_Element::isThreadSafe(void) const
+{
+    // only FE_Elements using the class wide storage select a copy per thread,
+    // and the element itself must not use shared scratch storage
+    if (myEle == 0 || myEle->isSubdomain() == true)
+	return false;
+
+    return myEle->isThreadSafe();
+}
+
+
+bool
+FE_Element::isTangentConstant(void) const
+{
+    // subdomains form their tangent from their own elements
+    if (myEle == 0 || myEle->isSubdomain() == true)
+	return false;
+
+    return myEle->isTangentConstant();
+}
+
+
+// void setThreadStorage(void);
+//	Method invoked from getTangent() and getResidual() to point the 
+//	tangent & residual at the class wide objects of the calling thread
+//	when invoked inside a parallel region or by a thread given a slot, 
+//	so that FE_Elements with the same number of dof can be formed at 
+//	the same time. The OpenMP threads use the slots of their thread 
+//	number, so a thread given a slot does not start a parallel region 
+//	(see IncrementalIntegrator).
+
+void
+FE_Element::setThreadStorage(void)
+{
+    if (numDOF > MAX_NUM_DOF || myTangent != 0)
+	return;
+
+    int threadID = theThreadSlot;
+#ifdef _OPENMP
+    if (threadID < 0 && omp_in_parallel() != 0)
+	threadID = omp_get_thread_num();
+#endif
+    if (threadID < 0)
+	return;
+
+    if (threadID >= MAX_NUM_FE_THREADS) {
+	opserr << "FATAL FE_Element::setThreadStorage() - thread " << threadID;
+	opserr << " exceeds the maximum of " << MAX_NUM_FE_THREADS << endln;
+	exit(-1);
+    }
+
+    int loc = threadID*(MAX_NUM_DOF+1) + numDOF;
+    if (theVectors[loc] == 0) {
+	theVectors[loc] = new Vector(numDOF);
+	theMatrices[loc] = new Matrix(numDOF,numDOF);
+    }
+
+    theResidual = theVectors[loc];
+    theTangent = theMatrices[loc];
+}
+
+void
+FE_Element::setThreadSlot(int slot)
+{
+    if (slot >= MAX_NUM_FE_THREADS)
+	slot = -1;
+    theThreadSlot = slot;
+}
+
+int
+FE_Element::getThreadSlot(void)
+{
+    return theThreadSlot;
+}
+
+
+// int getStorageSize(void) const;
+//	Method to return the number of doubles the object needs for its own 
+//	tangent & residual. Those with more than MAX_NUM_DOF dof already have
+//	their own, subdomains & subtypes without an element form theirs 
+//	elsewhere; these need none.
+
+int
+FE_Element::getStorageSize(void) const
+{
+    if (myEle == 0 || myEle->isSubdomain() == true || numDOF > MAX_NUM_DOF)
+	return 0;
+
+    return numDOF*numDOF + numDOF;
+}
+
+// int setStorage(double *data);
+//	Method to point the tangent & residual at the storage given, the 
+//	tangent first. With the tangent & residual of its own the object may
+//	be formed at the same time as any other and the result remains valid
+//	until it is next formed. If data is 0 the class wide objects are used 
+//	again.
+
+int
+FE_Element::setStorage(double *data)
+{
+    if (this->getStorageSize() == 0)
+	return 0;
+
+    if (data == 0) {
+	if (myTangent != 0) {
+	    delete myTangent;
+	    delete myResidual;
+	    myTangent = 0;
+	    myResidual = 0;
+	}
+	theTangent = theMatrices[numDOF];
+	theResidual = theVectors[numDOF];
+	return 0;
+    }
+
+    if (myTangent == 0) {
+	myTangent = new Matrix(data, numDOF, numDOF);
+	myResidual = new Vector(data + numDOF*numDOF, numDOF);
+    } else {
+	myTangent->setData(data, numDOF, numDOF);
+	myResidual->setData(data + numDOF*numDOF, numDOF);
+    }
+
+    theTangent = myTangent;
+    theResidual = myResidual;
+    return 0;
+}
+
+
 void  
 FE_Element::zeroTangent(void)
 {
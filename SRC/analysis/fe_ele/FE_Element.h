@@ -39,6 +39,9 @@
 #include <Vector.h>
 #include <TaggedObject.h>
 
+// maximum number of threads that may form FE_Elements concurrently
+#define MAX_NUM_FE_THREADS 64
+
 class TransientIntegrator;
 class Element;
 class Integrator;
@@ -61,6 +64,27 @@ class FE_Element: public TaggedObject
     virtual const Matrix &getTangent(Integrator *theIntegrator);
     virtual const Vector &getResidual(Integrator *theIntegrator);
 
+    // method to determine if getTangent() and getResidual() may be 
+    // invoked on different objects at the same time
+    virtual bool isThreadSafe(void) const;
+
+    // method to determine if the tangent depends only on the integrator
+    // coefficients and not on the state of the element
+    virtual bool isTangentConstant(void) const;
+
+    // method to give a thread its own class wide tangent and residual 
+    // objects outside of OpenMP parallel regions (see ThreadSubdomain); 
+    // slot is in the range [0, MAX_NUM_FE_THREADS), -1 to stop using them;
+    // getThreadSlot() returns that of the calling thread
+    static void setThreadSlot(int slot);
+    static int getThreadSlot(void);
+
+    // methods to give the object its own tangent and residual, laid out
+    // at data (getStorageSize() doubles) by the AnalysisModel; data = 0 
+    // returns it to the class wide objects
+    virtual int getStorageSize(void) const;
+    virtual int setStorage(double *data);
+
     // methods to allow integrator to build tangent
     virtual void  zeroTangent(void);
     virtual void  addKtToTang(double fact = 1.0);
@@ -114,6 +138,8 @@ class FE_Element: public TaggedObject
     ID myID;
 
   private:
+    void setThreadStorage(void);
+
     // private variables - a copy for each object of the class    
     int numDOF;
     AnalysisModel *theModel;
@@ -121,6 +147,8 @@ class FE_Element: public TaggedObject
     Vector *theResidual;
     Matrix *theTangent;
     Integrator *theIntegrator; // need for Subdomain
+    Vector *myResidual;        // the objects own storage, if given
+    Matrix *myTangent;
 
     
     // static variables - single copy for all objects of the class	
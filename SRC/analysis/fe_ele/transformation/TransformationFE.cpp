@@ -387,6 +387,28 @@ TransformationFE::getTangent(Integrator *theNewIntegrator)
 }
 
 
+// the transformed tangent and residual use class wide storage
+bool
+TransformationFE::isThreadSafe(void) const
+{
+    return false;
+}
+
+// the transformed tangent changes with time varying constraints
+bool
+TransformationFE::isTangentConstant(void) const
+{
+    if (this->FE_Element::isTangentConstant() == false)
+	return false;
+
+    for (int i=0; i<numGroups; i++)
+	if (theDOFs[i]->isTimeVarying() == true)
+	    return false;
+
+    return true;
+}
+
+
 const Vector &
 TransformationFE::getResidual(Integrator *theNewIntegrator)
 
@@ -39,16 +39,29 @@
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
 #include <EigenSOE.h>
+#include <Matrix.h>
+#include <Subdomain.h>
 #include <cmath>
+#include <Profiler.h>
+#include <Parameter.h>
+
+// number of FE_Elements each thread forms before a block is assembled
+#define FE_BLOCK_SIZE_PER_THREAD 64
 
 IncrementalIntegrator::IncrementalIntegrator(int clasTag)
 :Integrator(clasTag),
- statusFlag(CURRENT_TANGENT), theEigenSOE(0), 
+ statusFlag(CURRENT_TANGENT), numThreads(1), theEigenSOE(0), 
  eigenVectors(0), eigenValues(0), dampingForces(0),isDiagonal(false),diagMass(0),
  mV(0),tmpV1(0),tmpV2(0),
- theSOE(0), theAnalysisModel(0), theTest(0)
+ theSOE(0), theAnalysisModel(0), theTest(0),
+ theFEs(0), sizeFEs(0), blockTangents(0), blockResiduals(0), sizeBlock(0),
+ formedTangents(0), formedResiduals(0), privateStorage(false),
+ constantTangents(false), skipConstantFEs(false), parameterStamp(0)
 {
-  
+  for (int i=0; i<3; i++) {
+    probeFEs[i] = 0;
+    probeTangents[i] = 0;
+  }
 }
 
 IncrementalIntegrator::~IncrementalIntegrator()
@@ -65,6 +78,25 @@ IncrementalIntegrator::~IncrementalIntegrator()
     delete tmpV1;
   if (tmpV2 != 0)
     delete tmpV2;
+
+  if (theFEs != 0)
+    delete [] theFEs;
+  if (formedTangents != 0)
+    delete [] formedTangents;
+  if (formedResiduals != 0)
+    delete [] formedResiduals;
+  for (int i=0; i<sizeBlock; i++) {
+    delete blockTangents[i];
+    delete blockResiduals[i];
+  }
+  if (blockTangents != 0)
+    delete [] blockTangents;
+  if (blockResiduals != 0)
+    delete [] blockResiduals;
+
+  for (int i=0; i<3; i++)
+    if (probeTangents[i] != 0)
+      delete probeTangents[i];
 }
 
 void
@@ -84,6 +116,8 @@ IncrementalIntegrator::setEigenSOE(EigenSOE *theEigSOE) {
 int 
 IncrementalIntegrator::formTangent(int statFlag)
 {
+    OPS_PROFILE("IncrementalIntegrator::formTangent");
+
     int result = 0;
     statusFlag = statFlag;
 
@@ -94,22 +128,189 @@ IncrementalIntegrator::formTangent(int statFlag)
     }
 
     // zero the A matrix of the linearSOE
-    theSOE->zeroA();
+    this->resetTangent();
 
     // the loops to form and add the tangents are broken into two for 
     // efficiency when performing parallel computations - CHANGE
 
     // loop through the FE_Elements adding their contributions to the tangent
+    if (this->formElementTangent() < 0)
+	result = -3;
+
+    return result;
+}
+
+int
+IncrementalIntegrator::setNumThreads(int num)
+{
+    if (num < 1)
+	num = 1;
+
+    if (num > MAX_NUM_FE_THREADS) {
+	opserr << "WARNING IncrementalIntegrator::setNumThreads() - ";
+	opserr << num << " threads requested, using " << MAX_NUM_FE_THREADS << endln;
+	num = MAX_NUM_FE_THREADS;
+    }
+
+#ifndef _OPENMP
+    if (num > 1) {
+	opserr << "WARNING IncrementalIntegrator::setNumThreads() - ";
+	opserr << "not compiled with OpenMP (OPENMP_FLAG in Makefile.def), FE_Elements formed serially\n";
+    }
+#endif
+
+    numThreads = num;
+    return 0;
+}
+
+int
+IncrementalIntegrator::getNumThreads(void) const
+{
+    return numThreads;
+}
+
+int
+IncrementalIntegrator::setConstantTangents(bool flag)
+{
+    constantTangents = flag;
+    skipConstantFEs = false;
+    for (int i=0; i<3; i++)
+	probeFEs[i] = 0;
+
+    return 0;
+}
+
+bool
+IncrementalIntegrator::getConstantTangents(void) const
+{
+    return constantTangents;
+}
+
+int
+IncrementalIntegrator::setPrivateStorage(bool flag)
+{
+    privateStorage = flag;
+    return 0;
+}
+
+bool
+IncrementalIntegrator::getPrivateStorage(void) const
+{
+    return privateStorage;
+}
+
+// int resetTangent(void);
+//	Invoked by formTangent() in place of zeroA(). If constant tangents 
+//	are used, A is set to the sum of the constant FE_Element tangents 
+//	kept by the SOE, which is formed again if the SOE no longer holds it 
+//	(the SOE drops it in setSize()), if a Parameter has been updated since
+//	(element properties may have changed) or if the integrator 
+//	coefficients have changed, and formElementTangent() then skips those
+//	FE_Elements.
+
+int
+IncrementalIntegrator::resetTangent(void)
+{
+    skipConstantFEs = false;
+
+    if (constantTangents == false) {
+	theSOE->zeroA();
+	return 0;
+    }
+
+    if (parameterStamp == Parameter::getUpdateStamp() && theSOE->restoreA() == 0) {
+	bool valid = true;
+	for (int i=0; i<3 && valid == true; i++) {
+	    if (probeFEs[i] == 0)
+		continue;
+	    const Matrix &theTangent = probeFEs[i]->getTangent(this);
+	    const Matrix &theProbe = *(probeTangents[i]);
+	    int numRows = theProbe.noRows();
+	    for (int j=0; j<numRows && valid == true; j++)
+		for (int k=0; k<numRows; k++)
+		    if (theTangent(j,k) != theProbe(j,k)) {
+			valid = false;
+			break;
+		    }
+	}
+	if (valid == true) {
+	    skipConstantFEs = true;
+	    return 0;
+	}
+    }
+
+    theSOE->zeroA();
+    int res = this->formConstantTangents();
+    parameterStamp = Parameter::getUpdateStamp();
+
+    if (theSOE->saveA() < 0) {
+	opserr << "WARNING IncrementalIntegrator::resetTangent() - the LinearSOE ";
+	opserr << "cannot keep the constant tangents, they will be assembled with the others\n";
+	constantTangents = false;
+    }
+
+    // the constant tangents have been added for this formTangent()
+    skipConstantFEs = true;
+
+    return res;
+}
+
+// int formConstantTangents(void);
+//	Adds the tangents of the FE_Elements whose tangent is constant to the
+//	SOE and chooses the probes: the first such FE_Element and the first
+//	ones whose element has a nonzero mass and damping matrix.
+
+int
+IncrementalIntegrator::formConstantTangents(void)
+{
+    int res = 0;
+    for (int i=0; i<3; i++)
+	probeFEs[i] = 0;
+
     FE_Element *elePtr;
-    FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
-    while((elePtr = theEles2()) != 0)     
-	if (theSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0) {
-	    opserr << "WARNING IncrementalIntegrator::formTangent -";
-	    opserr << " failed in addA for ID " << elePtr->getID();	    
-	    result = -3;
+    FE_EleIter &theEles = theAnalysisModel->getFEs();
+    while ((elePtr = theEles()) != 0) {
+	if (elePtr->isTangentConstant() == false)
+	    continue;
+
+	const Matrix &theTangent = elePtr->getTangent(this);
+	if (theSOE->addA(theTangent, elePtr->getID()) < 0) {
+	    opserr << "WARNING IncrementalIntegrator::formConstantTangents -";
+	    opserr << " failed in addA for ID " << elePtr->getID();
+	    res = -3;
 	}
 
-    return result;
+	if (probeFEs[0] != 0 && probeFEs[1] != 0 && probeFEs[2] != 0)
+	    continue;
+
+	// copy the tangent before asking the element for its mass and damping
+	Matrix tangentCopy(theTangent);
+	Element *theEle = elePtr->getElement();
+	for (int i=0; i<3; i++) {
+	    if (probeFEs[i] != 0)
+		continue;
+	    bool isProbe = (i == 0);
+	    if (i != 0) {
+		const Matrix &theMatrix = (i == 1) ? theEle->getMass() : theEle->getDamp();
+		int numRows = theMatrix.noRows();
+		for (int j=0; j<numRows && isProbe == false; j++)
+		    for (int k=0; k<numRows; k++)
+			if (theMatrix(j,k) != 0.0) {
+			    isProbe = true;
+			    break;
+			}
+	    }
+	    if (isProbe == true) {
+		probeFEs[i] = elePtr;
+		if (probeTangents[i] == 0)
+		    probeTangents[i] = new Matrix(tangentCopy);
+		else
+		    *(probeTangents[i]) = tangentCopy;
+	    }
+	}
+    }
+
+    return res;
 }
 
 int
@@ -121,6 +322,8 @@ IncrementalIntegrator::formIndependentSensitivityLHS(int statFlag)
 int 
 IncrementalIntegrator::formUnbalance(void)
 {
+    OPS_PROFILE("IncrementalIntegrator::formUnbalance");
+
     if (theAnalysisModel == 0 || theSOE == 0) {
 	opserr << "WARNING IncrementalIntegrator::formUnbalance -";
 	opserr << " no AnalysisModel or LinearSOE has been set\n";
@@ -255,9 +458,49 @@ IncrementalIntegrator::formNodalUnbalance(void)
     return res;
 }
 
+int 
+IncrementalIntegrator::formElementTangent(void)
+{
+    this->startSubdomainTasks(SUBDOMAIN_TASK_COMPUTE_TANG);
+
+    int res = 0;
+
+    // the thread of a ThreadSubdomain forms its FE_Elements itself; OpenMP
+    // threads started there would take the slots of their thread numbers,
+    // which the teams of the other subdomains take as well
+    if (numThreads > 1 && FE_Element::getThreadSlot() < 0) 
+	res = this->formElementsThreaded(true);
+
+    else {
+	// loop through the FE_Elements adding their contributions to the tangent,
+	// skipping those already added by resetTangent()
+	FE_Element *elePtr;
+
+	FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
+	while((elePtr = theEles2()) != 0) {
+	    if (skipConstantFEs == true && elePtr->isTangentConstant() == true)
+		continue;
+	    OPS_PROFILE_CLASS(elePtr->getElement());
+	    if (theSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0) {
+		opserr << "WARNING IncrementalIntegrator::formElementTangent -";
+		opserr << " failed in addA for ID " << elePtr->getID();	    
+		res = -3;
+	    }
+	}
+    }
+
+    skipConstantFEs = false;
+    return res;
+}
+
 int 
 IncrementalIntegrator::formElementResidual(void)
 {
+    this->startSubdomainTasks(SUBDOMAIN_TASK_COMPUTE_RESIDUAL);
+
+    if (numThreads > 1 && FE_Element::getThreadSlot() < 0)
+	return this->formElementsThreaded(false);
+
     // loop through the FE_Elements and add the residual
     FE_Element *elePtr;
 
@@ -265,7 +508,7 @@ IncrementalIntegrator::formElementResidual(void)
 
     FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
     while((elePtr = theEles2()) != 0) {
-
+	OPS_PROFILE_CLASS(elePtr->getElement());
 	if (theSOE->addB(elePtr->getResidual(this),elePtr->getID()) <0) {
 	    opserr << "WARNING IncrementalIntegrator::formElementResidual -";
 	    opserr << " failed in addB for ID " << elePtr->getID();
@@ -276,6 +519,152 @@ IncrementalIntegrator::formElementResidual(void)
     return res;	    
 }
 
+// void startSubdomainTasks(int task);
+//	Starts the condensation of the threaded subdomains (ThreadSubdomain)
+//	before the FE_Elements are formed, so that the subdomains do it
+//	concurrently; FE_Element::getTangent() and getResidual() finish it.
+
+void
+IncrementalIntegrator::startSubdomainTasks(int task)
+{
+    FE_Element *elePtr;
+    FE_EleIter &theEles = theAnalysisModel->getFEs();
+    while ((elePtr = theEles()) != 0) {
+	Element *theEle = elePtr->getElement();
+	if (theEle != 0 && theEle->isSubdomain() == true) {
+	    Subdomain *theSub = (Subdomain *)theEle;
+	    if (theSub->isThreaded() == true)
+		theSub->startTask(task);
+	}
+    }
+}
+
+// int formElementsThreaded(bool formTangents);
+//	Forms the tangent (or residual) of the FE_Elements a block at a time,
+//	the FE_Elements of a block being shared among numThreads threads. 
+//	Each contribution is copied into storage for the block and once the 
+//	block is formed the contributions are added to the SOE serially in the
+//	same order as the serial loop, so the assembled system is identical 
+//	for any number of threads. FE_Elements that are not thread safe are 
+//	formed during the serial assembly of the block. With private storage
+//	the FE_Elements keep their own contributions, so all of them form one
+//	block and the contributions are added from where they were formed.
+
+int
+IncrementalIntegrator::formElementsThreaded(bool formTangents)
+{
+    int res = 0;
+
+    // gather the FE_Elements into an array
+    int numFEs = theAnalysisModel->getNumFE_Elements();
+    if (numFEs > sizeFEs) {
+	if (theFEs != 0)
+	    delete [] theFEs;
+	if (formedTangents != 0)
+	    delete [] formedTangents;
+	if (formedResiduals != 0)
+	    delete [] formedResiduals;
+	theFEs = new FE_Element *[numFEs];
+	formedTangents = new const Matrix *[numFEs];
+	formedResiduals = new const Vector *[numFEs];
+	sizeFEs = numFEs;
+    }
+
+    // the constant tangents may already have been added by resetTangent()
+    bool skipConstant = (formTangents == true && skipConstantFEs == true);
+
+    FE_Element *elePtr;
+    FE_EleIter &theEles = theAnalysisModel->getFEs();
+    numFEs = 0;
+    while ((elePtr = theEles()) != 0)
+	if (skipConstant == false || elePtr->isTangentConstant() == false)
+	    theFEs[numFEs++] = elePtr;
+
+    // the FE_Elements may keep their own contributions
+    bool ownStorage = false;
+    if (privateStorage == true || theAnalysisModel->hasPrivateStorage() == true)
+	if (theAnalysisModel->setPrivateStorage(privateStorage) == 0)
+	    ownStorage = privateStorage;
+
+    // make sure there is storage for a block
+    int blockSize = FE_BLOCK_SIZE_PER_THREAD*numThreads;
+    if (ownStorage == true)
+	blockSize = (numFEs > 0) ? numFEs : 1;
+    else if (blockSize > sizeBlock) {
+	Matrix **newTangents = new Matrix *[blockSize];
+	Vector **newResiduals = new Vector *[blockSize];
+	for (int i=0; i<sizeBlock; i++) {
+	    newTangents[i] = blockTangents[i];
+	    newResiduals[i] = blockResiduals[i];
+	}
+	for (int i=sizeBlock; i<blockSize; i++) {
+	    newTangents[i] = new Matrix();
+	    newResiduals[i] = new Vector();
+	}
+	if (blockTangents != 0)
+	    delete [] blockTangents;
+	if (blockResiduals != 0)
+	    delete [] blockResiduals;
+	blockTangents = newTangents;
+	blockResiduals = newResiduals;
+	sizeBlock = blockSize;
+    }
+
+    for (int start=0; start<numFEs; start+=blockSize) {
+	int end = start + blockSize;
+	if (end > numFEs)
+	    end = numFEs;
+
+	// form the contributions of the block
+#pragma omp parallel for num_threads(numThreads) schedule(dynamic,1)
+	for (int i=start; i<end; i++) {
+	    FE_Element *theFE = theFEs[i];
+	    if (theFE->isThreadSafe() == true) {
+		OPS_PROFILE_CLASS(theFE->getElement());
+		if (ownStorage == true) {
+		    if (formTangents == true)
+			formedTangents[i] = &(theFE->getTangent(this));
+		    else
+			formedResiduals[i] = &(theFE->getResidual(this));
+		} else {
+		    if (formTangents == true)
+			*(blockTangents[i-start]) = theFE->getTangent(this);
+		    else
+			*(blockResiduals[i-start]) = theFE->getResidual(this);
+		    formedTangents[i] = blockTangents[i-start];
+		    formedResiduals[i] = blockResiduals[i-start];
+		}
+	    }
+	}
+
+	// add them to the SOE in order
+	for (int i=start; i<end; i++) {
+	    FE_Element *theFE = theFEs[i];
+	    bool formed = theFE->isThreadSafe();
+	    OPS_PROFILE_CLASS(formed == true ? 0 : theFE->getElement());
+	    if (formTangents == true) {
+		const Matrix &theTangent = (formed == true) ? 
+		    *(formedTangents[i]) : theFE->getTangent(this);
+		if (theSOE->addA(theTangent, theFE->getID()) < 0) {
+		    opserr << "WARNING IncrementalIntegrator::formElementTangent -";
+		    opserr << " failed in addA for ID " << theFE->getID();
+		    res = -3;
+		}
+	    } else {
+		const Vector &theResidual = (formed == true) ? 
+		    *(formedResiduals[i]) : theFE->getResidual(this);
+		if (theSOE->addB(theResidual, theFE->getID()) < 0) {
+		    opserr << "WARNING IncrementalIntegrator::formElementResidual -";
+		    opserr << " failed in addB for ID " << theFE->getID();
+		    res = -2;
+		}
+	    }
+	}
+    }
+
+    return res;
+}
+
 /*
 int
 IncrementalIntegrator::setModalDampingFactors(const Vector &factors)
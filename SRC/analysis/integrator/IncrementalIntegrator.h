@@ -45,6 +45,7 @@ class ConvergenceTest;
 class FE_Element;
 class DOF_Group;
 class Vector;
+class Matrix;
 
 #define CURRENT_TANGENT 0
 #define INITIAL_TANGENT 1
@@ -70,6 +71,21 @@ class IncrementalIntegrator : public Integrator
     virtual int  formTangent(int statusFlag = CURRENT_TANGENT);    
     virtual int  formUnbalance(void);
 
+    // methods to set the number of threads used to form the FE_Elements
+    virtual int setNumThreads(int numThreads);
+    int getNumThreads(void) const;
+
+    // methods to have the tangents of the FE_Elements whose tangent is
+    // constant assembled once, the LinearSOE keeping their sum
+    virtual int setConstantTangents(bool flag);
+    bool getConstantTangents(void) const;
+
+    // methods to have each FE_Element and DOF_Group use its own tangent 
+    // and residual, so the threads form all the FE_Elements before any are
+    // added to the SOE
+    virtual int setPrivateStorage(bool flag);
+    bool getPrivateStorage(void) const;
+
     // pure virtual methods to define the FE_ELe and DOF_Group contributions
     virtual int formEleTangent(FE_Element *theEle) =0;
     virtual int formNodTangent(DOF_Group *theDof) =0;    
@@ -107,7 +123,10 @@ class IncrementalIntegrator : public Integrator
 
     virtual int  formNodalUnbalance(void);        
     virtual int  formElementResidual(void);            
+    virtual int  formElementTangent(void);            
+    int resetTangent(void);
     int statusFlag;
+    int numThreads;
 
     //    Vector *modalDampingValues;
     EigenSOE *theEigenSOE;
@@ -121,10 +140,36 @@ class IncrementalIntegrator : public Integrator
     Vector *tmpV2;
     
   private:
+    int formElementsThreaded(bool formTangents);
+    void startSubdomainTasks(int task);
+    int formConstantTangents(void);
+
     LinearSOE *theSOE;
     AnalysisModel *theAnalysisModel;
     ConvergenceTest *theTest;
 
+    // storage used when the FE_Elements are formed by a number of threads;
+    // contributions are formed a block at a time and then added to the
+    // SOE in the order of the FE_EleIter so results match a serial run
+    FE_Element **theFEs;
+    int sizeFEs;
+    Matrix **blockTangents;
+    Vector **blockResiduals;
+    int sizeBlock;
+    const Matrix **formedTangents;
+    const Vector **formedResiduals;
+    bool privateStorage;
+
+    // the sum of the constant FE_Element tangents is kept by the SOE and is
+    // valid while no parameter has been updated and the tangents of the 
+    // probe FE_Elements are unchanged; these are chosen to depend on the 
+    // stiffness, damping and mass coefficients
+    bool constantTangents;
+    bool skipConstantFEs;
+    FE_Element *probeFEs[3];
+    Matrix *probeTangents[3];
+    int parameterStamp;
+
 };
 
 #endif
@@ -44,6 +44,7 @@
 #include <DOF_Group.h>
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
+#include <Profiler.h>
 
 TransientIntegrator::TransientIntegrator(int clasTag)
 :IncrementalIntegrator(clasTag)
@@ -59,6 +60,8 @@ TransientIntegrator::~TransientIntegrator()
 int 
 TransientIntegrator::formTangent(int statFlag)
 {
+    OPS_PROFILE("IncrementalIntegrator::formTangent");
+
     int result = 0;
     statusFlag = statFlag;
 
@@ -73,7 +76,7 @@ TransientIntegrator::formTangent(int statFlag)
     // the loops to form and add the tangents are broken into two for 
     // efficiency when performing parallel computations
     
-    theLinSOE->zeroA();
+    this->resetTangent();
 
     // do modal damping
     bool inclModalMatrix=theModel->inclModalDampingMatrix();
@@ -97,14 +100,11 @@ TransientIntegrator::formTangent(int statFlag)
     }    
 
     // loop through the FE_Elements getting them to add the tangent    
-    FE_EleIter &theEles2 = theModel->getFEs();    
-    FE_Element *elePtr;    
-    while((elePtr = theEles2()) != 0)     {
-	if (theLinSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0) {
-	    opserr << "TransientIntegrator::formTangent() - failed to addA:ele\n";
-	    result = -2;
-	}
+    if (this->formElementTangent() < 0) {
+	opserr << "TransientIntegrator::formTangent() - failed to addA:ele\n";
+	result = -2;
     }
+
     return result;
 }
 
@@ -112,6 +112,8 @@ TransientIntegrator::formTangent(int statFlag)
     
 int
 TransientIntegrator::formUnbalance(void) {
+    OPS_PROFILE("IncrementalIntegrator::formUnbalance");
+
     LinearSOE *theLinSOE = this->getLinearSOE();
     AnalysisModel *theModel = this->getAnalysisModel();
 
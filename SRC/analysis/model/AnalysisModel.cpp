@@ -63,7 +63,8 @@ AnalysisModel::AnalysisModel(int theClassTag)
 :MovableObject(theClassTag),
  myDomain(0), myHandler(0),
  myDOFGraph(0), myGroupGraph(0),
- numFE_Ele(0), numDOF_Grp(0), numEqn(0)
+ numFE_Ele(0), numDOF_Grp(0), numEqn(0),
+ privateStorage(false), storageChanged(false), theStorage(0), sizeStorage(0)
 {
     theFEs     = new ArrayOfTaggedObjects(1024);
     theDOFs    =  new ArrayOfTaggedObjects(1024);
@@ -77,7 +78,8 @@ AnalysisModel::AnalysisModel()
 :MovableObject(AnaMODEL_TAGS_AnalysisModel),
  myDomain(0), myHandler(0),
  myDOFGraph(0), myGroupGraph(0),
- numFE_Ele(0), numDOF_Grp(0), numEqn(0)
+ numFE_Ele(0), numDOF_Grp(0), numEqn(0),
+ privateStorage(false), storageChanged(false), theStorage(0), sizeStorage(0)
 {
   theFEs     = new ArrayOfTaggedObjects(256);
   theDOFs    = new ArrayOfTaggedObjects(256);
@@ -90,7 +92,8 @@ AnalysisModel::AnalysisModel(TaggedObjectStorage &theFes, TaggedObjectStorage &t
 :MovableObject(AnaMODEL_TAGS_AnalysisModel),
  myDomain(0), myHandler(0),
  myDOFGraph(0), myGroupGraph(0),
- numFE_Ele(0), numDOF_Grp(0), numEqn(0)
+ numFE_Ele(0), numDOF_Grp(0), numEqn(0),
+ privateStorage(false), storageChanged(false), theStorage(0), sizeStorage(0)
 {
   theFEs     = &theFes;
   theDOFs    = &theDofs;
@@ -125,6 +128,9 @@ AnalysisModel::~AnalysisModel()
   if (myDOFGraph != 0) {
     delete myDOFGraph;
   }
+
+  if (theStorage != 0)
+    delete [] theStorage;
 }    
 
 void
@@ -159,6 +165,7 @@ AnalysisModel::addFE_Element(FE_Element *theElement)
   if (result == true) {
     theElement->setAnalysisModel(*this);
     numFE_Ele++;
+    storageChanged = true;
     return true;  // o.k.
   } else
     return false;
@@ -195,6 +202,7 @@ AnalysisModel::addDOF_Group(DOF_Group *theGroup)
   bool result = theDOFs->addComponent(theGroup);
   if (result == true) {
     numDOF_Grp++;
+    storageChanged = true;
     return true;  // o.k.
   } else
     return false;
@@ -219,6 +227,14 @@ AnalysisModel::clearAll(void)
     numFE_Ele =0;
     numDOF_Grp = 0;
     numEqn = 0;    
+
+    // the objects using the storage are gone
+    if (theStorage != 0)
+	delete [] theStorage;
+    theStorage = 0;
+    sizeStorage = 0;
+    privateStorage = false;
+    storageChanged = false;
 }
 
 void
@@ -249,6 +265,99 @@ AnalysisModel::getNumDOF_Groups(void) const
 }
 
 
+// int setPrivateStorage(bool flag);
+//	Method to give each FE_Element and DOF_Group its own tangent and 
+//	residual, all in one array sized for the objects in the model; it is 
+//	laid out again if objects have been added since. With flag false the
+//	objects use the class wide tangent and residual again.
+
+int
+AnalysisModel::setPrivateStorage(bool flag)
+{
+    if (flag == privateStorage && storageChanged == false)
+	return 0;
+
+    FE_Element *elePtr;
+    DOF_Group *dofPtr;
+
+    if (flag == false) {
+	FE_EleIter &theEles = this->getFEs();
+	while ((elePtr = theEles()) != 0)
+	    elePtr->setStorage(0);
+	DOF_GrpIter &theGroups = this->getDOFs();
+	while ((dofPtr = theGroups()) != 0)
+	    dofPtr->setStorage(0);
+
+	if (theStorage != 0)
+	    delete [] theStorage;
+	theStorage = 0;
+	sizeStorage = 0;
+	privateStorage = false;
+	storageChanged = false;
+	return 0;
+    }
+
+    // determine the size of the array
+    int size = 0;
+    FE_EleIter &theEles1 = this->getFEs();
+    while ((elePtr = theEles1()) != 0)
+	size += elePtr->getStorageSize();
+    DOF_GrpIter &theGroups1 = this->getDOFs();
+    while ((dofPtr = theGroups1()) != 0)
+	size += dofPtr->getStorageSize();
+
+    if (size > sizeStorage) {
+	if (theStorage != 0)
+	    delete [] theStorage;
+	theStorage = new double[size];
+	if (theStorage == 0) {
+	    opserr << "WARNING AnalysisModel::setPrivateStorage() - ";
+	    opserr << "ran out of memory for array of size " << size << endln;
+	    sizeStorage = 0;
+	    privateStorage = false;
+	    return -1;
+	}
+	sizeStorage = size;
+    }
+
+    // and give each object its part of it
+    double *data = theStorage;
+    FE_EleIter &theEles2 = this->getFEs();
+    while ((elePtr = theEles2()) != 0) {
+	int sizeEle = elePtr->getStorageSize();
+	if (sizeEle > 0) {
+	    elePtr->setStorage(data);
+	    data += sizeEle;
+	}
+    }
+    DOF_GrpIter &theGroups2 = this->getDOFs();
+    while ((dofPtr = theGroups2()) != 0) {
+	int sizeGroup = dofPtr->getStorageSize();
+	if (sizeGroup > 0) {
+	    dofPtr->setStorage(data);
+	    data += sizeGroup;
+	}
+    }
+
+    privateStorage = true;
+    storageChanged = false;
+    return 0;
+}
+
+bool
+AnalysisModel::hasPrivateStorage(void) const
+{
+    return privateStorage;
+}
+
+
+int
+AnalysisModel::getNumFE_Elements(void) const
+{
+  return numFE_Ele;
+}
+
+
 DOF_Group *
 AnalysisModel::getDOF_GroupPtr(int tag)
 {
@@ -35,7 +35,8 @@
 // and providing access to the FE_Element and DOF_Group objects that the 
 // ConstraintHandler creates. It is also responsible for updating the 
 // response quantities at the DOF_Groups and for triggering methods 
-// in the associated Domain.
+// in the associated Domain. Optionally it gives each FE_Element and 
+// DOF_Group its own tangent and residual, laid out in a single array.
 //
 // What: "@(#) AnalysisModel.h, revA"
 
@@ -67,9 +68,17 @@ class AnalysisModel: public MovableObject
     virtual void clearAll(void);
     virtual void clearDOFGraph(void);
     virtual void clearDOFGroupGraph(void);
+
+    // method to give the FE_Elements and DOF_Groups their own tangent and
+    // residual (flag true), so that they may be formed at the same time 
+    // and the results stay valid for assembly, or to use the class wide
+    // objects again (flag false)
+    int setPrivateStorage(bool flag);
+    bool hasPrivateStorage(void) const;
     
     // methods to access the FE_Elements and DOF_Groups and their numbers
     virtual int getNumDOF_Groups(void) const;		
+    virtual int getNumFE_Elements(void) const;		
     virtual DOF_Group *getDOF_GroupPtr(int tag);	
     virtual FE_EleIter &getFEs();
     virtual DOF_GrpIter &getDOFs();
@@ -140,6 +149,11 @@ class AnalysisModel: public MovableObject
     
     FE_EleIter    *theFEiter;     
     DOF_GrpIter   *theDOFiter;    
+
+    bool privateStorage;       // objects are using theStorage
+    bool storageChanged;       // objects added since it was laid out
+    double *theStorage;
+    int sizeStorage;
 };
 
 #endif
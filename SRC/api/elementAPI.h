@@ -180,6 +180,8 @@ extern "C" int        OPS_GetIntInput(int *numData, int*data);
 extern "C" int        OPS_SetIntOutput(int *numData, int*data);
 extern "C" int        OPS_GetDoubleInput(int *numData, double *data);
 extern "C" int        OPS_SetDoubleOutput(int *numData, double *data);
+extern "C" double    *OPS_GetDoubleOutputArray(int numRows, int numCols); // row-major staging storage
+extern "C" int        OPS_SetDoubleOutputArray(void); // returns the filled array
 extern "C" const char *OPS_GetString(void); // does a strcpy
 extern "C" int        OPS_SetString(const char*); 
 //extern "C" int        OPS_GetString(char *cArray, int sizeArray); // does a strcpy
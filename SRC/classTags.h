@@ -55,12 +55,14 @@
 #define EigenSOE_TAGS_FullGenEigenSOE   4
 #define EigenSOE_TAGS_ArpackSOE 	5
 #define EigenSOE_TAGS_GeneralArpackSOE 	6
+#define EigenSOE_TAGS_SymSparseEigenSOE 	7
 #define EigenSOLVER_TAGS_BandArpackSolver 	1
 #define EigenSOLVER_TAGS_SymArpackSolver 	2
 #define EigenSOLVER_TAGS_SymBandEigenSolver     3
 #define EigenSOLVER_TAGS_FullGenEigenSolver  4
 #define EigenSOLVER_TAGS_ArpackSolver  5
 #define EigenSOLVER_TAGS_GeneralArpackSolver  6
+#define EigenSOLVER_TAGS_SymSparseEigenSolver  7
 
 #define EigenALGORITHM_TAGS_Frequency 1
 #define EigenALGORITHM_TAGS_Standard  2
@@ -858,6 +860,7 @@
 #define LinSOE_TAGS_PFEMLinSOE 26
 #define LinSOE_TAGS_SProfileSPDLinSOE		27
 #define LinSOE_TAGS_PFEMCompressibleLinSOE 28
+#define LinSOE_TAGS_SupernodalSymLinSOE 29
 
 
 #define SOLVER_TAGS_FullGenLinLapackSolver  	1
@@ -891,6 +894,8 @@
 #define SOLVER_TAGS_CulaSparseS4                        29
 #define SOLVER_TAGS_CulaSparseS5                        30
 #define SOLVER_TAGS_CuSP                                31
+#define SOLVER_TAGS_SupernodalSymLinSolver              32
+#define SOLVER_TAGS_SparseKrylovSolver                  33
 
 #define RECORDER_TAGS_ElementRecorder		1
 #define RECORDER_TAGS_NodeRecorder		2
@@ -923,6 +928,8 @@
 #define OPS_STREAM_TAGS_ChannelStream           9
 #define OPS_STREAM_TAGS_DataTurbineStream      10
 #define OPS_STREAM_TAGS_DataFileStreamAdd      11
+#define OPS_STREAM_TAGS_ChunkedBinaryFileStream 12
+#define OPS_STREAM_TAGS_AsyncStream             13
 
 
 #define DomDecompALGORITHM_TAGS_DomainDecompAlgo 1
@@ -56,13 +56,13 @@ Journal of Structural Engineering, 133(2):155-165.
 #include <CorotCrdTransf2d.h>
 
 // initialize static variables
-Matrix CorotCrdTransf2d::Tlg(6,6);
-Matrix CorotCrdTransf2d::Tbl(3,6);
-Vector CorotCrdTransf2d::uxg(3); 
-Vector CorotCrdTransf2d::pg(6); 
-Vector CorotCrdTransf2d::dub(3); 
-Vector CorotCrdTransf2d::Dub(3); 
-Matrix CorotCrdTransf2d::kg(6,6);
+OPS_THREAD_LOCAL Matrix CorotCrdTransf2d::Tlg(6,6);
+OPS_THREAD_LOCAL Matrix CorotCrdTransf2d::Tbl(3,6);
+OPS_THREAD_LOCAL Vector CorotCrdTransf2d::uxg(3); 
+OPS_THREAD_LOCAL Vector CorotCrdTransf2d::pg(6); 
+OPS_THREAD_LOCAL Vector CorotCrdTransf2d::dub(3); 
+OPS_THREAD_LOCAL Vector CorotCrdTransf2d::Dub(3); 
+OPS_THREAD_LOCAL Matrix CorotCrdTransf2d::kg(6,6);
 
 
 // constructor:
@@ -206,7 +206,7 @@ CorotCrdTransf2d::update(void)
     const Vector &dispI = nodeIPtr->getTrialDisp();
     const Vector &dispJ = nodeJPtr->getTrialDisp();
     
-    static Vector ug(6);    
+    static OPS_THREAD_LOCAL Vector ug(6);    
     for (int i = 0; i < 3; i++) {
         ug(i  ) = dispI(i);
         ug(i+3) = dispJ(i);
@@ -232,7 +232,7 @@ CorotCrdTransf2d::update(void)
     }
     
     // transform global end displacements to local coordinates
-    static Vector ul(6);
+    static OPS_THREAD_LOCAL Vector ul(6);
     
     ul(0) = cosTheta*ug(0) + sinTheta*ug(1);
     ul(1) = cosTheta*ug(1) - sinTheta*ug(0);
@@ -259,7 +259,7 @@ int
 CorotCrdTransf2d::compElemtLengthAndOrient(void)
 {
     // element projection
-    static Vector dx(2);
+    static OPS_THREAD_LOCAL Vector dx(2);
     
     if (nodeOffsets == true) 
       dx = (nodeJPtr->getCrds() + nodeJOffset) - (nodeIPtr->getCrds() + nodeIOffset);  
@@ -422,14 +422,14 @@ CorotCrdTransf2d::getBasicTrialVel(void)
 	const Vector &vel1 = nodeIPtr->getTrialVel();
 	const Vector &vel2 = nodeJPtr->getTrialVel();
 	
-	static double vg[6];
+	static OPS_THREAD_LOCAL double vg[6];
 	for (int i = 0; i < 3; i++) {
 		vg[i]   = vel1(i);
 		vg[i+3] = vel2(i);
 	}
 	
     // transform global end velocities to local coordinates
-    static Vector vl(6);
+    static OPS_THREAD_LOCAL Vector vl(6);
 
     vl(0) = cosTheta*vg[0] + sinTheta*vg[1];
     vl(1) = cosTheta*vg[1] - sinTheta*vg[0];
@@ -442,7 +442,7 @@ CorotCrdTransf2d::getBasicTrialVel(void)
     Lydot = vl(4) - vl(1);
 
     // transform local velocities to basic coordinates
-    static Vector vb(3);
+    static OPS_THREAD_LOCAL Vector vb(3);
 	
     vb(0) = (Lx*Lxdot + Ly*Lydot)/Ln;
     vb(1) = vl(2) - (Lx*Lydot - Ly*Lxdot)/pow(Ln,2);
@@ -459,7 +459,7 @@ CorotCrdTransf2d::getBasicTrialAccel(void)
 	const Vector &vel1 = nodeIPtr->getTrialVel();
 	const Vector &vel2 = nodeJPtr->getTrialVel();
 	
-	static double vg[6];
+	static OPS_THREAD_LOCAL double vg[6];
 	int i;
 	for (i = 0; i < 3; i++) {
 		vg[i]   = vel1(i);
@@ -467,7 +467,7 @@ CorotCrdTransf2d::getBasicTrialAccel(void)
 	}
 	
     // transform global end velocities to local coordinates
-    static Vector vl(6);
+    static OPS_THREAD_LOCAL Vector vl(6);
 
     vl(0) = cosTheta*vg[0] + sinTheta*vg[1];
     vl(1) = cosTheta*vg[1] - sinTheta*vg[0];
@@ -483,14 +483,14 @@ CorotCrdTransf2d::getBasicTrialAccel(void)
 	const Vector &accel1 = nodeIPtr->getTrialAccel();
 	const Vector &accel2 = nodeJPtr->getTrialAccel();
 	
-	static double ag[6];
+	static OPS_THREAD_LOCAL double ag[6];
 	for (i = 0; i < 3; i++) {
 		ag[i]   = accel1(i);
 		ag[i+3] = accel2(i);
 	}
 	
     // transform global end accelerations to local coordinates
-    static Vector al(6);
+    static OPS_THREAD_LOCAL Vector al(6);
 
     al(0) = cosTheta*ag[0] + sinTheta*ag[1];
     al(1) = cosTheta*ag[1] - sinTheta*ag[0];
@@ -503,7 +503,7 @@ CorotCrdTransf2d::getBasicTrialAccel(void)
     Lydotdot = al(4) - al(1);
 
     // transform local accelerations to basic coordinates
-    static Vector ab(3);
+    static OPS_THREAD_LOCAL Vector ab(3);
 	
     ab(0) = (Lxdot*Lxdot + Lx*Lxdotdot + Ly*Lydotdot + Lydot*Lydot)/Ln
           - pow(Lx*Lxdot + Ly*Lydot,2)/pow(Ln,3);
@@ -521,7 +521,7 @@ CorotCrdTransf2d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
     
     // transform resisting forces from the basic system to local coordinates
     this->compTransfMatrixBasicLocal(Tbl);
-    static Vector pl(6);
+    static OPS_THREAD_LOCAL Vector pl(6);
     pl.addMatrixTransposeVector(0.0, Tbl, pb, 1.0);    // pl = Tbl ^ pb;
     
     // add end forces due to element p0 loads
@@ -564,7 +564,7 @@ const Matrix &
 CorotCrdTransf2d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 {
     // transform tangent stiffness matrix from the basic system to local coordinates
-    static Matrix kl(6,6);
+    static OPS_THREAD_LOCAL Matrix kl(6,6);
     this->compTransfMatrixBasicLocal(Tbl);
     kl.addMatrixTripleProduct(0.0, Tbl, kb, 1.0);      // kl = Tbl ^ kb * Tbl;
     
@@ -724,8 +724,8 @@ const Matrix &
 CorotCrdTransf2d::getInitialGlobalStiffMatrix(const Matrix &kb)
 {
     // transform tangent stiffness matrix from the basic system to local coordinates
-    static Matrix kl(6,6);
-    static Matrix T(3,6);
+    static OPS_THREAD_LOCAL Matrix kl(6,6);
+    static OPS_THREAD_LOCAL Matrix T(3,6);
     
     T(0,0) = -1.0;
     T(1,0) = 0;
@@ -915,7 +915,7 @@ CorotCrdTransf2d::getGeomStiffMatrix(const Vector &pb) const
     c2 = cosAlpha*cosAlpha;
     cs = sinAlpha*cosAlpha;
     
-    static Matrix kg0(6,6), kg12(6,6);
+    static OPS_THREAD_LOCAL Matrix kg0(6,6), kg12(6,6);
     kg0.Zero();
     
     kg12.Zero();
@@ -944,7 +944,7 @@ CorotCrdTransf2d::getGeomStiffMatrix(const Vector &pb) const
     
     kg12 *= (pb(1)+pb(2))/(Ln*Ln);
     
-    static Matrix kg(6,6);
+    static OPS_THREAD_LOCAL Matrix kg(6,6);
     // kg = kg0 + kg12;
     kg = kg0;
     kg.addMatrix(1.0, kg12, 1.0);
@@ -1095,7 +1095,7 @@ CorotCrdTransf2d::getGlobalMatrixFromLocal(const Matrix &ml)
 const Vector &
 CorotCrdTransf2d::getPointGlobalCoordFromLocal(const Vector &xl)
 {
-    static Vector xg(3);
+    static OPS_THREAD_LOCAL Vector xg(3);
     opserr << " CorotCrdTransf2d::getPointGlobalCoordFromLocal: not implemented yet" ;
     
     return xg;  
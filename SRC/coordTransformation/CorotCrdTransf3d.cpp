@@ -43,17 +43,17 @@
 #include <CorotCrdTransf3d.h>
 
 // initialize static variables
-Matrix CorotCrdTransf3d::RI(3,3); 
-Matrix CorotCrdTransf3d::RJ(3,3); 
-Matrix CorotCrdTransf3d::Rbar(3,3); 
-Matrix CorotCrdTransf3d::e(3,3); 
+OPS_THREAD_LOCAL Matrix CorotCrdTransf3d::RI(3,3); 
+OPS_THREAD_LOCAL Matrix CorotCrdTransf3d::RJ(3,3); 
+OPS_THREAD_LOCAL Matrix CorotCrdTransf3d::Rbar(3,3); 
+OPS_THREAD_LOCAL Matrix CorotCrdTransf3d::e(3,3); 
 Matrix CorotCrdTransf3d::Tp(6,7); 
-Matrix CorotCrdTransf3d::T(7,12);
-Matrix CorotCrdTransf3d::Tlg(12,12);
-Matrix CorotCrdTransf3d::kg(12,12);
-Matrix CorotCrdTransf3d::Lr2(12,3);
-Matrix CorotCrdTransf3d::Lr3(12,3);
-Matrix CorotCrdTransf3d::A(3,3);
+OPS_THREAD_LOCAL Matrix CorotCrdTransf3d::T(7,12);
+OPS_THREAD_LOCAL Matrix CorotCrdTransf3d::Tlg(12,12);
+OPS_THREAD_LOCAL Matrix CorotCrdTransf3d::kg(12,12);
+OPS_THREAD_LOCAL Matrix CorotCrdTransf3d::Lr2(12,3);
+OPS_THREAD_LOCAL Matrix CorotCrdTransf3d::Lr3(12,3);
+OPS_THREAD_LOCAL Matrix CorotCrdTransf3d::A(3,3);
 
 
 // constructor:
@@ -283,9 +283,9 @@ CorotCrdTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
 	initialDispChecked = true;
     }
     
-    static Vector XAxis(3);
-    static Vector YAxis(3);
-    static Vector ZAxis(3);
+    static OPS_THREAD_LOCAL Vector XAxis(3);
+    static OPS_THREAD_LOCAL Vector YAxis(3);
+    static OPS_THREAD_LOCAL Vector ZAxis(3);
     
     // get 3by3 rotation matrix
     if ((error = this->getLocalAxes(XAxis, YAxis, ZAxis)))
@@ -324,8 +324,8 @@ CorotCrdTransf3d::update(void)
      // get the iterative spins dAlphaI and dAlphaJ 
      // (rotational displacement increments at both nodes)
      
-      static Vector dAlphaI(3);
-      static Vector dAlphaJ(3);
+      static OPS_THREAD_LOCAL Vector dAlphaI(3);
+      static OPS_THREAD_LOCAL Vector dAlphaJ(3);
       
        
         for (k = 0; k < 3; k++)
@@ -336,8 +336,8 @@ CorotCrdTransf3d::update(void)
     **************************************************************/
     
     // determine global displacement increments from last iteration
-    static Vector dispI(6);
-    static Vector dispJ(6);
+    static OPS_THREAD_LOCAL Vector dispI(6);
+    static OPS_THREAD_LOCAL Vector dispJ(6);
     dispI = nodeIPtr->getTrialDisp();
     dispJ = nodeJPtr->getTrialDisp();
     
@@ -354,8 +354,8 @@ CorotCrdTransf3d::update(void)
     // get the iterative spins dAlphaI and dAlphaJ 
     // (rotational displacement increments at both nodes)
     
-    static Vector dAlphaI(3);
-    static Vector dAlphaJ(3);
+    static OPS_THREAD_LOCAL Vector dAlphaI(3);
+    static OPS_THREAD_LOCAL Vector dAlphaJ(3);
     
     for (k = 0; k < 3; k++) {
         dAlphaI(k) = dispI(k+3) - alphaI(k);
@@ -367,8 +367,8 @@ CorotCrdTransf3d::update(void)
     /************** END OF REPLACEMENT **************************/
     
     // update the nodal triads TI and RJ using quaternions
-    static Vector dAlphaIq(4);
-    static Vector dAlphaJq(4);
+    static OPS_THREAD_LOCAL Vector dAlphaIq(4);
+    static OPS_THREAD_LOCAL Vector dAlphaJq(4);
 
     dAlphaIq = this->getQuaternionFromPseudoRotVector (dAlphaI);
     dAlphaJq = this->getQuaternionFromPseudoRotVector (dAlphaJ);
@@ -380,9 +380,9 @@ CorotCrdTransf3d::update(void)
     RJ = this->getRotationMatrixFromQuaternion (alphaJq);
 
     // compute the mean nodal triad
-    static Matrix dRgamma(3,3); 
-    static Vector gammaq(4);
-    static Vector gammaw(3);
+    static OPS_THREAD_LOCAL Matrix dRgamma(3,3); 
+    static OPS_THREAD_LOCAL Vector gammaq(4);
+    static OPS_THREAD_LOCAL Vector gammaw(3);
     
     dRgamma.Zero();
     
@@ -404,17 +404,17 @@ CorotCrdTransf3d::update(void)
             Rbar.addMatrixProduct(0.0, dRgamma, RI, 1.0);
             
             // compute the base vectors e1, e2, e3
-            static Vector e1(3);
-            static Vector e2(3);
-            static Vector e3(3);
+            static OPS_THREAD_LOCAL Vector e1(3);
+            static OPS_THREAD_LOCAL Vector e2(3);
+            static OPS_THREAD_LOCAL Vector e3(3);
             
             // relative translation displacements
-            static Vector dJI(3);    
+            static OPS_THREAD_LOCAL Vector dJI(3);    
             for (int kk = 0; kk < 3; kk++)
                 dJI(kk) = dispJ(kk) - dispI(kk);
             
             // element projection
-            static Vector xJI(3);
+            static OPS_THREAD_LOCAL Vector xJI(3);
             xJI = nodeJPtr->getCrds() - nodeIPtr->getCrds();
             
             if (nodeIInitialDisp != 0) {
@@ -429,7 +429,7 @@ CorotCrdTransf3d::update(void)
                 xJI(2) += nodeJInitialDisp[2];
             }
             
-            static Vector dx(3);
+            static OPS_THREAD_LOCAL Vector dx(3);
             // dx = xJI + dJI;  
             dx = xJI;
             dx.addVector (1.0, dJI, 1.0);
@@ -449,9 +449,9 @@ CorotCrdTransf3d::update(void)
             
             // 'rotate' the mean rotation matrix Rbar on to e1 to 
             // obtain e2 and e3 (using the 'mid-point' procedure)
-            static Vector r1(3);
-            static Vector r2(3);
-            static Vector r3(3);
+            static OPS_THREAD_LOCAL Vector r1(3);
+            static OPS_THREAD_LOCAL Vector r2(3);
+            static OPS_THREAD_LOCAL Vector r3(3);
             
             for (k = 0; k < 3; k ++)
             {
@@ -463,7 +463,7 @@ CorotCrdTransf3d::update(void)
             //    e2 = r2 - (e1 + r1)*((r2^ e1)*0.5);
             // e3 = r3 - (e1 + r1)*((r3^ e1)*0.5);
             
-            static Vector tmp(3);
+            static OPS_THREAD_LOCAL Vector tmp(3);
             tmp = e1;
             tmp += r1;
             
@@ -479,8 +479,8 @@ CorotCrdTransf3d::update(void)
             e3.addVector(-1.0,  r3, 1.0);
             
             // compute the basic rotations
-            static Vector rI1(3), rI2(3), rI3(3);
-            static Vector rJ1(3), rJ2(3), rJ3(3);
+            static OPS_THREAD_LOCAL Vector rI1(3), rI2(3), rI3(3);
+            static OPS_THREAD_LOCAL Vector rJ1(3), rJ2(3), rJ3(3);
             
             for (k = 0; k < 3; k ++)
             {
@@ -525,10 +525,10 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
     int i, j, k;
     
     //opserr << "comprTransfMatrixBasicGlobal: *****************************\n";
-    static Vector r1(3), r2(3), r3(3);
-    static Vector e1(3), e2(3), e3(3);
-    static Vector rI1(3), rI2(3), rI3(3);
-    static Vector rJ1(3), rJ2(3), rJ3(3);
+    static OPS_THREAD_LOCAL Vector r1(3), r2(3), r3(3);
+    static OPS_THREAD_LOCAL Vector e1(3), e2(3), e3(3);
+    static OPS_THREAD_LOCAL Vector rI1(3), rI2(3), rI3(3);
+    static OPS_THREAD_LOCAL Vector rJ1(3), rJ2(3), rJ3(3);
     
     for (k = 0; k < 3; k ++)
     {
@@ -551,7 +551,7 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
     
     // compute the transformation matrix from the basic to the
     // global system
-    static Matrix I(3,3);
+    static OPS_THREAD_LOCAL Matrix I(3,3);
     
     //   A = (1/Ln)*(I - e1*e1');
     for (i = 0; i < 3; i++)
@@ -564,8 +564,8 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
         Lr2 = this->getLMatrix (r2);
         Lr3 = this->getLMatrix (r3);
         
-        static Matrix Sr1(3,3), Sr2(3,3), Sr3(3,3);
-        static Vector Se(3), At(3);
+        static OPS_THREAD_LOCAL Matrix Sr1(3,3), Sr2(3,3), Sr3(3,3);
+        static OPS_THREAD_LOCAL Vector Se(3), At(3);
         
         //   T1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',        O', O']';
         //   T2 = [(A*rI2)', (-S(rI2)*e1 + S(rI1)*e2)', -(A*rI2)', O']';
@@ -658,7 +658,7 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
         }
         
         // setup tranformation matrix
-        static Vector Lr(12);
+        static OPS_THREAD_LOCAL Vector Lr(12);
         
         // T(:,1) += Lr3*rI2 - Lr2*rI3;
         // T(:,2) +=           Lr2*rI1;
@@ -725,10 +725,10 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
     int i, j, k;
     
     //opserr << "comprTransfMatrixBasicGlobal: *****************************\n";
-    static Vector r1(3), r2(3), r3(3);
-    static Vector e1(3), e2(3), e3(3);
-    static Vector rI1(3), rI2(3), rI3(3);
-    static Vector rJ1(3), rJ2(3), rJ3(3);
+    static OPS_THREAD_LOCAL Vector r1(3), r2(3), r3(3);
+    static OPS_THREAD_LOCAL Vector e1(3), e2(3), e3(3);
+    static OPS_THREAD_LOCAL Vector rI1(3), rI2(3), rI3(3);
+    static OPS_THREAD_LOCAL Vector rJ1(3), rJ2(3), rJ3(3);
     
     for (k = 0; k < 3; k ++)
     {
@@ -751,7 +751,7 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
     
     // compute the transformation matrix from the basic to the
     // global system
-    static Matrix I(3,3);
+    static OPS_THREAD_LOCAL Matrix I(3,3);
     
     //   A = (1/Ln)*(I - e1*e1');
     for (i = 0; i < 3; i++)
@@ -784,8 +784,8 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
         // opserr << "Lr2: " << Lr2;
         // opserr << "Lr3: " << Lr3;
         
-        static Matrix Sr1(3,3), Sr2(3,3), Sr3(3,3);
-        static Vector Se(3), At(3);
+        static OPS_THREAD_LOCAL Matrix Sr1(3,3), Sr2(3,3), Sr3(3,3);
+        static OPS_THREAD_LOCAL Vector Se(3), At(3);
         
         
         // O = zeros(3,1);
@@ -796,12 +796,12 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
         // hJ2 = [(A*rJ3)', O', -(A*rJ3)', (-S(rJ3)*e1 + S(rJ1)*e3)']';
         // hJ3 = [(A*rJ2)', O', -(A*rJ2)', (-S(rJ2)*e1 + S(rJ1)*e2)']';
         
-        static Vector hI1(12);
-        static Vector hI2(12);
-        static Vector hI3(12);
-        static Vector hJ1(12);
-        static Vector hJ2(12);
-        static Vector hJ3(12);
+        static OPS_THREAD_LOCAL Vector hI1(12);
+        static OPS_THREAD_LOCAL Vector hI2(12);
+        static OPS_THREAD_LOCAL Vector hI3(12);
+        static OPS_THREAD_LOCAL Vector hJ1(12);
+        static OPS_THREAD_LOCAL Vector hJ2(12);
+        static OPS_THREAD_LOCAL Vector hJ3(12);
         
         Sr1 = this->getSkewSymMatrix(rI1);
         Sr2 = this->getSkewSymMatrix(rI2);
@@ -894,7 +894,7 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
         
         // T = F'
         T.Zero();
-        static Vector Lr(12);
+        static OPS_THREAD_LOCAL Vector Lr(12);
         
         // f1 =  [-e1' O' e1' O'];
         for (i=0; i<3; i++) {
@@ -902,8 +902,8 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
             T(i+3,0) = e1(i);
         }
         
-        static Vector thetaI(3);
-        static Vector thetaJ(3);
+        static OPS_THREAD_LOCAL Vector thetaI(3);
+        static OPS_THREAD_LOCAL Vector thetaJ(3);
         
         
         thetaI(0) = ul(0);
@@ -987,7 +987,7 @@ CorotCrdTransf3d::compTransfMatrixLocalGlobal(Matrix &Tlg)
 const Vector &
 CorotCrdTransf3d::getBasicTrialDisp(void)
 {
-    static Vector ub(6);
+    static OPS_THREAD_LOCAL Vector ub(6);
     
     // use transformation matrix to renumber the degrees of freedom
     ub.addMatrixVector(0.0, Tp, ul, 1.0);
@@ -999,8 +999,8 @@ CorotCrdTransf3d::getBasicTrialDisp(void)
 const Vector &
 CorotCrdTransf3d::getBasicIncrDeltaDisp(void)
 {
-    static Vector dub(6);
-    static Vector dul(7);
+    static OPS_THREAD_LOCAL Vector dub(6);
+    static OPS_THREAD_LOCAL Vector dul(7);
     
     // dul = ul - ulpr;
     dul = ul;
@@ -1016,8 +1016,8 @@ CorotCrdTransf3d::getBasicIncrDeltaDisp(void)
 const Vector &
 CorotCrdTransf3d::getBasicIncrDisp(void)
 {
-    static Vector Dub(6);
-    static Vector Dul(7);
+    static OPS_THREAD_LOCAL Vector Dub(6);
+    static OPS_THREAD_LOCAL Vector Dul(7);
     
     // Dul = ul - ulcommit;
     Dul = ul;
@@ -1036,7 +1036,7 @@ CorotCrdTransf3d::getBasicTrialVel(void)
     opserr << "WARNING CorotCrdTransf3d::getBasicTrialVel()"
         << " - has not been implemented yet. Returning zeros." << endln;
     
-    static Vector dummy(6);
+    static OPS_THREAD_LOCAL Vector dummy(6);
     return dummy;
 }
 
@@ -1047,7 +1047,7 @@ CorotCrdTransf3d::getBasicTrialAccel(void)
     opserr << "WARNING CorotCrdTransf3d::getBasicTrialAccel()"
         << " - has not been implemented yet. Returning zeros." << endln;
     
-    static Vector dummy(6);
+    static OPS_THREAD_LOCAL Vector dummy(6);
     return dummy;
 }
 
@@ -1059,7 +1059,7 @@ CorotCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
     
     //   opserr << "basic forces: " << pb;  
     // transform resisting forces from the basic system to local coordinates
-    static Vector pl(7);
+    static OPS_THREAD_LOCAL Vector pl(7);
     pl.addMatrixTransposeVector(0.0, Tp, pb, 1.0);    // pl = Tp ^ pb;
     //opserr << "pl: " << pl;
     // Add effects of member loads
@@ -1071,7 +1071,7 @@ CorotCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
     //pl(8) += p0(4);
     
     // transform resisting forces  from local to global coordinates
-    static Vector pg(12);
+    static OPS_THREAD_LOCAL Vector pg(12);
     pg.addMatrixTransposeVector(0.0, T, pl, 1.0);   // pg = T ^ pl; residual
     //opserr << "pg: " << pg;
     
@@ -1093,14 +1093,14 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
     
     int i, j, k;   
     // transform tangent stiffness matrix from the basic system to local coordinates
-    static Matrix kl(7,7);
+    static OPS_THREAD_LOCAL Matrix kl(7,7);
     kl.addMatrixTripleProduct(0.0, Tp, kb, 1.0);      // kl = Tp ^ kb * Tp;
 
     //    opserr << "kb: " << kb;
     //    opserr << "Tp: " << Tp;
     
     // transform resisting forces from the basic system to local coordinates
-    static Vector pl(7);
+    static OPS_THREAD_LOCAL Vector pl(7);
     pl.addMatrixTransposeVector(0.0, Tp, pb, 1.0);    // pl = Tp ^ pb;
     
     // transform tangent  stiffness matrix from local to global coordinates
@@ -1109,16 +1109,16 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
     // compute the tangent stiffness matrix in global coordinates
     kg.addMatrixTripleProduct(0.0, T, kl, 1.0);
     
-    static Vector m(6);
+    static OPS_THREAD_LOCAL Vector m(6);
     for (i = 0; i < 6; i++)
         m(i) = pl(i)/(2*cos(ul(i)));
     
     // compute the basic rotations
     
-    static Vector e1(3), e2(3), e3(3);
-    static Vector r1(3), r2(3), r3(3);
-    static Vector rI1(3), rI2(3), rI3(3);
-    static Vector rJ1(3), rJ2(3), rJ3(3);
+    static OPS_THREAD_LOCAL Vector e1(3), e2(3), e3(3);
+    static OPS_THREAD_LOCAL Vector r1(3), r2(3), r3(3);
+    static OPS_THREAD_LOCAL Vector rI1(3), rI2(3), rI3(3);
+    static OPS_THREAD_LOCAL Vector rJ1(3), rJ2(3), rJ3(3);
     
     for (k = 0; k < 3; k ++)
     {
@@ -1145,9 +1145,9 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
     //        m(5)*ks2r2u1 + m(6)*ks2r3u1 + ...
     //        ks3 + ks3' + ks4 + ks5;
     
-    static Matrix Se1(3,3), Se2(3,3), Se3(3,3);
-    static Matrix SrI1(3,3), SrI2(3,3), SrI3(3,3);
-    static Matrix SrJ1(3,3), SrJ2(3,3), SrJ3(3,3);
+    static OPS_THREAD_LOCAL Matrix Se1(3,3), Se2(3,3), Se3(3,3);
+    static OPS_THREAD_LOCAL Matrix SrI1(3,3), SrI2(3,3), SrI3(3,3);
+    static OPS_THREAD_LOCAL Matrix SrJ1(3,3), SrJ2(3,3), SrJ3(3,3);
     
     Se1 = this->getSkewSymMatrix(e1);
     Se2 = this->getSkewSymMatrix(e2);
@@ -1187,8 +1187,8 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
     
     //     ks3 = [o kbar2 o kbar4];
     
-    static Matrix Sm(3,3);
-    static Matrix kbar(12,3);
+    static OPS_THREAD_LOCAL Matrix Sm(3,3);
+    static OPS_THREAD_LOCAL Matrix kbar(12,3);
     
     Sm.addMatrix(0.0, SrI3,  m(3));
     Sm.addMatrix(1.0, SrI1,  m(1));
@@ -1232,7 +1232,7 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
     //           O    O     O    O;
     //           O    O     O  Ks4_44];
     
-    static Matrix ks33(3,3);
+    static OPS_THREAD_LOCAL Matrix ks33(3,3);
     
     ks33.addMatrixProduct(0.0, Se2, SrI3,  m(3));
     ks33.addMatrixProduct(1.0, Se3, SrI2, -m(3));
@@ -1266,7 +1266,7 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
     //          Ks5_14t     O   -Ks5_14t   O];
     
     // v = (1/Ln)*(m(2)*rI2 + m(3)*rI3 + m(5)*rJ2 + m(6)*rJ3);
-    static Vector v(3);
+    static OPS_THREAD_LOCAL Vector v(3);
     v.addVector (0.0, rI2, m(1));
     v.addVector (1.0, rI3, m(2));
     v.addVector (1.0, rJ2, m(4));
@@ -1275,7 +1275,7 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
     v /= Ln;
     
     //Ks5_11 = A*v*e1' + e1*v'*A + (e1'*v)*A;
-    static Matrix m33(3,3);
+    static OPS_THREAD_LOCAL Matrix m33(3,3);
     double  e1tv = 0;   // dot product e1. v
     
     for (i = 0; i < 3; i++)
@@ -1325,7 +1325,7 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
             //opserr << "kg += ksigma5: " << kg;
             
             // Ksigma -------------------------------
-            static Vector rm(3);
+            static OPS_THREAD_LOCAL Vector rm(3);
             
             rm = rI3;
             rm.addVector (1.0, rJ3, -1.0); 
@@ -1367,7 +1367,7 @@ const Matrix &
 CorotCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &kb)
 {
     // transform tangent stiffness matrix from the basic system to local coordinates
-    static Matrix kl(7,7);
+    static OPS_THREAD_LOCAL Matrix kl(7,7);
     kl.addMatrixTripleProduct(0.0, Tp, kb, 1.0);      // kl = Tp ^ kb * Tp;
     
     // transform tangent  stiffness matrix from local to global coordinates
@@ -1385,7 +1385,7 @@ CorotCrdTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
 {
     // element projection
     
-    static Vector dx(3);
+    static OPS_THREAD_LOCAL Vector dx(3);
     
     dx = (nodeJPtr->getCrds() + nodeJOffset) - (nodeIPtr->getCrds() + nodeIOffset);  
     if (nodeIInitialDisp != 0) {
@@ -1417,7 +1417,7 @@ CorotCrdTransf3d::getLocalAxes(Vector &XAxis, Vector &YAxis, Vector &ZAxis)
     XAxis(0) = xAxis(0);    XAxis(1) = xAxis(1);    XAxis(2) = xAxis(2);
     
     // calculate the cross-product y = v * x   
-    static Vector yAxis(3), zAxis(3);
+    static OPS_THREAD_LOCAL Vector yAxis(3), zAxis(3);
     
     yAxis(0) = vAxis(1)*xAxis(2) - vAxis(2)*xAxis(1);
     yAxis(1) = vAxis(2)*xAxis(0) - vAxis(0)*xAxis(2);
@@ -1473,7 +1473,7 @@ CorotCrdTransf3d::getQuaternionFromRotMatrix(const Matrix &R) const
     int i, j, k;
     double trR;              // trace of R
     double a    ;
-    static Vector q(4);      // normalized quaternion
+    static OPS_THREAD_LOCAL Vector q(4);      // normalized quaternion
     
     trR = R(0,0) + R(1,1) + R(2,2);    
     
@@ -1518,7 +1518,7 @@ CorotCrdTransf3d::getQuaternionFromPseudoRotVector(const Vector  &theta) const
 {
     double t;                // norm of the pseudo rotation vector
     double factor;
-    static Vector q(4);      // normalized quaternion
+    static OPS_THREAD_LOCAL Vector q(4);      // normalized quaternion
     
     t = theta.Norm();
     
@@ -1541,10 +1541,10 @@ const Vector &
 CorotCrdTransf3d::quaternionProduct(const Vector &q1, const Vector &q2) const
 {
     
-    static Vector q12(4);
+    static OPS_THREAD_LOCAL Vector q12(4);
     int i;
     double q1Tq2= 0;  // dot product
-    static Vector q1xq2(3);     // cross product
+    static OPS_THREAD_LOCAL Vector q1xq2(3);     // cross product
     
     // calculate the dot product q1.q2
     for (i = 0; i < 3; i++)       // NOTE i <3, not i<4
@@ -1570,10 +1570,10 @@ CorotCrdTransf3d::getRotationMatrixFromQuaternion(const Vector &q) const
 { 
     int i, j;
     double factor;
-    static Matrix I(3,3); // identity matrix
-    static Matrix qqT(3,3); 
-    static Matrix S(3,3);
-    static Matrix R(3,3);
+    static OPS_THREAD_LOCAL Matrix I(3,3); // identity matrix
+    static OPS_THREAD_LOCAL Matrix qqT(3,3); 
+    static OPS_THREAD_LOCAL Matrix S(3,3);
+    static OPS_THREAD_LOCAL Matrix R(3,3);
     
     // R = (q0^2 - q' * q) * I + 2 * q * q' + 2*q0*S(q);
     
@@ -1602,7 +1602,7 @@ CorotCrdTransf3d::getRotationMatrixFromQuaternion(const Vector &q) const
 const Vector &
 CorotCrdTransf3d::getTangScaledPseudoVectorFromQuaternion(const Vector &q) const
 { 
-    static Vector w(3);
+    static OPS_THREAD_LOCAL Vector w(3);
     
     for (int i = 0; i < 3; i++)
         w(i) = 2.0 * q(i)/q(3);
@@ -1615,9 +1615,9 @@ const Matrix &
 CorotCrdTransf3d::getRotMatrixFromTangScaledPseudoVector(const Vector &w) const
 { 
     // Rotation matrix in terms of the tangent-scaled pseudo-vector
-    static Matrix S(3,3);
-    static Matrix S2(3,3);
-    static Matrix R(3,3);
+    static OPS_THREAD_LOCAL Matrix S(3,3);
+    static OPS_THREAD_LOCAL Matrix S2(3,3);
+    static OPS_THREAD_LOCAL Matrix R(3,3);
     double normw2;
     
     S = this->getSkewSymMatrix(w);
@@ -1643,7 +1643,7 @@ CorotCrdTransf3d::getRotMatrixFromTangScaledPseudoVector(const Vector &w) const
 const Matrix &
 CorotCrdTransf3d::getSkewSymMatrix(const Vector &theta) const
 {
-    static Matrix S(3,3);
+    static OPS_THREAD_LOCAL Matrix S(3,3);
     
     //  St = [   0       -theta(2)  theta(1);
     //         theta(2)     0      -theta(0);
@@ -1671,14 +1671,14 @@ CorotCrdTransf3d::getSkewSymMatrix(const Vector &theta) const
 const Matrix &
 CorotCrdTransf3d::getLMatrix(const Vector &ri) const
 {
-    static Matrix L1(3,3), L2(3,3);
-    static Vector r1(3), e1(3);
+    static OPS_THREAD_LOCAL Matrix L1(3,3), L2(3,3);
+    static OPS_THREAD_LOCAL Vector r1(3), e1(3);
     double rie1, e1r1k;
-    static Matrix rie1r1(3,3);
-    static Matrix e1e1r1(3,3);
-    static Matrix Sri(3,3);
-    static Matrix Sr1(3,3);
-    static Matrix L(12,3);
+    static OPS_THREAD_LOCAL Matrix rie1r1(3,3);
+    static OPS_THREAD_LOCAL Matrix e1e1r1(3,3);
+    static OPS_THREAD_LOCAL Matrix Sri(3,3);
+    static OPS_THREAD_LOCAL Matrix Sr1(3,3);
+    static OPS_THREAD_LOCAL Matrix L(12,3);
     
     int j, k;
     
@@ -1743,8 +1743,8 @@ CorotCrdTransf3d::getLMatrix(const Vector &ri) const
 const Matrix &
 CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
 {
-    static Matrix ks2(12,12);
-    static Vector e1(3), r1(3);
+    static OPS_THREAD_LOCAL Matrix ks2(12,12);
+    static OPS_THREAD_LOCAL Vector e1(3), r1(3);
     
     //opserr << "\ngetKs2Matrix:\n";
     //opserr << "ri: " << ri;
@@ -1773,9 +1773,9 @@ CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
         ztr1  += z(i)*r1(i);
     }
     
-    static Matrix zrit(3,3), ze1t(3,3);
-    static Matrix rizt(3,3), r1e1t(3,3), rie1t(3,3);
-    static Matrix e1zt(3,3);
+    static OPS_THREAD_LOCAL Matrix zrit(3,3), ze1t(3,3);
+    static OPS_THREAD_LOCAL Matrix rizt(3,3), r1e1t(3,3), rie1t(3,3);
+    static OPS_THREAD_LOCAL Matrix e1zt(3,3);
     
     for (i = 0; i < 3; i++)
         for (j = 0; j < 3; j++)
@@ -1788,7 +1788,7 @@ CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
             rie1t(i,j) = ri(i)*e1(j);
         }
         
-        static Matrix U(3,3);
+        static OPS_THREAD_LOCAL Matrix U(3,3);
         //opserr << " rite1: "<< rite1;
         //opserr << " zte1: "<< zte1;
         //opserr << " ztr1: "<< ztr1;
@@ -1808,7 +1808,7 @@ CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
         U.addMatrixProduct (1.0, A, rie1t, (zte1 + ztr1)/(2*Ln));
         
         //opserr << "U: " << U;
-        static Matrix ks(3,3);
+        static OPS_THREAD_LOCAL Matrix ks(3,3);
         
         //K11 = U + U' + ri'*e1*(2*(e1'*z)+z'*r1)*A/(2*Ln);
         
@@ -1830,7 +1830,7 @@ CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
             ks2.Assemble(ks, 6, 0, -1.0);
             ks2.Assemble(ks, 6, 6,  1.0);
             
-            static Matrix Sri(3,3), Sr1(3,3), Sz(3,3), Se1(3,3);
+            static OPS_THREAD_LOCAL Matrix Sri(3,3), Sr1(3,3), Sz(3,3), Se1(3,3);
             
             Sri = this->getSkewSymMatrix(ri);  
             Sr1 = this->getSkewSymMatrix(r1);
@@ -1839,7 +1839,7 @@ CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
             
             //K12 = (1/4)*(-A*z*e1'*Sri - A*ri*z'*Sr1 - z'*(e1+r1)*A*Sri);
             
-            static Matrix m1(3,3);
+            static OPS_THREAD_LOCAL Matrix m1(3,3);
             
             m1.addMatrixProduct(0.0, A, ze1t, -1.0);
             ks.addMatrixProduct(0.0, m1, Sri, 0.25);
@@ -2058,7 +2058,7 @@ CorotCrdTransf3d::getGlobalMatrixFromLocal(const Matrix &ml)
 const Vector &
 CorotCrdTransf3d::getPointGlobalCoordFromLocal(const Vector &xl)
 {
-    static Vector xg(3);
+    static OPS_THREAD_LOCAL Vector xg(3);
     opserr << " CorotCrdTransf3d::getPointGlobalCoordFromLocal: not implemented yet" ;
     
     return xg;  
@@ -2068,7 +2068,7 @@ CorotCrdTransf3d::getPointGlobalCoordFromLocal(const Vector &xl)
 const Vector &
 CorotCrdTransf3d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
 {
-    static Vector uxg(3);
+    static OPS_THREAD_LOCAL Vector uxg(3);
     opserr << " CorotCrdTransf3d::getPointGlobalDisplFromBasic: not implemented yet" ;
     
     
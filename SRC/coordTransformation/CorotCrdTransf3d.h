@@ -124,15 +124,15 @@ private:
     Vector ulcommit;            // commited local displacements
     Vector ulpr;                // previous local displacements
     
-    static Matrix RI;           // nodal triad for node 1
-    static Matrix RJ;           // nodal triad for node 2
-    static Matrix Rbar;         // mean nodal triad 
-    static Matrix e;            // base vectors
-    static Matrix Tp;           // transformation matrix to renumber dofs
-    static Matrix T;            // transformation matrix from basic to global system
-    static Matrix Tlg;          // transformation matrix from global to local system
-    static Matrix kg;           // global stiffness matrix
-    static Matrix Lr2, Lr3, A;  // auxiliary matrices
+    static OPS_THREAD_LOCAL Matrix RI;           // nodal triad for node 1
+    static OPS_THREAD_LOCAL Matrix RJ;           // nodal triad for node 2
+    static OPS_THREAD_LOCAL Matrix Rbar;         // mean nodal triad 
+    static OPS_THREAD_LOCAL Matrix e;            // base vectors
+    static Matrix Tp;                            // transformation matrix to renumber dofs
+    static OPS_THREAD_LOCAL Matrix T;            // transformation matrix from basic to global system
+    static OPS_THREAD_LOCAL Matrix Tlg;          // transformation matrix from global to local system
+    static OPS_THREAD_LOCAL Matrix kg;           // global stiffness matrix
+    static OPS_THREAD_LOCAL Matrix Lr2, Lr3, A;  // auxiliary matrices
     
     double *nodeIInitialDisp, *nodeJInitialDisp;
     bool initialDispChecked;
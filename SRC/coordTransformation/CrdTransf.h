@@ -56,6 +56,7 @@ public:
     virtual CrdTransf *getCopy2d(void) {return 0;};
     virtual CrdTransf *getCopy3d(void) {return 0;};
     virtual int getLocalAxes(Vector &xAxis, Vector &yAxis, Vector &zAxis) {return -1;};
+    virtual bool isLinear(void) {return false;} // global stiffness independent of state
     
     virtual int    initialize(Node *node1Pointer, Node *node2Pointer) = 0;
     virtual int    update(void) = 0;
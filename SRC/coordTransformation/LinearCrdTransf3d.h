@@ -55,6 +55,7 @@ public:
     
     int initialize(Node *node1Pointer, Node *node2Pointer);
     int update(void);
+    bool isLinear(void) {return true;}
     double getInitialLength(void);
     double getDeformedLength(void);
     
@@ -103,8 +104,8 @@ private:
     double R[3][3];	 // rotation matrix
     double L;        // undeformed element length
 
-    static Matrix Tlg;  // matrix that transforms from global to local coordinates
-    static Matrix kg;   // global stiffness matrix
+    static OPS_THREAD_LOCAL Matrix Tlg;  // matrix that transforms from global to local coordinates
+    static OPS_THREAD_LOCAL Matrix kg;   // global stiffness matrix
 
     double *nodeIInitialDisp, *nodeJInitialDisp;
     bool initialDispChecked;
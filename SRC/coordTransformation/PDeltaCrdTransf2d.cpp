@@ -44,8 +44,8 @@
 #include <PDeltaCrdTransf2d.h>
 
 // initialize static variables
-Matrix PDeltaCrdTransf2d::Tlg(6,6);
-Matrix PDeltaCrdTransf2d::kg(6,6);
+OPS_THREAD_LOCAL Matrix PDeltaCrdTransf2d::Tlg(6,6);
+OPS_THREAD_LOCAL Matrix PDeltaCrdTransf2d::kg(6,6);
 
 
 // constructor:
@@ -192,8 +192,8 @@ PDeltaCrdTransf2d::initialize(Node *nodeIPointer, Node *nodeJPointer)
 int
 PDeltaCrdTransf2d::update(void)
 {
-    static Vector nodeIDisp(3);
-    static Vector nodeJDisp(3);
+    static OPS_THREAD_LOCAL Vector nodeIDisp(3);
+    static OPS_THREAD_LOCAL Vector nodeJDisp(3);
     nodeIDisp = nodeIPtr->getTrialDisp();
     nodeJDisp = nodeJPtr->getTrialDisp();
     
@@ -233,7 +233,7 @@ int
 PDeltaCrdTransf2d::computeElemtLengthAndOrient()
 {
     // element projection
-    static Vector dx(2);
+    static OPS_THREAD_LOCAL Vector dx(2);
     
     const Vector &ndICoords = nodeIPtr->getCrds();
     const Vector &ndJCoords = nodeJPtr->getCrds();
@@ -314,7 +314,7 @@ PDeltaCrdTransf2d::getBasicTrialDisp(void)
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
     
-    static double ug[6];
+    static OPS_THREAD_LOCAL double ug[6];
     for (int i = 0; i < 3; i++) {
         ug[i]   = disp1(i);
         ug[i+3] = disp2(i);
@@ -330,7 +330,7 @@ PDeltaCrdTransf2d::getBasicTrialDisp(void)
             ug[j+3] -= nodeJInitialDisp[j];
     }
     
-    static Vector ub(3);
+    static OPS_THREAD_LOCAL Vector ub(3);
     
     double oneOverL = 1.0/L;
     double sl = sinTheta*oneOverL;
@@ -369,13 +369,13 @@ PDeltaCrdTransf2d::getBasicIncrDisp(void)
     const Vector &disp1 = nodeIPtr->getIncrDisp();
     const Vector &disp2 = nodeJPtr->getIncrDisp();
     
-    static double dug[6];
+    static OPS_THREAD_LOCAL double dug[6];
     for (int i = 0; i < 3; i++) {
         dug[i]   = disp1(i);
         dug[i+3] = disp2(i);
     }
     
-    static Vector dub(3);
+    static OPS_THREAD_LOCAL Vector dub(3);
     
     double oneOverL = 1.0/L;
     double sl = sinTheta*oneOverL;
@@ -414,13 +414,13 @@ PDeltaCrdTransf2d::getBasicIncrDeltaDisp(void)
     const Vector &disp1 = nodeIPtr->getIncrDeltaDisp();
     const Vector &disp2 = nodeJPtr->getIncrDeltaDisp();
     
-    static double Dug[6];
+    static OPS_THREAD_LOCAL double Dug[6];
     for (int i = 0; i < 3; i++) {
         Dug[i]   = disp1(i);
         Dug[i+3] = disp2(i);
     }
     
-    static Vector Dub(3);
+    static OPS_THREAD_LOCAL Vector Dub(3);
     
     double oneOverL = 1.0/L;
     double sl = sinTheta*oneOverL;
@@ -459,13 +459,13 @@ PDeltaCrdTransf2d::getBasicTrialVel(void)
 	const Vector &vel1 = nodeIPtr->getTrialVel();
 	const Vector &vel2 = nodeJPtr->getTrialVel();
 	
-	static double vg[6];
+	static OPS_THREAD_LOCAL double vg[6];
 	for (int i = 0; i < 3; i++) {
 		vg[i]   = vel1(i);
 		vg[i+3] = vel2(i);
 	}
 	
-	static Vector vb(3);
+	static OPS_THREAD_LOCAL Vector vb(3);
 	
 	double oneOverL = 1.0/L;
 	double sl = sinTheta*oneOverL;
@@ -504,13 +504,13 @@ PDeltaCrdTransf2d::getBasicTrialAccel(void)
 	const Vector &accel1 = nodeIPtr->getTrialAccel();
 	const Vector &accel2 = nodeJPtr->getTrialAccel();
 	
-	static double ag[6];
+	static OPS_THREAD_LOCAL double ag[6];
 	for (int i = 0; i < 3; i++) {
 		ag[i]   = accel1(i);
 		ag[i+3] = accel2(i);
 	}
 	
-	static Vector ab(3);
+	static OPS_THREAD_LOCAL Vector ab(3);
 	
 	double oneOverL = 1.0/L;
 	double sl = sinTheta*oneOverL;
@@ -546,7 +546,7 @@ const Vector &
 PDeltaCrdTransf2d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 {
     // transform resisting forces from the basic system to local coordinates
-    static double pl[6];
+    static OPS_THREAD_LOCAL double pl[6];
     
     double q0 = pb(0);
     double q1 = pb(1);
@@ -573,7 +573,7 @@ PDeltaCrdTransf2d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
     pl[4] -= NoverL;
     
     // transform resisting forces  from local to global coordinates
-    static Vector pg(6);
+    static OPS_THREAD_LOCAL Vector pg(6);
     
     pg(0) = cosTheta*pl[0] - sinTheta*pl[1];
     pg(1) = sinTheta*pl[0] + cosTheta*pl[1];
@@ -605,8 +605,8 @@ PDeltaCrdTransf2d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 const Matrix &
 PDeltaCrdTransf2d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 {
-    static double kl[6][6];
-    static double tmp[6][6];
+    static OPS_THREAD_LOCAL double kl[6][6];
+    static OPS_THREAD_LOCAL double tmp[6][6];
     double oneOverL = 1.0/L;
     
     // Basic stiffness
@@ -813,7 +813,7 @@ PDeltaCrdTransf2d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 const Matrix &
 PDeltaCrdTransf2d::getInitialGlobalStiffMatrix(const Matrix &kb)
 {
-    static double tmp [6][6];
+    static OPS_THREAD_LOCAL double tmp [6][6];
     double oneOverL = 1.0/L;
     double kb00, kb01, kb02, kb10, kb11, kb12, kb20, kb21, kb22;
     
@@ -1104,7 +1104,7 @@ PDeltaCrdTransf2d::getGlobalMatrixFromLocal(const Matrix &ml)
 const Vector &
 PDeltaCrdTransf2d::getPointGlobalCoordFromLocal(const Vector &xl)
 {
-    static Vector xg(2);
+    static OPS_THREAD_LOCAL Vector xg(2);
     
     const Vector &nodeICoords = nodeIPtr->getCrds();
     xg(0) = nodeICoords(0);
@@ -1130,7 +1130,7 @@ PDeltaCrdTransf2d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
     
-    static Vector ug(6);
+    static OPS_THREAD_LOCAL Vector ug(6);
     for (int i = 0; i < 3; i++)
     {
         ug(i)   = disp1(i);
@@ -1148,7 +1148,7 @@ PDeltaCrdTransf2d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
     }
     
     // transform global end displacements to local coordinates
-    static Vector ul(6);      // total displacements
+    static OPS_THREAD_LOCAL Vector ul(6);      // total displacements
     
     ul(0) =  cosTheta*ug(0) + sinTheta*ug(1);
     ul(1) = -sinTheta*ug(0) + cosTheta*ug(1);
@@ -1174,7 +1174,7 @@ PDeltaCrdTransf2d::getPointGlobalDisplFromBasic(double xi, const Vector &uxb)
     }
     
     // compute displacements at point xi, in local coordinates
-    static Vector uxl(2),  uxg(2);
+    static OPS_THREAD_LOCAL Vector uxl(2),  uxg(2);
     
     uxl(0) = uxb(0) +        ul(0);
     uxl(1) = uxb(1) + (1-xi)*ul(1) + xi*ul(4);
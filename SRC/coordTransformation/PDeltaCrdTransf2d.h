@@ -102,8 +102,8 @@ private:
     double L;     // undeformed element length
     double ul14;  // Transverse local displacement offset of P-Delta
     
-    static Matrix Tlg;  // matrix that transforms from global to local coordinates
-    static Matrix kg;   // global stiffness matrix
+    static OPS_THREAD_LOCAL Matrix Tlg;  // matrix that transforms from global to local coordinates
+    static OPS_THREAD_LOCAL Matrix kg;   // global stiffness matrix
     
     double *nodeIInitialDisp, *nodeJInitialDisp;
     bool initialDispChecked;
@@ -102,8 +102,8 @@ private:
     double ul17;	// Transverse local displacement offsets of P-Delta
     double ul28;
 
-    static Matrix Tlg;  // matrix that transforms from global to local coordinates
-    static Matrix kg;   // global stiffness matrix
+    static OPS_THREAD_LOCAL Matrix Tlg;  // matrix that transforms from global to local coordinates
+    static OPS_THREAD_LOCAL Matrix kg;   // global stiffness matrix
 
     double *nodeIInitialDisp, *nodeJInitialDisp;
     bool initialDispChecked;
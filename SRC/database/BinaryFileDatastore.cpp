@@ -0,0 +1,468 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the class implementation for 
+// BinaryFileDatastore.
+//
+// The file holds a 16 byte header ("OPSBDAT1", byte order word, version) 
+// followed by the blocks appended by commitState(). Each block is a 16 byte
+// head (marker, commitTag, number of items), the size of the data, the data
+// with each item starting on an 8 byte boundary, and then an Entry giving
+// the key and file offset of each item.
+//
+// What: "@(#) BinaryFileDatastore.cpp, revA"
+
+#include <BinaryFileDatastore.h>
+#include <FEM_ObjectBroker.h>
+#include <Domain.h>
+#include <Message.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <OPS_Globals.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/types.h>
+#define BINARY_DATASTORE_SEEK fseeko
+#define BINARY_DATASTORE_TELL ftello
+#else
+#define BINARY_DATASTORE_SEEK _fseeki64
+#define BINARY_DATASTORE_TELL _ftelli64
+#endif
+
+#define BINARY_DATASTORE_HEADER 16
+#define BINARY_DATASTORE_BLOCK 0x4B4C4242
+
+// the types of item stored
+#define BINARY_DATASTORE_ID 1
+#define BINARY_DATASTORE_VECTOR 2
+#define BINARY_DATASTORE_MATRIX 3
+#define BINARY_DATASTORE_MSG 4
+
+bool
+BinaryFileDatastore::Key::operator<(const Key &other) const
+{
+  if (type != other.type)
+    return type < other.type;
+  if (dbTag != other.dbTag)
+    return dbTag < other.dbTag;
+  if (commitTag != other.commitTag)
+    return commitTag < other.commitTag;
+  return size < other.size;
+}
+
+BinaryFileDatastore::BinaryFileDatastore(const char *name,
+					 Domain &theDom, 
+					 FEM_ObjectBroker &theBroker) 
+  :FE_Datastore(theDom, theBroker), theDomain(&theDom), fileName(0), theFile(0), fileEnd(0),
+   theMap(0), mapSize(0), mapped(false)
+{
+  fileName = new char[strlen(name)+1];
+  strcpy(fileName, name);
+
+  // open an existing file to restore from or append to, else start a new one
+  theFile = fopen(fileName, "r+b");
+  if (theFile != 0) {
+    if (this->readIndex() < 0) {
+      fclose(theFile);
+      theFile = 0;
+    }
+  } else {
+    theFile = fopen(fileName, "w+b");
+    if (theFile == 0) {
+      opserr << "BinaryFileDatastore::BinaryFileDatastore() - could not open file " << fileName << endln;
+      return;
+    }
+    char header[BINARY_DATASTORE_HEADER];
+    int head[2] = {0x01020304, 1};
+    memcpy(header, "OPSBDAT1", 8);
+    memcpy(header+8, head, sizeof(head));
+    if (fwrite(header, 1, BINARY_DATASTORE_HEADER, theFile) != BINARY_DATASTORE_HEADER) {
+      opserr << "BinaryFileDatastore::BinaryFileDatastore() - could not write file " << fileName << endln;
+      fclose(theFile);
+      theFile = 0;
+      return;
+    }
+    fflush(theFile);
+    fileEnd = BINARY_DATASTORE_HEADER;
+  }
+}
+
+BinaryFileDatastore::~BinaryFileDatastore()
+{
+  if (theFile != 0) {
+    this->writeBlock();
+    this->unmapFile();
+    fclose(theFile);
+  }
+
+  if (fileName != 0)
+    delete [] fileName;
+}
+
+int
+BinaryFileDatastore::commitState(int commitTag)
+{
+  if (theFile == 0) {
+    opserr << "BinaryFileDatastore::commitState() - no file open\n";
+    return -1;
+  }
+
+  // anything sent before belongs to an earlier block
+  if (this->writeBlock() < 0)
+    return -1;
+
+  int res = this->FE_Datastore::commitState(commitTag);
+  if (res < 0) {
+    theBuffer.clear();
+    theEntries.clear();
+    return res;
+  }
+
+  return this->writeBlock();
+}
+
+int
+BinaryFileDatastore::restoreState(int commitTag)
+{
+  if (theFile == 0) {
+    opserr << "BinaryFileDatastore::restoreState() - no file open\n";
+    return -1;
+  }
+
+  if (this->writeBlock() < 0 || this->mapFile() < 0)
+    return -1;
+
+  int res = this->FE_Datastore::restoreState(commitTag);
+
+  // the domain may keep its components, but an analysis already set up on 
+  // it must renumber & have its integrator pick up the restored response
+  if (res >= 0)
+    theDomain->domainChange();
+
+  return res;
+}
+
+int 
+BinaryFileDatastore::sendMsg(int dataTag, int commitTag, 
+			     const Message &theMessage, 
+			     ChannelAddress *theAddress)
+{
+  Message &theMsg = const_cast<Message &>(theMessage);
+  return this->send(BINARY_DATASTORE_MSG, dataTag, commitTag, 
+		    theMsg.getData(), theMsg.getSize());
+}		       
+
+int 
+BinaryFileDatastore::recvMsg(int dataTag, int commitTag, 
+			     Message &theMessage, 
+			     ChannelAddress *theAddress)
+{
+  int size = theMessage.getSize();
+  const char *theData = this->find(BINARY_DATASTORE_MSG, dataTag, commitTag, size);
+  if (theData == 0)
+    return -1;
+
+  memcpy((char *)theMessage.getData(), theData, size);
+  return 0;
+}		       
+
+int 
+BinaryFileDatastore::recvMsgUnknownSize(int dataTag, int commitTag, 
+					Message &theMessage, 
+					ChannelAddress *theAddress)
+{
+  opserr << "BinaryFileDatastore::recvMsgUnknownSize() - not yet implemented\n";
+  return -1;
+}		       
+
+int 
+BinaryFileDatastore::sendMatrix(int dataTag, int commitTag, 
+				const Matrix &theMatrix, 
+				ChannelAddress *theAddress)
+{
+  return this->send(BINARY_DATASTORE_MATRIX, dataTag, commitTag, 
+		    theMatrix.data, theMatrix.dataSize*sizeof(double));
+}		       
+
+int 
+BinaryFileDatastore::recvMatrix(int dataTag, int commitTag, 
+				Matrix &theMatrix, 
+				ChannelAddress *theAddress)
+{
+  int size = theMatrix.dataSize*sizeof(double);
+  const char *theData = this->find(BINARY_DATASTORE_MATRIX, dataTag, commitTag, size);
+  if (theData == 0)
+    return -1;
+
+  memcpy(theMatrix.data, theData, size);
+  return 0;
+}		       
+
+int 
+BinaryFileDatastore::sendVector(int dataTag, int commitTag, 
+				const Vector &theVector, 
+				ChannelAddress *theAddress)
+{
+  return this->send(BINARY_DATASTORE_VECTOR, dataTag, commitTag, 
+		    theVector.theData, theVector.sz*sizeof(double));
+}		       
+
+int 
+BinaryFileDatastore::recvVector(int dataTag, int commitTag, 
+				Vector &theVector, 
+				ChannelAddress *theAddress)
+{
+  int size = theVector.sz*sizeof(double);
+  const char *theData = this->find(BINARY_DATASTORE_VECTOR, dataTag, commitTag, size);
+  if (theData == 0)
+    return -1;
+
+  memcpy(theVector.theData, theData, size);
+  return 0;
+}		       
+
+int 
+BinaryFileDatastore::sendID(int dataTag, int commitTag, 
+			    const ID &theID, 
+			    ChannelAddress *theAddress)
+{
+  return this->send(BINARY_DATASTORE_ID, dataTag, commitTag, 
+		    theID.data, theID.sz*sizeof(int));
+}		       
+
+int 
+BinaryFileDatastore::recvID(int dataTag, int commitTag, 
+			    ID &theID, 
+			    ChannelAddress *theAddress)
+{
+  int size = theID.sz*sizeof(int);
+  const char *theData = this->find(BINARY_DATASTORE_ID, dataTag, commitTag, size);
+  if (theData == 0)
+    return -1;
+
+  memcpy(theID.data, theData, size);
+  return 0;
+}		       
+
+//
+// private methods
+//
+
+int
+BinaryFileDatastore::send(int type, int dbTag, int commitTag, const void *theData, int size)
+{
+  if (theFile == 0) {
+    opserr << "BinaryFileDatastore::send() - no file open\n";
+    return -1;
+  }
+
+  // each item starts on an 8 byte boundary, so the doubles of a mapped 
+  // file are aligned
+  Entry theEntry;
+  theEntry.theKey.type = type;
+  theEntry.theKey.dbTag = dbTag;
+  theEntry.theKey.commitTag = commitTag;
+  theEntry.theKey.size = size;
+  theEntry.offset = theBuffer.size();
+
+  theBuffer.resize(theEntry.offset + ((size + 7) & ~7), 0);
+  if (size > 0)
+    memcpy(&theBuffer[theEntry.offset], theData, size);
+
+  theEntries.push_back(theEntry);
+
+  return 0;
+}
+
+const char *
+BinaryFileDatastore::find(int type, int dbTag, int commitTag, int size)
+{
+  // items sent but not yet written out are written first
+  if (theFile == 0 || this->writeBlock() < 0 || this->mapFile() < 0)
+    return 0;
+
+  Key theKey;
+  theKey.type = type;
+  theKey.dbTag = dbTag;
+  theKey.commitTag = commitTag;
+  theKey.size = size;
+
+  std::map<Key, long long>::iterator theItem = theIndex.find(theKey);
+  if (theItem == theIndex.end())
+    return 0;
+
+  return theMap + theItem->second;
+}
+
+int
+BinaryFileDatastore::writeBlock(void)
+{
+  if (theEntries.empty())
+    return 0;
+
+  int head[4] = {BINARY_DATASTORE_BLOCK, 0, (int)theEntries.size(), 0};
+  long long dataSize = theBuffer.size();
+  long long dataStart = fileEnd + sizeof(head) + sizeof(long long);
+
+  // the index holds file offsets
+  for (size_t i=0; i<theEntries.size(); i++)
+    theEntries[i].offset += dataStart;
+
+  // the commitTag of the block is that of the domain data, sent first
+  head[1] = theEntries[0].theKey.commitTag;
+
+  this->unmapFile();
+
+  size_t numEntries = theEntries.size();
+  if (BINARY_DATASTORE_SEEK(theFile, fileEnd, SEEK_SET) != 0 ||
+      fwrite(head, sizeof(head), 1, theFile) != 1 ||
+      fwrite(&dataSize, sizeof(long long), 1, theFile) != 1 ||
+      (dataSize > 0 && fwrite(&theBuffer[0], 1, dataSize, theFile) != (size_t)dataSize) ||
+      fwrite(&theEntries[0], sizeof(Entry), numEntries, theFile) != numEntries ||
+      fflush(theFile) != 0) {
+    opserr << "BinaryFileDatastore::writeBlock() - could not write to file " << fileName << endln;
+    theBuffer.clear();
+    theEntries.clear();
+    return -1;
+  }
+
+  // a later item with the same key replaces an earlier one
+  for (size_t i=0; i<numEntries; i++)
+    theIndex[theEntries[i].theKey] = theEntries[i].offset;
+
+  fileEnd = dataStart + dataSize + numEntries*sizeof(Entry);
+
+  theBuffer.clear();
+  theEntries.clear();
+
+  return 0;
+}
+
+int
+BinaryFileDatastore::readIndex(void)
+{
+  BINARY_DATASTORE_SEEK(theFile, 0, SEEK_END);
+  long long fileSize = BINARY_DATASTORE_TELL(theFile);
+  BINARY_DATASTORE_SEEK(theFile, 0, SEEK_SET);
+
+  char header[BINARY_DATASTORE_HEADER];
+  int head[2];
+  if (fileSize < BINARY_DATASTORE_HEADER ||
+      fread(header, 1, BINARY_DATASTORE_HEADER, theFile) != BINARY_DATASTORE_HEADER ||
+      strncmp(header, "OPSBDAT1", 8) != 0) {
+    opserr << "BinaryFileDatastore::readIndex() - " << fileName << " is not a binary datastore file\n";
+    return -1;
+  }
+  memcpy(head, header+8, sizeof(head));
+  if (head[0] != 0x01020304 || head[1] != 1) {
+    opserr << "BinaryFileDatastore::readIndex() - " << fileName;
+    opserr << " written with another byte order or version\n";
+    return -1;
+  }
+
+  // the blocks, one not written out completely is ignored & written over
+  long long loc = BINARY_DATASTORE_HEADER;
+  std::vector<Entry> blockEntries;
+  while (loc + 4*(long long)sizeof(int) + (long long)sizeof(long long) <= fileSize) {
+    int blockHead[4];
+    long long dataSize;
+    if (BINARY_DATASTORE_SEEK(theFile, loc, SEEK_SET) != 0 ||
+	fread(blockHead, sizeof(blockHead), 1, theFile) != 1 ||
+	fread(&dataSize, sizeof(long long), 1, theFile) != 1)
+      break;
+
+    long long entriesStart = loc + sizeof(blockHead) + sizeof(long long) + dataSize;
+    long long blockEnd = entriesStart + blockHead[2]*(long long)sizeof(Entry);
+    if (blockHead[0] != BINARY_DATASTORE_BLOCK || dataSize < 0 || blockHead[2] < 0 ||
+	blockEnd > fileSize)
+      break;
+
+    blockEntries.resize(blockHead[2]);
+    if (BINARY_DATASTORE_SEEK(theFile, entriesStart, SEEK_SET) != 0 ||
+	(blockHead[2] > 0 && 
+	 fread(&blockEntries[0], sizeof(Entry), blockHead[2], theFile) != (size_t)blockHead[2]))
+      break;
+
+    for (int i=0; i<blockHead[2]; i++)
+      theIndex[blockEntries[i].theKey] = blockEntries[i].offset;
+
+    loc = blockEnd;
+  }
+
+  fileEnd = loc;
+
+  return 0;
+}
+
+int
+BinaryFileDatastore::mapFile(void)
+{
+  if (theMap != 0)
+    return 0;
+
+  if (fileEnd <= BINARY_DATASTORE_HEADER)
+    return -1;
+
+#ifndef _WIN32
+  void *theData = mmap(0, fileEnd, PROT_READ, MAP_SHARED, fileno(theFile), 0);
+  if (theData == MAP_FAILED) {
+    opserr << "BinaryFileDatastore::mapFile() - could not map file " << fileName << endln;
+    return -1;
+  }
+  theMap = (const char *)theData;
+  mapped = true;
+#else
+  char *theData = new char[fileEnd];
+  if (BINARY_DATASTORE_SEEK(theFile, 0, SEEK_SET) != 0 ||
+      fread(theData, 1, fileEnd, theFile) != (size_t)fileEnd) {
+    opserr << "BinaryFileDatastore::mapFile() - could not read file " << fileName << endln;
+    delete [] theData;
+    return -1;
+  }
+  theMap = theData;
+  mapped = false;
+#endif
+  mapSize = fileEnd;
+
+  return 0;
+}
+
+void
+BinaryFileDatastore::unmapFile(void)
+{
+  if (theMap != 0) {
+#ifndef _WIN32
+    if (mapped == true)
+      munmap((void *)theMap, mapSize);
+    else
+#endif
+      delete [] theMap;
+  }
+  theMap = 0;
+  mapSize = 0;
+  mapped = false;
+}
@@ -0,0 +1,129 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// BinaryFileDatastore. BinaryFileDatastore is a concrete subclass of 
+// FE_Datastore. Like a FileDatastore it stores/restores the geometry and
+// state information in a domain, but everything goes into one binary file.
+// The IDs, Vectors, Matrices and Messages sent by the objects during a 
+// commitState() are gathered in memory and then appended to the file as a
+// single block holding the data and an index of where each item is. When
+// the file is opened the indices of all the blocks are read, so that a new
+// process can restoreState() any of the commitTags saved; the file is then
+// memory mapped and the objects read straight from it. A block not written
+// out completely (the run was killed while saving) is ignored.
+//
+// What: "@(#) BinaryFileDatastore.h, revA"
+
+#ifndef BinaryFileDatastore_h
+#define BinaryFileDatastore_h
+
+#include <FE_Datastore.h>
+#include <stdio.h>
+#include <vector>
+#include <map>
+
+class FEM_ObjectBroker;
+
+class BinaryFileDatastore: public FE_Datastore
+{
+  public:
+    BinaryFileDatastore(const char *fileName,
+			Domain &theDomain, 
+			FEM_ObjectBroker &theBroker);    
+    ~BinaryFileDatastore();
+
+    // methods for sending and receiving the data
+    int sendMsg(int dbTag, int commitTag, 
+		const Message &, 
+		ChannelAddress *theAddress =0);    
+    int recvMsg(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+    int recvMsgUnknownSize(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+
+    int sendMatrix(int dbTag, int commitTag, 
+		   const Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag, 
+		   Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendVector(int dbTag, int commitTag, 
+		   const Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag, 
+		   Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendID(int dbTag, int commitTag,
+	       const ID &theID,
+	       ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag,
+	       ID &theID,
+	       ChannelAddress *theAddress =0);
+
+    int commitState(int commitTag);        
+    int restoreState(int commitTag);        
+
+  protected:
+
+  private:
+    // an item is found by its type, dbTag, commitTag and size (in bytes)
+    struct Key {
+      int type;
+      int dbTag;
+      int commitTag;
+      int size;
+      bool operator<(const Key &other) const;
+    };
+    struct Entry {
+      Key theKey;
+      long long offset;    // in the block buffer, then in the file
+    };
+
+    int send(int type, int dbTag, int commitTag, const void *theData, int size);
+    const char *find(int type, int dbTag, int commitTag, int size);
+    int writeBlock(void);
+    int readIndex(void);
+    int mapFile(void);
+    void unmapFile(void);
+
+    Domain *theDomain;
+    char *fileName;
+    FILE *theFile;
+    long long fileEnd;                  // end of the last complete block
+
+    std::vector<char> theBuffer;        // the block being gathered
+    std::vector<Entry> theEntries;
+    std::map<Key, long long> theIndex;  // where in the file each item is
+
+    const char *theMap;                 // the file, for reading
+    long long mapSize;
+    bool mapped;                        // by mmap, else read into memory
+};
+
+#endif
@@ -0,0 +1,213 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Written: agent
+// Created: Oct 2026
+//
+// Purpose: This file is a driver to test the BinaryFileDatastore. It
+// sends IDs, Vectors and Matrices for a few commitTags and checks they
+// come back the same: from the same datastore, from a new one opened on
+// the file, and from the file with its last block cut short (as when a
+// run is killed while saving), where that block must be ignored and
+// written over by the next one.
+//
+//   testBinaryFileDatastore <fileName>
+
+#include <stdio.h>
+#include <vector>
+
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+#include <Domain.h>
+#include <FEM_ObjectBroker.h>
+#include <BinaryFileDatastore.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+
+// global variables, ops_Dt and ops_TheActiveDomain come with the Domain
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+static int numTests = 0;
+static int numFailed = 0;
+
+static void
+check(bool ok, const char *what)
+{
+  numTests++;
+  if (ok)
+    opserr << "PASS: " << what << endln;
+  else {
+    opserr << "FAIL: " << what << endln;
+    numFailed++;
+  }
+}
+
+// the items sent for a commitTag, different for each commitTag and pass
+static void
+fillItems(int commitTag, int pass, ID &theID, Vector &theVector, Matrix &theMatrix)
+{
+  for (int i=0; i<theID.Size(); i++)
+    theID(i) = 1000*pass + 100*commitTag + i;
+  for (int i=0; i<theVector.Size(); i++)
+    theVector(i) = pass + 0.5*commitTag + 0.001*i;
+  for (int i=0; i<theMatrix.noRows(); i++)
+    for (int j=0; j<theMatrix.noCols(); j++)
+      theMatrix(i,j) = pass - 0.25*commitTag + 0.01*i + 0.0001*j;
+}
+
+static int
+sendItems(FE_Datastore &theStore, int commitTag, int pass)
+{
+  ID theID(7);
+  Vector theVector(13);
+  Matrix theMatrix(5,3);
+  fillItems(commitTag, pass, theID, theVector, theMatrix);
+
+  int res = theStore.sendID(1, commitTag, theID);
+  res += theStore.sendVector(2, commitTag, theVector);
+  res += theStore.sendMatrix(3, commitTag, theMatrix);
+  return res;
+}
+
+// 0 if the items come back as sent, -1 if one is missing, -2 if one differs
+static int
+recvItems(FE_Datastore &theStore, int commitTag, int pass)
+{
+  ID theID(7), sentID(7);
+  Vector theVector(13), sentVector(13);
+  Matrix theMatrix(5,3), sentMatrix(5,3);
+  fillItems(commitTag, pass, sentID, sentVector, sentMatrix);
+
+  if (theStore.recvID(1, commitTag, theID) < 0 ||
+      theStore.recvVector(2, commitTag, theVector) < 0 ||
+      theStore.recvMatrix(3, commitTag, theMatrix) < 0)
+    return -1;
+
+  for (int i=0; i<theID.Size(); i++)
+    if (theID(i) != sentID(i))
+      return -2;
+  for (int i=0; i<theVector.Size(); i++)
+    if (theVector(i) != sentVector(i))
+      return -2;
+  for (int i=0; i<theMatrix.noRows(); i++)
+    for (int j=0; j<theMatrix.noCols(); j++)
+      if (theMatrix(i,j) != sentMatrix(i,j))
+	return -2;
+
+  return 0;
+}
+
+// cut the last numBytes off the file
+static int
+truncateFile(const char *fileName, long numBytes)
+{
+  FILE *theFile = fopen(fileName, "rb");
+  if (theFile == 0)
+    return -1;
+  std::vector<char> theData;
+  char buffer[4096];
+  size_t num;
+  while ((num = fread(buffer, 1, sizeof(buffer), theFile)) > 0)
+    theData.insert(theData.end(), buffer, buffer+num);
+  fclose(theFile);
+
+  if ((long)theData.size() <= numBytes)
+    return -1;
+
+  theFile = fopen(fileName, "wb");
+  if (theFile == 0)
+    return -1;
+  size_t size = theData.size() - numBytes;
+  int res = (fwrite(&theData[0], 1, size, theFile) == size) ? 0 : -1;
+  fclose(theFile);
+  return res;
+}
+
+
+int main(int argc, char **argv)
+{
+  const char *fileName = "testBinaryFileDatastore.dat";
+  if (argc > 1)
+    fileName = argv[1];
+  remove(fileName);
+
+  Domain theDomain;
+  FEM_ObjectBroker theBroker;
+
+  //
+  // send and receive in the same datastore, two blocks
+  //
+
+  BinaryFileDatastore *theStore = new BinaryFileDatastore(fileName, theDomain, theBroker);
+  check(sendItems(*theStore, 0, 0) == 0, "send commitTag 0");
+  check(recvItems(*theStore, 0, 0) == 0, "receive commitTag 0 from the same datastore");
+  check(sendItems(*theStore, 1, 0) == 0, "send commitTag 1");
+  check(recvItems(*theStore, 1, 0) == 0, "receive commitTag 1 from the same datastore");
+  check(recvItems(*theStore, 0, 0) == 0, "receive commitTag 0 after a second block");
+
+  ID wrongSize(8);
+  check(theStore->recvID(1, 0, wrongSize) < 0, "an ID of another size is not found");
+  check(theStore->recvID(1, 5, wrongSize) < 0, "a commitTag not sent is not found");
+
+  // a later item with the same key replaces the earlier
+  check(sendItems(*theStore, 1, 1) == 0, "send commitTag 1 again");
+  check(recvItems(*theStore, 1, 1) == 0, "receive the items sent last for commitTag 1");
+  delete theStore;
+
+  //
+  // a new datastore on the file, as a new process restoring from it
+  //
+
+  theStore = new BinaryFileDatastore(fileName, theDomain, theBroker);
+  check(recvItems(*theStore, 0, 0) == 0, "receive commitTag 0 after reopening");
+  check(recvItems(*theStore, 1, 1) == 0, "receive commitTag 1 after reopening");
+  check(sendItems(*theStore, 2, 0) == 0, "send commitTag 2 after reopening");
+  delete theStore;
+
+  //
+  // the block of commitTag 2 cut short: it is ignored and written over
+  //
+
+  check(truncateFile(fileName, 12) == 0, "cut the last block short");
+
+  theStore = new BinaryFileDatastore(fileName, theDomain, theBroker);
+  check(recvItems(*theStore, 0, 0) == 0, "receive commitTag 0 from the truncated file");
+  check(recvItems(*theStore, 1, 1) == 0, "receive commitTag 1 from the truncated file");
+  check(recvItems(*theStore, 2, 0) == -1, "the items of the truncated block are not found");
+  check(sendItems(*theStore, 2, 2) == 0, "send commitTag 2 over the truncated block");
+  delete theStore;
+
+  theStore = new BinaryFileDatastore(fileName, theDomain, theBroker);
+  check(recvItems(*theStore, 2, 2) == 0, "receive commitTag 2 written over the truncated block");
+  check(recvItems(*theStore, 0, 0) == 0, "receive commitTag 0 after writing over the truncated block");
+  delete theStore;
+
+  remove(fileName);
+
+  opserr << numTests - numFailed << " of " << numTests << " tests passed\n";
+
+  if (numFailed != 0)
+    return -1;
+
+  return 0;
+}
@@ -26,6 +26,8 @@
 #include <Parameter.h>
 #include <DomainComponent.h>
 
+int Parameter::updateStamp = 0;
+
 Parameter::Parameter(int passedTag,
 		     DomainComponent *parentObject,
 		     const char **argv, int argc)
@@ -182,6 +184,7 @@ int
 Parameter::update(int newValue)
 {
   theInfo.theInt = newValue;
+  updateStamp++;
 
   int ok = 0;
 
@@ -195,6 +198,7 @@ int
 Parameter::update(double newValue)
 {
   theInfo.theDouble = newValue;
+  updateStamp++;
 
   int ok = 0;
 
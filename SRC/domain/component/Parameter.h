@@ -72,6 +72,10 @@ class Parameter : public TaggedObject, public MovableObject
 
   virtual void setDomain(Domain *theDomain);
 
+  // count of the updates of all the parameters, for objects keeping 
+  // results that depend on the state of the model
+  static int getUpdateStamp(void) {return updateStamp;}
+
   virtual int sendSelf(int commitTag, Channel &theChannel);  
   virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
 
@@ -94,6 +98,8 @@ class Parameter : public TaggedObject, public MovableObject
   int maxNumComponents;
 
   int gradIndex; // 0,...,nparam-1
+
+  static int updateStamp;
 };
 
 #endif
@@ -74,6 +74,7 @@
 #include <Analysis.h>
 #include <FE_Datastore.h>
 #include <FEM_ObjectBroker.h>
+#include <Profiler.h>
 
 //
 // global variables
@@ -84,7 +85,7 @@ double        ops_Dt = 0.0;
 bool          ops_InitialStateAnalysis = false;
 
 Domain::Domain()
-:theRecorders(0), numRecorders(0),
+:theRecorders(0), numRecorders(0), updateGlobals(true),
  currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
  hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
@@ -94,7 +95,8 @@ Domain::Domain()
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalDampingFactors(0), inclModalMatrix(false),
  lastChannel(0),
- paramIndex(0), paramSize(0), numParameters(0)
+ paramIndex(0), paramSize(0), numParameters(0),
+ numThreads(1), theEleArray(0), sizeEleArray(0)
 {
   
     // init the arrays for storing the domain components
@@ -139,7 +141,7 @@ Domain::Domain()
 
 Domain::Domain(int numNodes, int numElements, int numSPs, int numMPs,
 	       int numLoadPatterns)
-:theRecorders(0), numRecorders(0),
+:theRecorders(0), numRecorders(0), updateGlobals(true),
  currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
  hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
@@ -148,7 +150,8 @@ Domain::Domain(int numNodes, int numElements, int numSPs, int numMPs,
  theRegions(0), numRegions(0), commitTag(0),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalDampingFactors(0), inclModalMatrix(false),
- lastChannel(0), paramIndex(0), paramSize(0), numParameters(0)
+ lastChannel(0), paramIndex(0), paramSize(0), numParameters(0),
+ numThreads(1), theEleArray(0), sizeEleArray(0)
 {
     // init the arrays for storing the domain components
     theElements = new MapOfTaggedObjects();
@@ -194,7 +197,7 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
 	       TaggedObjectStorage &theMPsStorage,
 	       TaggedObjectStorage &theSPsStorage,
 	       TaggedObjectStorage &theLoadPatternsStorage)
-:theRecorders(0), numRecorders(0),
+:theRecorders(0), numRecorders(0), updateGlobals(true),
  currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
  hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
@@ -208,7 +211,8 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
  theRegions(0), numRegions(0), commitTag(0),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalDampingFactors(0), inclModalMatrix(false),
- lastChannel(0),paramIndex(0), paramSize(0), numParameters(0)
+ lastChannel(0),paramIndex(0), paramSize(0), numParameters(0),
+ numThreads(1), theEleArray(0), sizeEleArray(0)
 {
     // init the arrays for storing the domain components
     thePCs      = new MapOfTaggedObjects();
@@ -257,7 +261,7 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
 
 
 Domain::Domain(TaggedObjectStorage &theStorage)
-:theRecorders(0), numRecorders(0),
+:theRecorders(0), numRecorders(0), updateGlobals(true),
  currentTime(0.0), committedTime(0.0), dT(0.0), currentGeoTag(0),
  hasDomainChangedFlag(false), theDbTag(0), lastGeoSendTag(-1),
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
@@ -266,7 +270,8 @@ Domain::Domain(TaggedObjectStorage &theStorage)
  theRegions(0), numRegions(0), commitTag(0),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalDampingFactors(0), inclModalMatrix(false),
- lastChannel(0),paramIndex(0), paramSize(0), numParameters(0)
+ lastChannel(0),paramIndex(0), paramSize(0), numParameters(0),
+ numThreads(1), theEleArray(0), sizeEleArray(0)
 {
     // init the arrays for storing the domain components
     theStorage.clearAll(); // clear the storage just in case populated
@@ -368,6 +373,9 @@ Domain::~Domain()
   if (theParamIter != 0)
     delete theParamIter;
 
+  if (theEleArray != 0)
+    delete [] theEleArray;
+
   if (theEigenvalues != 0)
     delete theEigenvalues;
 
@@ -498,6 +506,25 @@ Domain::addNode(Node * node)
 }
 
 
+// int reserve(int numNodes, int numElements);
+//	Method to tell the storage objects that numNodes nodes and 
+//	numElements elements are about to be added, so that array based
+//	storage can be sized once and not grown as the objects are added.
+
+int
+Domain::reserve(int numNodes, int numElements)
+{
+  int res = 0;
+  if (numNodes > 0)
+    if (theNodes->setSize(theNodes->getNumComponents() + numNodes) < 0)
+      res = -1;
+  if (numElements > 0)
+    if (theElements->setSize(theElements->getNumComponents() + numElements) < 0)
+      res = -1;
+
+  return res;
+}
+
 // void addSP_Constraint(SP_Constraint *);
 //	Method to add a constraint to the model.
 //
@@ -1788,7 +1815,8 @@ Domain::applyLoad(double timeStep)
       theSP->applyConstraint(timeStep);
     }
 
-    ops_Dt = dT;
+    if (updateGlobals == true)
+      ops_Dt = dT;
 }
 
 
@@ -1858,6 +1886,8 @@ Domain::setRayleighDampingFactors(double alphaM, double betaK, double betaK0, do
 int
 Domain::record(bool fromAnalysis)
 {
+  OPS_PROFILE("Domain::record");
+
   int res = 0;
 
   // invoke record on all recorders
@@ -1874,6 +1904,8 @@ Domain::record(bool fromAnalysis)
 int
 Domain::commit(void)
 {
+    OPS_PROFILE("Domain::commit");
+
     // 
     // first invoke commit on all nodes and elements in the domain
     //
@@ -1894,9 +1926,12 @@ Domain::commit(void)
     dT = 0.0;
 
     // invoke record on all recorders
-    for (int i=0; i<numRecorders; i++)
-      if (theRecorders[i] != 0)
-	theRecorders[i]->record(commitTag, currentTime);
+    {
+      OPS_PROFILE("Domain::record");
+      for (int i=0; i<numRecorders; i++)
+	if (theRecorders[i] != 0)
+	  theRecorders[i]->record(commitTag, currentTime);
+    }
 
     // update the commitTag
     commitTag++;
@@ -1970,9 +2005,13 @@ Domain::revertToStart(void)
 int
 Domain::update(void)
 {
+  OPS_PROFILE("Domain::update");
+
   // set the global constants
-  ops_Dt = dT;
-  ops_TheActiveDomain = this;
+  if (updateGlobals == true) {
+    ops_Dt = dT;
+    ops_TheActiveDomain = this;
+  }
 
   int ok = 0;
 
@@ -1980,9 +2019,48 @@ Domain::update(void)
   ElementIter &theEles = this->getElements();
   Element *theEle;
 
-  while ((theEle = theEles()) != 0) {
-    ops_TheActiveElement = theEle;
-    ok += theEle->update();
+  if (numThreads > 1) {
+
+    // gather the thread safe elements into an array so the loop can be
+    // shared among threads, the others are updated as they are met
+    int numEle = theElements->getNumComponents();
+    if (numEle > sizeEleArray) {
+      if (theEleArray != 0)
+	delete [] theEleArray;
+      theEleArray = new Element *[numEle];
+      sizeEleArray = numEle;
+    }
+
+    int numEleArray = 0;
+    while ((theEle = theEles()) != 0) {
+      if (theEle->isThreadSafe() == true)
+	theEleArray[numEleArray++] = theEle;
+      else {
+	OPS_PROFILE_CLASS(theEle);
+	if (updateGlobals == true)
+	  ops_TheActiveElement = theEle;
+	ok += theEle->update();
+      }
+    }
+
+    // no one element is active while the others are updated concurrently
+    if (updateGlobals == true)
+      ops_TheActiveElement = 0;
+
+#pragma omp parallel for num_threads(numThreads) schedule(dynamic,16) reduction(+:ok)
+    for (int i=0; i<numEleArray; i++) {
+      OPS_PROFILE_CLASS(theEleArray[i]);
+      ok += theEleArray[i]->update();
+    }
+
+  } else {
+
+    while ((theEle = theEles()) != 0) {
+      OPS_PROFILE_CLASS(theEle);
+      if (updateGlobals == true)
+	ops_TheActiveElement = theEle;
+      ok += theEle->update();
+    }
   }
 
   if (ok != 0)
@@ -1992,6 +2070,21 @@ Domain::update(void)
 }
 
 
+void
+Domain::setNumThreads(int num)
+{
+  if (num < 1)
+    num = 1;
+  numThreads = num;
+}
+
+int
+Domain::getNumThreads(void) const
+{
+  return numThreads;
+}
+
+
 int
 Domain::update(double newTime, double dT)
 {
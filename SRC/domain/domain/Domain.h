@@ -104,6 +104,7 @@ class Domain
     virtual  bool addMP_Constraint(MP_Constraint *); 
     virtual  bool addLoadPattern(LoadPattern *);            
     virtual  bool addParameter(Parameter *);            
+    virtual  int  reserve(int numNodes, int numElements);
     
     // methods to add components to a LoadPattern object
     virtual  bool addSP_Constraint(SP_Constraint *, int loadPatternTag); 
@@ -185,6 +186,8 @@ class Domain
     virtual  int  revertToStart(void);    
     virtual  int  update(void);
     virtual  int  update(double newTime, double dT);
+    void setNumThreads(int numThreads);
+    int getNumThreads(void) const;
     virtual  int  updateParameter(int tag, int value);
     virtual  int  updateParameter(int tag, double value);    
     
@@ -240,6 +243,11 @@ class Domain
     Recorder **theRecorders;
     int numRecorders;    
 
+    // if update() and applyLoad() set the global ops_Dt, ops_TheActiveDomain
+    // and ops_TheActiveElement; false for subdomains updated on a thread of
+    // their own, the globals then being set by the thread driving the analysis
+    bool updateGlobals;
+
   private:
     double currentTime;               // current pseudo time
     double committedTime;             // the committed pseudo time
@@ -294,6 +302,12 @@ class Domain
     enum {paramSize_grow = 20};
     int paramSize;
     int numParameters;
+
+    // number of threads used in update() and storage for the
+    // element pointers shared among them
+    int numThreads;
+    Element **theEleArray;
+    int sizeEleArray;
 };
 
 #endif
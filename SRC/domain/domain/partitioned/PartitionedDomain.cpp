@@ -951,14 +951,19 @@ PartitionedDomain::update(void)
 {
   int res = this->Domain::update();
 
-  // do the same for all the subdomains
+  // do the same for all the subdomains, the tasks are all started before
+  // any is finished so that threaded subdomains update concurrently
   if (theSubdomains != 0) {
     ArrayOfTaggedObjectsIter theSubsIter(*theSubdomains);	
     TaggedObject *theObject;
     while ((theObject = theSubsIter()) != 0) {
       Subdomain *theSub = (Subdomain *)theObject;	    
-      theSub->computeNodalResponse();
-      res += theSub->update();
+      theSub->startTask(SUBDOMAIN_TASK_UPDATE);
+    }
+    ArrayOfTaggedObjectsIter theSubsIter1(*theSubdomains);	
+    while ((theObject = theSubsIter1()) != 0) {
+      Subdomain *theSub = (Subdomain *)theObject;	    
+      res += theSub->finishTask();
     }
   }
 
@@ -1010,8 +1015,12 @@ PartitionedDomain::update(double newTime, double dT)
     TaggedObject *theObject;
     while ((theObject = theSubsIter()) != 0) {
       Subdomain *theSub = (Subdomain *)theObject;	    
-      theSub->computeNodalResponse();
-      res +=theSub->update(newTime, dT);
+      theSub->startTask(SUBDOMAIN_TASK_UPDATE_TIME, newTime, dT);
+    }
+    ArrayOfTaggedObjectsIter theSubsIter1(*theSubdomains);	
+    while ((theObject = theSubsIter1()) != 0) {
+      Subdomain *theSub = (Subdomain *)theObject;	    
+      res += theSub->finishTask();
     }
   }
 
@@ -1092,7 +1101,12 @@ PartitionedDomain::analysisStep(double dT)
     TaggedObject *theObject;
     while ((theObject = theSubsIter()) != 0) {
       Subdomain *theSub = (Subdomain *)theObject;	    
-      res += theSub->analysisStep(dT);
+      theSub->startTask(SUBDOMAIN_TASK_ANALYSIS_STEP, dT);
+    }
+    ArrayOfTaggedObjectsIter theSubsIter1(*theSubdomains);	
+    while ((theObject = theSubsIter1()) != 0) {
+      Subdomain *theSub = (Subdomain *)theObject;	    
+      res += theSub->finishTask();
       if (res != 0) 
 	opserr << "PartitionedDomain::step - subdomain " << theSub->getTag() << " failed in step\n";
     }
@@ -1189,13 +1203,21 @@ PartitionedDomain::commit(void)
     TaggedObject *theObject;
     while ((theObject = theSubsIter()) != 0) {
       Subdomain *theSub = (Subdomain *)theObject;	    
-      int res = theSub->commit();
-      if (res < 0) {
+      theSub->startTask(SUBDOMAIN_TASK_COMMIT);
+    }
+    int res = 0;
+    ArrayOfTaggedObjectsIter theSubsIter1(*theSubdomains);	
+    while ((theObject = theSubsIter1()) != 0) {
+      Subdomain *theSub = (Subdomain *)theObject;	    
+      int subResult = theSub->finishTask();
+      if (subResult < 0) {
 	opserr << "PartitionedDomain::commit(void)";
 	opserr << " - failed in Subdomain::commit()\n";
-	return res;
+	res = subResult;
       }	    
     }
+    if (res < 0)
+      return res;
   }
 
   // now we load balance if we have subdomains and a partitioner
@@ -1224,13 +1246,21 @@ PartitionedDomain::revertToLastCommit(void)
 	TaggedObject *theObject;
 	while ((theObject = theSubsIter()) != 0) {
 	    Subdomain *theSub = (Subdomain *)theObject;	    
-	    int res = theSub->revertToLastCommit();
-	    if (res < 0) {
+	    theSub->startTask(SUBDOMAIN_TASK_REVERT);
+	}
+	int res = 0;
+	ArrayOfTaggedObjectsIter theSubsIter1(*theSubdomains);	
+	while ((theObject = theSubsIter1()) != 0) {
+	    Subdomain *theSub = (Subdomain *)theObject;	    
+	    int subResult = theSub->finishTask();
+	    if (subResult < 0) {
 		opserr << "PartitionedDomain::revertToLastCommit(void)";
 		opserr << " - failed in Subdomain::revertToLastCommit()\n";
-		return res;
+		res = subResult;
 	    }	    
 	}
+	if (res < 0)
+	    return res;
     }
 
     return 0;
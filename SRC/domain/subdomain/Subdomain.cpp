@@ -67,7 +67,7 @@ Subdomain::Subdomain(int tag)
 :Element(tag,ELE_TAG_Subdomain),
  Domain(),
  mapBuilt(false),map(0),mappedVect(0),mappedMatrix(0),
- realCost(0.0),cpuCost(0),pageCost(0),
+ taskResult(0), realCost(0.0),cpuCost(0),pageCost(0),
  theAnalysis(0), extNodes(0), theFEele(0) 
 {
 
@@ -106,7 +106,7 @@ Subdomain::Subdomain(int tag,
    mapBuilt(false),map(0),mappedVect(0),mappedMatrix(0),
    internalNodes(&theInternalNodeStorage),
    externalNodes(&theExternalNodeStorage), 
-   realCost(0.0),cpuCost(0),pageCost(0),
+   taskResult(0), realCost(0.0),cpuCost(0),pageCost(0),
    theAnalysis(0), extNodes(0), theFEele(0)
 {
   //thePartitionedModelBuilder = 0;
@@ -832,6 +832,72 @@ Subdomain::doesIndependentAnalysis(void)
 }
 
 
+int
+Subdomain::startTask(int task, double arg1, double arg2)
+{
+  taskResult = this->performTask(task, arg1, arg2);
+  return 0;
+}
+
+int
+Subdomain::finishTask(void)
+{
+  int res = taskResult;
+  taskResult = 0;
+  return res;
+}
+
+bool
+Subdomain::isThreaded(void)
+{
+  return false;
+}
+
+int
+Subdomain::performTask(int task, double arg1, double arg2)
+{
+  int res = 0;
+
+  switch (task) {
+  case SUBDOMAIN_TASK_COMPUTE_TANG:
+    res = this->computeTang();
+    break;
+
+  case SUBDOMAIN_TASK_COMPUTE_RESIDUAL:
+    res = this->computeResidual();
+    break;
+
+  case SUBDOMAIN_TASK_UPDATE:
+    this->computeNodalResponse();
+    res = this->update();
+    break;
+
+  case SUBDOMAIN_TASK_UPDATE_TIME:
+    this->computeNodalResponse();
+    res = this->update(arg1, arg2);
+    break;
+
+  case SUBDOMAIN_TASK_COMMIT:
+    res = this->commit();
+    break;
+
+  case SUBDOMAIN_TASK_REVERT:
+    res = this->revertToLastCommit();
+    break;
+
+  case SUBDOMAIN_TASK_ANALYSIS_STEP:
+    res = this->analysisStep(arg1);
+    break;
+
+  default:
+    opserr << "Subdomain::performTask() - unknown task " << task << endln;
+    res = -1;
+  }
+
+  return res;
+}
+
+
 int 
 Subdomain::sendSelf(int cTag, Channel &theChannel)
 {
@@ -55,6 +55,15 @@ class FE_Element;
 
 #include <SubdomainNodIter.h>
 
+// the analysis tasks which may be invoked in two phases, see startTask()
+#define SUBDOMAIN_TASK_COMPUTE_TANG      1
+#define SUBDOMAIN_TASK_COMPUTE_RESIDUAL  2
+#define SUBDOMAIN_TASK_UPDATE            3  // computeNodalResponse() & update()
+#define SUBDOMAIN_TASK_UPDATE_TIME       4  // computeNodalResponse() & update(t, dT)
+#define SUBDOMAIN_TASK_COMMIT            5
+#define SUBDOMAIN_TASK_REVERT            6  // revertToLastCommit()
+#define SUBDOMAIN_TASK_ANALYSIS_STEP     7
+
 class Subdomain: public Element, public Domain
 {
   public:
@@ -153,6 +162,14 @@ class Subdomain: public Element, public Domain
     virtual int eigenAnalysis(int numMode, bool generalized, bool findSmallest);
     virtual bool doesIndependentAnalysis(void);
 
+    // two phase invocation of the analysis tasks, startTask() performs the
+    // task and finishTask() returns the result; subclasses which perform 
+    // the tasks on their own thread return true from isThreaded() and 
+    // allow the tasks of a number of subdomains to be done concurrently
+    virtual int startTask(int task, double arg1 = 0.0, double arg2 = 0.0);
+    virtual int finishTask(void);
+    virtual bool isThreaded(void);
+
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, 
 			 FEM_ObjectBroker &theBroker);
@@ -173,8 +190,10 @@ class Subdomain: public Element, public Domain
     TaggedObjectStorage  *externalNodes;    
 
     DomainDecompositionAnalysis *getDDAnalysis(void);
+    int performTask(int task, double arg1, double arg2);
 
   private:
+    int taskResult;
     double realCost;
     double cpuCost;
     int pageCost;
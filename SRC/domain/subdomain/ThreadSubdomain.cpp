@@ -0,0 +1,360 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the class implementation for 
+// ThreadSubdomain.
+//
+// What: "@(#) ThreadSubdomain.cpp, revA"
+
+#include <ThreadSubdomain.h>
+#include <FE_Element.h>
+#include <DOF_Group.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <OPS_Globals.h>
+
+// the slots at the top of the range are given to the subdomain threads, 
+// those at the bottom being used by the OpenMP threads (see FE_Element)
+std::mutex ThreadSubdomain::slotMutex;
+bool ThreadSubdomain::slotUsed[MAX_NUM_FE_THREADS];
+
+ThreadSubdomain::ThreadSubdomain(int tag)
+  :Subdomain(tag),
+   haveJob(false), stop(false), jobResult(0), slot(-1), pendingTask(0)
+{
+  {
+    std::lock_guard<std::mutex> lock(slotMutex);
+    for (int i=MAX_NUM_FE_THREADS-1; i>=MAX_NUM_FE_THREADS/2 && slot < 0; i--)
+      if (slotUsed[i] == false) {
+	slotUsed[i] = true;
+	slot = i;
+      }
+  }
+
+  if (slot < 0) {
+    opserr << "WARNING ThreadSubdomain::ThreadSubdomain() - subdomain " << tag;
+    opserr << " has no thread, the maximum of " << MAX_NUM_FE_THREADS/2 << " exceeded\n";
+    return;
+  }
+
+  // the globals are set by the thread driving the analysis, the elements
+  // of the subdomain only read them
+  updateGlobals = false;
+
+  theThread = std::thread(&ThreadSubdomain::run, this);
+}
+
+ThreadSubdomain::~ThreadSubdomain()
+{
+  if (slot < 0)
+    return;
+
+  this->wait();
+  {
+    std::lock_guard<std::mutex> lock(theMutex);
+    stop = true;
+  }
+  theCondition.notify_all();
+  theThread.join();
+
+  std::lock_guard<std::mutex> lock(slotMutex);
+  slotUsed[slot] = false;
+}
+
+void
+ThreadSubdomain::run(void)
+{
+  FE_Element::setThreadSlot(slot);
+  DOF_Group::setThreadSlot(slot);
+
+  std::unique_lock<std::mutex> lock(theMutex);
+  while (true) {
+    theCondition.wait(lock, [this]{return haveJob == true || stop == true;});
+    if (haveJob == false)
+      break;
+
+    lock.unlock();
+    int res = job();
+    lock.lock();
+
+    jobResult = res;
+    haveJob = false;
+    theCondition.notify_all();
+  }
+}
+
+bool
+ThreadSubdomain::onThread(void)
+{
+  // without a thread all is done by the caller
+  if (slot < 0)
+    return true;
+
+  return std::this_thread::get_id() == theThread.get_id();
+}
+
+bool
+ThreadSubdomain::canRunConcurrently(void)
+{
+  ElementIter &theEles = this->getElements();
+  Element *theEle;
+  while ((theEle = theEles()) != 0)
+    if (theEle->isThreadSafe() == false)
+      return false;
+
+  return true;
+}
+
+void
+ThreadSubdomain::post(std::function<int(void)> theJob)
+{
+  std::lock_guard<std::mutex> lock(theMutex);
+  job = theJob;
+  haveJob = true;
+  theCondition.notify_all();
+}
+
+int
+ThreadSubdomain::wait(void)
+{
+  if (slot < 0)
+    return jobResult;
+
+  std::unique_lock<std::mutex> lock(theMutex);
+  theCondition.wait(lock, [this]{return haveJob == false;});
+  return jobResult;
+}
+
+int
+ThreadSubdomain::call(std::function<int(void)> theJob)
+{
+  if (this->onThread() == true)
+    return theJob();
+
+  this->wait();
+  pendingTask = 0;
+  this->post(theJob);
+  return this->wait();
+}
+
+int
+ThreadSubdomain::startTask(int task, double arg1, double arg2)
+{
+  if (slot < 0) {
+    jobResult = this->performTask(task, arg1, arg2);
+    pendingTask = task;
+    return 0;
+  }
+
+  this->wait();
+  bool concurrent = this->canRunConcurrently();
+
+  pendingTask = task;
+  this->post([this, task, arg1, arg2]{return this->performTask(task, arg1, arg2);});
+
+  // elements with shared scratch storage, let the task finish
+  if (concurrent == false)
+    this->wait();
+
+  return 0;
+}
+
+int
+ThreadSubdomain::finishTask(void)
+{
+  pendingTask = 0;
+  return this->wait();
+}
+
+bool
+ThreadSubdomain::isThreaded(void)
+{
+  return slot >= 0;
+}
+
+int
+ThreadSubdomain::commit(void)
+{
+  return this->call([this]{return this->Subdomain::commit();});
+}
+
+int
+ThreadSubdomain::revertToLastCommit(void)
+{
+  return this->call([this]{return this->Subdomain::revertToLastCommit();});
+}
+
+int
+ThreadSubdomain::revertToStart(void)
+{
+  return this->call([this]{return this->Subdomain::revertToStart();});
+}
+
+int
+ThreadSubdomain::update(void)
+{
+  return this->call([this]{return this->Subdomain::update();});
+}
+
+int
+ThreadSubdomain::update(double newTime, double dT)
+{
+  if (this->onThread() == false)
+    ops_Dt = dT;
+
+  return this->call([this, newTime, dT]{return this->Subdomain::update(newTime, dT);});
+}
+
+void
+ThreadSubdomain::wipeAnalysis(void)
+{
+  this->call([this]{this->Subdomain::wipeAnalysis(); return 0;});
+}
+
+void
+ThreadSubdomain::setDomainDecompAnalysis(DomainDecompositionAnalysis &theAnalysis)
+{
+  DomainDecompositionAnalysis *theDDA = &theAnalysis;
+  this->call([this, theDDA]{this->Subdomain::setDomainDecompAnalysis(*theDDA); return 0;});
+}
+
+int
+ThreadSubdomain::setAnalysisAlgorithm(EquiSolnAlgo &theAlgorithm)
+{
+  EquiSolnAlgo *theAlgo = &theAlgorithm;
+  return this->call([this, theAlgo]{return this->Subdomain::setAnalysisAlgorithm(*theAlgo);});
+}
+
+int
+ThreadSubdomain::setAnalysisIntegrator(IncrementalIntegrator &theIntegrator)
+{
+  IncrementalIntegrator *theInt = &theIntegrator;
+  return this->call([this, theInt]{return this->Subdomain::setAnalysisIntegrator(*theInt);});
+}
+
+int
+ThreadSubdomain::setAnalysisLinearSOE(LinearSOE &theSOE)
+{
+  LinearSOE *theLinSOE = &theSOE;
+  return this->call([this, theLinSOE]{return this->Subdomain::setAnalysisLinearSOE(*theLinSOE);});
+}
+
+int
+ThreadSubdomain::setAnalysisEigenSOE(EigenSOE &theSOE)
+{
+  EigenSOE *theEigSOE = &theSOE;
+  return this->call([this, theEigSOE]{return this->Subdomain::setAnalysisEigenSOE(*theEigSOE);});
+}
+
+int
+ThreadSubdomain::setAnalysisConvergenceTest(ConvergenceTest &theTest)
+{
+  ConvergenceTest *theConvTest = &theTest;
+  return this->call([this, theConvTest]{return this->Subdomain::setAnalysisConvergenceTest(*theConvTest);});
+}
+
+int
+ThreadSubdomain::invokeChangeOnAnalysis(void)
+{
+  return this->call([this]{return this->Subdomain::invokeChangeOnAnalysis();});
+}
+
+int
+ThreadSubdomain::computeTang(void)
+{
+  if (this->onThread() == true)
+    return this->Subdomain::computeTang();
+
+  // started by startTask()?
+  if (pendingTask == SUBDOMAIN_TASK_COMPUTE_TANG)
+    return this->finishTask();
+
+  return this->call([this]{return this->Subdomain::computeTang();});
+}
+
+int
+ThreadSubdomain::computeResidual(void)
+{
+  if (this->onThread() == true)
+    return this->Subdomain::computeResidual();
+
+  if (pendingTask == SUBDOMAIN_TASK_COMPUTE_RESIDUAL)
+    return this->finishTask();
+
+  return this->call([this]{return this->Subdomain::computeResidual();});
+}
+
+int
+ThreadSubdomain::computeNodalResponse(void)
+{
+  return this->call([this]{return this->Subdomain::computeNodalResponse();});
+}
+
+int
+ThreadSubdomain::analysisStep(double deltaT)
+{
+  return this->call([this, deltaT]{return this->Subdomain::analysisStep(deltaT);});
+}
+
+int
+ThreadSubdomain::eigenAnalysis(int numMode, bool generalized, bool findSmallest)
+{
+  return this->call([this, numMode, generalized, findSmallest]
+		    {return this->Subdomain::eigenAnalysis(numMode, generalized, findSmallest);});
+}
+
+const Matrix &
+ThreadSubdomain::getTang(void)
+{
+  if (this->onThread() == false)
+    this->wait();
+  return this->Subdomain::getTang();
+}
+
+const Vector &
+ThreadSubdomain::getResistingForce(void)
+{
+  if (this->onThread() == false)
+    this->wait();
+  return this->Subdomain::getResistingForce();
+}
+
+int
+ThreadSubdomain::record(bool fromAnalysis)
+{
+  if (this->onThread() == false)
+    this->wait();
+  return this->Subdomain::record(fromAnalysis);
+}
+
+void
+ThreadSubdomain::clearAll(void)
+{
+  if (this->onThread() == false)
+    this->wait();
+  this->Subdomain::clearAll();
+}
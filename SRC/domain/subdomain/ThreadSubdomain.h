@@ -0,0 +1,118 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+                                                                        
+#ifndef ThreadSubdomain_h
+#define ThreadSubdomain_h
+
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the class definition for ThreadSubdomain.
+// A ThreadSubdomain is a Subdomain which performs its analysis tasks 
+// (condensation, state determination, commit, analysis steps, ...) on a
+// thread of its own within the process. The tasks started by startTask()
+// on a number of ThreadSubdomains are done concurrently; finishTask() waits 
+// for the task and returns its result. PartitionedDomain and 
+// IncrementalIntegrator start the tasks of all the subdomains before 
+// finishing any of them. As the subdomains share the process, the 
+// condensed tangent and residual are returned by reference without copies.
+//
+// Each thread is given a slot for the class wide FE_Element and DOF_Group
+// objects. A subdomain containing Elements that are not thread safe (see
+// Element::isThreadSafe()) performs its tasks on its thread while the 
+// caller waits. The analysis set for the subdomain should form the 
+// FE_Elements and update the Domain with a single thread. The global
+// ops_Dt, ops_TheActiveDomain and ops_TheActiveElement are not written by
+// the subdomain's thread, they are left as set by the calling thread.
+//
+// What: "@(#) ThreadSubdomain.h, revA"
+
+#include <Subdomain.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+class ThreadSubdomain: public Subdomain
+{
+  public:
+    ThreadSubdomain(int tag);
+    ~ThreadSubdomain();
+
+    // two phase invocation of the analysis tasks
+    int startTask(int task, double arg1 = 0.0, double arg2 = 0.0);
+    int finishTask(void);
+    bool isThreaded(void);
+
+    // methods performed on the subdomain's thread
+    int commit(void);
+    int revertToLastCommit(void);
+    int revertToStart(void);
+    int update(void);
+    int update(double newTime, double dT);
+
+    void wipeAnalysis(void);
+    void setDomainDecompAnalysis(DomainDecompositionAnalysis &theAnalysis);
+    int setAnalysisAlgorithm(EquiSolnAlgo &theAlgorithm);
+    int setAnalysisIntegrator(IncrementalIntegrator &theIntegrator);
+    int setAnalysisLinearSOE(LinearSOE &theSOE);
+    int setAnalysisEigenSOE(EigenSOE &theSOE);
+    int setAnalysisConvergenceTest(ConvergenceTest &theTest);
+    int invokeChangeOnAnalysis(void);
+
+    int computeTang(void);
+    int computeResidual(void);
+    int computeNodalResponse(void);
+    int analysisStep(double deltaT);
+    int eigenAnalysis(int numMode, bool generalized, bool findSmallest);
+
+    // methods invoked once the subdomain's thread is idle
+    const Matrix &getTang(void);
+    const Vector &getResistingForce(void);
+    int record(bool fromAnalysis = true);
+    void clearAll(void);
+
+  protected:
+
+  private:
+    void run(void);
+    bool onThread(void);
+    bool canRunConcurrently(void);
+    void post(std::function<int(void)> theJob);
+    int wait(void);
+    int call(std::function<int(void)> theJob);
+
+    std::thread theThread;
+    std::mutex theMutex;
+    std::condition_variable theCondition;
+    std::function<int(void)> job;
+    bool haveJob;
+    bool stop;
+    int jobResult;
+    int slot;          // slot for the class wide FE_Element & DOF_Group objects
+    int pendingTask;   // task started and not yet finished
+
+    static std::mutex slotMutex;
+    static bool slotUsed[];
+};
+
+#endif
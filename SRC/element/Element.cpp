@@ -46,10 +46,9 @@
 
 Element  *ops_TheActiveElement = 0;
 
-Matrix **Element::theMatrices; 
-Vector **Element::theVectors1; 
-Vector **Element::theVectors2; 
-int  Element::numMatrices(0);
+OPS_THREAD_LOCAL std::deque<Matrix> Element::theMatrices; 
+OPS_THREAD_LOCAL std::deque<Vector> Element::theVectors1; 
+OPS_THREAD_LOCAL std::deque<Vector> Element::theVectors2; 
 
 // Element(int tag, int noExtNodes);
 // 	constructor that takes the element's unique tag and the number
@@ -111,75 +110,53 @@ Element::addInertiaLoadToUnbalance(const Vector &accel)
 }
 
 
-int
-Element::setRayleighDampingFactors(double alpham, double betak, double betak0, double betakc)
+// void setStorage(void);
+//	sets index to the entry of the class wide matrix and vectors used for
+//	the damping and residual calculations, creating an entry of size numDOF
+//	if there is none. The class wide storage is held per thread 
+//	(OPS_THREAD_LOCAL) so the entry is looked up again if the element is 
+//	handled by a thread other than the one that last selected it; it is
+//	freed when the thread exits.
+
+void
+Element::setStorage(void)
 {
-  alphaM = alpham;
-  betaK  = betak;
-  betaK0 = betak0;
-  betaKc = betakc;
+  int numMatrices = (int)theMatrices.size();
+  if (index != -1 && 
+      (index >= numMatrices || theMatrices[index].noRows() != this->getNumDOF()))
+    index = -1;
 
-  // check that memory has been allocated to store compute/return
-  // damping matrix & residual force calculations
   if (index == -1) {
     int numDOF = this->getNumDOF();
 
     for (int i=0; i<numMatrices; i++) {
-      Matrix *aMatrix = theMatrices[i];
-      if (aMatrix->noRows() == numDOF) {
+      if (theMatrices[i].noRows() == numDOF) {
 	index = i;
 	i = numMatrices;
       }
     }
     if (index == -1) {
-      Matrix **nextMatrices = new Matrix *[numMatrices+1];
-      if (nextMatrices == 0) {
-	opserr << "Element::getTheMatrix - out of memory\n";
-      }
-	  int j;
-      for (j=0; j<numMatrices; j++)
-	nextMatrices[j] = theMatrices[j];
-      Matrix *theMatrix = new Matrix(numDOF, numDOF);
-      if (theMatrix == 0) {
-	opserr << "Element::getTheMatrix - out of memory\n";
-	exit(-1);
-      }
-      nextMatrices[numMatrices] = theMatrix;
-
-      Vector **nextVectors1 = new Vector *[numMatrices+1];
-      Vector **nextVectors2 = new Vector *[numMatrices+1];
-      if (nextVectors1 == 0 || nextVectors2 == 0) {
-	opserr << "Element::getTheVector - out of memory\n";
-	exit(-1);
-      }
-
-      for (j=0; j<numMatrices; j++) {
-	nextVectors1[j] = theVectors1[j];
-	nextVectors2[j] = theVectors2[j];
-      }
-	
-      Vector *theVector1 = new Vector(numDOF);
-      Vector *theVector2 = new Vector(numDOF);
-      if (theVector1 == 0 || theVector2 == 0) {
-	opserr << "Element::getTheVector - out of memory\n";
-	exit(-1);
-      }
-
-      nextVectors1[numMatrices] = theVector1;
-      nextVectors2[numMatrices] = theVector2;
-
-      if (numMatrices != 0) {
-	delete [] theMatrices;
-	delete [] theVectors1;
-	delete [] theVectors2;
-      }
+      // a deque keeps the entries already handed out in place as it grows
+      theMatrices.emplace_back(numDOF, numDOF);
+      theVectors1.emplace_back(numDOF);
+      theVectors2.emplace_back(numDOF);
       index = numMatrices;
-      numMatrices++;
-      theMatrices = nextMatrices;
-      theVectors1 = nextVectors1;
-      theVectors2 = nextVectors2;
     }
   }
+}
+
+
+int
+Element::setRayleighDampingFactors(double alpham, double betak, double betak0, double betakc)
+{
+  alphaM = alpham;
+  betaK  = betak;
+  betaK0 = betak0;
+  betaKc = betakc;
+
+  // check that memory has been allocated to store compute/return
+  // damping matrix & residual force calculations
+  this->setStorage();
 
   // if need storage for Kc go get it
   if (betaKc != 0.0) {  
@@ -204,10 +181,11 @@ Element::getDamp(void)
 {
   if (index  == -1) {
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  } else
+    this->setStorage();
 
   // now compute the damping matrix
-  Matrix *theMatrix = theMatrices[index]; 
+  Matrix *theMatrix = &theMatrices[index]; 
   theMatrix->Zero();
   if (alphaM != 0.0)
     theMatrix->addMatrix(0.0, this->getMass(), alphaM);
@@ -229,10 +207,11 @@ Element::getMass(void)
 {
   if (index  == -1) {
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  } else
+    this->setStorage();
 
   // zero the matrix & return it
-  Matrix *theMatrix = theMatrices[index]; 
+  Matrix *theMatrix = &theMatrices[index]; 
   theMatrix->Zero();
   return *theMatrix;
 }
@@ -242,11 +221,12 @@ Element::getResistingForceIncInertia(void)
 {
   if (index == -1) {
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  } else
+    this->setStorage();
 
-  Matrix *theMatrix = theMatrices[index]; 
-  Vector *theVector = theVectors2[index];
-  Vector *theVector2 = theVectors1[index];
+  Matrix *theMatrix = &theMatrices[index]; 
+  Vector *theVector = &theVectors2[index];
+  Vector *theVector2 = &theVectors1[index];
 
   //
   // perform: R = P(U) - Pext(t);
@@ -309,11 +289,12 @@ Element::getRayleighDampingForces(void)
 
   if (index == -1) {
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  } else
+    this->setStorage();
 
-  Matrix *theMatrix = theMatrices[index]; 
-  Vector *theVector = theVectors2[index];
-  Vector *theVector2 = theVectors1[index];
+  Matrix *theMatrix = &theMatrices[index]; 
+  Vector *theVector = &theVectors2[index];
+  Vector *theVector2 = &theVectors1[index];
 
   //
   // perform: R = (alphaM * M + betaK0 * K0 + betaK * K) * v
@@ -407,6 +388,30 @@ Element::isSubdomain(void)
     return false;
 }
 
+// bool isThreadSafe(void) const;
+//	returns true if the element can be updated and formed concurrently with
+//	other elements, i.e. it and the objects it uses (sections, materials, 
+//	transformations) hold no shared scratch storage. Elements opt in by
+//	overriding the method; the default is false.
+
+bool
+Element::isThreadSafe(void) const
+{
+    return false;
+}
+
+// bool isTangentConstant(void) const;
+//	returns true if the tangent stiffness returned by the element does
+//	not change with the element state, so that it need only be assembled
+//	again after the domain changes. Elements opt in by overriding the 
+//	method; the default is false.
+
+bool
+Element::isTangentConstant(void) const
+{
+    return false;
+}
+
 Response*
 Element::setResponse(const char **argv, int argc, OPS_Stream &output)
 {
@@ -487,9 +492,10 @@ Element::getResistingForceSensitivity(int gradIndex)
 {
   if (index == -1) {
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  } else
+    this->setStorage();
 
-  Vector *theVector = theVectors1[index];
+  Vector *theVector = &theVectors1[index];
   theVector->Zero();
 
   return *theVector;
@@ -500,9 +506,10 @@ Element::getInitialStiffSensitivity(int gradIndex)
 {
   if (index == -1) {
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  } else
+    this->setStorage();
 
-  Matrix *theMatrix = theMatrices[index];
+  Matrix *theMatrix = &theMatrices[index];
   theMatrix->Zero();
 
   return *theMatrix;
@@ -513,9 +520,10 @@ Element::getMassSensitivity(int gradIndex)
 {
   if (index == -1) {
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  } else
+    this->setStorage();
 
-  Matrix *theMatrix = theMatrices[index];
+  Matrix *theMatrix = &theMatrices[index];
   theMatrix->Zero();
 
   return *theMatrix;
@@ -543,10 +551,11 @@ Element::getDampSensitivity(int gradIndex)
 {
   if (index  == -1) {
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  } else
+    this->setStorage();
 
   // now compute the damping matrix
-  Matrix *theMatrix = theMatrices[index]; 
+  Matrix *theMatrix = &theMatrices[index]; 
   theMatrix->Zero();
   if (alphaM != 0.0) {
     theMatrix->addMatrix(0.0, this->getMassSensitivity(gradIndex), alphaM);
@@ -575,7 +584,7 @@ Element::addResistingForceToNodalReaction(int flag)
   int numNodes = this->getNumExternalNodes();
   Node **theNodes = this->getNodePtrs();
 
-  static Vector theVector(48);
+  static OPS_THREAD_LOCAL Vector theVector(48);
 
   //
   // now determine the resisting force
@@ -705,9 +714,10 @@ Element::getGeometricTangentStiff()
 {
     if (index == -1) {
 	this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-    }
+    } else
+	this->setStorage();
     
-    Matrix *theMatrix = theMatrices[index];
+    Matrix *theMatrix = &theMatrices[index];
     theMatrix->Zero();
     
     return *theMatrix;
@@ -39,6 +39,7 @@
 
 #include <DomainComponent.h>
 #include <ID.h>
+#include <deque>
 
 class Matrix;
 class Vector;
@@ -66,6 +67,8 @@ class Element : public DomainComponent
     virtual int revertToStart(void);                
     virtual int update(void);
     virtual bool isSubdomain(void);
+    virtual bool isThreadSafe(void) const;
+    virtual bool isTangentConstant(void) const;
     
     // methods to return the current linearized stiffness,
     // damping and mass matrices
@@ -119,12 +122,12 @@ class Element : public DomainComponent
     int numPreviousK;
 
   private:
+    void setStorage(void);
     int index, nodeIndex;
 
-    static Matrix ** theMatrices; 
-    static Vector ** theVectors1; 
-    static Vector ** theVectors2; 
-    static int numMatrices;
+    static OPS_THREAD_LOCAL std::deque<Matrix> theMatrices; 
+    static OPS_THREAD_LOCAL std::deque<Vector> theVectors1; 
+    static OPS_THREAD_LOCAL std::deque<Vector> theVectors2; 
 };
 
 
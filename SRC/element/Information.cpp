@@ -35,28 +35,28 @@
 
 Information::Information() 
   :theType(UnknownType),
-   theID(0), theVector(0), theMatrix(0), theString(0)
+   theID(0), theVector(0), theMatrix(0), theString(0), theVectorView(false)
 {
     // does nothing
 }
 
 Information::Information(int val) 
   :theType(IntType), theInt(val),
-  theID(0), theVector(0), theMatrix(0), theString(0)
+  theID(0), theVector(0), theMatrix(0), theString(0), theVectorView(false)
 {
     // does nothing
 }
 
 Information::Information(double val) 
   :theType(DoubleType), theDouble(val),
-  theID(0), theVector(0), theMatrix(0), theString(0)
+  theID(0), theVector(0), theMatrix(0), theString(0), theVectorView(false)
 {
   // does nothing
 }
 
 Information::Information(const ID &val) 
   :theType(IdType),
-  theID(0), theVector(0), theMatrix(0), theString(0)
+  theID(0), theVector(0), theMatrix(0), theString(0), theVectorView(false)
 {
   // Make a copy
   theID = new ID(val);
@@ -67,7 +67,7 @@ Information::Information(const ID &val)
 
 Information::Information(const Vector &val) 
   :theType(VectorType),
-  theID(0), theVector(0), theMatrix(0), theString(0)
+  theID(0), theVector(0), theMatrix(0), theString(0), theVectorView(false)
 {
   // Make a copy
   theVector = new Vector(val);
@@ -78,7 +78,7 @@ Information::Information(const Vector &val)
 
 Information::Information(const Matrix &val) 
   :theType(MatrixType),
-   theID(0), theVector(0), theMatrix(0), theString(0)
+   theID(0), theVector(0), theMatrix(0), theString(0), theVectorView(false)
 {
   // Make a copy
   theMatrix = new Matrix(val);
@@ -89,7 +89,7 @@ Information::Information(const Matrix &val)
 
 Information::Information(const ID &val1, const Vector &val2) 
   :theType(IdType),
-   theID(0), theVector(0), theMatrix(0), theString(0)
+   theID(0), theVector(0), theMatrix(0), theString(0), theVectorView(false)
 {
   // Make a copy
   theID = new ID(val1);
@@ -143,6 +143,13 @@ Information::setID(const ID &newID)
 int 
 Information::setVector(const Vector &newVector)
 {
+  if (theVectorView == true && theVector->Size() != newVector.Size()) {
+    // not the size the storage was set up for, go back to a Vector of our own
+    delete theVector;
+    theVector = 0;
+    theVectorView = false;
+  }
+
   if (theVector != 0) {
     *theVector = newVector;
   } else {
@@ -235,6 +242,21 @@ Information::Print(ofstream &s, int flag)
   return;
 }
 
+// have theVector use size doubles at data, storage owned by the caller (e.g.
+// a slice of a recorder's output Vector); setVector() and getData() then
+// write straight into it
+int
+Information::setStorage(double *data, int size)
+{
+  if (theVector != 0)
+    delete theVector;
+
+  theVector = new Vector(data, size);
+  theVectorView = true;
+
+  return 0;
+}
+
 const Vector &
 Information::getData(void) 
 {
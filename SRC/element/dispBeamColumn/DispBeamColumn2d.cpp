@@ -49,9 +49,9 @@
 #include <string>
 #include <ElementIter.h>
 
-Matrix DispBeamColumn2d::K(6,6);
-Vector DispBeamColumn2d::P(6);
-double DispBeamColumn2d::workArea[100];
+OPS_THREAD_LOCAL Matrix DispBeamColumn2d::K(6,6);
+OPS_THREAD_LOCAL Vector DispBeamColumn2d::P(6);
+OPS_THREAD_LOCAL double DispBeamColumn2d::workArea[100];
 
 void* OPS_DispBeamColumn2d()
 {
@@ -426,6 +426,25 @@ DispBeamColumn2d::revertToStart()
 
     return retVal;
 }
+bool
+DispBeamColumn2d::isThreadSafe(void) const
+{
+  // the scratch storage of the element and the linear, p-delta and
+  // corotational transformations is held per thread, the sections and
+  // their materials must be thread safe as well
+  int transfTag = crdTransf->getClassTag();
+  if (transfTag != CRDTR_TAG_LinearCrdTransf2d && 
+      transfTag != CRDTR_TAG_PDeltaCrdTransf2d &&
+      transfTag != CRDTR_TAG_CorotCrdTransf2d)
+    return false;
+
+  for (int i = 0; i < numSections; i++)
+    if (theSections[i]->isThreadSafe() == false)
+      return false;
+
+  return true;
+}
+
 
 int
 DispBeamColumn2d::update(void)
@@ -554,7 +573,7 @@ DispBeamColumn2d::getBasicStiff(Matrix &kb, int initial)
 const Matrix&
 DispBeamColumn2d::getTangentStiff()
 {
-  static Matrix kb(3,3);
+  static OPS_THREAD_LOCAL Matrix kb(3,3);
 
   this->getBasicStiff(kb);
 
@@ -615,7 +634,7 @@ DispBeamColumn2d::getTangentStiff()
 const Matrix&
 DispBeamColumn2d::getInitialBasicStiff()
 {
-  static Matrix kb(3,3);
+  static OPS_THREAD_LOCAL Matrix kb(3,3);
 
   // Zero for integral
   kb.Zero();
@@ -717,7 +736,7 @@ DispBeamColumn2d::getMass()
     K(0,0) = K(1,1) = K(3,3) = K(4,4) = m;
   } else  {
     // consistent mass matrix
-    static Matrix ml(6,6);
+    static OPS_THREAD_LOCAL Matrix ml(6,6);
     double m = rho*L/420.0;
     ml(0,0) = ml(3,3) = m*140.0;
     ml(0,3) = ml(3,0) = m*70.0;
@@ -846,7 +865,7 @@ DispBeamColumn2d::addInertiaLoadToUnbalance(const Vector &accel)
       Q(4) -= m*Raccel2(1);
     } else  {
       // use matrix vector multip. for consistent mass matrix
-      static Vector Raccel(6);
+      static OPS_THREAD_LOCAL Vector Raccel(6);
       for (int i=0; i<3; i++)  {
         Raccel(i)   = Raccel1(i);
         Raccel(i+3) = Raccel2(i);
@@ -940,7 +959,7 @@ DispBeamColumn2d::getResistingForceIncInertia()
     P(4) += m*accel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(6);
+    static OPS_THREAD_LOCAL Vector accel(6);
     for (int i=0; i<3; i++)  {
       accel(i)   = accel1(i);
       accel(i+3) = accel2(i);
@@ -73,6 +73,7 @@ class DispBeamColumn2d : public Element
 
     // public methods to obtain stiffness, mass, damping and residual information    
     int update(void);
+    bool isThreadSafe(void) const;
     const Matrix &getTangentStiff(void);
     const Matrix &getInitialStiff(void);
     const Matrix &getMass(void);
@@ -122,8 +123,8 @@ class DispBeamColumn2d : public Element
 
     Node *theNodes[2];
 
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
+    static OPS_THREAD_LOCAL Matrix K;		// Element stiffness, damping, and mass Matrix
+    static OPS_THREAD_LOCAL Vector P;		// Element resisting force vector
 
     Vector Q;      // Applied nodal loads
     Vector q;      // Basic force
@@ -135,7 +136,7 @@ class DispBeamColumn2d : public Element
 
     enum {maxNumSections = 20};
 
-    static double workArea[];
+    static OPS_THREAD_LOCAL double workArea[];
 
     // AddingSensitivity:BEGIN //////////////////////////////////////////
     int parameterID;
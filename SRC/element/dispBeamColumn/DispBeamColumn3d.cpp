@@ -49,9 +49,9 @@
 #include <elementAPI.h>
 #include <string>
 
-Matrix DispBeamColumn3d::K(12,12);
-Vector DispBeamColumn3d::P(12);
-double DispBeamColumn3d::workArea[200];
+OPS_THREAD_LOCAL Matrix DispBeamColumn3d::K(12,12);
+OPS_THREAD_LOCAL Vector DispBeamColumn3d::P(12);
+OPS_THREAD_LOCAL double DispBeamColumn3d::workArea[200];
 
     
 //Element *theEle =  new DispBeamColumn3d(iData[0],iData[1],iData[2],secTags.Size(),sections,*bi,*theTransf,mass,cmass);
@@ -280,6 +280,25 @@ DispBeamColumn3d::revertToStart()
 
     return retVal;
 }
+bool
+DispBeamColumn3d::isThreadSafe(void) const
+{
+  // the scratch storage of the element and the linear, p-delta and
+  // corotational transformations is held per thread, the sections and
+  // their materials must be thread safe as well
+  int transfTag = crdTransf->getClassTag();
+  if (transfTag != CRDTR_TAG_LinearCrdTransf3d && 
+      transfTag != CRDTR_TAG_PDeltaCrdTransf3d &&
+      transfTag != CRDTR_TAG_CorotCrdTransf3d)
+    return false;
+
+  for (int i = 0; i < numSections; i++)
+    if (theSections[i]->isThreadSafe() == false)
+      return false;
+
+  return true;
+}
+
 
 int
 DispBeamColumn3d::update(void)
@@ -344,7 +363,7 @@ DispBeamColumn3d::update(void)
 const Matrix&
 DispBeamColumn3d::getTangentStiff()
 {
-  static Matrix kb(6,6);
+  static OPS_THREAD_LOCAL Matrix kb(6,6);
   
   // Zero for integral
   kb.Zero();
@@ -476,7 +495,7 @@ DispBeamColumn3d::getTangentStiff()
 const Matrix&
 DispBeamColumn3d::getInitialBasicStiff()
 {
-  static Matrix kb(6,6);
+  static OPS_THREAD_LOCAL Matrix kb(6,6);
   
   // Zero for integral
   kb.Zero();
@@ -598,7 +617,7 @@ DispBeamColumn3d::getMass()
     K(0,0) = K(1,1) = K(2,2) = K(6,6) = K(7,7) = K(8,8) = m;
   } else  {
     // consistent mass matrix
-    static Matrix ml(12,12);
+    static OPS_THREAD_LOCAL Matrix ml(12,12);
     double m = rho*L/420.0;
     ml(0,0) = ml(6,6) = m*140.0;
     ml(0,6) = ml(6,0) = m*70.0;
@@ -761,7 +780,7 @@ DispBeamColumn3d::addInertiaLoadToUnbalance(const Vector &accel)
     Q(8) -= m*Raccel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(12);
+    static OPS_THREAD_LOCAL Vector Raccel(12);
     for (int i=0; i<6; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+6) = Raccel2(i);
@@ -862,7 +881,7 @@ DispBeamColumn3d::getResistingForceIncInertia()
     P(8) += m*accel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(12);
+    static OPS_THREAD_LOCAL Vector accel(12);
     for (int i=0; i<6; i++)  {
       accel(i)   = accel1(i);
       accel(i+6) = accel2(i);
@@ -51,9 +51,12 @@
 #include <string>
 #include <ElementIter.h>
 
-Matrix ElasticBeam2d::K(6,6);
-Vector ElasticBeam2d::P(6);
-Matrix ElasticBeam2d::kb(3,3);
+MatrixN<6,6> ElasticBeam2d::KN;
+VectorN<6> ElasticBeam2d::PN;
+MatrixN<3,3> ElasticBeam2d::kbN;
+Matrix ElasticBeam2d::K(KN.getData(), 6, 6);
+Vector ElasticBeam2d::P(PN.getData(), 6);
+Matrix ElasticBeam2d::kb(kbN.getData(), 3, 3);
 
 //return new ElasticBeam2d(iData[0],data[0],data[1],data[2],iData[1],iData[2],*theTransf,alpha,depth,mass,cMass);
 
@@ -218,6 +221,12 @@ ElasticBeam2d::update(void)
   return theCoordTransf->update();
 }
 
+bool
+ElasticBeam2d::isTangentConstant(void) const
+{
+  return theCoordTransf != 0 && theCoordTransf->isLinear();
+}
+
 const Matrix &
 ElasticBeam2d::getTangentStiff(void)
 {
@@ -277,7 +286,8 @@ ElasticBeam2d::getMass(void)
             K(0,0) = K(1,1) = K(3,3) = K(4,4) = m;
         } else  {
             // consistent mass matrix
-            static Matrix ml(6,6);
+            MatrixN<6,6> mlN;
+            Matrix ml(mlN.getData(), 6, 6);
             double m = rho*L/420.0;
             ml(0,0) = ml(3,3) = m*140.0;
             ml(0,3) = ml(3,0) = m*70.0;
@@ -434,12 +444,16 @@ ElasticBeam2d::addInertiaLoadToUnbalance(const Vector &accel)
     Q(4) -= m * Raccel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(6);
+    VectorN<6> Raccel;
     for (int i=0; i<3; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+3) = Raccel2(i);
     }
-    Q.addMatrixVector(1.0, this->getMass(), Raccel, -1.0);
+    this->getMass();
+    VectorN<6> MRaccel;
+    MRaccel.addMatrixVector(0.0, KN, Raccel, 1.0);
+    for (int i=0; i<6; i++)
+      Q(i) -= MRaccel(i);
   }
   
   return 0;
@@ -476,12 +490,13 @@ ElasticBeam2d::getResistingForceIncInertia()
     P(4) += m * accel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(6);
+    VectorN<6> accel;
     for (int i=0; i<3; i++)  {
       accel(i)   = accel1(i);
       accel(i+3) = accel2(i);
     }
-    P.addMatrixVector(1.0, this->getMass(), accel, 1.0);
+    this->getMass();
+    PN.addMatrixVector(1.0, KN, accel, 1.0);
   }
   
   return P;
@@ -36,6 +36,7 @@
 #include <Node.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <MatrixN.h>
 
 class Channel;
 class Information;
@@ -67,6 +68,7 @@ class ElasticBeam2d : public Element
     int revertToStart(void);
     
     int update(void);
+    bool isTangentConstant(void) const;
     const Matrix &getTangentStiff(void);
     const Matrix &getInitialStiff(void);
     const Matrix &getMass(void);    
@@ -96,11 +98,14 @@ class ElasticBeam2d : public Element
     double rho;       // mass per unit length
     int cMass;        // consistent mass flag
 
-    static Matrix K;
-    static Vector P;
+    static MatrixN<6,6> KN;   // class wide storage
+    static VectorN<6> PN;
+    static MatrixN<3,3> kbN;
+    static Matrix K;          // class wide Matrix, viewing KN
+    static Vector P;          // class wide Vector, viewing PN
     Vector Q;
     
-    static Matrix kb;
+    static Matrix kb;         // viewing kbN
     Vector q;
     double q0[3];  // Fixed end forces in basic system
     double p0[3];  // Reactions in basic system
@@ -50,9 +50,12 @@
 #include <string>
 #include <elementAPI.h>
 
-Matrix ElasticBeam3d::K(12,12);
-Vector ElasticBeam3d::P(12);
-Matrix ElasticBeam3d::kb(6,6);
+MatrixN<12,12> ElasticBeam3d::KN;
+VectorN<12> ElasticBeam3d::PN;
+MatrixN<6,6> ElasticBeam3d::kbN;
+Matrix ElasticBeam3d::K(KN.getData(), 12, 12);
+Vector ElasticBeam3d::P(PN.getData(), 12);
+Matrix ElasticBeam3d::kb(kbN.getData(), 6, 6);
 
 
 // return new ElasticBeam3d(iData[0],iData[1],iData[2],theSection,*theTrans,mass,cMass); 
@@ -295,6 +298,12 @@ ElasticBeam3d::update(void)
   return theCoordTransf->update();
 }
 
+bool
+ElasticBeam3d::isTangentConstant(void) const
+{
+  return theCoordTransf != 0 && theCoordTransf->isLinear();
+}
+
 const Matrix &
 ElasticBeam3d::getTangentStiff(void)
 {
@@ -378,7 +387,8 @@ ElasticBeam3d::getMass(void)
             K(8,8) = m;
         } else  {
             // consistent mass matrix
-            static Matrix ml(12,12);
+            MatrixN<12,12> mlN;
+            Matrix ml(mlN.getData(), 12, 12);
             double m = rho*L/420.0;
             ml(0,0) = ml(6,6) = m*140.0;
             ml(0,6) = ml(6,0) = m*70.0;
@@ -542,12 +552,16 @@ ElasticBeam3d::addInertiaLoadToUnbalance(const Vector &accel)
     Q(8) -= m * Raccel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(12);
+    VectorN<12> Raccel;
     for (int i=0; i<6; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+6) = Raccel2(i);
     }
-    Q.addMatrixVector(1.0, this->getMass(), Raccel, -1.0);
+    this->getMass();
+    VectorN<12> MRaccel;
+    MRaccel.addMatrixVector(0.0, KN, Raccel, 1.0);
+    for (int i=0; i<12; i++)
+      Q(i) -= MRaccel(i);
   }
   
   return 0;
@@ -587,12 +601,13 @@ ElasticBeam3d::getResistingForceIncInertia()
     P(8) += m * accel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(12);
+    VectorN<12> accel;
     for (int i=0; i<6; i++)  {
       accel(i)   = accel1(i);
       accel(i+6) = accel2(i);
     }
-    P.addMatrixVector(1.0, this->getMass(), accel, 1.0);
+    this->getMass();
+    PN.addMatrixVector(1.0, KN, accel, 1.0);
   }
   
   return P;
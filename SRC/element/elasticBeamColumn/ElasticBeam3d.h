@@ -36,6 +36,7 @@
 #include <Node.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <MatrixN.h>
 
 class Channel;
 class Information;
@@ -73,6 +74,7 @@ class ElasticBeam3d : public Element
     int revertToStart(void);
     
     int update(void);
+    bool isTangentConstant(void) const;
     const Matrix &getTangentStiff(void);
     const Matrix &getInitialStiff(void);
     const Matrix &getMass(void);    
@@ -103,11 +105,14 @@ class ElasticBeam3d : public Element
     int cMass;
     int sectionTag;
 
-    static Matrix K;
-    static Vector P;
+    static MatrixN<12,12> KN; // class wide storage
+    static VectorN<12> PN;
+    static MatrixN<6,6> kbN;
+    static Matrix K;          // class wide Matrix, viewing KN
+    static Vector P;          // class wide Vector, viewing PN
     Vector Q;
     
-    static Matrix kb;
+    static Matrix kb;         // viewing kbN
     Vector q;
     double q0[5];  // Fixed end forces in basic system (no torsion)
     double p0[5];  // Reactions in basic system (no torsion)
@@ -49,8 +49,10 @@
 
 
 // initialize the class wide variables
-Matrix ElasticTimoshenkoBeam2d::theMatrix(6,6);
-Vector ElasticTimoshenkoBeam2d::theVector(6);
+MatrixN<6,6> ElasticTimoshenkoBeam2d::theMatrixN;
+VectorN<6> ElasticTimoshenkoBeam2d::theVectorN;
+Matrix ElasticTimoshenkoBeam2d::theMatrix(theMatrixN.getData(), 6, 6);
+Vector ElasticTimoshenkoBeam2d::theVector(theVectorN.getData(), 6);
 
 // theElement = new ElasticTimoshenkoBeam2d(iData[0], iData[1], iData[2], dData[0], dData[1], dData[2], dData[3], dData[4], *theTrans, dData[5], iData[4]);
 
@@ -59,8 +61,8 @@ ElasticTimoshenkoBeam2d::ElasticTimoshenkoBeam2d(int tag, int Nd1, int Nd2,
     double r, int cm)
     : Element(tag, ELE_TAG_ElasticTimoshenkoBeam2d),
     connectedExternalNodes(2), theCoordTransf(0), E(e), G(g), A(a), Iz(iz),
-    Avy(avy), rho(r), cMass(cm), nlGeo(0), phi(0.0), L(0.0), ul(6), ql(6),
-    ql0(6), kl(6,6), klgeo(6,6), Tgl(6,6), Ki(6,6), M(6,6), theLoad(6)
+    Avy(avy), rho(r), cMass(cm), nlGeo(0), phi(0.0), L(0.0),
+    Ki(6,6), M(6,6), theLoad(6)
 {
     // ensure the connectedExternalNode ID is of correct size & set values
     if (connectedExternalNodes.Size() != 2)  {
@@ -105,8 +107,8 @@ ElasticTimoshenkoBeam2d::ElasticTimoshenkoBeam2d(int tag, int Nd1, int Nd2,
 ElasticTimoshenkoBeam2d::ElasticTimoshenkoBeam2d()
     : Element(0, ELE_TAG_ElasticTimoshenkoBeam2d),
     connectedExternalNodes(2), theCoordTransf(0), E(0.0), G(0.0), A(0.0),
-    Iz(0.0), Avy(0.0), rho(0.0), cMass(0), nlGeo(0), phi(0.0), L(0.0), ul(6),
-    ql(6), ql0(6), kl(6,6), klgeo(6,6), Tgl(6,6), Ki(6,6), M(6,6), theLoad(6)
+    Iz(0.0), Avy(0.0), rho(0.0), cMass(0), nlGeo(0), phi(0.0), L(0.0),
+    Ki(6,6), M(6,6), theLoad(6)
 {
     // ensure the connectedExternalNode ID is of correct size & set values
     if (connectedExternalNodes.Size() != 2)  {
@@ -253,22 +255,18 @@ int ElasticTimoshenkoBeam2d::update()
 
 const Matrix& ElasticTimoshenkoBeam2d::getTangentStiff()
 {
-    // zero the matrix
-    theMatrix.Zero();
-    
     if (nlGeo == 0)  {
         // transform from local to global system
-        theMatrix.addMatrixTripleProduct(0.0, Tgl, kl, 1.0);
+        theMatrixN.addMatrixTripleProduct(0.0, Tgl, kl, 1.0);
         
     } else  {
         // initialize local stiffness matrix
-        static Matrix klTot(6,6);
-        klTot.addMatrix(0.0, kl, 1.0);
+        MatrixN<6,6> klTot(kl);
         
         // get global trial displacements
         const Vector &dsp1 = theNodes[0]->getTrialDisp();
         const Vector &dsp2 = theNodes[1]->getTrialDisp();
-        static Vector ug(6);
+        VectorN<6> ug;
         for (int i=0; i<3; i++)  {
             ug(i)   = dsp1(i);
             ug(i+3) = dsp2(i);
@@ -285,7 +283,7 @@ const Matrix& ElasticTimoshenkoBeam2d::getTangentStiff()
             klTot.addMatrix(1.0, klgeo, ql(0));
         
         // transform from local to global system
-        theMatrix.addMatrixTripleProduct(0.0, Tgl, klTot, 1.0);
+        theMatrixN.addMatrixTripleProduct(0.0, Tgl, klTot, 1.0);
     }
     
     return theMatrix;
@@ -370,13 +368,10 @@ int ElasticTimoshenkoBeam2d::addInertiaLoadToUnbalance(const Vector &accel)
 
 const Vector& ElasticTimoshenkoBeam2d::getResistingForce()
 {
-    // zero the residual
-    theVector.Zero();
-    
     // get global trial displacements
     const Vector &dsp1 = theNodes[0]->getTrialDisp();
     const Vector &dsp2 = theNodes[1]->getTrialDisp();
-    static Vector ug(6);
+    VectorN<6> ug;
     for (int i=0; i<3; i++)  {
         ug(i)   = dsp1(i);
         ug(i+3) = dsp2(i);
@@ -396,7 +391,7 @@ const Vector& ElasticTimoshenkoBeam2d::getResistingForce()
     ql.addVector(1.0, ql0, 1.0);
     
     // determine resisting forces in global system
-    theVector.addMatrixTransposeVector(0.0, Tgl, ql, 1.0);
+    theVectorN.addMatrixTransposeVector(0.0, Tgl, ql, 1.0);
     
     return theVector;
 }
@@ -666,9 +661,8 @@ int ElasticTimoshenkoBeam2d::getResponse (int responseID, Information &eleInfo)
         return eleInfo.setVector(this->getResistingForce());
 
     case 2: // local forces
-        theVector.Zero();
         // determine resisting forces in local system
-        theVector = ql;
+        theVectorN = ql;
         
         return eleInfo.setVector(theVector);
 
@@ -807,7 +801,8 @@ void ElasticTimoshenkoBeam2d::setUp()
     }
     
     // compute initial stiffness matrix in global system
-    Ki.addMatrixTripleProduct(0.0, Tgl, kl, 1.0);
+    theMatrixN.addMatrixTripleProduct(0.0, Tgl, kl, 1.0);
+    Ki = theMatrix;
     
     // compute mass matrix in global system
     M.Zero();
@@ -821,8 +816,7 @@ void ElasticTimoshenkoBeam2d::setUp()
             }
         } else  {
             // consistent mass matrix
-            Matrix mlTrn(6,6), mlRot(6,6), ml(6,6);
-            mlTrn.Zero(); mlRot.Zero(); ml.Zero();
+            MatrixN<6,6> mlTrn, mlRot;
             double c1x = rho*L/210.0;
             mlTrn(0,0) = mlTrn(3,3) = c1x*70.0;
             mlTrn(0,3) = mlTrn(3,0) = c1x*35.0;
@@ -843,9 +837,10 @@ void ElasticTimoshenkoBeam2d::setUp()
             mlRot(1,2) = mlRot(2,1) = mlRot(1,5) = mlRot(5,1) = -c2z*L*(15.0*phi - 3.0);
             mlRot(2,4) = mlRot(4,2) = mlRot(4,5) = mlRot(5,4) = -mlRot(1,2);
             // add translational and rotational parts
-            ml = mlTrn + mlRot;
+            mlTrn.addMatrix(1.0, mlRot, 1.0);
             // transform from local to global system
-            M.addMatrixTripleProduct(0.0, Tgl, ml, 1.0);
+            theMatrixN.addMatrixTripleProduct(0.0, Tgl, mlTrn, 1.0);
+            M = theMatrix;
         }
     }
 }
@@ -35,6 +35,7 @@
 
 #include <Element.h>
 #include <Matrix.h>
+#include <MatrixN.h>
 
 class CrdTransf;
 
@@ -116,19 +117,21 @@ private:
     double L;    // element length
     
     // state variables
-    Vector ul;     // displacements in local system
-    Vector ql;     // forces in local system
-    Vector ql0;    // fixed end forces due to loads in local system
-    Matrix kl;     // stiffness matrix in local system
-    Matrix klgeo;  // geometric stiffness matrix in local system
+    VectorN<6> ul;                  // displacements in local system
+    VectorN<6> ql;                  // forces in local system
+    VectorN<6> ql0;                 // fixed end forces due to loads in local system
+    MatrixN<6,6> kl;                // stiffness matrix in local system
+    MatrixN<6,6> klgeo;             // geometric stiffness matrix in local system
     
     // constant variables
-    Matrix Tgl;  // transformation matrix from global to local system
-    Matrix Ki;   // initial stiffness matrix in global system
-    Matrix M;    // mass matrix in global system
-    
-    static Matrix theMatrix;  // a class wide Matrix
-    static Vector theVector;  // a class wide Vector
+    MatrixN<6,6> Tgl;               // transformation matrix from global to local system
+    Matrix Ki;                      // initial stiffness matrix in global system
+    Matrix M;                       // mass matrix in global system
+    
+    static MatrixN<6,6> theMatrixN; // class wide storage
+    static VectorN<6> theVectorN;
+    static Matrix theMatrix;        // a class wide Matrix, viewing theMatrixN
+    static Vector theVector;        // a class wide Vector, viewing theVectorN
     Vector theLoad;
 };
 
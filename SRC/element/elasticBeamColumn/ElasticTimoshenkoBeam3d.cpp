@@ -49,8 +49,10 @@
 
 
 // initialize the class wide variables
-Matrix ElasticTimoshenkoBeam3d::theMatrix(12,12);
-Vector ElasticTimoshenkoBeam3d::theVector(12);
+MatrixN<12,12> ElasticTimoshenkoBeam3d::theMatrixN;
+VectorN<12> ElasticTimoshenkoBeam3d::theVectorN;
+Matrix ElasticTimoshenkoBeam3d::theMatrix(theMatrixN.getData(), 12, 12);
+Vector ElasticTimoshenkoBeam3d::theVector(theVectorN.getData(), 12);
 
 // theElement = new ElasticTimoshenkoBeam3d(iData[0], iData[1], iData[2], dData[0], dData[1], dData[2], dData[3], dData[4], dData[5], dData[6], dData[7], *theTrans, dData[8], iData[4], dData[9]);
 
@@ -60,8 +62,7 @@ ElasticTimoshenkoBeam3d::ElasticTimoshenkoBeam3d(int tag, int Nd1, int Nd2,
     : Element(tag, ELE_TAG_ElasticTimoshenkoBeam3d),
     connectedExternalNodes(2), theCoordTransf(0), E(e), G(g), A(a), Jx(jx),
     Iy(iy), Iz(iz), Avy(avy), Avz(avz), rho(r), cMass(cm), lenfactor(LenFactor), nlGeo(0), phiY(0.0),
-    phiZ(0.0), L(0.0), ul(12), ql(12), ql0(12), kl(12,12), klgeo(12,12),
-    Tgl(12,12), Ki(12,12), M(12,12), theLoad(12)
+    phiZ(0.0), L(0.0), Ki(12,12), M(12,12), theLoad(12)
 {
     // ensure the connectedExternalNode ID is of correct size & set values
     if (connectedExternalNodes.Size() != 2)  {
@@ -107,8 +108,7 @@ ElasticTimoshenkoBeam3d::ElasticTimoshenkoBeam3d()
     : Element(0, ELE_TAG_ElasticTimoshenkoBeam3d),
     connectedExternalNodes(2), theCoordTransf(0), E(0.0), G(0.0), A(0.0),
     Jx(0.0), Iy(0.0), Iz(0.0), Avy(0.0), Avz(0.0), rho(0.0), cMass(0), lenfactor(0),
-    nlGeo(0), phiY(0.0), phiZ(0.0), L(0.0), ul(12), ql(12), ql0(12),
-    kl(12,12), klgeo(12,12), Tgl(12,12), Ki(12,12), M(12,12), theLoad(12)
+    nlGeo(0), phiY(0.0), phiZ(0.0), L(0.0), Ki(12,12), M(12,12), theLoad(12)
 {
     // ensure the connectedExternalNode ID is of correct size & set values
     if (connectedExternalNodes.Size() != 2)  {
@@ -255,22 +255,18 @@ int ElasticTimoshenkoBeam3d::update()
 
 const Matrix& ElasticTimoshenkoBeam3d::getTangentStiff()
 {
-    // zero the matrix
-    theMatrix.Zero();
-    
     if (nlGeo == 0)  {
         // transform from local to global system
-        theMatrix.addMatrixTripleProduct(0.0, Tgl, kl, 1.0);
+        theMatrixN.addMatrixTripleProduct(0.0, Tgl, kl, 1.0);
         
     } else  {
         // initialize local stiffness matrix
-        static Matrix klTot(12,12);
-        klTot.addMatrix(0.0, kl, 1.0);
+        MatrixN<12,12> klTot(kl);
         
         // get global trial displacements
         const Vector &dsp1 = theNodes[0]->getTrialDisp();
         const Vector &dsp2 = theNodes[1]->getTrialDisp();
-        static Vector ug(12);
+        VectorN<12> ug;
         for (int i=0; i<6; i++)  {
             ug(i)   = dsp1(i);
             ug(i+6) = dsp2(i);
@@ -287,7 +283,7 @@ const Matrix& ElasticTimoshenkoBeam3d::getTangentStiff()
             klTot.addMatrix(1.0, klgeo, ql(0));
         
         // transform from local to global system
-        theMatrix.addMatrixTripleProduct(0.0, Tgl, klTot, 1.0);
+        theMatrixN.addMatrixTripleProduct(0.0, Tgl, klTot, 1.0);
     }
     
     return theMatrix;
@@ -379,13 +375,10 @@ int ElasticTimoshenkoBeam3d::addInertiaLoadToUnbalance(const Vector &accel)
 
 const Vector& ElasticTimoshenkoBeam3d::getResistingForce()
 {
-    // zero the residual
-    theVector.Zero();
-    
     // get global trial displacements
     const Vector &dsp1 = theNodes[0]->getTrialDisp();
     const Vector &dsp2 = theNodes[1]->getTrialDisp();
-    static Vector ug(12);
+    VectorN<12> ug;
     for (int i=0; i<6; i++)  {
         ug(i)   = dsp1(i);
         ug(i+6) = dsp2(i);
@@ -405,7 +398,7 @@ const Vector& ElasticTimoshenkoBeam3d::getResistingForce()
     ql.addVector(1.0, ql0, 1.0);
     
     // determine resisting forces in global system
-    theVector.addMatrixTransposeVector(0.0, Tgl, ql, 1.0);
+    theVectorN.addMatrixTransposeVector(0.0, Tgl, ql, 1.0);
     
     return theVector;
 }
@@ -695,9 +688,8 @@ int ElasticTimoshenkoBeam3d::getResponse (int responseID, Information &eleInfo)
         return eleInfo.setVector(this->getResistingForce());
 
     case 2: // local forces
-        theVector.Zero();
         // determine resisting forces in local system
-        theVector = ql;
+        theVectorN = ql;
         
         return eleInfo.setVector(theVector);
 
@@ -890,7 +882,8 @@ void ElasticTimoshenkoBeam3d::setUp()
     }
     
     // compute initial stiffness matrix in global system
-    Ki.addMatrixTripleProduct(0.0, Tgl, kl, 1.0);
+    theMatrixN.addMatrixTripleProduct(0.0, Tgl, kl, 1.0);
+    Ki = theMatrix;
     
     // compute mass matrix in global system
     M.Zero();
@@ -904,8 +897,7 @@ void ElasticTimoshenkoBeam3d::setUp()
             }
         } else  {
             // consistent mass matrix
-            Matrix mlTrn(12,12), mlRot(12,12), ml(12,12);
-            mlTrn.Zero(); mlRot.Zero(); ml.Zero();
+            MatrixN<12,12> mlTrn, mlRot;
             double c1x = rho*L/210.0;
             mlTrn(0,0) = mlTrn(6,6) = c1x*70.0;
             mlTrn(0,6) = mlTrn(6,0) = c1x*35.0;
@@ -947,9 +939,10 @@ void ElasticTimoshenkoBeam3d::setUp()
             mlRot(1,5) = mlRot(5,1) = mlRot(1,11) = mlRot(11,1) = -c2z*L*(15.0*phiZ - 3.0);
             mlRot(5,7) = mlRot(7,5) = mlRot(7,11) = mlRot(11,7) = -mlRot(1,5);
             // add translational and rotational parts
-            ml = mlTrn + mlRot;
+            mlTrn.addMatrix(1.0, mlRot, 1.0);
             // transform from local to global system
-            M.addMatrixTripleProduct(0.0, Tgl, ml, 1.0);
+            theMatrixN.addMatrixTripleProduct(0.0, Tgl, mlTrn, 1.0);
+            M = theMatrix;
         }
     }
 }
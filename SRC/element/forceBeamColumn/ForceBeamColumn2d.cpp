@@ -79,13 +79,13 @@ Journal of Structural Engineering, Approved for publication, February 2007.
 #include <ElementalLoad.h>
 #include <ElementIter.h>
 
-Matrix ForceBeamColumn2d::theMatrix(6,6);
-Vector ForceBeamColumn2d::theVector(6);
-double ForceBeamColumn2d::workArea[200];
+OPS_THREAD_LOCAL Matrix ForceBeamColumn2d::theMatrix(6,6);
+OPS_THREAD_LOCAL Vector ForceBeamColumn2d::theVector(6);
+OPS_THREAD_LOCAL double ForceBeamColumn2d::workArea[200];
 
-Vector *ForceBeamColumn2d::vsSubdivide = 0;
-Matrix *ForceBeamColumn2d::fsSubdivide = 0;
-Vector *ForceBeamColumn2d::SsrSubdivide = 0;
+OPS_THREAD_LOCAL std::vector<Vector> ForceBeamColumn2d::vsSubdivide;
+OPS_THREAD_LOCAL std::vector<Matrix> ForceBeamColumn2d::fsSubdivide;
+OPS_THREAD_LOCAL std::vector<Vector> ForceBeamColumn2d::SsrSubdivide;
 
 void* OPS_ForceBeamColumn2d()
 {
@@ -290,16 +290,6 @@ ForceBeamColumn2d::ForceBeamColumn2d():
   theNodes[0] = 0;  
   theNodes[1] = 0;
 
-  if (vsSubdivide == 0)
-    vsSubdivide  = new Vector [maxNumSections];
-  if (fsSubdivide == 0)
-    fsSubdivide  = new Matrix [maxNumSections];
-  if (SsrSubdivide == 0)
-    SsrSubdivide  = new Vector [maxNumSections];
-  if (!vsSubdivide || !fsSubdivide || !SsrSubdivide) {
-    opserr << "ForceBeamColumn2d::ForceBeamColumn2d() -- failed to allocate Subdivide arrays";   
-    exit(-1);
-  }
 }
 
 // constructor which takes the unique element tag, sections,
@@ -341,16 +331,6 @@ ForceBeamColumn2d::ForceBeamColumn2d (int tag, int nodeI, int nodeJ,
 
   this->setSectionPointers(numSec, sec);
   
-  if (vsSubdivide == 0)
-    vsSubdivide  = new Vector [maxNumSections];
-  if (fsSubdivide == 0)
-    fsSubdivide  = new Matrix [maxNumSections];
-  if (SsrSubdivide == 0)
-    SsrSubdivide  = new Vector [maxNumSections];
-  if (!vsSubdivide || !fsSubdivide || !SsrSubdivide) {
-    opserr << "ForceBeamColumn2d::ForceBeamColumn2d() -- failed to allocate Subdivide arrays";   
-    exit(-1);
-  }
 }
 
 // ~ForceBeamColumn2d():
@@ -595,11 +575,11 @@ ForceBeamColumn2d::getInitialStiff(void)
     Ki = new Matrix(this->getTangentStiff());
   */
 
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
+  static OPS_THREAD_LOCAL Matrix f(NEBD, NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f);
 
   /*
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
+  static OPS_THREAD_LOCAL Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
   I.Zero();
   for (int i=0; i<NEBD; i++)
     I(i,i) = 1.0;
@@ -607,12 +587,12 @@ ForceBeamColumn2d::getInitialStiff(void)
   // calculate element stiffness matrix
   // invert3by3Matrix(f, kv);
 
-  static Matrix kvInit(NEBD, NEBD);
+  static OPS_THREAD_LOCAL Matrix kvInit(NEBD, NEBD);
   if (f.Solve(I, kvInit) < 0)
     opserr << "ForceBeamColumn2d::getInitialStiff() -- could not invert flexibility\n";
   */
 
-  static Matrix kvInit(NEBD, NEBD);
+  static OPS_THREAD_LOCAL Matrix kvInit(NEBD, NEBD);
   f.Invert(kvInit);
   Ki = new Matrix(crdTransf->getInitialGlobalStiffMatrix(kvInit));
   return *Ki;
@@ -767,6 +747,25 @@ ForceBeamColumn2d::initializeSectionHistoryVariables (void)
   }
 }
 
+bool
+ForceBeamColumn2d::isThreadSafe(void) const
+{
+  // the scratch storage of the element and the linear, p-delta and
+  // corotational transformations is held per thread, the sections and
+  // their materials must be thread safe as well
+  int transfTag = crdTransf->getClassTag();
+  if (transfTag != CRDTR_TAG_LinearCrdTransf2d && 
+      transfTag != CRDTR_TAG_PDeltaCrdTransf2d &&
+      transfTag != CRDTR_TAG_CorotCrdTransf2d)
+    return false;
+
+  for (int i = 0; i < numSections; i++)
+    if (sections[i]->isThreadSafe() == false)
+      return false;
+
+  return true;
+}
+
 /********* NEWTON , SUBDIVIDE AND INITIAL ITERATIONS ********************
  */
 int
@@ -783,14 +782,14 @@ ForceBeamColumn2d::update()
   // get basic displacements and increments
   const Vector &v = crdTransf->getBasicTrialDisp();    
 
-  static Vector dv(NEBD);
+  static OPS_THREAD_LOCAL Vector dv(NEBD);
 
   dv = crdTransf->getBasicIncrDeltaDisp();    
 
   if (initialFlag != 0 && dv.Norm() <= DBL_EPSILON && numEleLoads == 0)
     return 0;
 
-  static Vector vin(NEBD);
+  static OPS_THREAD_LOCAL Vector vin(NEBD);
   vin = v;
   vin -= dv;
 
@@ -804,10 +803,10 @@ ForceBeamColumn2d::update()
   double wt[maxNumSections];
   beamIntegr->getSectionWeights(numSections, L, wt);
 
-  static Vector vr(NEBD);       // element residual displacements
-  static Matrix f(NEBD,NEBD);   // element flexibility matrix
+  static OPS_THREAD_LOCAL Vector vr(NEBD);       // element residual displacements
+  static OPS_THREAD_LOCAL Matrix f(NEBD,NEBD);   // element flexibility matrix
   
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+  static OPS_THREAD_LOCAL Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
   double dW;                    // section strain energy (work) norm 
   int i, j;
   
@@ -817,19 +816,27 @@ ForceBeamColumn2d::update()
 
   int numSubdivide = 1;
   bool converged = false;
-  static Vector dSe(NEBD);
-  static Vector dvToDo(NEBD);
-  static Vector dvTrial(NEBD);
-  static Vector SeTrial(NEBD);
-  static Matrix kvTrial(NEBD, NEBD);
+  static OPS_THREAD_LOCAL Vector dSe(NEBD);
+  static OPS_THREAD_LOCAL Vector dvToDo(NEBD);
+  static OPS_THREAD_LOCAL Vector dvTrial(NEBD);
+  static OPS_THREAD_LOCAL Vector SeTrial(NEBD);
+  static OPS_THREAD_LOCAL Matrix kvTrial(NEBD, NEBD);
 
   dvToDo = dv;
   dvTrial = dvToDo;
 
-  static double factor = 10;
+  static OPS_THREAD_LOCAL double factor = 10;
 
   maxSubdivisions = 4;
 
+  // the subdivision work arrays are private to each thread forming elements,
+  // so a thread other than the one that built the element allocates its own
+  if (vsSubdivide.empty()) {
+    vsSubdivide.resize(maxNumSections);
+    fsSubdivide.resize(maxNumSections);
+    SsrSubdivide.resize(maxNumSections);
+  }
+
   // fmk - modification to get compatable ele forces and deformations 
   //   for a change in deformation dV we try first a newton iteration, if
   //   that fails we try an initial flexibility iteration on first iteration 
@@ -895,10 +902,10 @@ ForceBeamColumn2d::update()
 	    int order      = sections[i]->getOrder();
 	    const ID &code = sections[i]->getType();
 
-	    static Vector Ss;
-	    static Vector dSs;
-	    static Vector dvs;
-	    static Matrix fb;
+	    static OPS_THREAD_LOCAL Vector Ss;
+	    static OPS_THREAD_LOCAL Vector dSs;
+	    static OPS_THREAD_LOCAL Vector dvs;
+	    static OPS_THREAD_LOCAL Matrix fb;
 	    
 	    Ss.setData(workArea, order);
 	    dSs.setData(&workArea[order], order);
@@ -2103,7 +2110,7 @@ ForceBeamColumn2d::getInitialDeformations(Vector &v0)
     double xL1 = xL-1.0;
     double wtL = wt[i]*L;
 
-    static Vector sp;
+    static OPS_THREAD_LOCAL Vector sp;
     sp.setData(workArea, order);
     sp.Zero();
 
@@ -2111,7 +2118,7 @@ ForceBeamColumn2d::getInitialDeformations(Vector &v0)
 
     const Matrix &fse = sections[i]->getInitialFlexibility();
 
-    static Vector e;
+    static OPS_THREAD_LOCAL Vector e;
     e.setData(&workArea[order], order);
 
     e.addMatrixVector(0.0, fse, sp, 1.0);
@@ -2142,7 +2149,7 @@ ForceBeamColumn2d::getInitialDeformations(Vector &v0)
 void ForceBeamColumn2d::compSectionDisplacements(Vector sectionCoords[], Vector sectionDispls[]) const
 {
    // get basic displacements and increments
-   static Vector ub(NEBD);
+   static OPS_THREAD_LOCAL Vector ub(NEBD);
    ub = crdTransf->getBasicTrialDisp();    
 
    double L = crdTransf->getInitialLength();
@@ -2151,7 +2158,7 @@ void ForceBeamColumn2d::compSectionDisplacements(Vector sectionCoords[], Vector
    // get integration point positions and weights
    //   const Matrix &xi_pt  = quadRule.getIntegrPointCoords(numSections);
    // get integration point positions and weights
-   static double xi_pts[maxNumSections];
+   static OPS_THREAD_LOCAL double xi_pts[maxNumSections];
    beamIntegr->getSectionLocations(numSections, L, xi_pts);
 
    // setup Vandermode and CBDI influence matrices
@@ -2164,7 +2171,7 @@ void ForceBeamColumn2d::compSectionDisplacements(Vector sectionCoords[], Vector
 
    // get section curvatures
    Vector kappa(numSections);  // curvature
-   static Vector vs;              // section deformations 
+   static OPS_THREAD_LOCAL Vector vs;              // section deformations 
 
    for (i=0; i<numSections; i++)
    {
@@ -2190,8 +2197,8 @@ void ForceBeamColumn2d::compSectionDisplacements(Vector sectionCoords[], Vector
    }
 
    Vector w(numSections);
-   static Vector xl(NDM), uxb(NDM);
-   static Vector xg(NDM), uxg(NDM); 
+   static OPS_THREAD_LOCAL Vector xl(NDM), uxb(NDM);
+   static OPS_THREAD_LOCAL Vector xg(NDM), uxg(NDM); 
 
    // w = ls * kappa;  
    w.addMatrixVector (0.0, ls, kappa, 1.0);
@@ -3247,7 +3254,7 @@ ForceBeamColumn2d::computedqdh(int gradNumber)
 
   double d1oLdh = crdTransf->getd1overLdh();
 
-  static Vector dvdh(3);
+  static OPS_THREAD_LOCAL Vector dvdh(3);
   dvdh.Zero();
 
   // Loop over the integration points
@@ -3342,7 +3349,7 @@ ForceBeamColumn2d::computedqdh(int gradNumber)
     }
   }
 
-  static Matrix dfedh(3,3);
+  static OPS_THREAD_LOCAL Matrix dfedh(3,3);
   dfedh.Zero();
 
   if (beamIntegr->addElasticFlexDeriv(L, dfedh, dLdh) < 0)
@@ -3350,7 +3357,7 @@ ForceBeamColumn2d::computedqdh(int gradNumber)
   
   //opserr << "dfedh: " << dfedh << endln;
 
-  static Vector dqdh(3);
+  static OPS_THREAD_LOCAL Vector dqdh(3);
   dqdh.addMatrixVector(0.0, kv, dvdh, 1.0);
   
   //opserr << "dqdh: " << dqdh << endln;
@@ -3361,7 +3368,7 @@ ForceBeamColumn2d::computedqdh(int gradNumber)
 const Matrix&
 ForceBeamColumn2d::computedfedh(int gradNumber)
 {
-  static Matrix dfedh(3,3);
+  static OPS_THREAD_LOCAL Matrix dfedh(3,3);
 
   dfedh.Zero();
 
@@ -65,6 +65,7 @@ Journal of Structural Engineering, Approved for publication, February 2007.
 #include <Node.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <vector>
 #include <Channel.h>
 #include <BeamIntegration.h>
 #include <SectionForceDeformation.h>
@@ -98,6 +99,7 @@ class ForceBeamColumn2d: public Element
   int revertToLastCommit(void);        
   int revertToStart(void);
   int update(void);    
+  bool isThreadSafe(void) const;
   
   const Matrix &getTangentStiff(void);
   const Matrix &getInitialStiff(void);
@@ -191,9 +193,9 @@ class ForceBeamColumn2d: public Element
 
   Matrix *Ki;
   
-  static Matrix theMatrix;
-  static Vector theVector;
-  static double workArea[];
+  static OPS_THREAD_LOCAL Matrix theMatrix;
+  static OPS_THREAD_LOCAL Vector theVector;
+  static OPS_THREAD_LOCAL double workArea[];
   
   enum {maxNumSections = 30};
   enum {maxSectionOrder = 5};
@@ -201,9 +203,9 @@ class ForceBeamColumn2d: public Element
   // following are added for subdivision of displacement increment
   int    maxSubdivisions;       // maximum number of subdivisons of dv for local iterations
   
-  static Vector *vsSubdivide;
-  static Vector *SsrSubdivide;
-  static Matrix *fsSubdivide;
+  static OPS_THREAD_LOCAL std::vector<Vector> vsSubdivide;
+  static OPS_THREAD_LOCAL std::vector<Vector> SsrSubdivide;
+  static OPS_THREAD_LOCAL std::vector<Matrix> fsSubdivide;
   //static int maxNumSections;
 
   // AddingSensitivity:BEGIN //////////////////////////////////////////
@@ -90,13 +90,13 @@ using std::ifstream;
 
 #define DefaultLoverGJ 1.0e-10
 
-Matrix ForceBeamColumn3d::theMatrix(12,12);
-Vector ForceBeamColumn3d::theVector(12);
-double ForceBeamColumn3d::workArea[200];
+OPS_THREAD_LOCAL Matrix ForceBeamColumn3d::theMatrix(12,12);
+OPS_THREAD_LOCAL Vector ForceBeamColumn3d::theVector(12);
+OPS_THREAD_LOCAL double ForceBeamColumn3d::workArea[200];
 
-Vector *ForceBeamColumn3d::vsSubdivide = 0;
-Matrix *ForceBeamColumn3d::fsSubdivide = 0;
-Vector *ForceBeamColumn3d::SsrSubdivide = 0;
+OPS_THREAD_LOCAL std::vector<Vector> ForceBeamColumn3d::vsSubdivide;
+OPS_THREAD_LOCAL std::vector<Matrix> ForceBeamColumn3d::fsSubdivide;
+OPS_THREAD_LOCAL std::vector<Vector> ForceBeamColumn3d::SsrSubdivide;
 
 
 
@@ -126,16 +126,6 @@ ForceBeamColumn3d::ForceBeamColumn3d():
   v0[3] = 0.0;
   v0[4] = 0.0;
 
-  if (vsSubdivide == 0)
-    vsSubdivide  = new Vector [maxNumSections];
-  if (fsSubdivide == 0) 
-    fsSubdivide  = new Matrix [maxNumSections];
-  if (SsrSubdivide == 0)
-    SsrSubdivide  = new Vector [maxNumSections];
-  if (!vsSubdivide || !fsSubdivide || !SsrSubdivide) {
-    opserr << "ForceBeamColumn3d::ForceBeamColumn3d() -- failed to allocate Subdivide arrays";   
-    exit(-1);
-  }
 }
 
 // constructor which takes the unique element tag, sections,
@@ -188,16 +178,6 @@ ForceBeamColumn3d::ForceBeamColumn3d (int tag, int nodeI, int nodeJ,
   v0[3] = 0.0;
   v0[4] = 0.0;
 
-  if (vsSubdivide == 0)
-    vsSubdivide  = new Vector [maxNumSections];
-  if (fsSubdivide == 0)
-    fsSubdivide  = new Matrix [maxNumSections];
-  if (SsrSubdivide == 0)
-    SsrSubdivide  = new Vector [maxNumSections];
-  if (!vsSubdivide || !fsSubdivide || !SsrSubdivide) {
-    opserr << "ForceBeamColumn3d::ForceBeamColumn3d() -- failed to allocate Subdivide arrays";   
-    exit(-1);
-  }
 }
 
 // ~ForceBeamColumn3d():
@@ -433,17 +413,17 @@ ForceBeamColumn3d::getInitialStiff(void)
   if (Ki != 0)
     return *Ki;
 
-  static Matrix f(NEBD,NEBD);   // element flexibility matrix  
+  static OPS_THREAD_LOCAL Matrix f(NEBD,NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f);
   
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
+  static OPS_THREAD_LOCAL Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
   I.Zero();
   for (int i=0; i<NEBD; i++)
     I(i,i) = 1.0;
   
   // calculate element stiffness matrix
   // invert3by3Matrix(f, kv);
-  static Matrix kvInit(NEBD, NEBD);
+  static OPS_THREAD_LOCAL Matrix kvInit(NEBD, NEBD);
   if (f.Solve(I, kvInit) < 0)
     opserr << "ForceBeamColumn3d::getInitialStiff() -- could not invert flexibility";
 
@@ -484,6 +464,25 @@ ForceBeamColumn3d::getInitialStiff(void)
     }
   }
 
+  bool
+  ForceBeamColumn3d::isThreadSafe(void) const
+  {
+    // the scratch storage of the element and the linear, p-delta and
+    // corotational transformations is held per thread, the sections and
+    // their materials must be thread safe as well
+    int transfTag = crdTransf->getClassTag();
+    if (transfTag != CRDTR_TAG_LinearCrdTransf3d && 
+        transfTag != CRDTR_TAG_PDeltaCrdTransf3d &&
+        transfTag != CRDTR_TAG_CorotCrdTransf3d)
+      return false;
+
+    for (int i = 0; i < numSections; i++)
+      if (sections[i]->isThreadSafe() == false)
+        return false;
+
+    return true;
+  }
+
   /********* NEWTON , SUBDIVIDE AND INITIAL ITERATIONS ********************
    */
   int
@@ -500,13 +499,13 @@ ForceBeamColumn3d::getInitialStiff(void)
     // get basic displacements and increments
     const Vector &v = crdTransf->getBasicTrialDisp();    
 
-    static Vector dv(NEBD);
+    static OPS_THREAD_LOCAL Vector dv(NEBD);
     dv = crdTransf->getBasicIncrDeltaDisp();    
 
     if (initialFlag != 0 && dv.Norm() <= DBL_EPSILON && sp == 0)
       return 0;
 
-    static Vector vin(NEBD);
+    static OPS_THREAD_LOCAL Vector vin(NEBD);
     vin = v;
     vin -= dv;
     double L = crdTransf->getInitialLength();
@@ -519,10 +518,10 @@ ForceBeamColumn3d::getInitialStiff(void)
     double wt[maxNumSections];
     beamIntegr->getSectionWeights(numSections, L, wt);
 
-    static Vector vr(NEBD);       // element residual displacements
-    static Matrix f(NEBD,NEBD);   // element flexibility matrix
+    static OPS_THREAD_LOCAL Vector vr(NEBD);       // element residual displacements
+    static OPS_THREAD_LOCAL Matrix f(NEBD,NEBD);   // element flexibility matrix
 
-    static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+    static OPS_THREAD_LOCAL Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
     double dW;                    // section strain energy (work) norm 
     int i, j;
 
@@ -532,20 +531,28 @@ ForceBeamColumn3d::getInitialStiff(void)
 
     int numSubdivide = 1;
     bool converged = false;
-    static Vector dSe(NEBD);
-    static Vector dvToDo(NEBD);
-    static Vector dvTrial(NEBD);
-    static Vector SeTrial(NEBD);
-    static Matrix kvTrial(NEBD, NEBD);
+    static OPS_THREAD_LOCAL Vector dSe(NEBD);
+    static OPS_THREAD_LOCAL Vector dvToDo(NEBD);
+    static OPS_THREAD_LOCAL Vector dvTrial(NEBD);
+    static OPS_THREAD_LOCAL Vector SeTrial(NEBD);
+    static OPS_THREAD_LOCAL Matrix kvTrial(NEBD, NEBD);
 
     dvToDo = dv;
     dvTrial = dvToDo;
 
-    static double factor = 10;
+    static OPS_THREAD_LOCAL double factor = 10;
     double dW0 = 0.0;
 
     maxSubdivisions = 10;
 
+    // the subdivision work arrays are private to each thread forming elements,
+    // so a thread other than the one that built the element allocates its own
+    if (vsSubdivide.empty()) {
+      vsSubdivide.resize(maxNumSections);
+      fsSubdivide.resize(maxNumSections);
+      SsrSubdivide.resize(maxNumSections);
+    }
+
     // fmk - modification to get compatable ele forces and deformations 
     //   for a change in deformation dV we try first a newton iteration, if
     //   that fails we try an initial flexibility iteration on first iteration 
@@ -611,10 +618,10 @@ ForceBeamColumn3d::getInitialStiff(void)
 	      int order      = sections[i]->getOrder();
 	      const ID &code = sections[i]->getType();
 
-	      static Vector Ss;
-	      static Vector dSs;
-	      static Vector dvs;
-	      static Matrix fb;
+	      static OPS_THREAD_LOCAL Vector Ss;
+	      static OPS_THREAD_LOCAL Vector dSs;
+	      static OPS_THREAD_LOCAL Vector dvs;
+	      static OPS_THREAD_LOCAL Matrix fb;
 
 	      Ss.setData(workArea, order);
 	      dSs.setData(&workArea[order], order);
@@ -1794,14 +1801,14 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
 					      Vector sectionDispls[]) const
   {
      // get basic displacements and increments
-     static Vector ub(NEBD);
+     static OPS_THREAD_LOCAL Vector ub(NEBD);
      ub = crdTransf->getBasicTrialDisp();    
 
      double L = crdTransf->getInitialLength();
      L = L *lenfactor;
 
      // get integration point positions and weights
-     static double pts[maxNumSections];
+     static OPS_THREAD_LOCAL double pts[maxNumSections];
      beamIntegr->getSectionLocations(numSections, L, pts);
 
      // setup Vandermode and CBDI influence matrices
@@ -1815,7 +1822,7 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
      // get section curvatures
      Vector kappa_y(numSections);  // curvature
      Vector kappa_z(numSections);  // curvature
-     static Vector vs;                // section deformations 
+     static OPS_THREAD_LOCAL Vector vs;                // section deformations 
 
      for (i=0; i<numSections; i++) {
 	 // THIS IS VERY INEFFICIENT ... CAN CHANGE IF RUNS TOO SLOW
@@ -1850,8 +1857,8 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
      //cout << "kappa_z: " << kappa_z;   
 
      Vector v(numSections), w(numSections);
-     static Vector xl(NDM), uxb(NDM);
-     static Vector xg(NDM), uxg(NDM); 
+     static OPS_THREAD_LOCAL Vector xl(NDM), uxb(NDM);
+     static OPS_THREAD_LOCAL Vector xg(NDM), uxg(NDM); 
      // double theta;                             // angle of twist of the sections
 
      // v = ls * kappa_z;  
@@ -303,6 +303,16 @@ int  ShellMITC9::revertToStart( )
   return success ;
 }
 
+//tangent independent of state if the sections are elastic
+bool  ShellMITC9::isTangentConstant( ) const
+{
+  for ( int i = 0; i < 9; i++ ) 
+    if ( materialPointers[i] == 0 || !materialPointers[i]->isTangentConstant( ) )
+      return false ;
+
+  return true ;
+}
+
 //print out element data
 void  ShellMITC9::Print( OPS_Stream &s, int flag )
 {
@@ -72,6 +72,9 @@ class ShellMITC9 : public Element
     //revert to start 
     int revertToStart( ) ;
 
+    //tangent independent of state if the sections are elastic
+    bool isTangentConstant( ) const ;
+
     //print out element data
     void Print( OPS_Stream &s, int flag ) ;
 	
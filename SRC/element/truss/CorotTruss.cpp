@@ -167,7 +167,7 @@ CorotTruss::CorotTruss(int tag, int dim,
   theMaterial(0), connectedExternalNodes(2),
   numDOF(0), numDIM(dim), Lo(0.0), Ln(0.0), 
   A(a), rho(r), doRayleighDamping(damp), cMass(cm),
-  R(3,3), theLoad(0), theMatrix(0), theVector(0)
+  theLoad(0), theMatrix(0), theVector(0)
 {
   // get a copy of the material and check we obtained a valid copy
   theMaterial = theMat.getCopy();
@@ -200,7 +200,7 @@ CorotTruss::CorotTruss()
   theMaterial(0),connectedExternalNodes(2),
   numDOF(0), numDIM(0), Lo(0.0), Ln(0.0),
   A(0.0), rho(0.0), doRayleighDamping(0), cMass(0),
-  R(3,3), theLoad(0), theMatrix(0), theVector(0)
+  theLoad(0), theMatrix(0), theVector(0)
 {
   // ensure the connectedExternalNode ID is of correct size 
   if (connectedExternalNodes.Size() != 2) {
@@ -479,7 +479,7 @@ CorotTruss::update(void)
 const Matrix &
 CorotTruss::getTangentStiff(void)
 {
-    static Matrix kl(3,3);
+    MatrixN<3,3> kl;
 
     // Material stiffness
     //
@@ -506,7 +506,7 @@ CorotTruss::getTangentStiff(void)
     }
     
     // Compute R'*kl*R
-    static Matrix kg(3,3);
+    MatrixN<3,3> kg;
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
     Matrix &K = *theMatrix;
@@ -530,14 +530,13 @@ CorotTruss::getTangentStiff(void)
 const Matrix &
 CorotTruss::getInitialStiff(void)
 {
-    static Matrix kl(3,3);
+    MatrixN<3,3> kl;
 
     // Material stiffness
-    kl.Zero();
     kl(0,0) = A * theMaterial->getInitialTangent() / Lo;
 
     // Compute R'*kl*R
-    static Matrix kg(3,3);
+    MatrixN<3,3> kg;
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
     Matrix &K = *theMatrix;
@@ -561,20 +560,20 @@ CorotTruss::getInitialStiff(void)
 const Matrix &
 CorotTruss::getDamp(void)
 {
-    static Matrix kl(3,3);
+    MatrixN<3,3> kl;
 
-    Matrix a(3,1);
+    MatrixN<1,3> a;
     a(0,0) = (Lo+d21[0])/Ln;
-    a(1,0) = d21[1]/Ln;
-    a(2,0) = 0.0;
+    a(0,1) = d21[1]/Ln;
+    a(0,2) = 0.0;
 
-    Matrix cb(1,1);
+    MatrixN<1,1> cb;
     cb(0,0) = A*theMaterial->getDampTangent()/Lo;
 
     kl.addMatrixTripleProduct(0.0, a, cb, 1.0);
 
     // Compute R'*kl*R
-    static Matrix kg(3,3);
+    MatrixN<3,3> kg;
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
     Matrix &K = *theMatrix;
@@ -687,13 +686,13 @@ CorotTruss::getResistingForce()
 	double SA = A*theMaterial->getStress();
 	SA /= Ln;
 
-    static Vector ql(3);
+    VectorN<3> ql;
 
 	ql(0) = d21[0]*SA;
 	ql(1) = d21[1]*SA;
 	ql(2) = d21[2]*SA;
 
-    static Vector qg(3);
+    VectorN<3> qg;
     qg.addMatrixTransposeVector(0.0, R, ql, 1.0);
 
     Vector &P = *theVector;
@@ -36,6 +36,7 @@
 #include <Element.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <MatrixN.h>
 
 class Node;
 class Channel;
@@ -116,7 +117,7 @@ class CorotTruss : public Element
 
     Node *theNodes[2];
 
-    Matrix R;	// Rotation matrix
+    MatrixN<3,3> R;	// Rotation matrix
 
     Vector *theLoad;    // pointer to the load vector P
     Matrix *theMatrix;  // pointer to objects matrix (a class wide Matrix)
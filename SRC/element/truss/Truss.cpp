@@ -51,14 +51,22 @@
 //#include <fstream>
 
 // initialise the class wide variables
-Matrix Truss::trussM2(2,2);
-Matrix Truss::trussM4(4,4);
-Matrix Truss::trussM6(6,6);
-Matrix Truss::trussM12(12,12);
-Vector Truss::trussV2(2);
-Vector Truss::trussV4(4);
-Vector Truss::trussV6(6);
-Vector Truss::trussV12(12);
+MatrixN<2,2> Truss::trussM2N;
+MatrixN<4,4> Truss::trussM4N;
+MatrixN<6,6> Truss::trussM6N;
+MatrixN<12,12> Truss::trussM12N;
+VectorN<2> Truss::trussV2N;
+VectorN<4> Truss::trussV4N;
+VectorN<6> Truss::trussV6N;
+VectorN<12> Truss::trussV12N;
+Matrix Truss::trussM2(trussM2N.getData(), 2, 2);
+Matrix Truss::trussM4(trussM4N.getData(), 4, 4);
+Matrix Truss::trussM6(trussM6N.getData(), 6, 6);
+Matrix Truss::trussM12(trussM12N.getData(), 12, 12);
+Vector Truss::trussV2(trussV2N.getData(), 2);
+Vector Truss::trussV4(trussV4N.getData(), 4);
+Vector Truss::trussV6(trussV6N.getData(), 6);
+Vector Truss::trussV12(trussV12N.getData(), 12);
 
 // constructor:
 //  responsible for allocating the necessary space needed by each object
@@ -420,6 +428,12 @@ Truss::update(void)
     return theMaterial->setTrialStrain(strain, rate);
 }
 
+bool
+Truss::isTangentConstant(void) const
+{
+    return theMaterial != 0 && theMaterial->isTangentConstant();
+}
+
 
 const Matrix &
 Truss::getTangentStiff(void)
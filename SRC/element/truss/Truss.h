@@ -39,6 +39,7 @@
 
 #include <Element.h>
 #include <Matrix.h>
+#include <MatrixN.h>
 
 class Node;
 class Channel;
@@ -72,6 +73,7 @@ class Truss : public Element
     int revertToLastCommit(void);        
     int revertToStart(void);        
     int update(void);
+    bool isTangentConstant(void) const;
     
     // public methods to obtain stiffness, mass, damping and residual information    
     const Matrix &getKi(void);
@@ -143,6 +145,15 @@ class Truss : public Element
 // AddingSensitivity:END ///////////////////////////////////////////
 
     // static data - single copy for all objects of the class	
+    // storage of the class wide Matrix and Vector objects below
+    static MatrixN<2,2> trussM2N;
+    static MatrixN<4,4> trussM4N;
+    static MatrixN<6,6> trussM6N;
+    static MatrixN<12,12> trussM12N;
+    static VectorN<2> trussV2N;
+    static VectorN<4> trussV4N;
+    static VectorN<6> trussV6N;
+    static VectorN<12> trussV12N;
     static Matrix trussM2;   // class wide matrix for 2*2
     static Matrix trussM4;   // class wide matrix for 4*4
     static Matrix trussM6;   // class wide matrix for 6*6
@@ -46,14 +46,22 @@
 #include <stdlib.h>
 #include <string.h>
 
-static Matrix CoupledZeroLengthM2(2,2);   // class wide matrix for 2*2
-static Matrix CoupledZeroLengthM4(4,4);   // class wide matrix for 4*4
-static Matrix CoupledZeroLengthM6(6,6);   // class wide matrix for 6*6
-static Matrix CoupledZeroLengthM12(12,12);  // class wide matrix for 12*12
-static Vector CoupledZeroLengthV2(2);   // class wide Vector for size 2
-static Vector CoupledZeroLengthV4(4);   // class wide Vector for size 4
-static Vector CoupledZeroLengthV6(6);   // class wide Vector for size 6
-static Vector CoupledZeroLengthV12(12);  // class wide Vector for size 12
+static MatrixN<2,2> CoupledZeroLengthM2N;   // storage of the class wide objects
+static MatrixN<4,4> CoupledZeroLengthM4N;
+static MatrixN<6,6> CoupledZeroLengthM6N;
+static MatrixN<12,12> CoupledZeroLengthM12N;
+static VectorN<2> CoupledZeroLengthV2N;
+static VectorN<4> CoupledZeroLengthV4N;
+static VectorN<6> CoupledZeroLengthV6N;
+static VectorN<12> CoupledZeroLengthV12N;
+static Matrix CoupledZeroLengthM2(CoupledZeroLengthM2N.getData(), 2, 2);   // class wide matrix for 2*2
+static Matrix CoupledZeroLengthM4(CoupledZeroLengthM4N.getData(), 4, 4);   // class wide matrix for 4*4
+static Matrix CoupledZeroLengthM6(CoupledZeroLengthM6N.getData(), 6, 6);   // class wide matrix for 6*6
+static Matrix CoupledZeroLengthM12(CoupledZeroLengthM12N.getData(), 12, 12);  // class wide matrix for 12*12
+static Vector CoupledZeroLengthV2(CoupledZeroLengthV2N.getData(), 2);   // class wide Vector for size 2
+static Vector CoupledZeroLengthV4(CoupledZeroLengthV4N.getData(), 4);   // class wide Vector for size 4
+static Vector CoupledZeroLengthV6(CoupledZeroLengthV6N.getData(), 6);   // class wide Vector for size 6
+static Vector CoupledZeroLengthV12(CoupledZeroLengthV12N.getData(), 12);  // class wide Vector for size 12
 
 
 #include <elementAPI.h>
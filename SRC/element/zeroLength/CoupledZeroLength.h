@@ -32,6 +32,7 @@
 
 #include <Element.h>
 #include <Matrix.h>
+#include <MatrixN.h>
 #include <Vector.h>
 
 // Tolerance for zero length of element
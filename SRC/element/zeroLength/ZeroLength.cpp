@@ -50,14 +50,22 @@
 #include <vector>
 
 // initialise the class wide variables
-Matrix ZeroLength::ZeroLengthM2(2,2);
-Matrix ZeroLength::ZeroLengthM4(4,4);
-Matrix ZeroLength::ZeroLengthM6(6,6);
-Matrix ZeroLength::ZeroLengthM12(12,12);
-Vector ZeroLength::ZeroLengthV2(2);
-Vector ZeroLength::ZeroLengthV4(4);
-Vector ZeroLength::ZeroLengthV6(6);
-Vector ZeroLength::ZeroLengthV12(12);
+MatrixN<2,2> ZeroLength::ZeroLengthM2N;
+MatrixN<4,4> ZeroLength::ZeroLengthM4N;
+MatrixN<6,6> ZeroLength::ZeroLengthM6N;
+MatrixN<12,12> ZeroLength::ZeroLengthM12N;
+VectorN<2> ZeroLength::ZeroLengthV2N;
+VectorN<4> ZeroLength::ZeroLengthV4N;
+VectorN<6> ZeroLength::ZeroLengthV6N;
+VectorN<12> ZeroLength::ZeroLengthV12N;
+Matrix ZeroLength::ZeroLengthM2(ZeroLengthM2N.getData(), 2, 2);
+Matrix ZeroLength::ZeroLengthM4(ZeroLengthM4N.getData(), 4, 4);
+Matrix ZeroLength::ZeroLengthM6(ZeroLengthM6N.getData(), 6, 6);
+Matrix ZeroLength::ZeroLengthM12(ZeroLengthM12N.getData(), 12, 12);
+Vector ZeroLength::ZeroLengthV2(ZeroLengthV2N.getData(), 2);
+Vector ZeroLength::ZeroLengthV4(ZeroLengthV4N.getData(), 4);
+Vector ZeroLength::ZeroLengthV6(ZeroLengthV6N.getData(), 6);
+Vector ZeroLength::ZeroLengthV12(ZeroLengthV12N.getData(), 12);
 
 
 //  Constructor:
@@ -77,7 +85,7 @@ ZeroLength::ZeroLength(int tag,
   connectedExternalNodes(2),
   dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(doRayleigh),
   theMatrix(0), theVector(0),
-  numMaterials1d(1), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0)
+  numMaterials1d(1), theMaterial1d(0), dir1d(0), t1d(0), homogeneous(-1), work(0), d0(0), v0(0)
 {
   // allocate memory for numMaterials1d uniaxial material models
   theMaterial1d = new UniaxialMaterial*  [numMaterials1d];
@@ -121,7 +129,7 @@ ZeroLength::ZeroLength(int tag,
   connectedExternalNodes(2),
   dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(2),
   theMatrix(0), theVector(0),
-  numMaterials1d(1), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0)
+  numMaterials1d(1), theMaterial1d(0), dir1d(0), t1d(0), homogeneous(-1), work(0), d0(0), v0(0)
 {
   // allocate memory for numMaterials1d uniaxial material models
   theMaterial1d = new UniaxialMaterial*[2];
@@ -172,7 +180,7 @@ ZeroLength::ZeroLength(int tag,
   connectedExternalNodes(2),
   dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(doRayleigh),
   theMatrix(0), theVector(0),
-  numMaterials1d(n1dMat), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0)
+  numMaterials1d(n1dMat), theMaterial1d(0), dir1d(0), t1d(0), homogeneous(-1), work(0), d0(0), v0(0)
 {
 
     // allocate memory for numMaterials1d uniaxial material models
@@ -223,7 +231,7 @@ ZeroLength::ZeroLength(int tag,
   connectedExternalNodes(2),
   dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(doRayleigh),
   theMatrix(0), theVector(0),
-  numMaterials1d(n1dMat), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0)
+  numMaterials1d(n1dMat), theMaterial1d(0), dir1d(0), t1d(0), homogeneous(-1), work(0), d0(0), v0(0)
 {
 
     // allocate memory for numMaterials1d uniaxial material models
@@ -270,7 +278,7 @@ ZeroLength::ZeroLength(void)
   dimension(0), numDOF(0), transformation(3,3),
   theMatrix(0), theVector(0),
   numMaterials1d(0), theMaterial1d(0),
-  dir1d(0), t1d(0), d0(0), v0(0)
+  dir1d(0), t1d(0), homogeneous(-1), work(0), d0(0), v0(0)
 {
     // ensure the connectedExternalNode ID is of correct size 
     if (connectedExternalNodes.Size() != 2)
@@ -304,6 +312,8 @@ ZeroLength::~ZeroLength()
 	delete t1d;
     if (dir1d != 0 )
 	delete dir1d;
+    if (work != 0)
+	delete [] work;
 
     if (d0 != 0)
       delete d0;
@@ -528,9 +538,6 @@ ZeroLength::revertToStart()
 int
 ZeroLength::update(void)
 {
-    double strain;
-    double strainRate;
-
     // get trial displacements and take difference
     const Vector& disp1 = theNodes[0]->getTrialDisp();
     const Vector& disp2 = theNodes[1]->getTrialDisp();
@@ -545,18 +552,39 @@ ZeroLength::update(void)
     if (v0 != 0)
       diffv -= *v0;
     
-    // loop over 1d materials
-    
-    //    Matrix& tran = *t1d;
-    int ret = 0;
+    if (work == 0)
+      work = new double[2*numMaterials1d];
+    double *strains = work;
+    double *strainRates = &work[numMaterials1d];
+
+    // compute strain and rate of the 1d materials
     for (int mat=0; mat<numMaterials1d; mat++) {
-	// compute strain and rate; set as current trial for material
-	strain     = this->computeCurrentStrain1d(mat,diff );
-        strainRate = this->computeCurrentStrain1d(mat,diffv);
-	ret += theMaterial1d[mat]->setTrialStrain(strain,strainRate);
-	if (useRayleighDamping == 2) {
-	  ret += theMaterial1d[mat+numMaterials1d]->setTrialStrain(strainRate);	  
-	}
+	strains[mat]     = this->computeCurrentStrain1d(mat,diff );
+	strainRates[mat] = this->computeCurrentStrain1d(mat,diffv);
+    }
+
+    // set as current trial for the materials, in one call if they
+    // are all of one type
+    if (homogeneous == -1) {
+      homogeneous = 1;
+      for (int mat=1; mat<numMaterials1d; mat++)
+	if (theMaterial1d[mat]->getClassTag() != theMaterial1d[0]->getClassTag())
+	  homogeneous = 0;
+    }
+
+    // the stresses and tangents are not needed here, so a material without
+    // its own setTrialStrains() still makes one setTrialStrain() call each
+    int ret = 0;
+    if (homogeneous == 1 && numMaterials1d > 1)
+      ret += theMaterial1d[0]->setTrialStrains(numMaterials1d, theMaterial1d, strains, strainRates,
+						0, 0);
+    else
+      for (int mat=0; mat<numMaterials1d; mat++)
+	ret += theMaterial1d[mat]->setTrialStrain(strains[mat],strainRates[mat]);
+
+    if (useRayleighDamping == 2) {
+      for (int mat=0; mat<numMaterials1d; mat++)
+	ret += theMaterial1d[mat+numMaterials1d]->setTrialStrain(strainRates[mat]);	  
     }
 
     return ret;
@@ -896,6 +924,8 @@ ZeroLength::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBr
     return res;
   }
   else {
+    homogeneous = -1;
+
     // Check that there is correct number of materials, reallocate if needed
     if (numMaterials1d != idData(3)) {
       int i;
@@ -905,6 +935,9 @@ ZeroLength::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBr
 	delete [] theMaterial1d;
 	theMaterial1d = 0;
       }
+      if (work != 0)
+	delete [] work;
+      work = 0;
       
       numMaterials1d = idData(3);
       
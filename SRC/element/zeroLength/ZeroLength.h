@@ -43,6 +43,7 @@
 
 #include <Element.h>
 #include <Matrix.h>
+#include <MatrixN.h>
 
 // Tolerance for zero length of element
 #define	LENTOL 1.0e-6
@@ -182,12 +183,23 @@ class ZeroLength : public Element
     UniaxialMaterial **theMaterial1d;      // array of pointers to 1d materials
     ID               *dir1d;     	   // array of directions 0-5 for 1d materials
     Matrix           *t1d; 	   // hold the transformation matrix
+    int homogeneous;             // 1d materials all of one type (-1 if not yet known)
+    double *work;                // 1d strains and strain rates
 
     // vector pointers to initial disp and vel if present
     Vector *d0;
     Vector *v0;
 
     // static data - single copy for all objects of the class	
+    // storage of the class wide Matrix and Vector objects below
+    static MatrixN<2,2> ZeroLengthM2N;
+    static MatrixN<4,4> ZeroLengthM4N;
+    static MatrixN<6,6> ZeroLengthM6N;
+    static MatrixN<12,12> ZeroLengthM12N;
+    static VectorN<2> ZeroLengthV2N;
+    static VectorN<4> ZeroLengthV4N;
+    static VectorN<6> ZeroLengthV6N;
+    static VectorN<12> ZeroLengthV12N;
     static Matrix ZeroLengthM2;   // class wide matrix for 2*2
     static Matrix ZeroLengthM4;   // class wide matrix for 4*4
     static Matrix ZeroLengthM6;   // class wide matrix for 6*6
@@ -47,14 +47,18 @@
 #include <string.h>
 #include <elementAPI.h>
 
-Matrix ZeroLengthND::K6(6,6);
-Matrix ZeroLengthND::K12(12,12);
-
-Vector ZeroLengthND::P6(6);
-Vector ZeroLengthND::P12(12);
-
-Vector ZeroLengthND::v2(2);
-Vector ZeroLengthND::v3(3);
+MatrixN<6,6> ZeroLengthND::K6N;
+MatrixN<12,12> ZeroLengthND::K12N;
+VectorN<6> ZeroLengthND::P6N;
+VectorN<12> ZeroLengthND::P12N;
+VectorN<2> ZeroLengthND::v2N;
+VectorN<3> ZeroLengthND::v3N;
+Matrix ZeroLengthND::K6(K6N.getData(), 6, 6);
+Matrix ZeroLengthND::K12(K12N.getData(), 12, 12);
+Vector ZeroLengthND::P6(P6N.getData(), 6);
+Vector ZeroLengthND::P12(P12N.getData(), 12);
+Vector ZeroLengthND::v2(v2N.getData(), 2);
+Vector ZeroLengthND::v3(v3N.getData(), 3);
 
 //  Constructor:
 //  responsible for allocating the necessary space needed by each object
@@ -39,6 +39,7 @@
 
 #include <Element.h>
 #include <Matrix.h>
+#include <MatrixN.h>
 
 // Tolerance for zero length of element
 #define	LENTOL 1.0e-6
@@ -138,6 +139,13 @@ class ZeroLengthND : public Element
     int order;		// Order of the NDMaterial (2 or 3)
     
     // Class wide matrices for return
+    // storage of the class wide Matrix and Vector objects below
+    static MatrixN<6,6> K6N;
+    static MatrixN<12,12> K12N;
+    static VectorN<6> P6N;
+    static VectorN<12> P12N;
+    static VectorN<2> v2N;
+    static VectorN<3> v3N;
     static Matrix K6;
     static Matrix K12;
     
@@ -47,10 +47,14 @@
 #include <elementAPI.h>
 
 // initialise the class wide variables
-Matrix ZeroLengthRocking::ZeroLengthRockingM6(6,6);
-Matrix ZeroLengthRocking::ZeroLengthRockingM12(12,12);
-Vector ZeroLengthRocking::ZeroLengthRockingV6(6);
-Vector ZeroLengthRocking::ZeroLengthRockingV12(12);
+MatrixN<6,6> ZeroLengthRocking::ZeroLengthRockingM6N;
+MatrixN<12,12> ZeroLengthRocking::ZeroLengthRockingM12N;
+VectorN<6> ZeroLengthRocking::ZeroLengthRockingV6N;
+VectorN<12> ZeroLengthRocking::ZeroLengthRockingV12N;
+Matrix ZeroLengthRocking::ZeroLengthRockingM6(ZeroLengthRockingM6N.getData(), 6, 6);
+Matrix ZeroLengthRocking::ZeroLengthRockingM12(ZeroLengthRockingM12N.getData(), 12, 12);
+Vector ZeroLengthRocking::ZeroLengthRockingV6(ZeroLengthRockingV6N.getData(), 6);
+Vector ZeroLengthRocking::ZeroLengthRockingV12(ZeroLengthRockingV12N.getData(), 12);
 
 void* OPS_ZeroLengthRocking()
 {
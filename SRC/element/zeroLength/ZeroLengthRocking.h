@@ -41,6 +41,7 @@
 
 #include <Element.h>
 #include <Matrix.h>
+#include <MatrixN.h>
 #include <Vector.h>
 
 // Tolerance for zero length of element
@@ -145,6 +146,11 @@ class ZeroLengthRocking : public Element
     double d31plusT;    // state variable
 
     // static data - single copy for all objects of the class	
+    // storage of the class wide Matrix and Vector objects below
+    static MatrixN<6,6> ZeroLengthRockingM6N;
+    static MatrixN<12,12> ZeroLengthRockingM12N;
+    static VectorN<6> ZeroLengthRockingV6N;
+    static VectorN<12> ZeroLengthRockingV12N;
     static Matrix ZeroLengthRockingM6;   // class wide matrix for 6*6
     static Matrix ZeroLengthRockingM12;  // class wide matrix for 12*12
     static Vector ZeroLengthRockingV6;   // class wide Vector for size 6
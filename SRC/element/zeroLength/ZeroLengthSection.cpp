@@ -44,11 +44,14 @@
 #include <string.h>
 #include <elementAPI.h>
 
-Matrix ZeroLengthSection::K6(6,6);
-Matrix ZeroLengthSection::K12(12,12);
-
-Vector ZeroLengthSection::P6(6);
-Vector ZeroLengthSection::P12(12);
+MatrixN<6,6> ZeroLengthSection::K6N;
+MatrixN<12,12> ZeroLengthSection::K12N;
+VectorN<6> ZeroLengthSection::P6N;
+VectorN<12> ZeroLengthSection::P12N;
+Matrix ZeroLengthSection::K6(K6N.getData(), 6, 6);
+Matrix ZeroLengthSection::K12(K12N.getData(), 12, 12);
+Vector ZeroLengthSection::P6(P6N.getData(), 6);
+Vector ZeroLengthSection::P12(P12N.getData(), 12);
 
 void* OPS_ZeroLengthSection()
 {
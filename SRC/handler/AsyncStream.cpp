@@ -0,0 +1,652 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the class implementation for AsyncStream.
+//
+// What: "@(#) AsyncStream.cpp, revA"
+
+#include <AsyncStream.h>
+#include <OPS_Globals.h>
+#include <classTags.h>
+#include <Vector.h>
+#include <ID.h>
+#include <fstream>
+#include <deque>
+#include <thread>
+#include <algorithm>
+
+//
+// the writer threads shared by all AsyncStreams; the streams with rows to
+// be written sit in readyQueue. lock order: poolMutex before a stream's mutex
+//
+
+namespace {
+
+struct AsyncStreamPool {
+  std::mutex poolMutex;
+  std::condition_variable poolCondition;
+  std::deque<AsyncStream *> readyQueue;
+  std::vector<std::thread> workers;
+  int numThreads;
+  bool stop;
+
+  AsyncStreamPool() :numThreads(1), stop(false) {}
+  ~AsyncStreamPool() {this->stopWorkers();}
+
+  void startWorkers(void);
+  void stopWorkers(void);
+  void run(void);
+};
+
+AsyncStreamPool thePool;
+
+void
+AsyncStreamPool::startWorkers(void)
+{
+  // invoked with poolMutex held
+  stop = false;
+  for (int i=workers.size(); i<numThreads; i++)
+    workers.push_back(std::thread(&AsyncStreamPool::run, this));
+}
+
+void
+AsyncStreamPool::stopWorkers(void)
+{
+  {
+    std::lock_guard<std::mutex> lock(poolMutex);
+    stop = true;
+  }
+  poolCondition.notify_all();
+
+  for (unsigned int i=0; i<workers.size(); i++)
+    workers[i].join();
+  workers.clear();
+}
+
+void
+AsyncStreamPool::run(void)
+{
+  while (true) {
+    AsyncStream *theStream = 0;
+    {
+      std::unique_lock<std::mutex> lock(poolMutex);
+      poolCondition.wait(lock, [this]{return stop == true || !readyQueue.empty();});
+      if (readyQueue.empty())
+	return;
+
+      theStream = readyQueue.front();
+      readyQueue.pop_front();
+      
+      // claim the stream while poolMutex is still held so that its
+      // destructor will wait for us
+      if (theStream->claim() == false)
+	continue;
+    }
+
+    theStream->drain();
+  }
+}
+
+}
+
+AsyncStream::AsyncStream(OPS_Stream *stream, int bufferSize)
+  :OPS_Stream(OPS_STREAM_TAGS_AsyncStream),
+   theStream(stream), ring(bufferSize > 0 ? bufferSize : 1), 
+   head(0), count(0), busy(false), scheduled(false), writeError(0)
+{
+  for (unsigned int i=0; i<ring.size(); i++) {
+    ring[i].data = 0;
+    ring[i].size = 0;
+    ring[i].maxSize = 0;
+  }
+}
+
+AsyncStream::~AsyncStream()
+{
+  // write out everything still queued
+  this->flush();
+
+  {
+    std::lock_guard<std::mutex> lock(thePool.poolMutex);
+    std::deque<AsyncStream *>::iterator it = 
+      std::find(thePool.readyQueue.begin(), thePool.readyQueue.end(), this);
+    if (it != thePool.readyQueue.end())
+      thePool.readyQueue.erase(it);
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(theMutex);
+    theCondition.wait(lock, [this]{return busy == false;});
+  }
+
+  for (unsigned int i=0; i<ring.size(); i++)
+    if (ring[i].data != 0)
+      delete [] ring[i].data;
+
+  if (theStream != 0)
+    delete theStream;
+}
+
+int
+AsyncStream::setNumThreads(int numThreads)
+{
+  if (numThreads < 0)
+    numThreads = 0;
+
+  // let the current threads finish the queue before changing the pool
+  thePool.stopWorkers();
+
+  std::lock_guard<std::mutex> lock(thePool.poolMutex);
+  thePool.numThreads = numThreads;
+  thePool.stop = false;
+
+  return 0;
+}
+
+int
+AsyncStream::getNumThreads(void)
+{
+  std::lock_guard<std::mutex> lock(thePool.poolMutex);
+  return thePool.numThreads;
+}
+
+bool
+AsyncStream::claim(void)
+{
+  // invoked by a writer thread with poolMutex held
+  std::lock_guard<std::mutex> lock(theMutex);
+  scheduled = false;
+  if (busy == true || count == 0)
+    return false;
+  busy = true;
+  return true;
+}
+
+void
+AsyncStream::drain(void)
+{
+  // write the rows in order until the ring is empty; the caller has set busy
+  std::unique_lock<std::mutex> lock(theMutex);
+  while (count > 0) {
+    Entry &theEntry = ring[head];
+    lock.unlock();
+
+    int res = this->writeEntry(theEntry);
+
+    lock.lock();
+    if (res < 0)
+      writeError = res;
+    head = (head+1) % ring.size();
+    count--;
+    theCondition.notify_all();
+  }
+  busy = false;
+  theCondition.notify_all();
+}
+
+int
+AsyncStream::writeEntry(Entry &theEntry)
+{
+  if (theEntry.fileName.empty() == false) {
+    std::ofstream theFile(theEntry.fileName.c_str(), std::ios::out | std::ios::trunc);
+    if (!theFile.is_open()) {
+      opserr << "WARNING AsyncStream - failed to open file " << theEntry.fileName.c_str() << endln;
+      return -1;
+    }
+    theFile << theEntry.contents;
+    theFile.close();
+
+    std::string().swap(theEntry.contents);
+    theEntry.fileName.clear();
+    return 0;
+  }
+
+  if (theStream == 0)
+    return 0;
+
+  Vector data(theEntry.data, theEntry.size);
+  return theStream->write(data);
+}
+
+int
+AsyncStream::push(Entry *&theEntry)
+{
+  // on return theMutex is held and theEntry is the next free slot
+  std::unique_lock<std::mutex> lock(theMutex);
+  while (count == (int)ring.size()) {
+    if (busy == false) {
+      // the writers are behind, help them out
+      busy = true;
+      lock.unlock();
+      this->drain();
+      lock.lock();
+    } else
+      theCondition.wait(lock);
+  }
+  lock.release();
+
+  theEntry = &ring[(head+count) % ring.size()];
+  return writeError;
+}
+
+void
+AsyncStream::release(void)
+{
+  // invoked with theMutex held once the slot from push() is filled
+  count++;
+
+  bool schedule = false;
+  if (busy == false && scheduled == false) {
+    scheduled = true;
+    schedule = true;
+  }
+  theMutex.unlock();
+
+  if (schedule == false)
+    return;
+
+  bool inLine = false;
+  {
+    std::lock_guard<std::mutex> lock(thePool.poolMutex);
+    if (thePool.numThreads == 0)
+      inLine = true;
+    else {
+      if ((int)thePool.workers.size() < thePool.numThreads)
+	thePool.startWorkers();
+      thePool.readyQueue.push_back(this);
+    }
+  }
+
+  if (inLine == true)
+    this->flush();
+  else
+    thePool.poolCondition.notify_one();
+}
+
+int
+AsyncStream::flush(void)
+{
+  std::unique_lock<std::mutex> lock(theMutex);
+  while (count > 0 || busy == true) {
+    if (busy == false) {
+      busy = true;
+      lock.unlock();
+      this->drain();
+      lock.lock();
+    } else
+      theCondition.wait(lock);
+  }
+
+  int res = writeError;
+  writeError = 0;
+  return res;
+}
+
+int
+AsyncStream::writeFile(const char *fileName, const std::string &contents)
+{
+  if (fileName == 0)
+    return -1;
+
+  Entry *theEntry = 0;
+  int res = this->push(theEntry);
+  theEntry->fileName = fileName;
+  theEntry->contents = contents;
+  this->release();
+
+  return res;
+}
+
+int 
+AsyncStream::write(Vector &data)
+{
+  int size = data.Size();
+
+  Entry *theEntry = 0;
+  int res = this->push(theEntry);
+  if (theEntry->maxSize < size) {
+    if (theEntry->data != 0)
+      delete [] theEntry->data;
+    theEntry->data = new double[size];
+    theEntry->maxSize = size;
+  }
+  for (int i=0; i<size; i++)
+    theEntry->data[i] = data(i);
+  theEntry->size = size;
+  this->release();
+
+  return res;
+}
+
+int 
+AsyncStream::setFile(const char *fileName, openMode mode, bool echo)
+{
+  this->flush();
+  if (theStream == 0)
+    return 0;
+  return theStream->setFile(fileName, mode, echo);
+}
+
+int 
+AsyncStream::setPrecision(int prec)
+{
+  this->flush();
+  if (theStream == 0)
+    return 0;
+  return theStream->setPrecision(prec);
+}
+
+int 
+AsyncStream::setFloatField(floatField field)
+{
+  this->flush();
+  if (theStream == 0)
+    return 0;
+  return theStream->setFloatField(field);
+}
+
+int 
+AsyncStream::precision(int prec)
+{
+  this->flush();
+  if (theStream == 0)
+    return 0;
+  return theStream->precision(prec);
+}
+
+int 
+AsyncStream::width(int w)
+{
+  this->flush();
+  if (theStream == 0)
+    return 0;
+  return theStream->width(w);
+}
+
+int 
+AsyncStream::tag(const char *tagName)
+{
+  this->flush();
+  if (theStream == 0)
+    return 0;
+  return theStream->tag(tagName);
+}
+
+int 
+AsyncStream::tag(const char *tagName, const char *value)
+{
+  this->flush();
+  if (theStream == 0)
+    return 0;
+  return theStream->tag(tagName, value);
+}
+
+int 
+AsyncStream::endTag()
+{
+  this->flush();
+  if (theStream == 0)
+    return 0;
+  return theStream->endTag();
+}
+
+int 
+AsyncStream::attr(const char *name, int value)
+{
+  this->flush();
+  if (theStream == 0)
+    return 0;
+  return theStream->attr(name, value);
+}
+
+int 
+AsyncStream::attr(const char *name, double value)
+{
+  this->flush();
+  if (theStream == 0)
+    return 0;
+  return theStream->attr(name, value);
+}
+
+int 
+AsyncStream::attr(const char *name, const char *value)
+{
+  this->flush();
+  if (theStream == 0)
+    return 0;
+  return theStream->attr(name, value);
+}
+
+OPS_Stream& 
+AsyncStream::write(const char *s,int n)
+{
+  this->flush();
+  if (theStream != 0)
+    theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::write(const unsigned char *s,int n)
+{
+  this->flush();
+  if (theStream != 0)
+    theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::write(const signed char *s,int n)
+{
+  this->flush();
+  if (theStream != 0)
+    theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::write(const void *s, int n)
+{
+  this->flush();
+  if (theStream != 0)
+    theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::write(const double *s, int n)
+{
+  this->flush();
+  if (theStream != 0)
+    theStream->write(s, n);
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(char c)
+{
+  this->flush();
+  if (theStream != 0)
+    *theStream << c;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(unsigned char c)
+{
+  this->flush();
+  if (theStream != 0)
+    *theStream << c;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(signed char c)
+{
+  this->flush();
+  if (theStream != 0)
+    *theStream << c;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(const char *s)
+{
+  this->flush();
+  if (theStream != 0)
+    *theStream << s;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(const unsigned char *s)
+{
+  this->flush();
+  if (theStream != 0)
+    *theStream << s;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(const signed char *s)
+{
+  this->flush();
+  if (theStream != 0)
+    *theStream << s;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(const void *p)
+{
+  this->flush();
+  if (theStream != 0)
+    *theStream << p;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(int n)
+{
+  this->flush();
+  if (theStream != 0)
+    *theStream << n;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(unsigned int n)
+{
+  this->flush();
+  if (theStream != 0)
+    *theStream << n;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(long n)
+{
+  this->flush();
+  if (theStream != 0)
+    *theStream << n;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(unsigned long n)
+{
+  this->flush();
+  if (theStream != 0)
+    *theStream << n;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(short n)
+{
+  this->flush();
+  if (theStream != 0)
+    *theStream << n;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(unsigned short n)
+{
+  this->flush();
+  if (theStream != 0)
+    *theStream << n;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(bool b)
+{
+  this->flush();
+  if (theStream != 0)
+    *theStream << b;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(double n)
+{
+  this->flush();
+  if (theStream != 0)
+    *theStream << n;
+  return *this;
+}
+
+OPS_Stream& 
+AsyncStream::operator<<(float n)
+{
+  this->flush();
+  if (theStream != 0)
+    *theStream << n;
+  return *this;
+}
+
+int 
+AsyncStream::setOrder(const ID &order)
+{
+  this->flush();
+  if (theStream == 0)
+    return 0;
+  return theStream->setOrder(order);
+}
+
+int 
+AsyncStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  opserr << "AsyncStream::sendSelf() - not yet implemented\n";
+  return -1;
+}
+
+int 
+AsyncStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  opserr << "AsyncStream::recvSelf() - not yet implemented\n";
+  return -1;
+}
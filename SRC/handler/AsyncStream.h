@@ -0,0 +1,139 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the class definition for AsyncStream.
+// An AsyncStream is placed between a recorder and the stream it writes to
+// (FileStream, DataFileStream, BinaryFileStream, XmlFileStream, ...). The
+// Vectors passed to write() are copied into a ring buffer of bufferSize rows
+// and returned from at once; the formatting and writing of them by the 
+// wrapped stream is done by a pool of writer threads shared by all 
+// AsyncStreams. The rows of a stream are written in order, one thread at a 
+// time. When the ring buffer is full write() waits for the writers 
+// (backpressure). All other calls first wait until the buffer has been 
+// written and are then passed on to the wrapped stream on the calling 
+// thread. Whole files (e.g. the vtu files of a PVDRecorder) can also be 
+// queued with writeFile(). The destructor, invoked when the recorder is 
+// removed or the model wiped, writes out everything queued.
+//
+// What: "@(#) AsyncStream.h, revA"
+
+#ifndef _AsyncStream
+#define _AsyncStream
+
+#include <OPS_Stream.h>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+
+class AsyncStream : public OPS_Stream
+{
+ public:
+  AsyncStream(OPS_Stream *theStream = 0, int bufferSize = 64);
+  ~AsyncStream();
+
+  int flush(void);
+  int writeFile(const char *fileName, const std::string &contents);
+  OPS_Stream *getStream(void) {return theStream;}
+
+  // number of writer threads shared by all AsyncStreams
+  static int setNumThreads(int numThreads);
+  static int getNumThreads(void);
+
+  // output format
+  int setFile(const char *fileName, openMode mode = OVERWRITE, bool echo = false);
+  int setPrecision(int precision);
+  int setFloatField(floatField);
+  int precision(int precision);
+  int width(int width);
+
+  // xml stuff
+  int tag(const char *);
+  int tag(const char *, const char *);
+  int endTag();
+  int attr(const char *name, int value);
+  int attr(const char *name, double value);
+  int attr(const char *name, const char *value);
+  int write(Vector &data);
+
+  // regular stuff
+  OPS_Stream& write(const char *s, int n);
+  OPS_Stream& write(const unsigned char *s, int n);
+  OPS_Stream& write(const signed char *s, int n);
+  OPS_Stream& write(const void *s, int n);
+  OPS_Stream& write(const double *s, int n);
+
+  OPS_Stream& operator<<(char c);
+  OPS_Stream& operator<<(unsigned char c);
+  OPS_Stream& operator<<(signed char c);
+  OPS_Stream& operator<<(const char *s);
+  OPS_Stream& operator<<(const unsigned char *s);
+  OPS_Stream& operator<<(const signed char *s);
+  OPS_Stream& operator<<(const void *p);
+  OPS_Stream& operator<<(int n);
+  OPS_Stream& operator<<(unsigned int n);
+  OPS_Stream& operator<<(long n);
+  OPS_Stream& operator<<(unsigned long n);
+  OPS_Stream& operator<<(short n);
+  OPS_Stream& operator<<(unsigned short n);
+  OPS_Stream& operator<<(bool b);
+  OPS_Stream& operator<<(double n);
+  OPS_Stream& operator<<(float n);
+
+  // parallel stuff
+  int setOrder(const ID &order);
+  int sendSelf(int commitTag, Channel &theChannel);  
+  int recvSelf(int commitTag, Channel &theChannel, 
+	       FEM_ObjectBroker &theBroker);
+
+  // invoked by the writer threads
+  bool claim(void);
+  void drain(void);
+
+ private:
+  struct Entry {
+    double *data;          // a row, or
+    int size;
+    int maxSize;
+    std::string fileName;  // a whole file
+    std::string contents;
+  };
+
+  int push(Entry *&theEntry);
+  void release(void);
+  int writeEntry(Entry &theEntry);
+
+  OPS_Stream *theStream;
+  std::vector<Entry> ring;
+  int head;
+  int count;
+  bool busy;               // a thread is writing the rows
+  bool scheduled;          // the stream is queued for the writer threads
+  int writeError;
+  std::mutex theMutex;
+  std::condition_variable theCondition;
+};
+
+#endif
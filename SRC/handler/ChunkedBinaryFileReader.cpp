@@ -0,0 +1,319 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the class implementation for 
+// ChunkedBinaryFileReader.
+//
+// What: "@(#) ChunkedBinaryFileReader.cpp, revA"
+
+#include <ChunkedBinaryFileReader.h>
+#include <ChunkedBinaryFileStream.h>
+#include <Vector.h>
+#include <OPS_Globals.h>
+#include <string.h>
+#include <stdio.h>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+ChunkedBinaryFileReader::ChunkedBinaryFileReader(const char *name)
+  :fileName(0), theData(0), fileSize(0), mapped(false),
+   numColumns(0), numRows(0), chunkRows(0)
+{
+  fileName = new char[strlen(name)+1];
+  strcpy(fileName, name);
+}
+
+ChunkedBinaryFileReader::~ChunkedBinaryFileReader()
+{
+  this->close();
+
+  if (fileName != 0)
+    delete [] fileName;
+}
+
+int
+ChunkedBinaryFileReader::open(void)
+{
+  this->close();
+
+#ifndef _WIN32
+  int fd = ::open(fileName, O_RDONLY);
+  if (fd < 0) {
+    opserr << "ChunkedBinaryFileReader::open() - could not open file " << fileName << endln;
+    return -1;
+  }
+  struct stat theStat;
+  if (fstat(fd, &theStat) < 0 || theStat.st_size == 0) {
+    opserr << "ChunkedBinaryFileReader::open() - empty file " << fileName << endln;
+    ::close(fd);
+    return -1;
+  }
+  fileSize = theStat.st_size;
+  void *theMap = mmap(0, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (theMap == MAP_FAILED) {
+    opserr << "ChunkedBinaryFileReader::open() - could not map file " << fileName << endln;
+    fileSize = 0;
+    return -1;
+  }
+  theData = (const unsigned char *)theMap;
+  mapped = true;
+#else
+  FILE *theFile = fopen(fileName, "rb");
+  if (theFile == 0) {
+    opserr << "ChunkedBinaryFileReader::open() - could not open file " << fileName << endln;
+    return -1;
+  }
+  fseek(theFile, 0, SEEK_END);
+  fileSize = ftell(theFile);
+  fseek(theFile, 0, SEEK_SET);
+  unsigned char *buffer = new unsigned char[fileSize];
+  if (fread(buffer, 1, fileSize, theFile) != (size_t)fileSize) {
+    opserr << "ChunkedBinaryFileReader::open() - could not read file " << fileName << endln;
+    delete [] buffer;
+    fclose(theFile);
+    fileSize = 0;
+    return -1;
+  }
+  fclose(theFile);
+  theData = buffer;
+  mapped = false;
+#endif
+
+  // header
+  int head[6];
+  if (fileSize < 8 + (long long)sizeof(head) || strncmp((const char *)theData, "OPSCHNK1", 8) != 0) {
+    opserr << "ChunkedBinaryFileReader::open() - " << fileName << " is not a chunked binary file\n";
+    this->close();
+    return -1;
+  }
+  memcpy(head, theData + 8, sizeof(head));
+  if (head[0] != 0x01020304 || head[1] != 1) {
+    opserr << "ChunkedBinaryFileReader::open() - " << fileName;
+    opserr << " written with another byte order or version\n";
+    this->close();
+    return -1;
+  }
+  numColumns = head[2];
+  chunkRows = head[3];
+
+  long long loc = 8 + sizeof(head);
+  for (int i=0; i<numColumns; i++) {
+    int desc[3];
+    if (loc + (long long)sizeof(desc) > fileSize) {
+      opserr << "ChunkedBinaryFileReader::open() - truncated header in " << fileName << endln;
+      this->close();
+      return -1;
+    }
+    memcpy(desc, theData + loc, sizeof(desc));
+    loc += sizeof(desc);
+    if (desc[2] < 0 || loc + desc[2] > fileSize) {
+      opserr << "ChunkedBinaryFileReader::open() - truncated header in " << fileName << endln;
+      this->close();
+      return -1;
+    }
+    colKind.push_back(desc[0]);
+    colTag.push_back(desc[1]);
+    colName.push_back(std::string((const char *)theData + loc, desc[2]));
+    loc += desc[2];
+  }
+
+  // the chunks, a chunk still being written is ignored
+  numRows = 0;
+  while (loc + 4*(long long)sizeof(int) + (long long)sizeof(long long) <= fileSize) {
+    int chunkHead[4];
+    long long size;
+    memcpy(chunkHead, theData + loc, sizeof(chunkHead));
+    memcpy(&size, theData + loc + sizeof(chunkHead), sizeof(long long));
+    loc += sizeof(chunkHead) + sizeof(long long);
+    if (chunkHead[0] != 0x4B4E4843 || size < 0 || loc + size > fileSize)
+      break;
+
+    ChunkInfo theChunk;
+    theChunk.offset = loc;
+    theChunk.size = size;
+    theChunk.firstRow = numRows;
+    theChunk.numRows = chunkHead[1];
+    theChunk.codec = chunkHead[2];
+    theChunks.push_back(theChunk);
+
+    numRows += chunkHead[1];
+    loc += size;
+  }
+
+  return 0;
+}
+
+int
+ChunkedBinaryFileReader::close(void)
+{
+  if (theData != 0) {
+#ifndef _WIN32
+    if (mapped == true)
+      munmap((void *)theData, fileSize);
+    else
+#endif
+      delete [] theData;
+  }
+  theData = 0;
+  fileSize = 0;
+  mapped = false;
+
+  numColumns = 0;
+  numRows = 0;
+  colKind.clear();
+  colTag.clear();
+  colName.clear();
+  theChunks.clear();
+
+  return 0;
+}
+
+int
+ChunkedBinaryFileReader::getNumColumns(void)
+{
+  return numColumns;
+}
+
+int
+ChunkedBinaryFileReader::getNumRows(void)
+{
+  return numRows;
+}
+
+int
+ChunkedBinaryFileReader::getColumnKind(int column)
+{
+  if (column < 0 || column >= numColumns)
+    return -1;
+  return colKind[column];
+}
+
+int
+ChunkedBinaryFileReader::getColumnTag(int column)
+{
+  if (column < 0 || column >= numColumns)
+    return -1;
+  return colTag[column];
+}
+
+const char *
+ChunkedBinaryFileReader::getColumnName(int column)
+{
+  if (column < 0 || column >= numColumns)
+    return 0;
+  return colName[column].c_str();
+}
+
+int
+ChunkedBinaryFileReader::findColumn(int tag, const char *name)
+{
+  for (int i=0; i<numColumns; i++)
+    if (colTag[i] == tag && colName[i] == name)
+      return i;
+
+  return -1;
+}
+
+int
+ChunkedBinaryFileReader::getColumn(int column, Vector &data, int startRow, int num)
+{
+  if (column < 0 || column >= numColumns) {
+    opserr << "ChunkedBinaryFileReader::getColumn() - no column " << column << endln;
+    return -1;
+  }
+
+  if (startRow < 0)
+    startRow = 0;
+  if (num < 0 || startRow + num > numRows)
+    num = numRows - startRow;
+  if (num < 0)
+    num = 0;
+
+  data.resize(num);
+  if (num == 0)
+    return 0;
+
+  int endRow = startRow + num;
+  for (unsigned int i=0; i<theChunks.size(); i++) {
+    ChunkInfo &theChunk = theChunks[i];
+    int first = theChunk.firstRow;
+    int last = first + theChunk.numRows;
+    if (last <= startRow || first >= endRow)
+      continue;
+
+    int from = (startRow > first) ? startRow : first;
+    int to = (endRow < last) ? endRow : last;
+    if (this->readColumn(theChunk, column, from - first, to - from, 
+			 &data(from - startRow)) < 0)
+      return -1;
+  }
+
+  return 0;
+}
+
+int
+ChunkedBinaryFileReader::readColumn(ChunkInfo &theChunk, int column, 
+				    int first, int num, double *data)
+{
+  const unsigned char *payload = theData + theChunk.offset;
+  int n = theChunk.numRows;
+
+  if (theChunk.codec == CHUNKED_BINARY_RAW) {
+    memcpy(data, payload + ((long long)column*n + first)*sizeof(double), num*sizeof(double));
+    return 0;
+  }
+
+  int tableSize = (numColumns+1)*sizeof(long long) + ((numColumns+7)/8)*8;
+  long long start, end;
+  memcpy(&start, payload + column*sizeof(long long), sizeof(long long));
+  memcpy(&end, payload + (column+1)*sizeof(long long), sizeof(long long));
+  unsigned char codec = payload[(numColumns+1)*sizeof(long long) + column];
+  const unsigned char *block = payload + tableSize + start;
+
+  if (tableSize + end > theChunk.size || start > end) {
+    opserr << "ChunkedBinaryFileReader::getColumn() - corrupt chunk in " << fileName << endln;
+    return -1;
+  }
+
+  if (codec == CHUNKED_BINARY_RAW) {
+    memcpy(data, block + first*sizeof(double), num*sizeof(double));
+    return 0;
+  }
+
+  std::vector<double> values(n);
+  if (ChunkedBinaryFileStream::decodeColumn(block, (int)(end - start), &values[0], n) < 0) {
+    opserr << "ChunkedBinaryFileReader::getColumn() - corrupt chunk in " << fileName << endln;
+    return -1;
+  }
+  memcpy(data, &values[first], num*sizeof(double));
+
+  return 0;
+}
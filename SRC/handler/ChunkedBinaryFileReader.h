@@ -0,0 +1,89 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// ChunkedBinaryFileReader. A ChunkedBinaryFileReader maps a file written 
+// by a ChunkedBinaryFileStream into memory (reading it on systems without
+// mmap), reads the column descriptions and the location of each chunk, 
+// and returns any range of rows of a single column, touching only the 
+// part of the file holding that column.
+//
+// What: "@(#) ChunkedBinaryFileReader.h, revA"
+
+#ifndef _ChunkedBinaryFileReader
+#define _ChunkedBinaryFileReader
+
+#include <vector>
+#include <string>
+
+class Vector;
+
+class ChunkedBinaryFileReader
+{
+ public:
+  ChunkedBinaryFileReader(const char *fileName);
+  ~ChunkedBinaryFileReader();
+
+  int open(void);
+  int close(void);
+
+  int getNumColumns(void);
+  int getNumRows(void);
+  int getColumnKind(int column);     // 0 time, 1 node, 2 element, 3 other
+  int getColumnTag(int column);      // node or element tag, -1 if none
+  const char *getColumnName(int column);
+
+  // index of the column for response name of the node/element, -1 if none
+  int findColumn(int tag, const char *name);
+
+  // rows startRow to startRow+numRows-1 of a column, all if numRows < 0
+  int getColumn(int column, Vector &data, int startRow = 0, int numRows = -1);
+
+ private:
+  struct ChunkInfo {
+    long long offset;    // location of the payload in the file
+    long long size;
+    int firstRow;
+    int numRows;
+    int codec;
+  };
+
+  int readColumn(ChunkInfo &theChunk, int column, int first, int num, double *data);
+
+  char *fileName;
+  const unsigned char *theData;  // the mapped (or read) file
+  long long fileSize;
+  bool mapped;
+
+  int numColumns;
+  int numRows;
+  int chunkRows;
+  std::vector<int> colKind;
+  std::vector<int> colTag;
+  std::vector<std::string> colName;
+  std::vector<ChunkInfo> theChunks;
+};
+
+#endif
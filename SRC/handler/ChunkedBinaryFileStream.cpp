@@ -0,0 +1,489 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the class implementation for 
+// ChunkedBinaryFileStream.
+//
+// What: "@(#) ChunkedBinaryFileStream.cpp, revA"
+
+#include <ChunkedBinaryFileStream.h>
+#include <Vector.h>
+#include <iostream>
+#include <string.h>
+#include <stdio.h>
+
+using std::ios;
+
+ChunkedBinaryFileStream::ChunkedBinaryFileStream()
+  :OPS_Stream(OPS_STREAM_TAGS_ChunkedBinaryFileStream),
+   fileOpen(0), fileName(0), chunkRows(1024), compress(false), async(true),
+   numIndent(0), currentKind(3), currentTag(-1),
+   numColumns(-1), sizeWarning(false), rows(0), numRows(0),
+   maxPending(4), writerDone(false), writeError(0)
+{
+
+}
+
+ChunkedBinaryFileStream::ChunkedBinaryFileStream(const char *file, int nRows,
+						 bool comp, bool asyncWrite)
+  :OPS_Stream(OPS_STREAM_TAGS_ChunkedBinaryFileStream),
+   fileOpen(0), fileName(0), chunkRows(nRows), compress(comp), async(asyncWrite),
+   numIndent(0), currentKind(3), currentTag(-1),
+   numColumns(-1), sizeWarning(false), rows(0), numRows(0),
+   maxPending(4), writerDone(false), writeError(0)
+{
+  if (chunkRows < 1)
+    chunkRows = 1;
+
+  this->setFile(file);
+}
+
+ChunkedBinaryFileStream::~ChunkedBinaryFileStream()
+{
+  this->close();
+
+  if (fileName != 0)
+    delete [] fileName;
+}
+
+int 
+ChunkedBinaryFileStream::setFile(const char *name, openMode mode, bool echo)
+{
+  if (name == 0) {
+    std::cerr << "ChunkedBinaryFileStream::setFile() - no name passed\n";
+    return -1;
+  }
+
+  // if file already open, close it
+  this->close();
+
+  if (fileName != 0)
+    delete [] fileName;
+  fileName = new char[strlen(name)+1];
+  strcpy(fileName, name);
+
+  // the file always starts with a new header
+  if (mode == APPEND)
+    std::cerr << "ChunkedBinaryFileStream::setFile() - append not supported, overwriting " << name << "\n";
+
+  return 0;
+}
+
+int 
+ChunkedBinaryFileStream::open(void)
+{
+  // check setFile has been called
+  if (fileName == 0) {
+    std::cerr << "ChunkedBinaryFileStream::open(void) - no file name has been set\n";
+    return -1;
+  }
+
+  // if file already open, return
+  if (fileOpen == 1)
+    return 0;
+
+  theFile.open(fileName, ios::out | ios::binary | ios::trunc);
+  if (theFile.bad() || !theFile.is_open()) {
+    std::cerr << "WARNING - ChunkedBinaryFileStream::open()";
+    std::cerr << " - could not open file " << fileName << std::endl;
+    fileOpen = 0;
+    return -1;
+  } 
+
+  fileOpen = 1;
+  writerDone = false;
+  writeError = 0;
+  if (async == true)
+    theWriter = std::thread(&ChunkedBinaryFileStream::writerLoop, this);
+
+  return 0;
+}
+
+int 
+ChunkedBinaryFileStream::close(void)
+{
+  if (fileOpen == 0)
+    return 0;
+
+  // write the last partial chunk and wait for the writer to finish
+  if (numRows > 0)
+    this->submitChunk();
+
+  if (async == true) {
+    {
+      std::lock_guard<std::mutex> lock(theMutex);
+      writerDone = true;
+    }
+    theCondition.notify_all();
+    theWriter.join();
+  }
+
+  theFile.close();
+  fileOpen = 0;
+
+  if (rows != 0)
+    delete [] rows;
+  rows = 0;
+  numRows = 0;
+  numColumns = -1;
+
+  return writeError;
+}
+
+int 
+ChunkedBinaryFileStream::tag(const char *tagName)
+{
+  // the outermost tag gives the kind of object whose response follows
+  if (numIndent == 0) {
+    if (strcmp(tagName, "TimeOutput") == 0)
+      currentKind = 0;
+    else if (strcmp(tagName, "NodeOutput") == 0)
+      currentKind = 1;
+    else if (strcmp(tagName, "ElementOutput") == 0)
+      currentKind = 2;
+    else
+      currentKind = 3;
+    currentTag = -1;
+  }
+  numIndent++;
+
+  return 0;
+}
+
+int 
+ChunkedBinaryFileStream::tag(const char *tagName, const char *value)
+{
+  // each ResponseType is one column of the data
+  if (strcmp(tagName, "ResponseType") == 0 && numColumns < 0) {
+    colKind.push_back(numIndent > 0 ? currentKind : 0);
+    colTag.push_back(numIndent > 0 ? currentTag : -1);
+    colName.push_back(value);
+  }
+
+  return 0;
+}
+
+int 
+ChunkedBinaryFileStream::endTag()
+{
+  if (numIndent > 0)
+    numIndent--;
+
+  return 0;
+}
+
+int 
+ChunkedBinaryFileStream::attr(const char *name, int value)
+{
+  if (numIndent == 1 && 
+      (strcmp(name, "nodeTag") == 0 || strcmp(name, "eleTag") == 0))
+    currentTag = value;
+
+  return 0;
+}
+
+int 
+ChunkedBinaryFileStream::attr(const char *name, double value)
+{
+  return 0;
+}
+
+int 
+ChunkedBinaryFileStream::attr(const char *name, const char *value)
+{
+  return 0;
+}
+
+int 
+ChunkedBinaryFileStream::write(Vector &data)
+{
+  // the first row fixes the number of columns and the header
+  if (numColumns < 0) {
+    if (fileOpen == 0 && this->open() < 0)
+      return -1;
+
+    numColumns = data.Size();
+    rows = new double[numColumns*chunkRows];
+    numRows = 0;
+    if (this->writeHeader() < 0)
+      return -1;
+  }
+
+  int size = data.Size();
+  if (size != numColumns) {
+    if (sizeWarning == false) {
+      std::cerr << "WARNING - ChunkedBinaryFileStream::write() - row of size " << size;
+      std::cerr << " in file " << fileName << " with " << numColumns << " columns\n";
+      sizeWarning = true;
+    }
+    if (size > numColumns)
+      size = numColumns;
+  }
+
+  for (int i=0; i<size; i++)
+    rows[i*chunkRows + numRows] = data(i);
+  for (int i=size; i<numColumns; i++)
+    rows[i*chunkRows + numRows] = 0.0;
+  numRows++;
+
+  if (numRows == chunkRows)
+    return this->submitChunk();
+
+  return 0;
+}
+
+int 
+ChunkedBinaryFileStream::writeHeader(void)
+{
+  // columns not described by the recorder get a generic name
+  int numDescribed = (int)colName.size();
+  for (int i=numDescribed; i<numColumns; i++) {
+    char name[20];
+    sprintf(name, "c%d", i+1);
+    colKind.push_back(3);
+    colTag.push_back(-1);
+    colName.push_back(name);
+  }
+
+  int head[6];
+  head[0] = 0x01020304;
+  head[1] = 1;
+  head[2] = numColumns;
+  head[3] = chunkRows;
+  head[4] = (compress == true) ? CHUNKED_BINARY_COMPRESSED : CHUNKED_BINARY_RAW;
+  head[5] = 0;
+
+  theFile.write("OPSCHNK1", 8);
+  theFile.write((const char *)head, 6*sizeof(int));
+  for (int i=0; i<numColumns; i++) {
+    int desc[3];
+    desc[0] = colKind[i];
+    desc[1] = colTag[i];
+    desc[2] = (int)colName[i].size();
+    theFile.write((const char *)desc, 3*sizeof(int));
+    theFile.write(colName[i].c_str(), desc[2]);
+  }
+
+  if (theFile.bad()) {
+    std::cerr << "WARNING - ChunkedBinaryFileStream::writeHeader()";
+    std::cerr << " - could not write to file " << fileName << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+
+int 
+ChunkedBinaryFileStream::submitChunk(void)
+{
+  Chunk theChunk;
+  theChunk.data = rows;
+  theChunk.numRows = numRows;
+
+  rows = new double[numColumns*chunkRows];
+  numRows = 0;
+
+  if (async == false) {
+    int result = this->writeChunk(theChunk);
+    delete [] theChunk.data;
+    if (result < 0)
+      writeError = result;
+    return result;
+  }
+
+  // hand the chunk to the writer, waiting if it is behind
+  std::unique_lock<std::mutex> lock(theMutex);
+  while ((int)pending.size() >= maxPending)
+    theCondition.wait(lock);
+  pending.push_back(theChunk);
+  int result = writeError;
+  lock.unlock();
+  theCondition.notify_all();
+
+  return result;
+}
+
+void
+ChunkedBinaryFileStream::writerLoop(void)
+{
+  std::unique_lock<std::mutex> lock(theMutex);
+  while (true) {
+    while (pending.empty() && writerDone == false)
+      theCondition.wait(lock);
+    if (pending.empty())
+      break;
+
+    Chunk theChunk = pending.front();
+    lock.unlock();
+
+    int result = this->writeChunk(theChunk);
+    delete [] theChunk.data;
+
+    lock.lock();
+    if (result < 0)
+      writeError = result;
+    pending.pop_front();
+    theCondition.notify_all();
+  }
+}
+
+int 
+ChunkedBinaryFileStream::writeChunk(Chunk &theChunk)
+{
+  int n = theChunk.numRows;
+
+  int head[4];
+  head[0] = 0x4B4E4843; // "CHNK"
+  head[1] = n;
+  head[2] = CHUNKED_BINARY_RAW;
+  head[3] = 0;
+  long long payload = 0;
+
+  if (compress == false) {
+    payload = (long long)numColumns*n*sizeof(double);
+    theFile.write((const char *)head, 4*sizeof(int));
+    theFile.write((const char *)&payload, sizeof(long long));
+    for (int i=0; i<numColumns; i++)
+      theFile.write((const char *)&theChunk.data[i*chunkRows], n*sizeof(double));
+
+  } else {
+
+    // column offsets, codec bytes padded to 8 bytes, then the columns; a
+    // column that does not get smaller is stored raw
+    int tableSize = (numColumns+1)*sizeof(long long) + ((numColumns+7)/8)*8;
+    int maxSize = tableSize + numColumns*(9*n);
+    if ((int)encodeBuffer.size() < maxSize)
+      encodeBuffer.resize(maxSize);
+    unsigned char *table = &encodeBuffer[0];
+    long long *offsets = (long long *)table;
+    unsigned char *codec = table + (numColumns+1)*sizeof(long long);
+    unsigned char *out = table + tableSize;
+
+    memset(table, 0, tableSize);
+    long long loc = 0;
+    for (int i=0; i<numColumns; i++) {
+      const double *column = &theChunk.data[i*chunkRows];
+      offsets[i] = loc;
+      int numBytes = encodeColumn(column, n, out + loc);
+      if (numBytes >= (int)(n*sizeof(double))) {
+	memcpy(out + loc, column, n*sizeof(double));
+	numBytes = n*sizeof(double);
+	codec[i] = CHUNKED_BINARY_RAW;
+      } else
+	codec[i] = CHUNKED_BINARY_COMPRESSED;
+      loc += numBytes;
+    }
+    offsets[numColumns] = loc;
+
+    head[2] = CHUNKED_BINARY_COMPRESSED;
+    payload = tableSize + loc;
+    theFile.write((const char *)head, 4*sizeof(int));
+    theFile.write((const char *)&payload, sizeof(long long));
+    theFile.write((const char *)table, payload);
+  }
+
+  if (theFile.bad()) {
+    std::cerr << "WARNING - ChunkedBinaryFileStream::writeChunk()";
+    std::cerr << " - could not write to file " << fileName << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+
+int
+ChunkedBinaryFileStream::encodeColumn(const double *data, int n, unsigned char *out)
+{
+  int numBytes = 0;
+  unsigned long long last = 0;
+
+  for (int i=0; i<n; i++) {
+    unsigned long long bits;
+    memcpy(&bits, &data[i], sizeof(double));
+    unsigned long long x = bits ^ last;
+    last = bits;
+
+    int lead = 0;
+    int trail = 0;
+    if (x == 0) 
+      lead = 8;
+    else {
+      while (lead < 8 && ((x >> (56 - 8*lead)) & 0xff) == 0)
+	lead++;
+      while (trail < 8 && ((x >> (8*trail)) & 0xff) == 0)
+	trail++;
+    }
+
+    out[numBytes++] = (unsigned char)((lead << 4) | trail);
+    for (int b=7-lead; b>=trail; b--)
+      out[numBytes++] = (unsigned char)((x >> (8*b)) & 0xff);
+  }
+
+  return numBytes;
+}
+
+int
+ChunkedBinaryFileStream::decodeColumn(const unsigned char *in, int numBytes, 
+				      double *data, int n)
+{
+  int loc = 0;
+  unsigned long long last = 0;
+
+  for (int i=0; i<n; i++) {
+    if (loc >= numBytes)
+      return -1;
+    int lead = in[loc] >> 4;
+    int trail = in[loc] & 0x0f;
+    loc++;
+
+    unsigned long long x = 0;
+    if (lead < 8) {
+      if (loc + 8 - lead - trail > numBytes)
+	return -1;
+      for (int b=7-lead; b>=trail; b--)
+	x |= ((unsigned long long)in[loc++]) << (8*b);
+    }
+
+    last ^= x;
+    memcpy(&data[i], &last, sizeof(double));
+  }
+
+  return 0;
+}
+
+int 
+ChunkedBinaryFileStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  std::cerr << "ChunkedBinaryFileStream::sendSelf() - not available in parallel\n";
+  return -1;
+}
+
+int 
+ChunkedBinaryFileStream::recvSelf(int commitTag, Channel &theChannel, 
+				  FEM_ObjectBroker &theBroker)
+{
+  std::cerr << "ChunkedBinaryFileStream::recvSelf() - not available in parallel\n";
+  return -1;
+}
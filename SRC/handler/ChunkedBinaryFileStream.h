@@ -0,0 +1,140 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// ChunkedBinaryFileStream. A ChunkedBinaryFileStream writes the Vectors
+// passed to write() (one row per recorded step) to a self-describing
+// columnar binary file:
+//
+//   header: "OPSCHNK1", byte order mark 0x01020304, version, numColumns,
+//           chunkRows, compression, 0 and for each column its kind (0 time,
+//           1 node, 2 element, 3 other), the node/element tag and the 
+//           response name (int length, chars) obtained from the tag() and 
+//           attr() calls made by the recorders.
+//   chunks: 'CHNK', numRows, codec (0 raw, 1 compressed), 0, int64 size of
+//           the payload and the payload; up to chunkRows rows stored column 
+//           after column. A compressed payload starts with the int64 offsets
+//           of the columns and a codec byte per column (padded to 8 bytes);
+//           each column is the xor of each value with the previous one, 
+//           stored as a byte with the number of leading (high 4 bits) and 
+//           trailing zero bytes and the bytes in between.
+//
+// Full chunks are handed to a background thread which compresses and writes
+// them, at most maxPending chunks are held before write() waits for it. The
+// file can be read, and a single column sliced without reading the rest, 
+// with a ChunkedBinaryFileReader.
+//
+// What: "@(#) ChunkedBinaryFileStream.h, revA"
+
+#ifndef _ChunkedBinaryFileStream
+#define _ChunkedBinaryFileStream
+
+#include <OPS_Stream.h>
+#include <fstream>
+#include <vector>
+#include <deque>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#define CHUNKED_BINARY_RAW         0
+#define CHUNKED_BINARY_COMPRESSED  1
+
+class ChunkedBinaryFileStream : public OPS_Stream
+{
+ public:
+  ChunkedBinaryFileStream();
+  ChunkedBinaryFileStream(const char *fileName, 
+			  int chunkRows = 1024, 
+			  bool compress = false,
+			  bool async = true);
+  ~ChunkedBinaryFileStream();
+
+  int setFile(const char *fileName, openMode mode = OVERWRITE, bool echo = false);
+  int open(void);
+  int close(void);
+
+  // xml stuff
+  int tag(const char *);
+  int tag(const char *, const char *);
+  int endTag();
+  int attr(const char *name, int value);
+  int attr(const char *name, double value);
+  int attr(const char *name, const char *value);
+  int write(Vector &data);
+
+  // parallel stuff
+  int sendSelf(int commitTag, Channel &theChannel);  
+  int recvSelf(int commitTag, Channel &theChannel, 
+	       FEM_ObjectBroker &theBroker);
+
+  // encoding of a column of a compressed chunk, returns number of bytes
+  static int encodeColumn(const double *data, int n, unsigned char *out);
+  static int decodeColumn(const unsigned char *in, int numBytes, double *data, int n);
+
+ private:
+  struct Chunk {
+    double *data;
+    int numRows;
+  };
+
+  int writeHeader(void);
+  int writeChunk(Chunk &theChunk);
+  int submitChunk(void);
+  void writerLoop(void);
+
+  std::ofstream theFile;
+  int fileOpen;
+  char *fileName;
+  int chunkRows;
+  bool compress;
+  bool async;
+
+  // column description collected from tag() and attr()
+  std::vector<int> colKind;
+  std::vector<int> colTag;
+  std::vector<std::string> colName;
+  int numIndent;
+  int currentKind;
+  int currentTag;
+
+  int numColumns;          // set by first write()
+  bool sizeWarning;
+  double *rows;            // rows of the chunk being filled, column major
+  int numRows;
+
+  // writer thread
+  std::thread theWriter;
+  std::mutex theMutex;
+  std::condition_variable theCondition;
+  std::deque<Chunk> pending;
+  int maxPending;
+  bool writerDone;
+  int writeError;
+  std::vector<unsigned char> encodeBuffer;
+};
+
+#endif
@@ -0,0 +1,231 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Written: agent
+// Created: Oct 2026
+//
+// Purpose: This file is a driver to test the ChunkedBinaryFileStream and
+// ChunkedBinaryFileReader. The columns compressed with encodeColumn() must
+// come back bit for bit from decodeColumn(), for smooth, constant, random
+// and special (signed zero, infinite, NaN, denormal) values, and a column
+// cut short must be rejected. A file is then written, raw and compressed,
+// with and without the writer thread, and the column descriptions and
+// whole and sliced columns read back with the reader.
+//
+//   testChunkedBinaryFileStream <fileName>
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include <limits>
+#include <vector>
+
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+#include <Vector.h>
+
+#include <ChunkedBinaryFileStream.h>
+#include <ChunkedBinaryFileReader.h>
+
+// global variables
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+double        ops_Dt = 0;
+Domain       *ops_TheActiveDomain = 0;
+Element      *ops_TheActiveElement = 0;
+
+static int numTests = 0;
+static int numFailed = 0;
+
+static void
+check(bool ok, const char *what)
+{
+  numTests++;
+  if (ok)
+    opserr << "PASS: " << what << endln;
+  else {
+    opserr << "FAIL: " << what << endln;
+    numFailed++;
+  }
+}
+
+// encodes and decodes the column, checking the values come back bit for
+// bit and that the column cut short by a byte is rejected
+static void
+checkColumn(const std::vector<double> &column, const char *what)
+{
+  int n = column.size();
+  std::vector<unsigned char> encoded(9*n+1);
+  int numBytes = ChunkedBinaryFileStream::encodeColumn(&column[0], n, &encoded[0]);
+
+  std::vector<double> decoded(n);
+  int res = ChunkedBinaryFileStream::decodeColumn(&encoded[0], numBytes, &decoded[0], n);
+  bool ok = (res == 0 && numBytes <= 9*n &&
+	     memcmp(&column[0], &decoded[0], n*sizeof(double)) == 0);
+  ok = ok && ChunkedBinaryFileStream::decodeColumn(&encoded[0], numBytes-1, &decoded[0], n) < 0;
+
+  numTests++;
+  if (ok)
+    opserr << "PASS: " << what << ", " << numBytes << " bytes for " << n << " values\n";
+  else {
+    opserr << "FAIL: " << what << endln;
+    numFailed++;
+  }
+}
+
+// the value of column c of row i written to the file
+static double
+getValue(int i, int c)
+{
+  if (c == 0)
+    return 0.01*i;
+  return sin(0.1*i + c) * pow(10.0, c);
+}
+
+// writes numRows rows of 4 columns (time, 2 of node 7, 1 of element 3),
+// reads them back and checks the description and the columns
+static void
+checkFile(const char *fileName, int numRows, bool compress, bool async, const char *what)
+{
+  ChunkedBinaryFileStream *theStream =
+    new ChunkedBinaryFileStream(fileName, 16, compress, async);
+
+  theStream->tag("TimeOutput");
+  theStream->tag("ResponseType", "time");
+  theStream->endTag();
+  theStream->tag("NodeOutput");
+  theStream->attr("nodeTag", 7);
+  theStream->tag("ResponseType", "UX");
+  theStream->tag("ResponseType", "UY");
+  theStream->endTag();
+  theStream->tag("ElementOutput");
+  theStream->attr("eleTag", 3);
+  theStream->tag("ResponseType", "N");
+  theStream->endTag();
+
+  Vector row(4);
+  for (int i=0; i<numRows; i++) {
+    for (int c=0; c<4; c++)
+      row(c) = getValue(i, c);
+    theStream->write(row);
+  }
+  delete theStream;
+
+  ChunkedBinaryFileReader theReader(fileName);
+  bool ok = (theReader.open() == 0);
+  ok = ok && theReader.getNumColumns() == 4 && theReader.getNumRows() == numRows;
+  ok = ok && theReader.getColumnKind(0) == 0 && theReader.getColumnKind(1) == 1 &&
+    theReader.getColumnKind(3) == 2;
+  ok = ok && theReader.getColumnTag(2) == 7 && theReader.getColumnTag(3) == 3;
+  ok = ok && strcmp(theReader.getColumnName(2), "UY") == 0;
+  ok = ok && theReader.findColumn(7, "UY") == 2 && theReader.findColumn(3, "N") == 3;
+  ok = ok && theReader.findColumn(7, "N") == -1;
+
+  // each whole column, and rows 10 to 40 that span three chunks
+  Vector data;
+  for (int c=0; ok == true && c<4; c++) {
+    ok = (theReader.getColumn(c, data) == 0 && data.Size() == numRows);
+    for (int i=0; ok == true && i<numRows; i++)
+      ok = (data(i) == getValue(i, c));
+    ok = ok && (theReader.getColumn(c, data, 10, 31) == 0 && data.Size() == 31);
+    for (int i=0; ok == true && i<31; i++)
+      ok = (data(i) == getValue(10+i, c));
+  }
+  theReader.close();
+
+  check(ok, what);
+}
+
+
+int main(int argc, char **argv)
+{
+  const char *fileName = "testChunkedBinaryFileStream.out";
+  if (argc > 1)
+    fileName = argv[1];
+
+  //
+  // encodeColumn() and decodeColumn()
+  //
+
+  int n = 200;
+  std::vector<double> column(n);
+
+  for (int i=0; i<n; i++)
+    column[i] = 0.0;
+  checkColumn(column, "zeros");
+
+  for (int i=0; i<n; i++)
+    column[i] = 3.25;
+  checkColumn(column, "constant");
+
+  for (int i=0; i<n; i++)
+    column[i] = 0.001*i;
+  checkColumn(column, "ramp");
+
+  for (int i=0; i<n; i++)
+    column[i] = 1.0e-3*sin(0.05*i);
+  checkColumn(column, "sine");
+
+  unsigned long long seed = 12345;
+  for (int i=0; i<n; i++) {
+    seed = seed*6364136223846793005ULL + 1442695040888963407ULL;
+    unsigned long long bits = seed;
+    memcpy(&column[i], &bits, sizeof(double));
+  }
+  checkColumn(column, "random bits");
+
+  double special[] = {0.0, -0.0, std::numeric_limits<double>::infinity(),
+		      -std::numeric_limits<double>::infinity(),
+		      std::numeric_limits<double>::quiet_NaN(),
+		      std::numeric_limits<double>::denorm_min(),
+		      DBL_MAX, -DBL_MAX, DBL_MIN, 1.0, -1.0};
+  int numSpecial = sizeof(special)/sizeof(double);
+  column.resize(3*numSpecial);
+  for (int i=0; i<3*numSpecial; i++)
+    column[i] = special[(7*i) % numSpecial];
+  checkColumn(column, "signed zero, infinite, NaN and denormal");
+
+  column.resize(1);
+  column[0] = -2.5;
+  checkColumn(column, "single value");
+
+  //
+  // the stream and the reader: 50 rows are three full chunks and part of
+  // a fourth
+  //
+
+  checkFile(fileName, 50, false, false, "file, raw, no writer thread");
+  checkFile(fileName, 50, false, true, "file, raw, writer thread");
+  checkFile(fileName, 50, true, false, "file, compressed, no writer thread");
+  checkFile(fileName, 50, true, true, "file, compressed, writer thread");
+  checkFile(fileName, 200, true, true, "file, compressed, more chunks than held");
+
+  remove(fileName);
+
+  opserr << numTests - numFailed << " of " << numTests << " tests passed\n";
+
+  if (numFailed != 0)
+    return -1;
+
+  return 0;
+}
@@ -3,12 +3,15 @@
 
 DL_Interpreter  *ops_TheActiveInterpreter = 0;
 
-DL_Interpreter::DL_Interpreter() {
+DL_Interpreter::DL_Interpreter()
+  :outputArray(0), outputArraySize(0), outputArrayRows(0), outputArrayCols(0)
+{
 
 }
 
 DL_Interpreter::~DL_Interpreter() {
-  // does nothing
+  if (outputArray != 0)
+    delete [] outputArray;
 }
 
 int 
@@ -66,3 +69,33 @@ DL_Interpreter::setString(const char*)
 {
     return -1;
 }
+
+double *
+DL_Interpreter::getDoubleArray(int numRows, int numCols)
+{
+  // the staging array is kept between commands and only grows
+  int size = numRows*numCols;
+  if (size < 1)
+    size = 1;
+  if (size > outputArraySize) {
+    if (outputArray != 0)
+      delete [] outputArray;
+    outputArray = new double[size];
+    outputArraySize = size;
+  }
+  outputArrayRows = numRows;
+  outputArrayCols = numCols;
+
+  return outputArray;
+}
+
+int
+DL_Interpreter::setDoubleArray(void)
+{
+  // by default the block is returned as a flat list
+  int size = outputArrayRows*outputArrayCols;
+  if (size == 0)
+    return 0;
+
+  return this->setDouble(outputArray, size);
+}
@@ -57,9 +57,18 @@ class DL_Interpreter
     virtual int setInt(int *, int numArgs);
     virtual int setDouble(double *, int numArgs);
     virtual int setString(const char*);
+
+    // methods for commands returning a numRows x numCols block of
+    // doubles: the command fills the row-major storage returned by
+    // getDoubleArray() and then invokes setDoubleArray()
+    virtual double *getDoubleArray(int numRows, int numCols);
+    virtual int setDoubleArray(void);
     
   private:
-
+    double *outputArray;
+    int outputArraySize;
+    int outputArrayRows;
+    int outputArrayCols;
 };
 
 
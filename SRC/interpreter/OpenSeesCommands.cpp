@@ -58,6 +58,8 @@
 #include <FullGenEigenSolver.h>
 #include <FullGenEigenSOE.h>
 #include <ArpackSOE.h>
+#include <SymSparseEigenSOE.h>
+#include <SymSparseEigenSolver.h>
 #include <LoadControl.h>
 #include <CTestPFEM.h>
 #include <PFEMIntegrator.h>
@@ -77,6 +79,7 @@
 #include <RegulaFalsiLineSearch.h>
 #include <NewtonLineSearch.h>
 #include <FileDatastore.h>
+#include <BinaryFileDatastore.h>
 
 
 // active object
@@ -91,8 +94,8 @@ OpenSeesCommands::OpenSeesCommands(DL_Interpreter* interp)
      theSOE(0), theEigenSOE(0), theNumberer(0), theHandler(0),
      theStaticIntegrator(0), theTransientIntegrator(0),
      theAlgorithm(0), theStaticAnalysis(0), theTransientAnalysis(0),
-     thePFEMAnalysis(0),
-     theAnalysisModel(0), theTest(0), numEigen(0), theDatabase(0),
+     thePFEMAnalysis(0), theExplicitAnalysis(0),
+     theAnalysisModel(0), theTest(0), numEigen(0), numThreads(1), constantTangents(false), privateStorage(false), theDatabase(0),
      theBroker(), theTimer(), theSimulationInfo()
 {
     cmds = this;
@@ -154,7 +157,8 @@ OpenSeesCommands::setSOE(LinearSOE* soe)
 
 int
 OpenSeesCommands::eigen(int typeSolver, double shift,
-			bool generalizedAlgo, bool findSmallest)
+			bool generalizedAlgo, bool findSmallest,
+			double shiftMax, int blockSize, int numThreads)
 {
     //
     // create a transient analysis if no analysis exists
@@ -216,6 +220,11 @@ OpenSeesCommands::eigen(int typeSolver, double shift,
 	    FullGenEigenSolver *theEigenSolver = new FullGenEigenSolver();
 	    theEigenSOE = new FullGenEigenSOE(*theEigenSolver, *theAnalysisModel);
 
+	} else if (typeSolver == EigenSOE_TAGS_SymSparseEigenSOE) {
+
+	    SymSparseEigenSolver *theEigenSolver = new SymSparseEigenSolver();
+	    theEigenSOE = new SymSparseEigenSOE(*theEigenSolver, *theAnalysisModel);
+
 	} else {
 
 	    theEigenSOE = new ArpackSOE(shift);
@@ -234,6 +243,14 @@ OpenSeesCommands::eigen(int typeSolver, double shift,
 
     } // theEigenSOE != 0
 
+    // the sparse solver keeps its factorization between calls, the window
+    // and block size being set on each
+    if (typeSolver == EigenSOE_TAGS_SymSparseEigenSOE) {
+	SymSparseEigenSOE *theSparseSOE = (SymSparseEigenSOE *)theEigenSOE;
+	theSparseSOE->setWindow(shift, shiftMax);
+	theSparseSOE->setBlockSize(blockSize);
+	theSparseSOE->setNumThreads(numThreads);
+    }
 
     // run analysis
     int result = 0;
@@ -354,6 +371,9 @@ OpenSeesCommands::setStaticIntegrator(StaticIntegrator* integrator)
     // set new one
     theStaticIntegrator = integrator;
     if (integrator == 0) return;
+    integrator->setNumThreads(numThreads);
+    integrator->setConstantTangents(constantTangents);
+    integrator->setPrivateStorage(privateStorage);
 
     // set in analysis object
     if (theStaticAnalysis != 0) {
@@ -384,6 +404,9 @@ OpenSeesCommands::setTransientIntegrator(TransientIntegrator* integrator)
     // set new one
     theTransientIntegrator = integrator;
     if (integrator == 0) return;
+    integrator->setNumThreads(numThreads);
+    integrator->setConstantTangents(constantTangents);
+    integrator->setPrivateStorage(privateStorage);
 
     // set in analysis object
     if (theTransientAnalysis != 0) {
@@ -391,6 +414,57 @@ OpenSeesCommands::setTransientIntegrator(TransientIntegrator* integrator)
     }
 }
 
+void
+OpenSeesCommands::setNumThreads(int num)
+{
+    if (num < 1) num = 1;
+    numThreads = num;
+
+    // element state determination in the domain
+    if (theDomain != 0) {
+	theDomain->setNumThreads(num);
+    }
+
+    // formation of tangent and residual by the integrators
+    if (theStaticIntegrator != 0) {
+	theStaticIntegrator->setNumThreads(num);
+    }
+    if (theTransientIntegrator != 0) {
+	theTransientIntegrator->setNumThreads(num);
+    }
+
+    // element forces of the explicit analysis
+    if (theExplicitAnalysis != 0) {
+	theExplicitAnalysis->setNumThreads(num);
+    }
+}
+
+void
+OpenSeesCommands::setConstantTangents(bool flag)
+{
+    constantTangents = flag;
+
+    if (theStaticIntegrator != 0) {
+	theStaticIntegrator->setConstantTangents(flag);
+    }
+    if (theTransientIntegrator != 0) {
+	theTransientIntegrator->setConstantTangents(flag);
+    }
+}
+
+void
+OpenSeesCommands::setPrivateStorage(bool flag)
+{
+    privateStorage = flag;
+
+    if (theStaticIntegrator != 0) {
+	theStaticIntegrator->setPrivateStorage(flag);
+    }
+    if (theTransientIntegrator != 0) {
+	theTransientIntegrator->setPrivateStorage(flag);
+    }
+}
+
 void
 OpenSeesCommands::setAlgorithm(EquiSolnAlgo* algorithm)
 {
@@ -434,6 +508,10 @@ OpenSeesCommands::setStaticAnalysis()
 	delete theTransientAnalysis;
 	theTransientAnalysis = 0;
     }
+    if (theExplicitAnalysis != 0) {
+	delete theExplicitAnalysis;
+	theExplicitAnalysis = 0;
+    }
 
     // create static analysis
     if (theAnalysisModel == 0) {
@@ -505,6 +583,10 @@ OpenSeesCommands::setPFEMAnalysis()
 	delete theTransientAnalysis;
 	theTransientAnalysis = 0;
     }
+    if (theExplicitAnalysis != 0) {
+	delete theExplicitAnalysis;
+	theExplicitAnalysis = 0;
+    }
 
     // create PFEM analysis
     if(OPS_GetNumRemainingInputArgs() < 3) {
@@ -596,6 +678,10 @@ OpenSeesCommands::setVariableAnalysis()
 	delete theTransientAnalysis;
 	theTransientAnalysis = 0;
     }
+    if (theExplicitAnalysis != 0) {
+	delete theExplicitAnalysis;
+	theExplicitAnalysis = 0;
+    }
 
     // make sure all the components have been built,
     // otherwise print a warning and use some defaults
@@ -668,6 +754,30 @@ OpenSeesCommands::setVariableAnalysis()
 
 }
 
+void
+OpenSeesCommands::setExplicitAnalysis(double dtFactor, double alphaM, int maxLevels)
+{
+    // delete the old analysis
+    if (theStaticAnalysis != 0) {
+	delete theStaticAnalysis;
+	theStaticAnalysis = 0;
+    }
+    if (theTransientAnalysis != 0) {
+	delete theTransientAnalysis;
+	theTransientAnalysis = 0;
+	thePFEMAnalysis = 0;
+    }
+    if (theExplicitAnalysis != 0) {
+	delete theExplicitAnalysis;
+	theExplicitAnalysis = 0;
+    }
+
+    // the explicit analysis works on the domain, it needs no 
+    // system, numberer, handler, integrator or algorithm
+    theExplicitAnalysis = new ExplicitDynamicAnalysis(*theDomain, numThreads,
+						      dtFactor, alphaM, maxLevels);
+}
+
 void
 OpenSeesCommands::setTransientAnalysis()
 {
@@ -680,6 +790,10 @@ OpenSeesCommands::setTransientAnalysis()
 	delete theTransientAnalysis;
 	theTransientAnalysis = 0;
     }
+    if (theExplicitAnalysis != 0) {
+	delete theExplicitAnalysis;
+	theExplicitAnalysis = 0;
+    }
 
     // create transient analysis
     if (theAnalysisModel == 0) {
@@ -911,6 +1025,9 @@ OpenSeesCommands::wipeAnalysis()
     	theTransientAnalysis->clearAll();
     	delete theTransientAnalysis;
     }
+    if (theExplicitAnalysis != 0) {
+    	delete theExplicitAnalysis;
+    }
 
     theAlgorithm = 0;
     theHandler = 0;
@@ -923,6 +1040,7 @@ OpenSeesCommands::wipeAnalysis()
     theStaticAnalysis = 0;
     theTransientAnalysis = 0;
     thePFEMAnalysis = 0;
+    theExplicitAnalysis = 0;
     theTest = 0;
 
 // AddingSensitivity:BEGIN /////////////////////////////////////////////////
@@ -951,6 +1069,9 @@ OpenSeesCommands::wipe()
     if (theDomain != 0) {
 	theDomain->clearAll();
     }
+    this->setNumThreads(1);
+    this->setConstantTangents(false);
+    this->setPrivateStorage(false);
 
     // time set to zero
     ops_Dt = 0.0;
@@ -1002,20 +1123,59 @@ OpenSeesCommands::setFileDatabase(const char* filename)
     }
 }
 
+void
+OpenSeesCommands::setBinaryFileDatabase(const char* filename)
+{
+    if (theDatabase != 0) delete theDatabase;
+    theDatabase = new BinaryFileDatastore(filename, *theDomain, theBroker);
+    if (theDatabase == 0) {
+	opserr << "WARNING ran out of memory - database Binary " << filename << endln;
+    }
+}
+
 /////////////////////////////
 //// OpenSees APIs  /// /////
 /////////////////////////////
+// ints handed out by OPS_GetIntInput before the command line
+// arguments, used by the bulk commands to feed tags to the parsers
+static const int* intInputPrefix = 0;
+static int numIntInputPrefix = 0;
+
+int OPS_SetIntInputPrefix(int numData, const int* data)
+{
+    if (numData < 0 || (numData > 0 && data == 0)) return -1;
+    intInputPrefix = data;
+    numIntInputPrefix = numData;
+    return 0;
+}
+
+int OPS_GetNumIntInputPrefix()
+{
+    return numIntInputPrefix;
+}
+
 int OPS_GetNumRemainingInputArgs()
 {
     DL_Interpreter* interp = cmds->getInterpreter();
-    return interp->getNumRemainingInputArgs();
+    return numIntInputPrefix + interp->getNumRemainingInputArgs();
 }
 
 int OPS_GetIntInput(int *numData, int*data)
 {
     DL_Interpreter* interp = cmds->getInterpreter();
     if (numData == 0 || data == 0) return -1;
-    return interp->getInt(data, *numData);
+    int num = *numData;
+    if (numIntInputPrefix > 0 && num > 0) {
+	int numPrefix = num < numIntInputPrefix ? num : numIntInputPrefix;
+	for (int i=0; i<numPrefix; i++) {
+	    data[i] = intInputPrefix[i];
+	}
+	intInputPrefix += numPrefix;
+	numIntInputPrefix -= numPrefix;
+	if (numPrefix == num) return 0;
+	return interp->getInt(&data[numPrefix], num-numPrefix);
+    }
+    return interp->getInt(data, num);
 }
 
 int OPS_SetIntOutput(int *numData, int*data)
@@ -1039,6 +1199,19 @@ int OPS_SetDoubleOutput(int *numData, double *data)
     return interp->setDouble(data, *numData);
 }
 
+double* OPS_GetDoubleOutputArray(int numRows, int numCols)
+{
+    DL_Interpreter* interp = cmds->getInterpreter();
+    if (numRows < 0 || numCols < 0) return 0;
+    return interp->getDoubleArray(numRows, numCols);
+}
+
+int OPS_SetDoubleOutputArray()
+{
+    DL_Interpreter* interp = cmds->getInterpreter();
+    return interp->setDoubleArray();
+}
+
 const char * OPS_GetString(void)
 {
     DL_Interpreter* interp = cmds->getInterpreter();
@@ -1176,6 +1349,20 @@ int OPS_System()
 
     const char* type = OPS_GetString();
 
+    // system -numThreads n: number of threads used to update the elements
+    // and form the tangent and residual assembled into the system, the
+    // same as integrator -numThreads n
+    if (strcmp(type,"-numThreads") == 0) {
+	int numThreads = 1;
+	int numdata = 1;
+	if (OPS_GetIntInput(&numdata, &numThreads) < 0 || numThreads < 1) {
+	    opserr << "WARNING system -numThreads n - invalid n\n";
+	    return -1;
+	}
+	cmds->setNumThreads(numThreads);
+	return 0;
+    }
+
     // create soe
     LinearSOE* theSOE = 0;
 
@@ -1264,6 +1451,14 @@ int OPS_System()
 	// now must determine the type of solver to create from rest of args
 	theSOE = (LinearSOE*)OPS_SymSparseLinSolver();
 
+    } else if (strcmp(type,"Supernodal") == 0) {
+	// SUPERNODAL SYMMETRIC SOE & SOLVER
+	theSOE = (LinearSOE*)OPS_SupernodalSymLinSolver();
+
+    } else if (strcmp(type,"Krylov") == 0) {
+	// SPARSE ROW SOE & PRECONDITIONED KRYLOV SOLVER
+	theSOE = (LinearSOE*)OPS_SparseKrylovSolver();
+
     } else if (strcmp(type, "UmfPack") == 0 || strcmp(type, "Umfpack") == 0) {
 
 	theSOE = (LinearSOE*)OPS_UmfpackGenLinSolver();
@@ -1427,6 +1622,51 @@ int OPS_Integrator()
 
     const char* type = OPS_GetString();
 
+    // integrator -numThreads n: number of threads used to update and
+    // form the elements with the current and any later integrator
+    if (strcmp(type,"-numThreads") == 0) {
+	int numThreads = 1;
+	int numdata = 1;
+	if (OPS_GetIntInput(&numdata, &numThreads) < 0 || numThreads < 1) {
+	    opserr << "WARNING integrator -numThreads n - invalid n\n";
+	    return -1;
+	}
+	cmds->setNumThreads(numThreads);
+	return 0;
+    }
+
+    // integrator -constantTangents flag: assemble the tangents of the 
+    // elements whose tangent is constant (e.g. elastic beams with a linear
+    // transformation) only once, with the current and any later integrator
+    if (strcmp(type,"-constantTangents") == 0) {
+	int flag = 1;
+	int numdata = 1;
+	if (OPS_GetNumRemainingInputArgs() > 0) {
+	    if (OPS_GetIntInput(&numdata, &flag) < 0) {
+		opserr << "WARNING integrator -constantTangents <flag> - invalid flag\n";
+		return -1;
+	    }
+	}
+	cmds->setConstantTangents(flag != 0);
+	return 0;
+    }
+
+    // integrator -privateStorage flag: give each FE_Element and DOF_Group
+    // its own tangent and residual, so that with a number of threads all
+    // the FE_Elements are formed before they are assembled
+    if (strcmp(type,"-privateStorage") == 0) {
+	int flag = 1;
+	int numdata = 1;
+	if (OPS_GetNumRemainingInputArgs() > 0) {
+	    if (OPS_GetIntInput(&numdata, &flag) < 0) {
+		opserr << "WARNING integrator -privateStorage <flag> - invalid flag\n";
+		return -1;
+	    }
+	}
+	cmds->setPrivateStorage(flag != 0);
+	return 0;
+    }
+
     // create integrator
     StaticIntegrator* si = 0;
     TransientIntegrator* ti = 0;
@@ -1659,6 +1899,39 @@ int OPS_Analysis()
 	if (cmds->setPFEMAnalysis() < 0) {
 	    return -1;
 	}
+    } else if (strcmp(type, "Explicit") == 0 ||
+	       strcmp(type, "ExplicitDynamic") == 0) {
+	// analysis Explicit <-dtFactor f?> <-alphaM alphaM?> <-subcycle maxLevels?>
+	double dtFactor = 0.9;
+	double alphaM = 0.0;
+	int maxLevels = 0;
+	while (OPS_GetNumRemainingInputArgs() > 0) {
+	    const char* opt = OPS_GetString();
+	    int numdata = 1;
+	    if (strcmp(opt, "-dtFactor") == 0) {
+		if (OPS_GetDoubleInput(&numdata, &dtFactor) < 0 ||
+		    dtFactor <= 0.0 || dtFactor > 1.0) {
+		    opserr << "WARNING analysis Explicit - invalid dtFactor\n";
+		    return -1;
+		}
+	    } else if (strcmp(opt, "-alphaM") == 0) {
+		if (OPS_GetDoubleInput(&numdata, &alphaM) < 0 || alphaM < 0.0) {
+		    opserr << "WARNING analysis Explicit - invalid alphaM\n";
+		    return -1;
+		}
+	    } else if (strcmp(opt, "-subcycle") == 0) {
+		if (OPS_GetIntInput(&numdata, &maxLevels) < 0 || 
+		    maxLevels < 0 || maxLevels > 16) {
+		    opserr << "WARNING analysis Explicit - invalid number of subcycle levels\n";
+		    return -1;
+		}
+	    } else {
+		opserr << "WARNING analysis Explicit - unknown option " << opt << "\n";
+		return -1;
+	    }
+	}
+	cmds->setExplicitAnalysis(dtFactor, alphaM, maxLevels);
+
     } else if (strcmp(type, "VariableTimeStepTransient") == 0 ||
 	       (strcmp(type,"TransientWithVariableTimeStep") == 0) ||
 	       (strcmp(type,"VariableTransient") == 0)) {
@@ -1690,6 +1963,7 @@ int OPS_analyze()
     StaticAnalysis* theStaticAnalysis = cmds->getStaticAnalysis();
     TransientAnalysis* theTransientAnalysis = cmds->getTransientAnalysis();
     PFEMAnalysis* thePFEMAnalysis = cmds->getPFEMAnalysis();
+    ExplicitDynamicAnalysis* theExplicitAnalysis = cmds->getExplicitAnalysis();
 
     if (theStaticAnalysis != 0) {
 	if (OPS_GetNumRemainingInputArgs() < 1) {
@@ -1705,6 +1979,21 @@ int OPS_analyze()
 
 	result = thePFEMAnalysis->analyze();
 
+    } else if (theExplicitAnalysis != 0) {
+	if (OPS_GetNumRemainingInputArgs() < 2) {
+	    opserr << "WARNING insufficient args: analyze numIncr deltaT ...\n";
+	    return -1;
+	}
+	int numIncr;
+	int numdata = 1;
+	if (OPS_GetIntInput(&numdata, &numIncr) < 0) return -1;
+
+	double dt;
+	if (OPS_GetDoubleInput(&numdata, &dt) < 0) return -1;
+	ops_Dt = dt;
+
+	result = theExplicitAnalysis->analyze(numIncr, dt);
+
     } else if (theTransientAnalysis != 0) {
 	if (OPS_GetNumRemainingInputArgs() < 2) {
 	    opserr << "WARNING insufficient args: analyze numIncr deltaT ...\n";
@@ -1751,6 +2040,9 @@ int OPS_eigenAnalysis()
 
     int typeSolver = EigenSOE_TAGS_ArpackSOE;
     double shift = 0.0;
+    double shiftMax = 0.0;
+    int blockSize = 0;
+    int numThreads = 0;
     bool findSmallest = true;
 
     // Check type of eigenvalue analysis
@@ -1789,6 +2081,37 @@ int OPS_eigenAnalysis()
 		 (strcmp(type,"-fullGenLapackEigen") == 0))
 	    typeSolver = EigenSOE_TAGS_FullGenEigenSOE;
 
+	else if ((strcmp(type,"symmSparseLanczos") == 0) ||
+		 (strcmp(type,"-symmSparseLanczos") == 0))
+	    typeSolver = EigenSOE_TAGS_SymSparseEigenSOE;
+
+	// eigenvalues sought in [lambdaMin, lambdaMax], symmSparseLanczos only
+	else if (strcmp(type,"-window") == 0) {
+	    double data[2];
+	    int numdata = 2;
+	    if (OPS_GetNumRemainingInputArgs() < 3 ||
+		OPS_GetDoubleInput(&numdata, data) < 0) {
+		opserr << "WARNING eigen -window lambdaMin lambdaMax numModes? - can't read window\n";
+		return -1;
+	    }
+	    shift = data[0];
+	    shiftMax = data[1];
+	}
+
+	else if (strcmp(type,"-blockSize") == 0 || strcmp(type,"-numThreads") == 0) {
+	    int value;
+	    int numdata = 1;
+	    if (OPS_GetNumRemainingInputArgs() < 2 ||
+		OPS_GetIntInput(&numdata, &value) < 0) {
+		opserr << "WARNING eigen " << type << " n numModes? - can't read n\n";
+		return -1;
+	    }
+	    if (strcmp(type,"-blockSize") == 0)
+		blockSize = value;
+	    else
+		numThreads = value;
+	}
+
 	else {
 	    opserr << "eigen - unknown option specified " << type << endln;
 	}
@@ -1810,7 +2133,8 @@ int OPS_eigenAnalysis()
     cmds->setNumEigen(numEigen);
 
     // set eigen soe
-    if (cmds->eigen(typeSolver,shift,generalizedAlgo,findSmallest) < 0) {
+    if (cmds->eigen(typeSolver,shift,generalizedAlgo,findSmallest,
+		    shiftMax,blockSize,numThreads) < 0) {
 	opserr<<"WANRING failed to do eigen analysis\n";
 	return -1;
     }
@@ -2336,7 +2660,7 @@ int OPS_Database()
 {
     // make sure at least one other argument to contain integrator
     if (OPS_GetNumRemainingInputArgs() < 1) {
-	opserr << "WARNING need to specify a Database type; valid type File, MySQL, BerkeleyDB \n";
+	opserr << "WARNING need to specify a Database type; valid type File, Binary, MySQL, BerkeleyDB \n";
 	return -1;
     }
 
@@ -2358,8 +2682,21 @@ int OPS_Database()
 
 	return 0;
     }
+
+    // a single binary file, restorable by a later run
+    if (strcmp(type,"Binary") == 0) {
+	if (OPS_GetNumRemainingInputArgs() < 1) {
+	    opserr << "WARNING database Binary fileName? ";
+	    return -1;
+	}
+
+	const char* filename = OPS_GetString();
+	cmds->setBinaryFileDatabase(filename);
+
+	return 0;
+    }
     opserr << "WARNING No database type exists ";
-    opserr << "for database of type:" << type << "valid database type File\n";
+    opserr << "for database of type:" << type << "valid database types File, Binary\n";
 
     return -1;
 }
@@ -2678,6 +3015,34 @@ int OPS_accelCPU()
 
 int OPS_numFact()
 {
+    // numFact -solver: factorizations done by the linear solver, as
+    // {with a new symbolic analysis, reusing the last symbolic analysis}
+    if (OPS_GetNumRemainingInputArgs() > 0) {
+	const char* flag = OPS_GetString();
+	if (strcmp(flag,"-solver") != 0) {
+	    opserr << "WARNING numFact <-solver> - unknown option " << flag << "\n";
+	    return -1;
+	}
+
+	LinearSOE* theSOE = cmds->getSOE();
+	if (theSOE == 0 || theSOE->getSolver() == 0) {
+	    opserr << "WARNING no system is set\n";
+	    return -1;
+	}
+
+	LinearSOESolver* theSolver = theSOE->getSolver();
+	double values[2];
+	values[0] = theSolver->getNumFullFactorizations();
+	values[1] = theSolver->getNumNumericFactorizations();
+	int numdata = 2;
+	if (OPS_SetDoubleOutput(&numdata, values) < 0) {
+	    opserr << "WARNING failed to set output\n";
+	    return -1;
+	}
+
+	return 0;
+    }
+
     EquiSolnAlgo* theAlgorithm = cmds->getAlgorithm();
     if (theAlgorithm == 0) {
 	opserr << "WARNING no algorithm is set\n";
@@ -2712,6 +3077,26 @@ int OPS_numIter()
     return 0;
 }
 
+int OPS_explicitEnergy()
+{
+    // kinetic, internal, external, damping and the balance of them
+    ExplicitDynamicAnalysis* theAnalysis = cmds->getExplicitAnalysis();
+    if (theAnalysis == 0) {
+	opserr << "WARNING no explicit analysis is set\n";
+	return -1;
+    }
+
+    double data[5];
+    theAnalysis->getEnergy(data);
+    int numdata = 5;
+    if (OPS_SetDoubleOutput(&numdata, data) < 0) {
+	opserr << "WARNING failed to set output\n";
+	return -1;
+    }
+
+    return 0;
+}
+
 int OPS_systemSize()
 {
     LinearSOE* theSOE = cmds->getSOE();
@@ -41,6 +41,7 @@
 #include <FE_Datastore.h>
 #include <FEM_ObjectBrokerAllClasses.h>
 #include <PFEMAnalysis.h>
+#include <ExplicitDynamicAnalysis.h>
 #include <VariableTimeStepDirectIntegrationAnalysis.h>
 #ifdef _RELIABILITY
 #include <ReliabilityStaticAnalysis.h>
@@ -80,6 +81,15 @@ public:
     void setTransientIntegrator(TransientIntegrator* integrator);
     TransientIntegrator* getTransientIntegrator() {return theTransientIntegrator;}
     
+    void setNumThreads(int num);
+    int getNumThreads() const {return numThreads;}
+
+    void setConstantTangents(bool flag);
+    bool getConstantTangents() const {return constantTangents;}
+
+    void setPrivateStorage(bool flag);
+    bool getPrivateStorage() const {return privateStorage;}
+
     void setAlgorithm(EquiSolnAlgo* algo);
     EquiSolnAlgo* getAlgorithm() {return theAlgorithm;}
     
@@ -92,6 +102,9 @@ public:
     int setPFEMAnalysis();
     PFEMAnalysis* getPFEMAnalysis() {return thePFEMAnalysis;}
     
+    void setExplicitAnalysis(double dtFactor, double alphaM, int maxLevels = 0);
+    ExplicitDynamicAnalysis* getExplicitAnalysis() {return theExplicitAnalysis;}
+    
     void setVariableAnalysis();
     VariableTimeStepDirectIntegrationAnalysis*
     getVariableAnalysis() {return theVariableTimeStepTransientAnalysis;}
@@ -104,6 +117,7 @@ public:
     EigenSOE* getEigenSOE() {return theEigenSOE;}
     
     void setFileDatabase(const char* filename);
+    void setBinaryFileDatabase(const char* filename);
     FE_Datastore* getDatabase() {return theDatabase;}
 
     Timer* getTimer() {return &theTimer;}
@@ -117,7 +131,8 @@ public:
     void wipeAnalysis();
     void wipe();
     int eigen(int typeSolver, double shift,
-	      bool generalizedAlgo, bool findSmallest);
+	      bool generalizedAlgo, bool findSmallest,
+	      double shiftMax = 0.0, int blockSize = 0, int numThreads = 0);
     
 private:
     
@@ -135,11 +150,15 @@ private:
     StaticAnalysis* theStaticAnalysis;
     DirectIntegrationAnalysis* theTransientAnalysis;
     PFEMAnalysis* thePFEMAnalysis;
+    ExplicitDynamicAnalysis* theExplicitAnalysis;
     VariableTimeStepDirectIntegrationAnalysis* theVariableTimeStepTransientAnalysis;
     AnalysisModel* theAnalysisModel;
     ConvergenceTest *theTest;
 
     int numEigen;
+    int numThreads;
+    bool constantTangents;
+    bool privateStorage;
     FE_Datastore* theDatabase;
     FEM_ObjectBrokerAllClasses theBroker;
     Timer theTimer;
@@ -175,6 +194,7 @@ int OPS_NDMaterial();
 
 /* OpenSeesElementCommands.cpp */
 int OPS_Element();
+int OPS_Elements();
 int OPS_doBlock2D();
 int OPS_doBlock3D();
 
@@ -192,6 +212,7 @@ int OPS_groundMotion();
 /* OpenSeesSectionCommands.cpp */
 int OPS_Section();
 int OPS_Fiber();
+int OPS_Fibers();
 int OPS_Patch();
 int OPS_Layer();
 
@@ -219,6 +240,8 @@ int OPS_nodeUnbalance();
 int OPS_nodeVel();
 int OPS_nodeAccel();
 int OPS_nodeResponse();
+int OPS_nodeResponses();
+int OPS_eleResponses();
 int OPS_nodeCoord();
 int OPS_setNodeCoord();
 int OPS_updateElementDomain();
@@ -250,12 +273,15 @@ int OPS_rayleighDamping();
 int OPS_setTime();
 int OPS_removeObject();
 int OPS_addNodalMass();
+int OPS_Nodes();
 int OPS_buildModel();
 int OPS_setNodeVel();
 int OPS_setElementRayleighDampingFactors();
 int OPS_MeshRegion();
 int OPS_peerNGA();
 int OPS_domainChange();
+int OPS_profile();
+int OPS_updateMaterialStage();
 int OPS_stripOpenSeesXML();
 int OPS_convertBinaryToText();
 int OPS_convertTextToBinary();
@@ -297,7 +323,10 @@ int OPS_solveCPU();
 int OPS_accelCPU();
 int OPS_numFact();
 int OPS_numIter();
+int OPS_explicitEnergy();
 int OPS_systemSize();
+int OPS_SetIntInputPrefix(int numData, const int* data);
+int OPS_GetNumIntInputPrefix();
 
 void* OPS_KrylovNewton();
 void* OPS_RaphsonNewton();
@@ -331,6 +360,8 @@ void* OPS_PFEMSolver();
 void* OPS_PFEMCompressibleSolver();
 void* OPS_PFEMSolver_Umfpack();
 void* OPS_SymSparseLinSolver();
+void* OPS_SupernodalSymLinSolver();
+void* OPS_SparseKrylovSolver();
 void* OPS_FullGenLinLapackSolver();
 
 void* OPS_PlainNumberer();
@@ -422,6 +453,6 @@ void* OPS_BFGS();
 //              ysEvolutionModel, plasticMaterial, cyclicModel, damageModel,
 //              FirePattern, PySimple1Gen, TzSimple1Gen, Hfiber, frictionModel,
 //              stiffnessDegradation, unloadingRule, strengthDegradation,
-//              hystereticBackbone, updateMaterialStage, updateMaterials,
+//              hystereticBackbone, updateMaterials,
 //              loadPackage
 #endif
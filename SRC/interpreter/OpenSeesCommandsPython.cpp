@@ -714,7 +714,8 @@ static char eigen_docstring[] =
     "solver can be used instead of the default Arpack solver.\n\n"
     "numEigenvalues -- number of eigenvalues required\n"
     "solver -- optional string detailing type of solver: -genBandArpack,\n"
-    "          -symmBandLapack, -fullGenLapack (default: -genBandArpack)";
+    "          -symmBandLapack, -fullGenLapack, -symmSparseLanczos\n"
+    "          (default: -genBandArpack)";
 
 static char eleLoad_docstring[] =
     "* eleLoad(['-ele',eleTag1,eleTag2,...][,'-type',...][,'-range',eleTag1,eleTag2]) -> patternTag\n\n"
@@ -40,6 +40,9 @@
 #include <BbarBrick.h>
 #include <ShellMITC4.h>
 
+int OPS_SetIntInputPrefix(int numData, const int* data);
+int OPS_GetNumIntInputPrefix();
+
 // no 'beamWithHinges', 'GenericClient', 'GenericCopy', 'flBrick', 'Adapter'
 
 void* OPS_ZeroLengthND();
@@ -514,6 +517,112 @@ OPS_Element()
 
 }
 
+int
+OPS_Elements()
+{
+    static bool initDone = false;
+    if (initDone == false) {
+	setUpFunctions();
+	initDone = true;
+    }
+
+    // elements type? numEle? numEleNodes? tags? nodes? <eleArgs?>
+    if (OPS_GetNumRemainingInputArgs() < 5) {
+	opserr<<"WARNING too few arguments: elements type? numEle? numEleNodes? tags? nodes? <eleArgs?>\n";
+	return -1;
+    }
+
+    const char* type = OPS_GetString();
+    
+    OPS_ParsingFunctionMap::const_iterator iter = functionMap.find(type);
+    if (iter == functionMap.end()) {
+	opserr<<"WARNING element type " << type << " is unknown\n";
+	return -1;
+    }
+    bool truss = strcmp(type, "truss")==0 || strcmp(type, "Truss")==0;
+
+    int idata[2];
+    int numdata = 2;
+    if (OPS_GetIntInput(&numdata, idata) < 0 || idata[0] < 0 || idata[1] < 1) {
+	opserr << "WARNING elements - invalid numEle? numEleNodes?\n";
+	return -1;
+    }
+    int numEle = idata[0];
+    int numEleNodes = idata[1];
+    if (numEle == 0) {
+	return 0;
+    }
+
+    ID tags(numEle);
+    numdata = numEle;
+    if (OPS_GetIntInput(&numdata, &tags(0)) < 0) {
+	opserr << "WARNING elements - want " << numEle << " element tags\n";
+	return -1;
+    }
+    ID nodes(numEle*numEleNodes);
+    numdata = numEle*numEleNodes;
+    if (OPS_GetIntInput(&numdata, &nodes(0)) < 0) {
+	opserr << "WARNING elements - want " << numEle*numEleNodes << " element nodes\n";
+	return -1;
+    }
+
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return -1;
+
+    theDomain->reserve(0, numEle);
+
+    // each element is parsed as if given by the element command, its tag 
+    // and nodes being handed to the parser ahead of the shared arguments
+    ID prefix(1+numEleNodes);
+    int numArgs = OPS_GetNumRemainingInputArgs();
+    for (int i=0; i<numEle; i++) {
+	prefix(0) = tags(i);
+	for (int j=0; j<numEleNodes; j++) {
+	    prefix(1+j) = nodes(i*numEleNodes+j);
+	}
+
+	OPS_SetIntInputPrefix(1+numEleNodes, &prefix(0));
+	Element* theEle = (Element*) (*iter->second)();
+	if (theEle == 0 && truss) {
+	    // for backward comatability
+	    OPS_SetIntInputPrefix(0, 0);
+	    int numRead = numArgs - OPS_GetNumRemainingInputArgs();
+	    if (numRead > 0) {
+		OPS_ResetCurrentInputArg(-numRead);
+	    }
+	    OPS_SetIntInputPrefix(1+numEleNodes, &prefix(0));
+	    theEle = (Element*) OPS_TrussSectionElement();
+	}
+
+	int numUnread = OPS_GetNumIntInputPrefix();
+	OPS_SetIntInputPrefix(0, 0);
+	if (theEle == 0) {
+	    opserr << "WARNING elements - failed to create element " << tags(i) << "\n";
+	    return -1;
+	}
+	if (numUnread != 0) {
+	    opserr << "WARNING elements - element " << tags(i) << " does not have ";
+	    opserr << numEleNodes << " nodes\n";
+	    delete theEle;
+	    return -1;
+	}
+
+	if (theDomain->addElement(theEle) == false) {
+	    opserr<<"ERROR could not add element " << tags(i) << " to domain.\n";
+	    delete theEle;
+	    return -1;
+	}
+
+	// rewind the shared arguments for the next element
+	int numRead = numArgs - OPS_GetNumRemainingInputArgs();
+	if (numRead > 0 && i < numEle-1) {
+	    OPS_ResetCurrentInputArg(-numRead);
+	}
+    }
+
+    return 0;
+}
+
 int OPS_doBlock2D()
 {
     int ndm = OPS_GetNDM();
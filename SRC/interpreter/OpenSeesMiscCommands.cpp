@@ -36,9 +36,12 @@
 #include <Matrix.h>
 #include <MeshRegion.h>
 #include <StringContainer.h>
+#include <Profiler.h>
+#include <FileStream.h>
 #include <fstream>
 #include <string>
 #include <InitialStateParameter.h>
+#include <MaterialStageParameter.h>
 #include <RigidRod.h>
 #include <RigidBeam.h>
 #include <RigidDiaphragm.h>
@@ -396,6 +399,105 @@ int OPS_addNodalMass()
 
 }
 
+int OPS_Nodes()
+{
+    // nodes numNodes? tags? crds? <-ndf ndf?> <-mass masses?>
+    if (OPS_GetNumRemainingInputArgs() < 3) {
+	opserr << "WARNING want - nodes numNodes? tags? crds? <-ndf ndf?> <-mass masses?>\n";
+	return -1;
+    }
+
+    int numNodes;
+    int numdata = 1;
+    if (OPS_GetIntInput(&numdata, &numNodes) < 0 || numNodes < 0) {
+	opserr << "WARNING invalid numNodes\n";
+	return -1;
+    }
+    if (numNodes == 0) {
+	return 0;
+    }
+
+    int ndm = OPS_GetNDM();
+    int ndf = OPS_GetNDF();
+    if (ndm < 1 || ndm > 3) {
+	opserr << "WARNING nodes - invalid ndm " << ndm << "\n";
+	return -1;
+    }
+
+    // the tags and then the coordinates, node by node
+    ID tags(numNodes);
+    numdata = numNodes;
+    if (OPS_GetIntInput(&numdata, &tags(0)) < 0) {
+	opserr << "WARNING nodes - want " << numNodes << " node tags\n";
+	return -1;
+    }
+    Vector crds(numNodes*ndm);
+    numdata = numNodes*ndm;
+    if (OPS_GetDoubleInput(&numdata, &crds(0)) < 0) {
+	opserr << "WARNING nodes - want " << numNodes*ndm << " coordinates\n";
+	return -1;
+    }
+
+    Vector masses;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char* opt = OPS_GetString();
+	if (strcmp(opt, "-ndf") == 0) {
+	    numdata = 1;
+	    if (OPS_GetIntInput(&numdata, &ndf) < 0 || ndf < 1) {
+		opserr << "WARNING nodes - invalid ndf\n";
+		return -1;
+	    }
+	} else if (strcmp(opt, "-mass") == 0) {
+	    masses.resize(numNodes*ndf);
+	    numdata = numNodes*ndf;
+	    if (OPS_GetDoubleInput(&numdata, &masses(0)) < 0) {
+		opserr << "WARNING nodes - want " << numNodes*ndf << " mass values\n";
+		return -1;
+	    }
+	} else {
+	    opserr << "WARNING nodes - unknown option " << opt << "\n";
+	    return -1;
+	}
+    }
+    if (masses.Size() != 0 && masses.Size() != numNodes*ndf) {
+	opserr << "WARNING nodes - -ndf must come before -mass\n";
+	return -1;
+    }
+
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return -1;
+
+    theDomain->reserve(numNodes, 0);
+
+    Matrix mass(ndf, ndf);
+    for (int i=0; i<numNodes; i++) {
+	Node* theNode = 0;
+	const double* x = &crds(i*ndm);
+	if (ndm == 1) {
+	    theNode = new Node(tags(i), ndf, x[0]);
+	} else if (ndm == 2) {
+	    theNode = new Node(tags(i), ndf, x[0], x[1]);
+	} else {
+	    theNode = new Node(tags(i), ndf, x[0], x[1], x[2]);
+	}
+
+	if (masses.Size() != 0) {
+	    for (int j=0; j<ndf; j++) {
+		mass(j,j) = masses(i*ndf+j);
+	    }
+	    theNode->setMass(mass);
+	}
+
+	if (theDomain->addNode(theNode) == false) {
+	    opserr << "WARNING nodes - failed to add node " << tags(i) << "\n";
+	    delete theNode;
+	    return -1;
+	}
+    }
+
+    return 0;
+}
+
 int OPS_buildModel()
 {
     return 0;
@@ -906,6 +1008,105 @@ int OPS_domainChange()
     return 0;
 }
 
+int OPS_profile()
+{
+    // profile start <-trace>, profile stop, profile reset,
+    // profile report <fileName>, profile trace fileName
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+	opserr << "WARNING want - profile start <-trace> | stop | reset | report <fileName> | trace fileName\n";
+	return -1;
+    }
+
+    const char *action = OPS_GetString();
+
+    if (strcmp(action, "start") == 0) {
+	bool trace = false;
+	if (OPS_GetNumRemainingInputArgs() > 0) {
+	    const char *opt = OPS_GetString();
+	    if (strcmp(opt, "-trace") == 0)
+		trace = true;
+	    else {
+		opserr << "WARNING profile start - unknown option " << opt << "\n";
+		return -1;
+	    }
+	}
+	Profiler::start(trace);
+
+    } else if (strcmp(action, "stop") == 0) {
+	Profiler::stop();
+
+    } else if (strcmp(action, "reset") == 0) {
+	Profiler::reset();
+
+    } else if (strcmp(action, "report") == 0) {
+	if (OPS_GetNumRemainingInputArgs() > 0) {
+	    const char *fileName = OPS_GetString();
+	    FileStream theFile(fileName);
+	    if (Profiler::report(theFile) < 0)
+		return -1;
+	} else {
+	    if (Profiler::report(opserr) < 0)
+		return -1;
+	}
+
+    } else if (strcmp(action, "trace") == 0) {
+	if (OPS_GetNumRemainingInputArgs() < 1) {
+	    opserr << "WARNING want - profile trace fileName\n";
+	    return -1;
+	}
+	const char *fileName = OPS_GetString();
+	if (Profiler::writeTrace(fileName) < 0)
+	    return -1;
+
+    } else {
+	opserr << "WARNING profile - unknown action " << action << "\n";
+	return -1;
+    }
+
+    return 0;
+}
+
+int OPS_updateMaterialStage()
+{
+    // updateMaterialStage -material matTag? -stage stage?
+    if (OPS_GetNumRemainingInputArgs() < 4) {
+	opserr << "WARNING want - updateMaterialStage -material matTag? -stage stage?\n";
+	return -1;
+    }
+
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return -1;
+
+    int matTag = 0;
+    int stage = 0;
+    int numdata = 1;
+    while (OPS_GetNumRemainingInputArgs() > 1) {
+	const char *opt = OPS_GetString();
+	if (strcmp(opt, "-material") == 0) {
+	    if (OPS_GetIntInput(&numdata, &matTag) < 0) {
+		opserr << "WARNING updateMaterialStage - invalid matTag\n";
+		return -1;
+	    }
+	} else if (strcmp(opt, "-stage") == 0) {
+	    if (OPS_GetIntInput(&numdata, &stage) < 0) {
+		opserr << "WARNING updateMaterialStage - invalid stage\n";
+		return -1;
+	    }
+	} else {
+	    opserr << "WARNING updateMaterialStage - unknown option " << opt << "\n";
+	    return -1;
+	}
+    }
+
+    // a parameter with tag 0 is not kept by the domain, adding it
+    // only finds the material in the elements
+    MaterialStageParameter theParameter(0, matTag);
+    theDomain->addParameter(&theParameter);
+    theParameter.update(stage);
+
+    return 0;
+}
+
 int OPS_stripOpenSeesXML()
 {
     if (OPS_GetNumRemainingInputArgs() < 2) {
@@ -40,6 +40,18 @@
 #include <ParameterIter.h>
 #include <DummyStream.h>
 #include <Response.h>
+#include <NodeRecorder.h>
+#include <ElementRecorder.h>
+#include <StandardStream.h>
+#include <DataFileStream.h>
+#include <XmlFileStream.h>
+#include <BinaryFileStream.h>
+#include <ChunkedBinaryFileStream.h>
+#include <AsyncStream.h>
+#include <string>
+#include <string.h>
+
+void* OPS_PVDRecorder();
 
 int OPS_nodeDisp()
 {
@@ -907,25 +919,202 @@ int OPS_printModelGID()
 }
 
 
+// reads the tags following an option such as -node or -dof, stopping at
+// the first argument that is not an int
+static void OPS_GetRecorderTags(ID& tags)
+{
+    int numdata = 1;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	int tag;
+	if (OPS_GetIntInput(&numdata, &tag) < 0) {
+	    OPS_ResetCurrentInputArg(-1);
+	    break;
+	}
+	tags[tags.Size()] = tag;
+    }
+}
+
+// recorder Node|Element <-file $f|-xml $f|-binary $f|-chunked $f 
+//   <-chunkRows $n> <-compress>> <-time> <-dT $dT> <-async <$numWriters>>
+//   <-node|-ele $tags..> <-nodeRange|-eleRange $t1 $t2> <-dof $dofs..> 
+//   $response..
+static Recorder* OPS_NodeElementRecorder(bool isNode, Domain& theDomain)
+{
+    const char* fileName = 0;
+    int streamType = 0;	// 0 stdout, 1 data, 2 xml, 3 binary, 4 chunked
+    int chunkRows = 1024;
+    bool compress = false;
+    bool echoTime = false;
+    double dT = 0.0;
+    bool async = false;
+    int numWriters = -1;
+    ID tags(0, 32);
+    ID dofs(0, 6);
+    bool haveTags = false;
+    bool haveDofs = false;
+    int numdata = 1;
+
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char* opt = OPS_GetString();
+	if (opt == 0) {
+	    opserr << "WARNING recorder - invalid option\n";
+	    return 0;
+	}
+
+	if (strcmp(opt,"-file") == 0 || strcmp(opt,"-xml") == 0 ||
+	    strcmp(opt,"-binary") == 0 || strcmp(opt,"-chunked") == 0) {
+	    if (OPS_GetNumRemainingInputArgs() < 1) {
+		opserr << "WARNING recorder " << opt << " needs a file name\n";
+		return 0;
+	    }
+	    fileName = OPS_GetString();
+	    if (strcmp(opt,"-file") == 0) streamType = 1;
+	    else if (strcmp(opt,"-xml") == 0) streamType = 2;
+	    else if (strcmp(opt,"-binary") == 0) streamType = 3;
+	    else streamType = 4;
+	} else if (strcmp(opt,"-chunkRows") == 0) {
+	    if (OPS_GetIntInput(&numdata, &chunkRows) < 0) {
+		opserr << "WARNING recorder -chunkRows needs an int\n";
+		return 0;
+	    }
+	} else if (strcmp(opt,"-compress") == 0) {
+	    compress = true;
+	} else if (strcmp(opt,"-time") == 0) {
+	    echoTime = true;
+	} else if (strcmp(opt,"-dT") == 0) {
+	    if (OPS_GetDoubleInput(&numdata, &dT) < 0) {
+		opserr << "WARNING recorder -dT needs a double\n";
+		return 0;
+	    }
+	} else if (strcmp(opt,"-async") == 0) {
+	    async = true;
+	    if (OPS_GetNumRemainingInputArgs() > 0) {
+		if (OPS_GetIntInput(&numdata, &numWriters) < 0) {
+		    OPS_ResetCurrentInputArg(-1);
+		    numWriters = -1;
+		}
+	    }
+	} else if (strcmp(opt,"-node") == 0 || strcmp(opt,"-ele") == 0) {
+	    OPS_GetRecorderTags(tags);
+	    haveTags = true;
+	} else if (strcmp(opt,"-nodeRange") == 0 || strcmp(opt,"-eleRange") == 0) {
+	    int range[2];
+	    numdata = 2;
+	    if (OPS_GetIntInput(&numdata, range) < 0) {
+		opserr << "WARNING recorder " << opt << " needs start and end tags\n";
+		return 0;
+	    }
+	    numdata = 1;
+	    for (int tag = range[0]; tag <= range[1]; tag++)
+		tags[tags.Size()] = tag;
+	    haveTags = true;
+	} else if (strcmp(opt,"-dof") == 0) {
+	    OPS_GetRecorderTags(dofs);
+	    for (int i = 0; i < dofs.Size(); i++)
+		dofs(i) -= 1;
+	    haveDofs = true;
+	} else {
+	    // start of the response
+	    OPS_ResetCurrentInputArg(-1);
+	    break;
+	}
+    }
+
+    // the response, copied as the Python strings do not outlive the command
+    std::vector<std::string> response;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char* arg = OPS_GetString();
+	if (arg == 0) {
+	    opserr << "WARNING recorder - invalid response argument\n";
+	    return 0;
+	}
+	response.push_back(arg);
+    }
+    if (response.empty()) {
+	opserr << "WARNING recorder - no response given\n";
+	return 0;
+    }
+    if (isNode && haveDofs == false) {
+	opserr << "WARNING recorder Node - no -dof given\n";
+	return 0;
+    }
+
+    OPS_Stream* theOutput = 0;
+    switch (streamType) {
+    case 1:
+	theOutput = new DataFileStream(fileName);
+	break;
+    case 2:
+	theOutput = new XmlFileStream(fileName);
+	break;
+    case 3:
+	theOutput = new BinaryFileStream(fileName);
+	break;
+    case 4:
+	theOutput = new ChunkedBinaryFileStream(fileName, chunkRows, compress);
+	break;
+    default:
+	theOutput = new StandardStream();
+    }
+
+    // rows are copied on record() and written by the writer threads
+    if (async) {
+	if (numWriters >= 0 && numWriters != AsyncStream::getNumThreads())
+	    AsyncStream::setNumThreads(numWriters);
+	theOutput = new AsyncStream(theOutput);
+    }
+
+    Recorder* theRecorder = 0;
+    if (isNode) {
+	theRecorder = new NodeRecorder(dofs, haveTags ? &tags : 0, 0, 
+				       response[0].c_str(), theDomain, *theOutput,
+				       dT, echoTime);
+    } else {
+	std::vector<const char*> argv(response.size());
+	for (int i = 0; i < (int)response.size(); i++)
+	    argv[i] = response[i].c_str();
+	theRecorder = new ElementRecorder(haveTags ? &tags : 0, &argv[0], 
+					  (int)argv.size(), echoTime, theDomain, 
+					  *theOutput, dT, haveDofs ? &dofs : 0);
+    }
+
+    return theRecorder;
+}
+
 int OPS_Recorder()
 {
     if (OPS_GetNumRemainingInputArgs() < 2) {
-	opserr<<"WARNING too few arguments: recorder type? tag? ...\n";
+	opserr<<"WARNING too few arguments: recorder type? ...\n";
 	return -1;
     }
 
-    // const char* type = OPS_GetString();
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return -1;
+
+    const char* type = OPS_GetString();
+    if (type == 0) {
+	opserr << "WARNING invalid recorder type\n";
+	return -1;
+    }
 
     Recorder* theRecorder = 0;
+    if (strcmp(type,"Node") == 0) {
+	theRecorder = OPS_NodeElementRecorder(true, *theDomain);
+    } else if (strcmp(type,"Element") == 0) {
+	theRecorder = OPS_NodeElementRecorder(false, *theDomain);
+    } else if (strcmp(type,"PVD") == 0 || strcmp(type,"pvd") == 0) {
+	theRecorder = (Recorder*) OPS_PVDRecorder();
+    } else {
+	opserr << "WARNING unknown recorder type " << type << "\n";
+	return -1;
+    }
+
     if (theRecorder == 0) {
 	opserr << "WARNING failed to create recorder\n";
 	return -1;
     }
 
     // Now add the element to the domain
-    Domain* theDomain = OPS_GetDomain();
-    if (theDomain == 0) return -1;
-
     if (theDomain->addRecorder(*theRecorder) < 0) {
 	opserr<<"ERROR could not add to domain - recorder.\n";
 	delete theRecorder;
@@ -1341,6 +1530,254 @@ int OPS_nodeResponse()
     return 0;
 }
 
+// nodeResponses $type <-dof $dof> <-node $tags..>
+//   one row per node, in the order of getNodeTags when no tags are
+//   given, with one column per dof; nodes with fewer dofs are padded
+//   with zeros
+int OPS_nodeResponses()
+{
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+	opserr << "WARNING want - nodeResponses type? <-dof dof?> <-node tags?..>\n";
+	return -1;
+    }
+
+    const char* type = OPS_GetString();
+    NodeResponseType responseType;
+    if (strcmp(type,"disp") == 0) {
+	responseType = Disp;
+    } else if (strcmp(type,"vel") == 0) {
+	responseType = Vel;
+    } else if (strcmp(type,"accel") == 0) {
+	responseType = Accel;
+    } else if (strcmp(type,"incrDisp") == 0) {
+	responseType = IncrDisp;
+    } else if (strcmp(type,"incrDeltaDisp") == 0) {
+	responseType = IncrDeltaDisp;
+    } else if (strcmp(type,"reaction") == 0) {
+	responseType = Reaction;
+    } else if (strcmp(type,"unbalance") == 0) {
+	responseType = Unbalance;
+    } else if (strcmp(type,"rayleighForces") == 0) {
+	responseType = RayleighForces;
+    } else {
+	opserr << "WARNING nodeResponses - unknown response type " << type << "\n";
+	return -1;
+    }
+
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return -1;
+
+    int dof = -1;
+    ID tags(0, 64);
+    bool haveTags = false;
+    int numdata = 1;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char* opt = OPS_GetString();
+	if (strcmp(opt,"-dof") == 0) {
+	    if (OPS_GetIntInput(&numdata, &dof) < 0) {
+		opserr << "WARNING nodeResponses - invalid dof\n";
+		return -1;
+	    }
+	    dof--;
+	    if (dof < 0) {
+		opserr << "WARNING nodeResponses - invalid dof\n";
+		return -1;
+	    }
+	} else if (strcmp(opt,"-node") == 0) {
+	    OPS_GetRecorderTags(tags);
+	    haveTags = true;
+	} else {
+	    opserr << "WARNING nodeResponses - unknown option " << opt << "\n";
+	    return -1;
+	}
+    }
+
+    // number of rows and columns
+    int numRows = 0;
+    int numCols = 0;
+    Node* theNode;
+    if (haveTags) {
+	numRows = tags.Size();
+	for (int i = 0; i < numRows; i++) {
+	    theNode = theDomain->getNode(tags(i));
+	    if (theNode == 0) {
+		opserr << "WARNING nodeResponses - node " << tags(i) << " not found\n";
+		return -1;
+	    }
+	    if (theNode->getNumberDOF() > numCols)
+		numCols = theNode->getNumberDOF();
+	}
+    } else {
+	NodeIter& theNodes = theDomain->getNodes();
+	while ((theNode = theNodes()) != 0) {
+	    if (theNode->getNumberDOF() > numCols)
+		numCols = theNode->getNumberDOF();
+	    numRows++;
+	}
+    }
+    if (dof >= 0) {
+	if (dof >= numCols) {
+	    opserr << "WARNING nodeResponses - dof " << dof+1 << " too large\n";
+	    return -1;
+	}
+	numCols = 1;
+    }
+
+    double* data = OPS_GetDoubleOutputArray(numRows, numCols);
+    if (data == 0) {
+	opserr << "WARNING nodeResponses - failed to get output array\n";
+	return -1;
+    }
+
+    // copy the responses straight into the output array
+    NodeIter& theNodes = theDomain->getNodes();
+    for (int i = 0; i < numRows; i++) {
+	if (haveTags)
+	    theNode = theDomain->getNode(tags(i));
+	else
+	    theNode = theNodes();
+
+	const Vector* theResponse = theNode->getResponse(responseType);
+	int size = 0;
+	if (theResponse != 0)
+	    size = theResponse->Size();
+
+	double* row = data + i*numCols;
+	if (dof >= 0) {
+	    row[0] = (dof < size) ? (*theResponse)(dof) : 0.0;
+	} else {
+	    for (int j = 0; j < size; j++)
+		row[j] = (*theResponse)(j);
+	    for (int j = size; j < numCols; j++)
+		row[j] = 0.0;
+	}
+    }
+
+    if (OPS_SetDoubleOutputArray() < 0) {
+	opserr << "WARNING nodeResponses - failed to set output\n";
+	return -1;
+    }
+
+    return 0;
+}
+
+// eleResponses <-ele $tags..> $args..
+//   one row per element, in the order of getEleTags when no tags are
+//   given, holding the response of eleResponse; shorter responses, and
+//   elements without the response, are padded with zeros
+int OPS_eleResponses()
+{
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return -1;
+
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+	opserr << "WARNING want - eleResponses <-ele tags?..> eleArgs...\n";
+	return -1;
+    }
+
+    ID tags(0, 64);
+    bool haveTags = false;
+    const char* opt = OPS_GetString();
+    if (strcmp(opt,"-ele") == 0) {
+	OPS_GetRecorderTags(tags);
+	haveTags = true;
+    } else {
+	OPS_ResetCurrentInputArg(-1);
+    }
+
+    int argc = OPS_GetNumRemainingInputArgs();
+    if (argc < 1) {
+	opserr << "WARNING eleResponses - no response given\n";
+	return -1;
+    }
+    const char** argv = new const char*[argc];
+    for (int i = 0; i < argc; i++)
+	argv[i] = OPS_GetString();
+
+    // the element forces are read directly, anything else goes
+    // through the element's Response objects, kept for the copy below
+    bool forces = (argc == 1 && strcmp(argv[0],"forces") == 0);
+    static std::vector<Element*> theElements;
+    static std::vector<Response*> theResponses;
+    theElements.clear();
+    theResponses.clear();
+
+    Element* theEle;
+    if (haveTags) {
+	for (int i = 0; i < tags.Size(); i++) {
+	    theEle = theDomain->getElement(tags(i));
+	    if (theEle == 0) {
+		opserr << "WARNING eleResponses - element " << tags(i) << " not found\n";
+		delete [] argv;
+		return -1;
+	    }
+	    theElements.push_back(theEle);
+	}
+    } else {
+	ElementIter& theEles = theDomain->getElements();
+	while ((theEle = theEles()) != 0)
+	    theElements.push_back(theEle);
+    }
+
+    int numRows = (int)theElements.size();
+    int numCols = 0;
+    DummyStream dummy;
+    for (int i = 0; i < numRows; i++) {
+	int size = 0;
+	if (forces) {
+	    size = theElements[i]->getNumDOF();
+	} else {
+	    Response* theResponse = theElements[i]->setResponse(argv, argc, dummy);
+	    if (theResponse != 0 && theResponse->getResponse() < 0) {
+		delete theResponse;
+		theResponse = 0;
+	    }
+	    if (theResponse != 0)
+		size = theResponse->getInformation().getData().Size();
+	    theResponses.push_back(theResponse);
+	}
+	if (size > numCols)
+	    numCols = size;
+    }
+    delete [] argv;
+
+    double* data = OPS_GetDoubleOutputArray(numRows, numCols);
+    int res = 0;
+    if (data == 0) {
+	opserr << "WARNING eleResponses - failed to get output array\n";
+	res = -1;
+    }
+
+    for (int i = 0; i < numRows; i++) {
+	const Vector* theData = 0;
+	if (forces)
+	    theData = &(theElements[i]->getResistingForce());
+	else if (theResponses[i] != 0)
+	    theData = &(theResponses[i]->getInformation().getData());
+
+	if (data != 0) {
+	    int size = (theData != 0) ? theData->Size() : 0;
+	    if (size > numCols)
+		size = numCols;
+	    double* row = data + i*numCols;
+	    for (int j = 0; j < size; j++)
+		row[j] = (*theData)(j);
+	    for (int j = size; j < numCols; j++)
+		row[j] = 0.0;
+	}
+
+	if (!forces && theResponses[i] != 0)
+	    delete theResponses[i];
+    }
+
+    if (res == 0 && OPS_SetDoubleOutputArray() < 0) {
+	opserr << "WARNING eleResponses - failed to set output\n";
+	res = -1;
+    }
+
+    return res;
+}
+
 int OPS_nodeCoord()
 {
     // make sure at least one other argument to contain type of system
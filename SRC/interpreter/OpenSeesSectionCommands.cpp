@@ -797,6 +797,94 @@ int OPS_Fiber()
     return 0;
 }
 
+int OPS_Fibers()
+{
+    // fibers numFibers? yLocs? zLocs? areas? matTags?
+    if (OPS_GetNumRemainingInputArgs() < 5) {
+	opserr<<"WARNING insufficient args: fibers numFibers? yLocs? zLocs? areas? matTags?\n";
+	return -1;
+    }
+
+    int numFibers;
+    int numdata = 1;
+    if (OPS_GetIntInput(&numdata, &numFibers) < 0 || numFibers < 0) {
+	opserr << "WARNING invalid numFibers\n";
+	return -1;
+    }
+
+    Vector data(3*numFibers+1);
+    ID matTags(numFibers+1);
+    numdata = 3*numFibers;
+    if (numFibers > 0 && OPS_GetDoubleInput(&numdata, &data(0)) < 0) {
+	opserr << "WARNING fibers - want " << numFibers << " yLocs, zLocs and areas\n";
+	return -1;
+    }
+    numdata = numFibers;
+    if (numFibers > 0 && OPS_GetIntInput(&numdata, &matTags(0)) < 0) {
+	opserr << "WARNING fibers - want " << numFibers << " matTags\n";
+	return -1;
+    }
+    const double* yLocs = &data(0);
+    const double* zLocs = yLocs + numFibers;
+    const double* areas = zLocs + numFibers;
+
+    if (theActiveFiberSection2d == 0 && theActiveFiberSection3d == 0 &&
+	theActiveNDFiberSection2d == 0 && theActiveNDFiberSection3d == 0) {
+	opserr << "WARNING fibers - no active fiber section\n";
+	return -1;
+    }
+
+    // the fibers are only used to pass the data to the section, which
+    // keeps its own copies of the materials
+    UniaxialMaterial *material = 0;
+    NDMaterial *ndmaterial = 0;
+    int matTag = 0;
+    for (int j=0; j<numFibers; j++) {
+	int res = 0;
+	if (theActiveFiberSection2d != 0 || theActiveFiberSection3d != 0) {
+	    if (material == 0 || matTags(j) != matTag) {
+		matTag = matTags(j);
+		material = OPS_getUniaxialMaterial(matTag);
+		if (material == 0) {
+		    opserr << "WARNING material "<<matTag<<" cannot be found\n";
+		    return -1;
+		}
+	    }
+	    if (theActiveFiberSection2d != 0) {
+		UniaxialFiber2d theFiber(j,*material,areas[j],yLocs[j]);
+		res = theActiveFiberSection2d->addFiber(theFiber);
+	    } else {
+		UniaxialFiber3d theFiber(j,*material,areas[j],yLocs[j],zLocs[j]);
+		res = theActiveFiberSection3d->addFiber(theFiber);
+	    }
+
+	} else {
+	    if (ndmaterial == 0 || matTags(j) != matTag) {
+		matTag = matTags(j);
+		ndmaterial = OPS_getNDMaterial(matTag);
+		if (ndmaterial == 0) {
+		    opserr << "WARNING material "<<matTag<<" cannot be found\n";
+		    return -1;
+		}
+	    }
+	    if (theActiveNDFiberSection2d != 0) {
+		NDFiber2d theFiber(j,*ndmaterial,areas[j],yLocs[j]);
+		res = theActiveNDFiberSection2d->addFiber(theFiber);
+	    } else {
+		NDFiber3d theFiber(j,*ndmaterial,areas[j],yLocs[j],zLocs[j]);
+		res = theActiveNDFiberSection3d->addFiber(theFiber);
+	    }
+	}
+
+	if (res < 0) {
+	    opserr << "WARNING failed to add fiber to section\n";
+	    return -1;
+	}
+    }
+
+    return 0;
+}
+
 int OPS_Patch()
 {
     // num args
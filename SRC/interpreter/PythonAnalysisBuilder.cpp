@@ -74,6 +74,8 @@
 #include <FullGenEigenSolver.h>
 #include <FullGenEigenSOE.h>
 #include <ArpackSOE.h>
+#include <SymSparseEigenSOE.h>
+#include <SymSparseEigenSolver.h>
 #include <iostream>
 #include <ProfileSPDLinSOE.h>
 
@@ -418,6 +420,11 @@ void PythonAnalysisBuilder::newEigenAnalysis(int typeSolver, double shift)
 	    FullGenEigenSolver *theEigenSolver = new FullGenEigenSolver();
 	    theEigenSOE = new FullGenEigenSOE(*theEigenSolver, *theAnalysisModel);
 
+	} else if(typeSolver == EigenSOE_TAGS_SymSparseEigenSOE) {
+
+	    SymSparseEigenSolver *theEigenSolver = new SymSparseEigenSolver();
+	    theEigenSOE = new SymSparseEigenSOE(*theEigenSolver, *theAnalysisModel);
+
 	} else {
 	    theEigenSOE = new ArpackSOE(shift);    
 	}
@@ -1140,6 +1147,8 @@ PyObject *ops_eigenAnalysis(PyObject *self, PyObject *args)
 	} else if(type=="fullGenLapack"||type=="-fullGenLapack"||
 		  type=="fullGenLapackEigen"||type=="-fullGenLapackEigen") {
 	    typeSolver = EigenSOE_TAGS_FullGenEigenSOE;
+	} else if(type=="symmSparseLanczos"||type=="-symmSparseLanczos") {
+	    typeSolver = EigenSOE_TAGS_SymSparseEigenSOE;
 	} else {
 	    PyErr_SetString(PyExc_RuntimeError,"eigen - unknown option specified");
 	    return NULL;
@@ -775,17 +775,25 @@ PythonInterpreter::getNumRemainingInputArgs(void) {
 
 int 
 PythonInterpreter::getInt(int *data, int numArgs) {
-    if ((wrapper.getNumberArgs() - wrapper.getCurrentArg()) < numArgs) {
-	return -1;
-    }
-
-    for (int i=0; i<numArgs; i++) {
+    int start = wrapper.getCurrentArg();
+    int i = 0;
+    while (i < numArgs) {
+	if (wrapper.getCurrentArg() >= wrapper.getNumberArgs()) {
+	    wrapper.resetCommandLine(start+1);
+	    return -1;
+	}
 	PyObject *o = PyTuple_GetItem(wrapper.getCurrentArgv(),wrapper.getCurrentArg());
 	wrapper.incrCurrentArg();
-	if (!PyInt_Check(o)) {
-	    return -1;
+	if (PyInt_Check(o)) {
+	    data[i++] = PyInt_AS_LONG(o);
+	} else {
+	    // a list or array argument gives several values at once
+	    int num = wrapper.getIntSequence(o, &data[i], numArgs-i);
+	    if (num < 1) {
+		return -1;
+	    }
+	    i += num;
 	}
-	data[i] = PyInt_AS_LONG(o);
     }
     
     return 0;
@@ -793,17 +801,25 @@ PythonInterpreter::getInt(int *data, int numArgs) {
 
 int 
 PythonInterpreter::getDouble(double *data, int numArgs) {
-    if ((wrapper.getNumberArgs() - wrapper.getCurrentArg()) < numArgs) {
-	return -1;
-    }
-
-    for (int i=0; i<numArgs; i++) {
+    int start = wrapper.getCurrentArg();
+    int i = 0;
+    while (i < numArgs) {
+	if (wrapper.getCurrentArg() >= wrapper.getNumberArgs()) {
+	    wrapper.resetCommandLine(start+1);
+	    return -1;
+	}
 	PyObject *o = PyTuple_GetItem(wrapper.getCurrentArgv(),wrapper.getCurrentArg());
 	wrapper.incrCurrentArg();
-	if (!PyFloat_Check(o)) {
-	    return -1;
+	if (PyFloat_Check(o)) {
+	    data[i++] = PyFloat_AS_DOUBLE(o);
+	} else {
+	    // a list or array argument gives several values at once
+	    int num = wrapper.getDoubleSequence(o, &data[i], numArgs-i);
+	    if (num < 1) {
+		return -1;
+	    }
+	    i += num;
 	}
-	data[i] = PyFloat_AS_DOUBLE(o);
     }
     
     return 0;
@@ -858,3 +874,16 @@ PythonInterpreter::setString(const char* str)
     return 0;
 }
 
+double*
+PythonInterpreter::getDoubleArray(int numRows, int numCols)
+{
+    return wrapper.getOutputArray(numRows, numCols);
+}
+
+int
+PythonInterpreter::setDoubleArray(void)
+{
+    wrapper.setOutputArray();
+    return 0;
+}
+
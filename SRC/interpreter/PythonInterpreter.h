@@ -59,6 +59,8 @@ class PythonInterpreter: public DL_Interpreter
     virtual int setInt(int *, int numArgs);
     virtual int setDouble(double *, int numArgs);
     virtual int setString(const char*);
+    virtual double *getDoubleArray(int numRows, int numCols);
+    virtual int setDoubleArray(void);
 
   private:
     PythonWrapper wrapper;
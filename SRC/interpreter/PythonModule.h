@@ -58,6 +58,8 @@ class PythonModule: public DL_Interpreter
     virtual int setInt(int *, int numArgs);
     virtual int setDouble(double *, int numArgs);
     virtual int setString(const char*);
+    virtual double *getDoubleArray(int numRows, int numCols);
+    virtual int setDoubleArray(void);
 
     // getwrapper
     PythonWrapper* getWrapper() {return &wrapper;}
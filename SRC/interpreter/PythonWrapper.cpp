@@ -29,9 +29,127 @@
 
 PythonWrapper* wrapper = 0;
 
+// the number of staging arrays kept by the wrapper; two lets a script
+// hold on to the last result while the next one is being written
+#define OPS_NUM_OUTPUT_ARRAYS 2
+
+// opensees.array - a row-major block of doubles handed to python
+// through the buffer protocol, so numpy.asarray() or memoryview()
+// use the memory in place
+typedef struct {
+    PyObject_HEAD
+    double* data;
+    Py_ssize_t size;
+    Py_ssize_t shape[2];
+    Py_ssize_t strides[2];
+} OpenSeesArray;
+
+static void
+OpenSeesArray_dealloc(PyObject* self)
+{
+    OpenSeesArray* theArray = (OpenSeesArray*)self;
+    if (theArray->data != 0) {
+	delete [] theArray->data;
+    }
+    PyObject_Del(self);
+}
+
+static Py_ssize_t
+OpenSeesArray_length(PyObject* self)
+{
+    return ((OpenSeesArray*)self)->shape[0];
+}
+
+static int
+OpenSeesArray_getbuffer(PyObject* self, Py_buffer* view, int flags)
+{
+    OpenSeesArray* theArray = (OpenSeesArray*)self;
+
+    view->buf = theArray->data;
+    view->obj = self;
+    Py_INCREF(self);
+    view->len = theArray->shape[0]*theArray->shape[1]*sizeof(double);
+    view->readonly = 0;
+    view->itemsize = sizeof(double);
+    view->format = 0;
+    if ((flags & PyBUF_FORMAT) == PyBUF_FORMAT) {
+	view->format = (char*)"d";
+    }
+    view->ndim = 2;
+    view->shape = 0;
+    if ((flags & PyBUF_ND) == PyBUF_ND) {
+	view->shape = theArray->shape;
+    }
+    view->strides = 0;
+    if ((flags & PyBUF_STRIDES) == PyBUF_STRIDES) {
+	view->strides = theArray->strides;
+    }
+    view->suboffsets = 0;
+    view->internal = 0;
+
+    return 0;
+}
+
+static PyObject*
+OpenSeesArray_getshape(PyObject* self, void*)
+{
+    OpenSeesArray* theArray = (OpenSeesArray*)self;
+    return Py_BuildValue("(nn)", theArray->shape[0], theArray->shape[1]);
+}
+
+static PySequenceMethods OpenSeesArray_as_sequence;
+static PyBufferProcs OpenSeesArray_as_buffer;
+static PyGetSetDef OpenSeesArray_getset[] = {
+    {(char*)"shape", OpenSeesArray_getshape, 0, (char*)"(rows, columns)", 0},
+    {0, 0, 0, 0, 0}
+};
+
+static PyTypeObject OpenSeesArrayType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "opensees.array"
+};
+
+static PyObject*
+OpenSeesArray_new()
+{
+    if (OpenSeesArrayType.tp_basicsize == 0) {
+	OpenSeesArray_as_sequence.sq_length = OpenSeesArray_length;
+	OpenSeesArray_as_buffer.bf_getbuffer = OpenSeesArray_getbuffer;
+	OpenSeesArrayType.tp_basicsize = sizeof(OpenSeesArray);
+	OpenSeesArrayType.tp_dealloc = OpenSeesArray_dealloc;
+	OpenSeesArrayType.tp_as_sequence = &OpenSeesArray_as_sequence;
+	OpenSeesArrayType.tp_as_buffer = &OpenSeesArray_as_buffer;
+	OpenSeesArrayType.tp_getset = OpenSeesArray_getset;
+#if PY_MAJOR_VERSION==2
+	OpenSeesArrayType.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_NEWBUFFER;
+#else
+	OpenSeesArrayType.tp_flags = Py_TPFLAGS_DEFAULT;
+#endif
+	OpenSeesArrayType.tp_doc = "block of OpenSees results shared through the buffer protocol";
+	if (PyType_Ready(&OpenSeesArrayType) < 0) {
+	    OpenSeesArrayType.tp_basicsize = 0;
+	    return 0;
+	}
+    }
+
+    OpenSeesArray* theArray = PyObject_New(OpenSeesArray, &OpenSeesArrayType);
+    if (theArray == 0) {
+	return 0;
+    }
+    theArray->data = 0;
+    theArray->size = 0;
+    theArray->shape[0] = 0;
+    theArray->shape[1] = 0;
+    theArray->strides[0] = 0;
+    theArray->strides[1] = sizeof(double);
+
+    return (PyObject*)theArray;
+}
+
 PythonWrapper::PythonWrapper()
     :currentArgv(0), currentArg(0), numberArgs(0),
-     methodsOpenSees(), opensees_docstring(""), currentResult(0)
+     methodsOpenSees(), opensees_docstring(""), currentResult(0),
+     outputArrays(), currentArray(0)
 {
     wrapper = this;
 }
@@ -111,6 +229,218 @@ PythonWrapper::setOutputs(const char* str)
     currentResult = Py_BuildValue("s", str);
 }
 
+double*
+PythonWrapper::getOutputArray(int numRows, int numCols)
+{
+    // drop an array left over from a command which failed
+    if (currentArray != 0) {
+	bool pooled = false;
+	for (int i=0; i<(int)outputArrays.size(); i++) {
+	    if (outputArrays[i] == currentArray) pooled = true;
+	}
+	if (!pooled) {
+	    Py_DECREF(currentArray);
+	}
+	currentArray = 0;
+    }
+
+    // reuse a staging array python no longer holds
+    for (int i=0; i<(int)outputArrays.size(); i++) {
+	if (Py_REFCNT(outputArrays[i]) == 1) {
+	    currentArray = outputArrays[i];
+	    break;
+	}
+    }
+
+    // otherwise get a new one, which is kept only if there is room
+    if (currentArray == 0) {
+	currentArray = OpenSeesArray_new();
+	if (currentArray == 0) {
+	    return 0;
+	}
+	if (outputArrays.size() < OPS_NUM_OUTPUT_ARRAYS) {
+	    outputArrays.push_back(currentArray);
+	    Py_INCREF(currentArray);
+	}
+    }
+
+    OpenSeesArray* theArray = (OpenSeesArray*)currentArray;
+    Py_ssize_t size = (Py_ssize_t)numRows*numCols;
+    if (size < 1) {
+	size = 1;
+    }
+    if (size > theArray->size) {
+	if (theArray->data != 0) {
+	    delete [] theArray->data;
+	}
+	theArray->data = new double[size];
+	theArray->size = size;
+    }
+    theArray->shape[0] = numRows;
+    theArray->shape[1] = numCols;
+    theArray->strides[0] = numCols*sizeof(double);
+
+    return theArray->data;
+}
+
+void
+PythonWrapper::setOutputArray()
+{
+    if (currentArray == 0) return;
+
+    // a pooled array is shared with the result, any other is handed over
+    for (int i=0; i<(int)outputArrays.size(); i++) {
+	if (outputArrays[i] == currentArray) {
+	    Py_INCREF(currentArray);
+	    break;
+	}
+    }
+    currentResult = currentArray;
+    currentArray = 0;
+}
+
+static bool
+OpenSeesArray_isSequence(PyObject* o)
+{
+    return PyList_Check(o) || PyTuple_Check(o) || PyObject_CheckBuffer(o);
+}
+
+// the format character of a contiguous buffer, 0 if not usable
+static char
+OpenSeesArray_getFormat(Py_buffer& view)
+{
+    const char* format = view.format;
+    if (format == 0) {
+	return 'B';
+    }
+    while (*format=='@' || *format=='=' || *format=='<') {
+	format++;
+    }
+    if (format[0] == 0 || format[1] != 0) {
+	return 0;
+    }
+    return format[0];
+}
+
+int
+PythonWrapper::getIntSequence(PyObject* o, int* data, int maxArgs)
+{
+    if (!OpenSeesArray_isSequence(o)) {
+	return -1;
+    }
+
+    // numpy arrays and the like: copy straight out of the buffer
+    if (PyObject_CheckBuffer(o)) {
+	Py_buffer view;
+	if (PyObject_GetBuffer(o, &view, PyBUF_C_CONTIGUOUS|PyBUF_FORMAT) == 0) {
+	    Py_ssize_t num = view.len/view.itemsize;
+	    char format = OpenSeesArray_getFormat(view);
+	    int res = (int)num;
+	    if (num > maxArgs) {
+		res = -1;
+	    } else if (format == 'i' && view.itemsize == sizeof(int)) {
+		const int* values = (const int*)view.buf;
+		for (Py_ssize_t i=0; i<num; i++) data[i] = values[i];
+	    } else if ((format == 'l' || format == 'q') && view.itemsize == sizeof(long long)) {
+		const long long* values = (const long long*)view.buf;
+		for (Py_ssize_t i=0; i<num; i++) data[i] = (int)values[i];
+	    } else if (format == 'l' && view.itemsize == sizeof(long)) {
+		const long* values = (const long*)view.buf;
+		for (Py_ssize_t i=0; i<num; i++) data[i] = (int)values[i];
+	    } else {
+		res = -2;
+	    }
+	    PyBuffer_Release(&view);
+	    if (res != -2) {
+		return res;
+	    }
+	} else {
+	    PyErr_Clear();
+	}
+    }
+
+    PyObject* seq = PySequence_Fast(o, "expected a sequence of integers");
+    if (seq == 0) {
+	PyErr_Clear();
+	return -1;
+    }
+    Py_ssize_t num = PySequence_Fast_GET_SIZE(seq);
+    if (num > maxArgs) {
+	Py_DECREF(seq);
+	return -1;
+    }
+    PyObject** items = PySequence_Fast_ITEMS(seq);
+    for (Py_ssize_t i=0; i<num; i++) {
+	long value = PyInt_AsLong(items[i]);
+	if (value == -1 && PyErr_Occurred()) {
+	    PyErr_Clear();
+	    Py_DECREF(seq);
+	    return -1;
+	}
+	data[i] = (int)value;
+    }
+    Py_DECREF(seq);
+
+    return (int)num;
+}
+
+int
+PythonWrapper::getDoubleSequence(PyObject* o, double* data, int maxArgs)
+{
+    if (!OpenSeesArray_isSequence(o)) {
+	return -1;
+    }
+
+    if (PyObject_CheckBuffer(o)) {
+	Py_buffer view;
+	if (PyObject_GetBuffer(o, &view, PyBUF_C_CONTIGUOUS|PyBUF_FORMAT) == 0) {
+	    Py_ssize_t num = view.len/view.itemsize;
+	    char format = OpenSeesArray_getFormat(view);
+	    int res = (int)num;
+	    if (num > maxArgs) {
+		res = -1;
+	    } else if (format == 'd' && view.itemsize == sizeof(double)) {
+		memcpy(data, view.buf, num*sizeof(double));
+	    } else if (format == 'f' && view.itemsize == sizeof(float)) {
+		const float* values = (const float*)view.buf;
+		for (Py_ssize_t i=0; i<num; i++) data[i] = values[i];
+	    } else {
+		res = -2;
+	    }
+	    PyBuffer_Release(&view);
+	    if (res != -2) {
+		return res;
+	    }
+	} else {
+	    PyErr_Clear();
+	}
+    }
+
+    PyObject* seq = PySequence_Fast(o, "expected a sequence of numbers");
+    if (seq == 0) {
+	PyErr_Clear();
+	return -1;
+    }
+    Py_ssize_t num = PySequence_Fast_GET_SIZE(seq);
+    if (num > maxArgs) {
+	Py_DECREF(seq);
+	return -1;
+    }
+    PyObject** items = PySequence_Fast_ITEMS(seq);
+    for (Py_ssize_t i=0; i<num; i++) {
+	double value = PyFloat_AsDouble(items[i]);
+	if (value == -1.0 && PyErr_Occurred()) {
+	    PyErr_Clear();
+	    Py_DECREF(seq);
+	    return -1;
+	}
+	data[i] = value;
+    }
+    Py_DECREF(seq);
+
+    return (int)num;
+}
+
 PyObject*
 PythonWrapper::getResults()
 {
@@ -220,6 +550,15 @@ static PyObject *Py_ops_node(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_nodes(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_Nodes() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_fix(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -238,6 +577,15 @@ static PyObject *Py_ops_element(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_elements(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_Elements() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_timeSeries(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -364,6 +712,15 @@ static PyObject *Py_ops_fiber(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_fibers(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_Fibers() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_patch(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -778,6 +1135,24 @@ static PyObject *Py_ops_nodeResponse(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_nodeResponses(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_nodeResponses() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_eleResponses(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_eleResponses() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_nodeCoord(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -913,6 +1288,24 @@ static PyObject *Py_ops_searchPeerNGA(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_profile(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_profile() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_updateMaterialStage(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_updateMaterialStage() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_domainChange(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -1139,6 +1532,15 @@ static PyObject *Py_ops_numIter(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_explicitEnergy(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_explicitEnergy() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_systemSize(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -1282,8 +1684,10 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("wipe", &Py_ops_wipe);
     addCommand("model", &Py_ops_model);
     addCommand("node", &Py_ops_node);
+    addCommand("nodes", &Py_ops_nodes);
     addCommand("fix", &Py_ops_fix);
     addCommand("element", &Py_ops_element);
+    addCommand("elements", &Py_ops_elements);
     addCommand("timeSeries", &Py_ops_timeSeries);
     addCommand("pattern", &Py_ops_pattern);
     addCommand("load", &Py_ops_nodalLoad);
@@ -1298,6 +1702,7 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("test", &Py_ops_test);
     addCommand("section", &Py_ops_section);
     addCommand("fiber", &Py_ops_fiber);
+    addCommand("fibers", &Py_ops_fibers);
     addCommand("patch", &Py_ops_patch);
     addCommand("layer", &Py_ops_layer);
     addCommand("geomTransf", &Py_ops_geomTransf);
@@ -1344,6 +1749,8 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("setNodeVel", &Py_ops_setNodeVel);
     addCommand("nodeAccel", &Py_ops_nodeAccel);
     addCommand("nodeResponse", &Py_ops_nodeResponse);
+    addCommand("nodeResponses", &Py_ops_nodeResponses);
+    addCommand("eleResponses", &Py_ops_eleResponses);
     addCommand("nodeCoord", &Py_ops_nodeCoord);
     addCommand("setNodeCoord", &Py_ops_setNodeCoord);
     addCommand("updateElementDomain", &Py_ops_updateElementDomain);
@@ -1360,6 +1767,8 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("setPrecision", &Py_ops_setPrecision);
     addCommand("searchPeerNGA", &Py_ops_searchPeerNGA);
     addCommand("domainChange", &Py_ops_domainChange);
+    addCommand("profile", &Py_ops_profile);
+    addCommand("updateMaterialStage", &Py_ops_updateMaterialStage);
     addCommand("metaData", &Py_ops_metaData);
     addCommand("neesUpload", &Py_ops_neesUpload);
     addCommand("stripXML", &Py_ops_stripXML);
@@ -1384,6 +1793,7 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("accelCPU", &Py_ops_accelCPU);
     addCommand("numFact", &Py_ops_numFact);
     addCommand("numIter", &Py_ops_numIter);
+    addCommand("explicitEnergy", &Py_ops_explicitEnergy);
     addCommand("systemSize", &Py_ops_systemSize);
     addCommand("version", &Py_ops_version);
     addCommand("setMaxOpenFiles", &Py_ops_setMaxOpenFiles);
@@ -50,12 +50,22 @@ public:
     int getNumberArgs() const {return numberArgs;}
     void incrCurrentArg() {currentArg++;}
 
+    // bulk inputs: the values of a list, tuple or buffer (e.g. numpy
+    // array) argument, returns the number read or -1
+    int getIntSequence(PyObject* o, int* data, int maxArgs);
+    int getDoubleSequence(PyObject* o, double* data, int maxArgs);
+
     // set outputs
     void setOutputs(int* data, int numArgs);
     void setOutputs(double* data, int numArgs);
     void setOutputs(const char* str);
     PyObject* getResults();
 
+    // bulk outputs: a numRows x numCols block of doubles written into
+    // a staging array which python reads through the buffer protocol
+    double* getOutputArray(int numRows, int numCols);
+    void setOutputArray();
+
 private:
     // command line arguments
     PyObject* currentArgv;
@@ -66,5 +76,10 @@ private:
     std::vector<PyMethodDef> methodsOpenSees;
     const char* opensees_docstring;
     PyObject* currentResult;
+
+    // staging arrays for bulk outputs, reused once python has
+    // released them
+    std::vector<PyObject*> outputArrays;
+    PyObject* currentArray;
 };
 #endif
@@ -173,6 +173,14 @@ static int Tcl_ops_node(ClientData clientData, Tcl_Interp *interp, int argc,   T
     return TCL_OK;
 }
 
+static int Tcl_ops_nodes(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_Nodes() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
 static int Tcl_ops_fix(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -189,6 +197,14 @@ static int Tcl_ops_element(ClientData clientData, Tcl_Interp *interp, int argc,
     return TCL_OK;
 }
 
+static int Tcl_ops_elements(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_Elements() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
 static int Tcl_ops_timeSeries(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -301,6 +317,14 @@ static int Tcl_ops_fiber(ClientData clientData, Tcl_Interp *interp, int argc,
     return TCL_OK;
 }
 
+static int Tcl_ops_fibers(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_Fibers() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
 static int Tcl_ops_patch(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -669,6 +693,22 @@ static int Tcl_ops_nodeResponse(ClientData clientData, Tcl_Interp *interp, int a
     return TCL_OK;
 }
 
+static int Tcl_ops_nodeResponses(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_nodeResponses() < 0) return TCL_ERROR;
+
+    return TCL_OK;
+}
+
+static int Tcl_ops_eleResponses(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_eleResponses() < 0) return TCL_ERROR;
+
+    return TCL_OK;
+}
+
 static int Tcl_ops_nodeCoord(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -789,6 +829,22 @@ static int Tcl_ops_searchPeerNGA(ClientData clientData, Tcl_Interp *interp, int
     return TCL_OK;
 }
 
+static int Tcl_ops_profile(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_profile() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_updateMaterialStage(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_updateMaterialStage() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
 static int Tcl_ops_domainChange(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -989,6 +1045,14 @@ static int Tcl_ops_numIter(ClientData clientData, Tcl_Interp *interp, int argc,
     return TCL_OK;
 }
 
+static int Tcl_ops_explicitEnergy(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_explicitEnergy() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
 static int Tcl_ops_systemSize(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -1117,8 +1181,10 @@ TclWrapper::addOpenSeesCommands(Tcl_Interp* interp)
     addCommand(interp,"wipe", &Tcl_ops_wipe);
     addCommand(interp,"model", &Tcl_ops_model);
     addCommand(interp,"node", &Tcl_ops_node);
+    addCommand(interp,"nodes", &Tcl_ops_nodes);
     addCommand(interp,"fix", &Tcl_ops_fix);
     addCommand(interp,"element", &Tcl_ops_element);
+    addCommand(interp,"elements", &Tcl_ops_elements);
     addCommand(interp,"timeSeries", &Tcl_ops_timeSeries);
     addCommand(interp,"pattern", &Tcl_ops_pattern);
     addCommand(interp,"load", &Tcl_ops_nodalLoad);
@@ -1133,6 +1199,7 @@ TclWrapper::addOpenSeesCommands(Tcl_Interp* interp)
     addCommand(interp,"test", &Tcl_ops_test);
     addCommand(interp,"section", &Tcl_ops_section);
     addCommand(interp,"fiber", &Tcl_ops_fiber);
+    addCommand(interp,"fibers", &Tcl_ops_fibers);
     addCommand(interp,"patch", &Tcl_ops_patch);
     addCommand(interp,"layer", &Tcl_ops_layer);
     addCommand(interp,"geomTransf", &Tcl_ops_geomTransf);
@@ -1179,6 +1246,8 @@ TclWrapper::addOpenSeesCommands(Tcl_Interp* interp)
     addCommand(interp,"setNodeVel", &Tcl_ops_setNodeVel);
     addCommand(interp,"nodeAccel", &Tcl_ops_nodeAccel);
     addCommand(interp,"nodeResponse", &Tcl_ops_nodeResponse);
+    addCommand(interp,"nodeResponses", &Tcl_ops_nodeResponses);
+    addCommand(interp,"eleResponses", &Tcl_ops_eleResponses);
     addCommand(interp,"nodeCoord", &Tcl_ops_nodeCoord);
     addCommand(interp,"setNodeCoord", &Tcl_ops_setNodeCoord);
     addCommand(interp,"updateElementDomain", &Tcl_ops_updateElementDomain);
@@ -1195,6 +1264,8 @@ TclWrapper::addOpenSeesCommands(Tcl_Interp* interp)
     addCommand(interp,"setPrecision", &Tcl_ops_setPrecision);
     addCommand(interp,"searchPeerNGA", &Tcl_ops_searchPeerNGA);
     addCommand(interp,"domainChange", &Tcl_ops_domainChange);
+    addCommand(interp,"profile", &Tcl_ops_profile);
+    addCommand(interp,"updateMaterialStage", &Tcl_ops_updateMaterialStage);
     addCommand(interp,"metaData", &Tcl_ops_metaData);
     addCommand(interp,"neesUpload", &Tcl_ops_neesUpload);
     addCommand(interp,"stripXML", &Tcl_ops_stripXML);
@@ -1219,6 +1290,7 @@ TclWrapper::addOpenSeesCommands(Tcl_Interp* interp)
     addCommand(interp,"accelCPU", &Tcl_ops_accelCPU);
     addCommand(interp,"numFact", &Tcl_ops_numFact);
     addCommand(interp,"numIter", &Tcl_ops_numIter);
+    addCommand(interp,"explicitEnergy", &Tcl_ops_explicitEnergy);
     addCommand(interp,"systemSize", &Tcl_ops_systemSize);
     addCommand(interp,"version", &Tcl_ops_version);
     addCommand(interp,"setMaxOpenFiles", &Tcl_ops_setMaxOpenFiles);
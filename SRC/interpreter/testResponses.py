@@ -0,0 +1,101 @@
+import struct
+import opensees as ops
+
+# checks the shape and strides of the blocks returned by nodeResponses and
+# eleResponses, their values against nodeDisp and eleResponse, and that a
+# block still held is not written over by the next command; the truss is
+# that of Truss.py
+
+ops.wipe()
+ops.model('basic', '-ndm', 2, '-ndf', 2)
+
+ops.node(1, 0.0, 0.0)
+ops.node(2, 144.0,  0.0)
+ops.node(3, 168.0,  0.0)
+ops.node(4,  72.0, 96.0)
+
+ops.fix(1, 1, 1)
+ops.fix(2, 1, 1)
+ops.fix(3, 1, 1)
+
+ops.uniaxialMaterial("Elastic", 1, 3000)
+
+ops.element("Truss",1,1,4,10.0,1)
+ops.element("Truss",2,2,4,5.0,1)
+ops.element("Truss",3,3,4,5.0,1)
+
+ops.timeSeries("Linear", 1)
+ops.pattern("Plain", 1, 1, "-fact", 1.0)
+ops.load(4, 100, -50)
+
+ops.system("BandSPD")
+ops.numberer("RCM")
+ops.constraints("Plain")
+ops.algorithm("Linear")
+ops.integrator("LoadControl", 1.0)
+ops.analysis("Static")
+ops.analyze(1)
+
+numFailed = [0]
+
+def check(ok, what):
+    if ok:
+        print("PASS: " + what)
+    else:
+        print("FAIL: " + what)
+        numFailed[0] += 1
+
+# the rows of a block, read through the buffer protocol
+def getRows(block):
+    m = memoryview(block)
+    rows, cols = m.shape
+    values = struct.unpack('%dd' % (rows*cols), m.tobytes())
+    return [list(values[i*cols:(i+1)*cols]) for i in range(rows)]
+
+def checkBlock(block, shape, rows, what):
+    m = memoryview(block)
+    check(m.format == 'd' and m.itemsize == 8 and m.ndim == 2, what + ": format")
+    check(tuple(m.shape) == shape and tuple(block.shape) == shape and
+          len(block) == shape[0], what + ": shape " + str(tuple(m.shape)))
+    check(tuple(m.strides) == (8*shape[1], 8) and m.c_contiguous,
+          what + ": strides " + str(tuple(m.strides)))
+    check(getRows(block) == rows, what + ": values")
+
+nodeTags = ops.getNodeTags()
+eleTags = ops.getEleTags()
+disp = [list(ops.nodeDisp(tag)) for tag in nodeTags]
+force = [list(ops.eleResponse(tag, 'axialForce')) for tag in eleTags]
+
+# all the nodes, one dof, a list of nodes
+d = ops.nodeResponses('disp')
+checkBlock(d, (len(nodeTags), 2), disp, "nodeResponses disp")
+
+d1 = ops.nodeResponses('disp', '-dof', 2)
+checkBlock(d1, (len(nodeTags), 1), [[u[1]] for u in disp], "nodeResponses disp -dof 2")
+
+# d and d1 are both held, a third block must not write over either
+d2 = ops.nodeResponses('disp', '-node', 4, 1)
+checkBlock(d2, (2, 2), [disp[nodeTags.index(4)], disp[nodeTags.index(1)]],
+           "nodeResponses disp -node 4 1")
+checkBlock(d, (len(nodeTags), 2), disp, "nodeResponses disp still held")
+checkBlock(d1, (len(nodeTags), 1), [[u[1]] for u in disp], "nodeResponses disp -dof 2 still held")
+
+# the elements, all and a list
+f = ops.eleResponses('axialForce')
+checkBlock(f, (len(eleTags), 1), force, "eleResponses axialForce")
+
+f2 = ops.eleResponses('-ele', 3, 1, 'axialForce')
+checkBlock(f2, (2, 1), [force[eleTags.index(3)], force[eleTags.index(1)]],
+           "eleResponses -ele 3 1 axialForce")
+
+# once released the blocks are reused, the results still being right
+del d, d1, d2, f, f2
+for i in range(3):
+    d = ops.nodeResponses('disp')
+    checkBlock(d, (len(nodeTags), 2), disp, "nodeResponses disp, block reused")
+    del d
+
+if numFailed[0] == 0:
+    print("all tests passed")
+else:
+    print(str(numFailed[0]) + " tests failed")
@@ -72,6 +72,7 @@ class NDMaterial : public Material
 
     virtual NDMaterial *getCopy(void) = 0;
     virtual NDMaterial *getCopy(const char *code);
+    virtual bool isThreadSafe(void) {return false;}
 
     virtual const char *getType(void) const = 0;
     virtual int getOrder(void) const {return 0;};  //??
@@ -98,6 +98,9 @@ class ElasticMembranePlateSection : public SectionForceDeformation{
     //send back the initial tangent 
     const Matrix& getInitialTangent( ) ;
 
+    //the tangent does not depend on the state
+    bool isTangentConstant( ) {return true;}
+
     //print out data
     void Print( OPS_Stream &s, int flag ) ;
 
@@ -29,6 +29,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <vector>
 #include <math.h>
 
 #include <Channel.h>
@@ -48,6 +49,23 @@
 
 ID FiberSection2d::code(2);
 
+// work array for the fiber locations, areas, strains, stresses and
+// tangents used during the state determination; private to each thread
+// when sections are updated concurrently, grown as needed and freed
+// when the thread exits
+static OPS_THREAD_LOCAL std::vector<double> fiberWork;
+
+static double *
+getFiberWork(int size)
+{
+  if (size < 1)
+    size = 1;
+  if (size > (int)fiberWork.size())
+    fiberWork.resize(size);
+
+  return &fiberWork[0];
+}
+
 void* OPS_FiberSection2d()
 {
     int numData = OPS_GetNumRemainingInputArgs();
@@ -67,7 +85,7 @@ void* OPS_FiberSection2d()
 // constructors:
 FiberSection2d::FiberSection2d(int tag, int num, Fiber **fibers): 
   SectionForceDeformation(tag, SEC_TAG_FiberSection2d),
-  numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
+  numFibers(num), sizeFibers(num), theMaterials(0), matData(0), homogeneous(-1),
   QzBar(0.0), ABar(0.0), yBar(0.0), sectionIntegr(0), e(2), s(0), ks(0), dedh(2)
 {
   if (numFibers > 0) {
@@ -124,7 +142,7 @@ FiberSection2d::FiberSection2d(int tag, int num, Fiber **fibers):
 // allocate memory for fibers
 FiberSection2d::FiberSection2d(int tag, int num): 
   SectionForceDeformation(tag, SEC_TAG_FiberSection2d),
-  numFibers(0), sizeFibers(num), theMaterials(0), matData(0),
+  numFibers(0), sizeFibers(num), theMaterials(0), matData(0), homogeneous(-1),
   QzBar(0.0), ABar(0.0), yBar(0.0), sectionIntegr(0), e(2), s(0), ks(0), dedh(2)
 {
     if(sizeFibers > 0) {
@@ -167,7 +185,7 @@ FiberSection2d::FiberSection2d(int tag, int num):
 FiberSection2d::FiberSection2d(int tag, int num, UniaxialMaterial **mats,
 			       SectionIntegration &si):
   SectionForceDeformation(tag, SEC_TAG_FiberSection2d),
-  numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
+  numFibers(num), sizeFibers(num), theMaterials(0), matData(0), homogeneous(-1),
   QzBar(0.0), ABar(0.0), yBar(0.0), sectionIntegr(0), e(2), s(0), ks(0), dedh(2)
 {
   if (numFibers != 0) {
@@ -230,7 +248,7 @@ FiberSection2d::FiberSection2d(int tag, int num, UniaxialMaterial **mats,
 // constructor for blank object that recvSelf needs to be invoked upon
 FiberSection2d::FiberSection2d():
   SectionForceDeformation(0, SEC_TAG_FiberSection2d),
-  numFibers(0), sizeFibers(0), theMaterials(0), matData(0),
+  numFibers(0), sizeFibers(0), theMaterials(0), matData(0), homogeneous(-1),
   QzBar(0.0), ABar(0.0), yBar(0.0), sectionIntegr(0), e(2), s(0), ks(0), dedh(2)
 {
   s = new Vector(sData, 2);
@@ -304,6 +322,7 @@ FiberSection2d::addFiber(Fiber &newFiber)
   }
 
   numFibers++;
+  homogeneous = -1;
 
   // Recompute centroid
   ABar += Area;
@@ -351,8 +370,11 @@ FiberSection2d::setTrialSectionDeformation (const Vector &deforms)
   double d0 = deforms(0);
   double d1 = deforms(1);
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  double *fiberLocs = getFiberWork(5*numFibers);
+  double *fiberArea = &fiberLocs[numFibers];
+  double *strain = &fiberLocs[2*numFibers];
+  double *stress = &fiberLocs[3*numFibers];
+  double *tangent = &fiberLocs[4*numFibers];
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
@@ -365,23 +387,32 @@ FiberSection2d::setTrialSectionDeformation (const Vector &deforms)
     }
   }
   
+  // determine the material strains
+  for (int i = 0; i < numFibers; i++)
+    strain[i] = d0 - (fiberLocs[i] - yBar)*d1;
+
+  // set the fiber strains, with a single call when the fibers are all
+  // of one material type
+  if (homogeneous == -1)
+    this->setHomogeneous();
+
+  if (homogeneous == 1)
+    res = theMaterials[0]->setTrialStrains(numFibers, theMaterials, strain, 0, stress, tangent);
+  else
+    for (int i = 0; i < numFibers; i++)
+      res += theMaterials[i]->setTrial(strain[i], stress[i], tangent[i]);
+
   for (int i = 0; i < numFibers; i++) {
-    UniaxialMaterial *theMat = theMaterials[i];
     double y = fiberLocs[i] - yBar;
     double A = fiberArea[i];
 
-    // determine material strain and set it
-    double strain = d0 - y*d1;
-    double tangent, stress;
-    res += theMat->setTrial(strain, stress, tangent);
-
-    double ks0 = tangent * A;
+    double ks0 = tangent[i] * A;
     double ks1 = ks0 * -y;
     kData[0] += ks0;
     kData[1] += ks1;
     kData[3] += ks1 * -y;
 
-    double fs0 = stress * A;
+    double fs0 = stress[i] * A;
     sData[0] += fs0;
     sData[1] += fs0 * -y;
   }
@@ -391,6 +422,26 @@ FiberSection2d::setTrialSectionDeformation (const Vector &deforms)
   return res;
 }
 
+// void setHomogeneous(void);
+//	sets homogeneous to 1 if the fibers are all of one material type, so
+//	their state can be set in a single setTrialStrains() call, and to 0
+//	otherwise; it is reset to -1 whenever the fibers change.
+
+void
+FiberSection2d::setHomogeneous(void)
+{
+  homogeneous = 0;
+  if (numFibers == 0)
+    return;
+
+  int classTag = theMaterials[0]->getClassTag();
+  for (int i = 1; i < numFibers; i++)
+    if (theMaterials[i]->getClassTag() != classTag)
+      return;
+
+  homogeneous = 1;
+}
+
 const Vector&
 FiberSection2d::getSectionDeformation(void)
 {
@@ -400,12 +451,12 @@ FiberSection2d::getSectionDeformation(void)
 const Matrix&
 FiberSection2d::getInitialTangent(void)
 {
-  static double kInitial[4];
-  static Matrix kInitialMatrix(kInitial, 2, 2);
+  static OPS_THREAD_LOCAL double kInitial[4];
+  static OPS_THREAD_LOCAL Matrix kInitialMatrix(kInitial, 2, 2);
   kInitial[0] = 0.0; kInitial[1] = 0.0; kInitial[2] = 0.0; kInitial[3] = 0.0;
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  double *fiberLocs = getFiberWork(2*numFibers);
+  double *fiberArea = &fiberLocs[numFibers];
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
@@ -518,6 +569,17 @@ FiberSection2d::getOrder () const
   return 2;
 }
 
+bool
+FiberSection2d::isThreadSafe(void)
+{
+  // the section scratch is held per thread, the fibers must be as well
+  for (int i = 0; i < numFibers; i++)
+    if (theMaterials[i]->isThreadSafe() == false)
+      return false;
+
+  return true;
+}
+
 int
 FiberSection2d::commitState(void)
 {
@@ -537,8 +599,8 @@ FiberSection2d::revertToLastCommit(void)
   kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
   sData[0] = 0.0; sData[1] = 0.0;
   
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  double *fiberLocs = getFiberWork(2*numFibers);
+  double *fiberArea = &fiberLocs[numFibers];
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
@@ -587,8 +649,8 @@ FiberSection2d::revertToStart(void)
   kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
   sData[0] = 0.0; sData[1] = 0.0;
   
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  double *fiberLocs = getFiberWork(2*numFibers);
+  double *fiberArea = &fiberLocs[numFibers];
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
@@ -752,6 +814,8 @@ FiberSection2d::recvSelf(int commitTag, Channel &theChannel,
       return res;
     }    
 
+    homogeneous = -1;
+
     int i;
     for (i=0; i<numFibers; i++) {
       int classTag = materialData(2*i);
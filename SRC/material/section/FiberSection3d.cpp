@@ -46,13 +46,31 @@
 #include <SectionIntegration.h>
 #include <elementAPI.h>
 #include <string.h>
+#include <vector>
 
 ID FiberSection3d::code(4);
 
+// work array for the fiber locations, areas, strains, stresses and
+// tangents used during the state determination; private to each thread
+// when sections are updated concurrently, grown as needed and freed
+// when the thread exits
+static OPS_THREAD_LOCAL std::vector<double> fiberWork;
+
+static double *
+getFiberWork(int size)
+{
+  if (size < 1)
+    size = 1;
+  if (size > (int)fiberWork.size())
+    fiberWork.resize(size);
+
+  return &fiberWork[0];
+}
+
 // constructors:
 FiberSection3d::FiberSection3d(int tag, int num, Fiber **fibers, UniaxialMaterial *torsion): 
   SectionForceDeformation(tag, SEC_TAG_FiberSection3d),
-  numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
+  numFibers(num), sizeFibers(num), theMaterials(0), matData(0), homogeneous(-1),
   QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0), e(4), s(0), ks(0), theTorsion(0)
 {
   if (numFibers != 0) {
@@ -124,7 +142,7 @@ FiberSection3d::FiberSection3d(int tag, int num, Fiber **fibers, UniaxialMateria
 
 FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial *torsion): 
     SectionForceDeformation(tag, SEC_TAG_FiberSection3d),
-    numFibers(0), sizeFibers(num), theMaterials(0), matData(0),
+    numFibers(0), sizeFibers(num), theMaterials(0), matData(0), homogeneous(-1),
     QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0), e(4), s(0), ks(0), theTorsion(0)
 {
     if(sizeFibers != 0) {
@@ -179,7 +197,7 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial *torsion):
 FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial **mats,
 			       SectionIntegration &si, UniaxialMaterial *torsion):
   SectionForceDeformation(tag, SEC_TAG_FiberSection3d),
-  numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
+  numFibers(num), sizeFibers(num), theMaterials(0), matData(0), homogeneous(-1),
   QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0), e(4), s(0), ks(0), theTorsion(0)
 {
   if (numFibers != 0) {
@@ -254,7 +272,7 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial **mats,
 // constructor for blank object that recvSelf needs to be invoked upon
 FiberSection3d::FiberSection3d():
   SectionForceDeformation(0, SEC_TAG_FiberSection3d),
-  numFibers(0), sizeFibers(0), theMaterials(0), matData(0),
+  numFibers(0), sizeFibers(0), theMaterials(0), matData(0), homogeneous(-1),
   QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0), e(4), s(0), ks(0), theTorsion(0)
 {
   s = new Vector(sData, 4);
@@ -331,6 +349,7 @@ FiberSection3d::addFiber(Fiber &newFiber)
   }
 
   numFibers++;
+  homogeneous = -1;
 
   // Recompute centroid
   Abar  += Area;
@@ -388,10 +407,13 @@ FiberSection3d::setTrialSectionDeformation (const Vector &deforms)
   double d2 = deforms(2);
   double d3 = deforms(3);
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
- 
+  double *yLocs = getFiberWork(6*numFibers);
+  double *zLocs = &yLocs[numFibers];
+  double *fiberArea = &yLocs[2*numFibers];
+  double *strain = &yLocs[3*numFibers];
+  double *stress = &yLocs[4*numFibers];
+  double *tangent = &yLocs[5*numFibers];
+
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
     sectionIntegr->getFiberWeights(numFibers, fiberArea);
@@ -406,18 +428,27 @@ FiberSection3d::setTrialSectionDeformation (const Vector &deforms)
     }
   }
  
-  double tangent, stress;
+  // determine the material strains
+  for (int i = 0; i < numFibers; i++)
+    strain[i] = d0 - (yLocs[i] - yBar)*d1 + (zLocs[i] - zBar)*d2;
+
+  // set the fiber strains, with a single call when the fibers are all
+  // of one material type
+  if (homogeneous == -1)
+    this->setHomogeneous();
+
+  if (homogeneous == 1)
+    res = theMaterials[0]->setTrialStrains(numFibers, theMaterials, strain, 0, stress, tangent);
+  else
+    for (int i = 0; i < numFibers; i++)
+      res += theMaterials[i]->setTrial(strain[i], stress[i], tangent[i]);
+
   for (int i = 0; i < numFibers; i++) {
-    UniaxialMaterial *theMat = theMaterials[i];
     double y = yLocs[i] - yBar;
     double z = zLocs[i] - zBar;
     double A = fiberArea[i];
 
-    // determine material strain and set it
-    double strain = d0 - y*d1 + z*d2;
-    res += theMat->setTrial(strain, stress, tangent);
-
-    double value = tangent * A;
+    double value = tangent[i] * A;
     double vas1 = -y*value;
     double vas2 = z*value;
     double vas1as2 = vas1*z;
@@ -431,7 +462,7 @@ FiberSection3d::setTrialSectionDeformation (const Vector &deforms)
     
     kData[10] += vas2 * z; 
 
-    double fs0 = stress * A;
+    double fs0 = stress[i] * A;
 
     sData[0] += fs0;
     sData[1] += fs0 * -y;
@@ -442,9 +473,10 @@ FiberSection3d::setTrialSectionDeformation (const Vector &deforms)
   kData[8] = kData[2];
   kData[9] = kData[6];
  
-  res += theTorsion->setTrial(d3, stress, tangent);
-  sData[3] = stress;
-  kData[15] = tangent;
+  double stressT, tangentT;
+  res += theTorsion->setTrial(d3, stressT, tangentT);
+  sData[3] = stressT;
+  kData[15] = tangentT;
 
   return res;
 }
@@ -452,14 +484,14 @@ FiberSection3d::setTrialSectionDeformation (const Vector &deforms)
 const Matrix&
 FiberSection3d::getInitialTangent(void)
 {
-  static double kInitialData[16];
-  static Matrix kInitial(kInitialData, 4, 4);
+  static OPS_THREAD_LOCAL double kInitialData[16];
+  static OPS_THREAD_LOCAL Matrix kInitial(kInitialData, 4, 4);
   
   kInitial.Zero();
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  double *yLocs = getFiberWork(3*numFibers);
+  double *zLocs = &yLocs[numFibers];
+  double *fiberArea = &yLocs[2*numFibers];
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
@@ -505,6 +537,26 @@ FiberSection3d::getInitialTangent(void)
   return kInitial;
 }
 
+// void setHomogeneous(void);
+//	sets homogeneous to 1 if the fibers are all of one material type, so
+//	their state can be set in a single setTrialStrains() call, and to 0
+//	otherwise; it is reset to -1 whenever the fibers change.
+
+void
+FiberSection3d::setHomogeneous(void)
+{
+  homogeneous = 0;
+  if (numFibers == 0)
+    return;
+
+  int classTag = theMaterials[0]->getClassTag();
+  for (int i = 1; i < numFibers; i++)
+    if (theMaterials[i]->getClassTag() != classTag)
+      return;
+
+  homogeneous = 1;
+}
+
 const Vector&
 FiberSection3d::getSectionDeformation(void)
 {
@@ -601,6 +653,20 @@ FiberSection3d::getOrder () const
   return 4;
 }
 
+bool
+FiberSection3d::isThreadSafe(void)
+{
+  // the section scratch is held per thread, the fibers must be as well
+  for (int i = 0; i < numFibers; i++)
+    if (theMaterials[i]->isThreadSafe() == false)
+      return false;
+
+  if (theTorsion != 0 && theTorsion->isThreadSafe() == false)
+    return false;
+
+  return true;
+}
+
 int
 FiberSection3d::commitState(void)
 {
@@ -625,9 +691,9 @@ FiberSection3d::revertToLastCommit(void)
   kData[15] = 0.0;
   sData[0] = 0.0; sData[1] = 0.0;  sData[2] = 0.0; sData[3] = 0.0;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  double *yLocs = getFiberWork(3*numFibers);
+  double *zLocs = &yLocs[numFibers];
+  double *fiberArea = &yLocs[2*numFibers];
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
@@ -695,9 +761,9 @@ FiberSection3d::revertToStart(void)
   kData[15] = 0.0; 
   sData[0] = 0.0; sData[1] = 0.0;  sData[2] = 0.0; sData[3] = 0.0;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  double *yLocs = getFiberWork(3*numFibers);
+  double *zLocs = &yLocs[numFibers];
+  double *fiberArea = &yLocs[2*numFibers];
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
@@ -899,6 +965,8 @@ FiberSection3d::recvSelf(int commitTag, Channel &theChannel,
      return res;
     }    
     
+    homogeneous = -1;
+    
     int i;
     for (i=0; i<numFibers; i++) {
       int classTag = materialData(2*i);
@@ -69,6 +69,7 @@ class FiberSection3d : public SectionForceDeformation
     SectionForceDeformation *getCopy(void);
     const ID &getType (void);
     int getOrder (void) const;
+    bool isThreadSafe(void);
     
     int sendSelf(int cTag, Channel &theChannel);
     int recvSelf(int cTag, Channel &theChannel, 
@@ -99,6 +100,7 @@ class FiberSection3d : public SectionForceDeformation
     int numFibers, sizeFibers;       // number of fibers in the section
     UniaxialMaterial **theMaterials; // array of pointers to materials
     double   *matData;               // data for the materials [yloc and area]
+    int homogeneous;                 // fibers all of one material type (-1 if not yet known)
     double   kData[16];               // data for ks matrix 
     double   sData[4];               // data for s vector 
 
@@ -110,6 +112,8 @@ class FiberSection3d : public SectionForceDeformation
 
     static ID code;
 
+    void setHomogeneous(void);
+
     Vector e;          // trial section deformations 
     Vector *s;         // section resisting forces  (axial force, bending moment)
     Matrix *ks;        // section stiffness
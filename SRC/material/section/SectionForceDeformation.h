@@ -74,6 +74,8 @@ class SectionForceDeformation : public Material
   virtual const Matrix &getInitialFlexibility (void);
   
   virtual double getRho(void);
+  virtual bool isTangentConstant(void) {return false;}
+  virtual bool isThreadSafe(void) {return false;}
   
   virtual int commitState (void) = 0;
   virtual int revertToLastCommit (void) = 0;
@@ -383,6 +383,26 @@ void Concrete01::unload ()
   }
 }
 
+int Concrete01::setTrialStrains (int numMat, UniaxialMaterial **theMats, const double *strains,
+			     const double *strainRates, double *stresses, double *tangents)
+{
+   // derived classes may change the state determination
+   if (this->getClassTag() != MAT_TAG_Concrete01)
+      return this->UniaxialMaterial::setTrialStrains(numMat, theMats, strains, strainRates, stresses, tangents);
+
+   int res = 0;
+   for (int i = 0; i < numMat; i++) {
+      Concrete01 *theMat = (Concrete01 *)theMats[i];
+      res += theMat->Concrete01::setTrialStrain(strains[i]); // rate independent
+      if (stresses != 0) {
+         stresses[i] = theMat->Tstress;
+         tangents[i] = theMat->Ttangent;
+      }
+   }
+
+   return res;
+}
+
 double Concrete01::getStress ()
 {
    return Tstress;
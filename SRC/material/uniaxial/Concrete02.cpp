@@ -238,6 +238,27 @@ Concrete02::getStrain(void)
   return eps;
 }
 
+int
+Concrete02::setTrialStrains(int numMat, UniaxialMaterial **theMats, const double *strains,
+			const double *strainRates, double *stresses, double *tangents)
+{
+  // derived classes may change the state determination
+  if (this->getClassTag() != MAT_TAG_Concrete02)
+    return this->UniaxialMaterial::setTrialStrains(numMat, theMats, strains, strainRates, stresses, tangents);
+
+  int res = 0;
+  for (int i = 0; i < numMat; i++) {
+    Concrete02 *theMat = (Concrete02 *)theMats[i];
+    res += theMat->Concrete02::setTrialStrain(strains[i]); // rate independent
+    if (stresses != 0) {
+      stresses[i] = theMat->sig;
+      tangents[i] = theMat->e;
+    }
+  }
+
+  return res;
+}
+
 double 
 Concrete02::getStress(void)
 {
@@ -55,8 +55,11 @@ class Concrete02 : public UniaxialMaterial
     const char *getClassType(void) const {return "Concrete02";};    
     double getInitialTangent(void);
     UniaxialMaterial *getCopy(void);
+    bool isThreadSafe(void) {return true;}
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
+    int setTrialStrains(int numMat, UniaxialMaterial **theMats, const double *strains,
+			const double *strainRates, double *stresses, double *tangents);
     double getStrain(void);      
     double getStress(void);
     double getTangent(void);
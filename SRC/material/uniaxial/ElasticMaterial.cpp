@@ -107,6 +107,32 @@ ElasticMaterial::setTrial(double strain, double &stress, double &tangent, double
 }
 
 
+int 
+ElasticMaterial::setTrialStrains(int numMat, UniaxialMaterial **theMats, const double *strains,
+				 const double *strainRates, double *stresses, double *tangents)
+{
+    // derived classes may change the state determination
+    if (this->getClassTag() != MAT_TAG_ElasticMaterial)
+        return this->UniaxialMaterial::setTrialStrains(numMat, theMats, strains, strainRates, stresses, tangents);
+
+    for (int i=0; i<numMat; i++) {
+        ElasticMaterial *theMat = (ElasticMaterial *)theMats[i];
+        double strain = strains[i];
+        double strainRate = (strainRates != 0) ? strainRates[i] : 0.0;
+        theMat->trialStrain     = strain;
+        theMat->trialStrainRate = strainRate;
+
+        if (stresses != 0) {
+            double E = (strain >= 0.0) ? theMat->Epos : theMat->Eneg;
+            stresses[i] = E*strain + theMat->eta*strainRate;
+            tangents[i] = E;
+        }
+    }
+
+    return 0;
+}
+
+
 double 
 ElasticMaterial::getStress(void)
 {
@@ -50,12 +50,16 @@ class ElasticMaterial : public UniaxialMaterial
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
     int setTrial(double strain, double &stress, double &tangent, double strainRate = 0.0); 
+    int setTrialStrains(int numMat, UniaxialMaterial **theMats, const double *strains,
+			const double *strainRates, double *stresses, double *tangents);
     double getStrain(void) {return trialStrain;};
     double getStrainRate(void) {return trialStrainRate;};
     double getStress(void);
     double getTangent(void);
     double getDampTangent(void) {return eta;};
     double getInitialTangent(void);
+    bool isTangentConstant(void) {return Epos == Eneg;}
+    bool isThreadSafe(void) {return true;}
 
     int commitState(void);
     int revertToLastCommit(void);    
@@ -137,7 +137,7 @@ ParallelMaterial::ParallelMaterial(
 				 Vector *factors)
 :UniaxialMaterial(tag, MAT_TAG_ParallelMaterial),
  trialStrain(0.0), trialStrainRate(0.0), numMaterials(num),
- theModels(0), theFactors(0)
+ theModels(0), theFactors(0), homogeneous(-1), work(0)
 {
     // create an array (theModels) to store copies of the MaterialModels
     theModels = new UniaxialMaterial *[num];
@@ -168,7 +168,7 @@ ParallelMaterial::ParallelMaterial(
 ParallelMaterial::ParallelMaterial()
 :UniaxialMaterial(0,MAT_TAG_ParallelMaterial),
  trialStrain(0.0), trialStrainRate(0.0), numMaterials(0),
- theModels(0), theFactors(0)
+ theModels(0), theFactors(0), homogeneous(-1), work(0)
 {
 
 }
@@ -187,6 +187,9 @@ ParallelMaterial::~ParallelMaterial()
     // clean up the factors
     if (theFactors != 0)
         delete theFactors;
+
+    if (work != 0)
+        delete [] work;
 }
 
 
@@ -206,6 +209,59 @@ ParallelMaterial::setTrialStrain(double strain, double strainRate)
 }
 
 
+int 
+ParallelMaterial::setTrial(double strain, double &stress, double &tangent, double strainRate)
+{
+    trialStrain = strain;
+    trialStrainRate = strainRate;
+
+    if (work == 0)
+      work = new double[4*numMaterials];
+    double *strains = work;
+    double *strainRates = &work[numMaterials];
+    double *stresses = &work[2*numMaterials];
+    double *tangents = &work[3*numMaterials];
+
+    for (int i=0; i<numMaterials; i++) {
+      strains[i] = strain;
+      strainRates[i] = strainRate;
+    }
+
+    // set the local MaterialModel objects, in one call if they are all
+    // of the same type
+    if (homogeneous == -1) {
+      homogeneous = 1;
+      for (int i=1; i<numMaterials; i++)
+	if (theModels[i]->getClassTag() != theModels[0]->getClassTag())
+	  homogeneous = 0;
+    }
+
+    int res = 0;
+    if (homogeneous == 1 && numMaterials > 0)
+      res = theModels[0]->setTrialStrains(numMaterials, theModels, strains, strainRates, stresses, tangents);
+    else
+      for (int i=0; i<numMaterials; i++)
+	res += theModels[i]->setTrial(strain, stresses[i], tangents[i], strainRate);
+
+    // stress and tangent are the (factored) sums of the local ones
+    stress = 0.0;
+    tangent = 0.0;
+    if (theFactors == 0) {
+        for (int i=0; i<numMaterials; i++) {
+            stress += stresses[i];
+            tangent += tangents[i];
+        }
+    } else {
+        for (int i=0; i<numMaterials; i++) {
+            stress += (*theFactors)(i) * stresses[i];
+            tangent += (*theFactors)(i) * tangents[i];
+        }
+    }
+
+    return res;
+}
+
+
 double 
 ParallelMaterial::getStrain(void)
 {
@@ -417,6 +473,7 @@ ParallelMaterial::recvSelf(int cTag, Channel &theChannel,
     }
 
     this->setTag(int(data(0)));
+    homogeneous = -1;
     int numMaterialsSent = int(data(1));
     if (numMaterials != numMaterialsSent) { 
       numMaterials = numMaterialsSent;
@@ -427,6 +484,10 @@ ParallelMaterial::recvSelf(int cTag, Channel &theChannel,
 	delete [] theModels;
       }
 
+      if (work != 0)
+	delete [] work;
+      work = 0;
+
       theModels = new UniaxialMaterial *[numMaterials];      
       if (theModels == 0) {
 	opserr << "FATAL ParallelMaterial::recvSelf() - ran out of memory";
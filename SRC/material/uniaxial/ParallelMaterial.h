@@ -49,6 +49,7 @@ class ParallelMaterial : public UniaxialMaterial
     const char *getClassType(void) const {return "ParallelMaterial";};
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
+    int setTrial(double strain, double &stress, double &tangent, double strainRate = 0.0); 
     double getStrain(void);          
     double getStrainRate(void);
     double getStress(void);
@@ -80,6 +81,8 @@ class ParallelMaterial : public UniaxialMaterial
     int numMaterials;   // the number of UniaxialMaterials in the aggregation
     UniaxialMaterial **theModels; // an array of pointers to the UniaxialMaterials
     Vector *theFactors;  // vector with material factors
+    int homogeneous;     // materials all of one type (-1 if not yet known)
+    double *work;        // strains, strain rates, stresses and tangents of the materials
 };
 
 #endif
@@ -277,6 +277,26 @@ double Steel01::getStrain ()
    return Tstrain;
 }
 
+int Steel01::setTrialStrains (int numMat, UniaxialMaterial **theMats, const double *strains,
+			     const double *strainRates, double *stresses, double *tangents)
+{
+   // derived classes may change the state determination
+   if (this->getClassTag() != MAT_TAG_Steel01)
+      return this->UniaxialMaterial::setTrialStrains(numMat, theMats, strains, strainRates, stresses, tangents);
+
+   int res = 0;
+   for (int i = 0; i < numMat; i++) {
+      Steel01 *theMat = (Steel01 *)theMats[i];
+      res += theMat->Steel01::setTrialStrain(strains[i]); // rate independent
+      if (stresses != 0) {
+         stresses[i] = theMat->Tstress;
+         tangents[i] = theMat->Ttangent;
+      }
+   }
+
+   return res;
+}
+
 double Steel01::getStress ()
 {
    return Tstress;
@@ -58,6 +58,8 @@ class Steel01 : public UniaxialMaterial
     const char *getClassType(void) const {return "Steel01";};
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
+    int setTrialStrains(int numMat, UniaxialMaterial **theMats, const double *strains,
+    		    const double *strainRates, double *stresses, double *tangents);
     int setTrial (double strain, double &stress, double &tangent, double strainRate = 0.0);
     double getStrain(void);              
     double getStress(void);
@@ -69,6 +71,7 @@ class Steel01 : public UniaxialMaterial
     int revertToStart(void);        
 
     UniaxialMaterial *getCopy(void);
+    bool isThreadSafe(void) {return true;}
     
     int sendSelf(int commitTag, Channel &theChannel);  
     int recvSelf(int commitTag, Channel &theChannel, 
@@ -302,6 +302,27 @@ Steel02::getStrain(void)
   return eps;
 }
 
+int
+Steel02::setTrialStrains(int numMat, UniaxialMaterial **theMats, const double *strains,
+			const double *strainRates, double *stresses, double *tangents)
+{
+  // derived classes may change the state determination
+  if (this->getClassTag() != MAT_TAG_Steel02)
+    return this->UniaxialMaterial::setTrialStrains(numMat, theMats, strains, strainRates, stresses, tangents);
+
+  int res = 0;
+  for (int i = 0; i < numMat; i++) {
+    Steel02 *theMat = (Steel02 *)theMats[i];
+    res += theMat->Steel02::setTrialStrain(strains[i]); // rate independent
+    if (stresses != 0) {
+      stresses[i] = theMat->sig;
+      tangents[i] = theMat->e;
+    }
+  }
+
+  return res;
+}
+
 double 
 Steel02::getStress(void)
 {
@@ -66,8 +66,11 @@ class Steel02 : public UniaxialMaterial
 
     double getInitialTangent(void);
     UniaxialMaterial *getCopy(void);
+    bool isThreadSafe(void) {return true;}
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
+    int setTrialStrains(int numMat, UniaxialMaterial **theMats, const double *strains,
+			const double *strainRates, double *stresses, double *tangents);
     double getStrain(void);      
     double getStress(void);
     double getTangent(void);
@@ -103,6 +103,38 @@ UniaxialMaterial::setTrial(double strain, double &stress, double &tangent, doubl
 }
 
 
+// int setTrialStrains(int numMat, UniaxialMaterial **theMats, const double *strains,
+//                     const double *strainRates, double *stresses, double *tangents);
+//	sets the trial strain (and strain rate, zero if strainRates is 0) of 
+//	numMat materials, all of the same class as this one, and returns 
+//	their stresses and tangents; classes can override this to set the 
+//	state of all the materials in one loop rather than through a virtual
+//	call for each. If stresses and tangents are 0 only the state is set,
+//	with the one setTrialStrain() call per material of the caller's own loop.
+
+int
+UniaxialMaterial::setTrialStrains(int numMat, UniaxialMaterial **theMats, const double *strains,
+				  const double *strainRates, double *stresses, double *tangents)
+{
+  int res = 0;
+  if (stresses == 0) {
+    for (int i = 0; i < numMat; i++)
+      res += theMats[i]->setTrialStrain(strains[i], (strainRates != 0) ? strainRates[i] : 0.0);
+    return res;
+  }
+
+  if (strainRates == 0) {
+    for (int i = 0; i < numMat; i++)
+      res += theMats[i]->setTrial(strains[i], stresses[i], tangents[i]);
+  } else {
+    for (int i = 0; i < numMat; i++)
+      res += theMats[i]->setTrial(strains[i], stresses[i], tangents[i], strainRates[i]);
+  }
+
+  return res;
+}
+
+
 int
 UniaxialMaterial::setTrial(double strain, double temperature, double &stress, double &tangent, double &thermalElongation, double strainRate)
 {
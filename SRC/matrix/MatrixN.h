@@ -0,0 +1,212 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the class definition for MatrixN.
+// MatrixN<NR,NC> is a matrix whose size is known at compile time, stored
+// by columns in the object itself like the data of a Matrix. Declared in
+// a function or as a member of an element it needs no memory allocation,
+// operator() does no bounds checks (unless _G3DEBUG is defined) and the 
+// products used by the element kernels (A*B, A'*B, T'*B*T) are formed in
+// loops with constant bounds, the inner loops running down contiguous 
+// columns so the compiler unrolls and vectorizes them for the common 
+// sizes (3, 6 and 12). A Matrix can be set to view the MatrixN data 
+// without a copy, e.g. for the return value of getTangentStiff():
+//	MatrixN<12,12> theMatrixN;
+//	Matrix theMatrix(theMatrixN.getData(), 12, 12);
+//
+// What: "@(#) MatrixN.h, revA"
+
+#ifndef MatrixN_h
+#define MatrixN_h
+
+#include <Matrix.h>
+#include <VectorN.h>
+
+template <int NR, int NC>
+class MatrixN
+{
+  public:
+    MatrixN() {this->Zero();}
+    explicit MatrixN(const Matrix &M) {*this = M;}
+
+    // utility methods
+    int noRows(void) const {return NR;}
+    int noCols(void) const {return NC;}
+    void Zero(void) {for (int i=0; i<NR*NC; i++) values[i] = 0.0;}
+    double *getData(void) {return values;}
+    const double *getData(void) const {return values;}
+
+    inline double &operator()(int row, int col);
+    inline double operator()(int row, int col) const;
+
+    // copies to and from a Matrix of the same size
+    MatrixN<NR,NC> &operator=(const Matrix &M);
+    int copyTo(Matrix &M) const;
+
+    // this = thisFact*this + otherFact*(other), (A*B), (A'*B) and (T'*B*T)
+    void addMatrix(double thisFact, const MatrixN<NR,NC> &other, double otherFact);
+    template <int K>
+    void addMatrixProduct(double thisFact, const MatrixN<NR,K> &A, 
+			  const MatrixN<K,NC> &B, double otherFact);
+    template <int K>
+    void addMatrixTransposeProduct(double thisFact, const MatrixN<K,NR> &A, 
+				   const MatrixN<K,NC> &B, double otherFact);
+    template <int K>
+    void addMatrixTripleProduct(double thisFact, const MatrixN<K,NR> &T, 
+				const MatrixN<K,K> &B, double otherFact);
+
+    MatrixN<NR,NC> &operator*=(double fact) {
+	for (int i=0; i<NR*NC; i++) values[i] *= fact;
+	return *this;
+    }
+
+  private:
+    double values[NR*NC];
+};
+
+template <int NR, int NC> inline double &
+MatrixN<NR,NC>::operator()(int row, int col)
+{
+#ifdef _G3DEBUG
+  if (row < 0 || row >= NR || col < 0 || col >= NC) {
+    opserr << "MatrixN::operator() - (" << row << "," << col << ") outside ";
+    opserr << NR << "x" << NC << " matrix\n";
+    return values[0];
+  }
+#endif
+  return values[col*NR + row];
+}
+
+template <int NR, int NC> inline double
+MatrixN<NR,NC>::operator()(int row, int col) const
+{
+#ifdef _G3DEBUG
+  if (row < 0 || row >= NR || col < 0 || col >= NC) {
+    opserr << "MatrixN::operator() - (" << row << "," << col << ") outside ";
+    opserr << NR << "x" << NC << " matrix\n";
+    return values[0];
+  }
+#endif
+  return values[col*NR + row];
+}
+
+template <int NR, int NC> MatrixN<NR,NC> &
+MatrixN<NR,NC>::operator=(const Matrix &M)
+{
+  if (M.noRows() != NR || M.noCols() != NC) {
+    opserr << "MatrixN::operator=() - Matrix of size " << M.noRows() << "x" << M.noCols();
+    opserr << " not of size " << NR << "x" << NC << endln;
+    return *this;
+  }
+
+  for (int j=0; j<NC; j++)
+    for (int i=0; i<NR; i++)
+      values[j*NR + i] = M(i,j);
+
+  return *this;
+}
+
+template <int NR, int NC> int
+MatrixN<NR,NC>::copyTo(Matrix &M) const
+{
+  if (M.noRows() != NR || M.noCols() != NC) {
+    opserr << "MatrixN::copyTo() - Matrix of size " << M.noRows() << "x" << M.noCols();
+    opserr << " not of size " << NR << "x" << NC << endln;
+    return -1;
+  }
+
+  for (int j=0; j<NC; j++)
+    for (int i=0; i<NR; i++)
+      M(i,j) = values[j*NR + i];
+
+  return 0;
+}
+
+template <int NR, int NC> void
+MatrixN<NR,NC>::addMatrix(double thisFact, const MatrixN<NR,NC> &other, double otherFact)
+{
+  if (thisFact == 1.0)
+    for (int i=0; i<NR*NC; i++)
+      values[i] += otherFact*other.values[i];
+  else
+    for (int i=0; i<NR*NC; i++)
+      values[i] = thisFact*values[i] + otherFact*other.values[i];
+}
+
+template <int NR, int NC> template <int K> void
+MatrixN<NR,NC>::addMatrixProduct(double thisFact, const MatrixN<NR,K> &A, 
+				 const MatrixN<K,NC> &B, double otherFact)
+{
+  if (thisFact == 0.0)
+    this->Zero();
+  else if (thisFact != 1.0)
+    *this *= thisFact;
+
+  // column j of this += A * column j of B
+  const double *aData = A.getData();
+  const double *bData = B.getData();
+  for (int j=0; j<NC; j++) {
+    double *thisCol = &values[j*NR];
+    for (int k=0; k<K; k++) {
+      double bkj = otherFact*bData[j*K + k];
+      const double *aCol = &aData[k*NR];
+      for (int i=0; i<NR; i++)
+	thisCol[i] += aCol[i]*bkj;
+    }
+  }
+}
+
+template <int NR, int NC> template <int K> void
+MatrixN<NR,NC>::addMatrixTransposeProduct(double thisFact, const MatrixN<K,NR> &A, 
+					  const MatrixN<K,NC> &B, double otherFact)
+{
+  // each term is the dot product of a column of A with a column of B
+  const double *aData = A.getData();
+  const double *bData = B.getData();
+  for (int j=0; j<NC; j++) {
+    const double *bCol = &bData[j*K];
+    for (int i=0; i<NR; i++) {
+      const double *aCol = &aData[i*K];
+      double sum = 0.0;
+      for (int k=0; k<K; k++)
+	sum += aCol[k]*bCol[k];
+      double &value = values[j*NR + i];
+      value = (thisFact == 0.0) ? otherFact*sum : thisFact*value + otherFact*sum;
+    }
+  }
+}
+
+template <int NR, int NC> template <int K> void
+MatrixN<NR,NC>::addMatrixTripleProduct(double thisFact, const MatrixN<K,NR> &T, 
+				       const MatrixN<K,K> &B, double otherFact)
+{
+  static_assert(NR == NC, "MatrixN::addMatrixTripleProduct() - T'BT is square");
+
+  // BT = B*T on the stack, then this = thisFact*this + otherFact*T'*BT
+  MatrixN<K,NC> BT;
+  BT.addMatrixProduct(0.0, B, T, 1.0);
+  this->addMatrixTransposeProduct(thisFact, T, BT, otherFact);
+}
+
+#endif
@@ -0,0 +1,196 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the class definition for VectorN.
+// VectorN<N> is a vector whose size is known at compile time. The data is
+// stored in the object itself, so a VectorN declared in a function or as a
+// member of an element needs no memory allocation, and the loops of its
+// methods have constant bounds that the compiler unrolls and vectorizes.
+// It is meant for the small fixed size computations of the element 
+// kernels; where a Vector is needed, e.g. for the return value of an 
+// element method, a Vector can be set to view the VectorN data without 
+// a copy:
+//	VectorN<12> theVectorN;
+//	Vector theVector(theVectorN.getData(), 12);
+//
+// What: "@(#) VectorN.h, revA"
+
+#ifndef VectorN_h
+#define VectorN_h
+
+#include <Vector.h>
+#include <math.h>
+
+template <int NR, int NC> class MatrixN;
+
+template <int N>
+class VectorN
+{
+  public:
+    VectorN() {this->Zero();}
+    explicit VectorN(const Vector &V) {*this = V;}
+
+    // utility methods
+    int Size(void) const {return N;}
+    void Zero(void) {for (int i=0; i<N; i++) values[i] = 0.0;}
+    double *getData(void) {return values;}
+    const double *getData(void) const {return values;}
+    double Norm(void) const {return sqrt((*this)^(*this));}
+
+    inline double &operator()(int x);
+    inline double operator()(int x) const;
+
+    // copies to and from a Vector of the same size
+    VectorN<N> &operator=(const Vector &V);
+    int copyTo(Vector &V) const;
+
+    // this = thisFact*this + otherFact*(other), (m*v) and (m'*v)
+    void addVector(double thisFact, const VectorN<N> &other, double otherFact);
+    template <int M>
+    void addMatrixVector(double thisFact, const MatrixN<N,M> &m, 
+			 const VectorN<M> &v, double otherFact);
+    template <int M>
+    void addMatrixTransposeVector(double thisFact, const MatrixN<M,N> &m, 
+				  const VectorN<M> &v, double otherFact);
+
+    VectorN<N> &operator*=(double fact) {
+	for (int i=0; i<N; i++) values[i] *= fact; 
+	return *this;
+    }
+
+    // dot product
+    double operator^(const VectorN<N> &V) const;
+
+  private:
+    double values[N];
+};
+
+template <int N> inline double &
+VectorN<N>::operator()(int x)
+{
+#ifdef _G3DEBUG
+  if (x < 0 || x >= N) {
+    opserr << "VectorN::(loc) - loc " << x << " outside range [0, " << N-1 << endln;
+    return values[0];
+  }
+#endif
+  return values[x];
+}
+
+template <int N> inline double
+VectorN<N>::operator()(int x) const
+{
+#ifdef _G3DEBUG
+  if (x < 0 || x >= N) {
+    opserr << "VectorN::(loc) - loc " << x << " outside range [0, " << N-1 << endln;
+    return values[0];
+  }
+#endif
+  return values[x];
+}
+
+template <int N> VectorN<N> &
+VectorN<N>::operator=(const Vector &V)
+{
+  if (V.Size() != N) {
+    opserr << "VectorN::operator=() - Vector of size " << V.Size() << " not of size " << N << endln;
+    return *this;
+  }
+
+  for (int i=0; i<N; i++)
+    values[i] = V(i);
+
+  return *this;
+}
+
+template <int N> int
+VectorN<N>::copyTo(Vector &V) const
+{
+  if (V.Size() != N) {
+    opserr << "VectorN::copyTo() - Vector of size " << V.Size() << " not of size " << N << endln;
+    return -1;
+  }
+
+  for (int i=0; i<N; i++)
+    V(i) = values[i];
+
+  return 0;
+}
+
+template <int N> void
+VectorN<N>::addVector(double thisFact, const VectorN<N> &other, double otherFact)
+{
+  if (thisFact == 1.0)
+    for (int i=0; i<N; i++)
+      values[i] += otherFact*other.values[i];
+  else
+    for (int i=0; i<N; i++)
+      values[i] = thisFact*values[i] + otherFact*other.values[i];
+}
+
+template <int N> template <int M> void
+VectorN<N>::addMatrixVector(double thisFact, const MatrixN<N,M> &m, 
+			    const VectorN<M> &v, double otherFact)
+{
+  if (thisFact == 0.0)
+    this->Zero();
+  else if (thisFact != 1.0)
+    *this *= thisFact;
+
+  // column by column, the inner loop running down a column of m
+  const double *mPtr = m.getData();
+  for (int j=0; j<M; j++) {
+    double vj = otherFact*v(j);
+    for (int i=0; i<N; i++)
+      values[i] += mPtr[i]*vj;
+    mPtr += N;
+  }
+}
+
+template <int N> template <int M> void
+VectorN<N>::addMatrixTransposeVector(double thisFact, const MatrixN<M,N> &m, 
+				     const VectorN<M> &v, double otherFact)
+{
+  // each term is the dot product of a column of m with v
+  const double *mPtr = m.getData();
+  for (int i=0; i<N; i++) {
+    double sum = 0.0;
+    for (int j=0; j<M; j++)
+      sum += mPtr[j]*v(j);
+    values[i] = (thisFact == 0.0) ? otherFact*sum : thisFact*values[i] + otherFact*sum;
+    mPtr += M;
+  }
+}
+
+template <int N> double
+VectorN<N>::operator^(const VectorN<N> &V) const
+{
+  double sum = 0.0;
+  for (int i=0; i<N; i++)
+    sum += values[i]*V.values[i];
+
+  return sum;
+}
+
+#endif
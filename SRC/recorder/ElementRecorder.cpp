@@ -179,8 +179,11 @@ ElementRecorder::record(int commitTag, double timeStamp)
 	  Information &eleInfo = theResponses[i]->getInformation();
 	  const Vector &eleData = eleInfo.getData();
 	  if (numDOF == 0) {
-	    for (int j=0; j<eleData.Size(); j++)
-	      (*data)(loc++) = eleData(j);
+	    if (eleInfo.theVectorView == true)
+	      loc += eleData.Size(); // written straight into data
+	    else
+	      for (int j=0; j<eleData.Size(); j++)
+		(*data)(loc++) = eleData(j);
 	  } else {
 	    int dataSize = data->Size();
 	    for (int j=0; j<numDOF; j++) {
@@ -673,6 +676,22 @@ ElementRecorder::initialize(void)
     opserr << "ElementRecorder::initialize() - out of memory\n";
     return -1;
   }
+
+  //
+  // if whole responses are recorded, have each written straight into its
+  // columns of data instead of into its own Information & then copied
+  //
+
+  if (numDOF == 0) {
+    int loc = (echoTimeFlag == true) ? 1 : 0;
+    for (int i=0; i<numEle; i++) {
+      if (theResponses[i] != 0) {
+	int dataSize = theResponses[i]->getInformation().getData().Size();
+	theResponses[i]->setStorage(&(*data)(loc), dataSize);
+	loc += dataSize;
+      }
+    }
+  }
   
   theOutputHandler->tag("Data");
   initializationDone = true;
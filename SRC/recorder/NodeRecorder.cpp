@@ -957,6 +957,21 @@ NodeRecorder::initialize(void)
     theOutputHandler->setOrder(orderResponse);
   }
 
+  // describe the columns, the node and response of each
+  for (int i=0; i<numValidNodes; i++) {
+    int nodeTag = theNodes[i]->getTag();
+    theOutputHandler->tag("NodeOutput");
+    theOutputHandler->attr("nodeTag", nodeTag);
+    if (dataFlag == 10000)
+      theOutputHandler->tag("ResponseType", dataType);
+    else
+      for (int j=0; j<numDOF; j++) {
+	sprintf(outputData, "%s%d", dataType, (*theDofs)(j)+1);
+	theOutputHandler->tag("ResponseType", outputData);
+      }
+    theOutputHandler->endTag();
+  }
+
   //theOutputHandler->tag("Data");
   initializationDone = true;
 
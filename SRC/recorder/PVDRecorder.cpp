@@ -36,6 +36,7 @@
 #include <classTags.h>
 #include <NodeIter.h>
 #include <BackgroundMesh.h>
+#include <AsyncStream.h>
 
 extern BackgroundMesh& OPS_GetBackgroundMesh();
 
@@ -58,6 +59,7 @@ void* OPS_PVDRecorder()
     numdata = OPS_GetNumRemainingInputArgs();
     int indent=2;
     int precision = 10;
+    bool async = false;
     PVDRecorder::NodeData nodedata;
     std::vector<PVDRecorder::EleData> eledata;
     while(numdata > 0) {
@@ -94,6 +96,8 @@ void* OPS_PVDRecorder()
 	    }
 	    numdata = 1;
 	    if(OPS_GetIntInput(&numdata,&precision) < 0) return 0;
+	} else if(type=="-async") {
+	    async = true;
 	} else if(type=="eleResponse") {
 	    numdata = OPS_GetNumRemainingInputArgs();
 	    if(numdata < 1) {
@@ -112,20 +116,29 @@ void* OPS_PVDRecorder()
     }
 
     // create recorder
-    return new PVDRecorder(name,nodedata,eledata,indent,precision);
+    return new PVDRecorder(name,nodedata,eledata,indent,precision,async);
 }
 
 PVDRecorder::PVDRecorder(const char *name, const NodeData& ndata,
-			 const std::vector<EleData>& edata, int ind, int pre)
+			 const std::vector<EleData>& edata, int ind, int pre,
+			 bool async)
     :Recorder(RECORDER_TAGS_PVDRecorder), indentsize(ind), precision(pre),
      indentlevel(0), filename(name),
-     timestep(), timeparts(), theFile(), quota('\"'), parts(),
+     timestep(), timeparts(), theFile(), theFileName(), theWriter(0),
+     quota('\"'), parts(),
      nodedata(ndata), eledata(edata), theDomain(0), partnum()
 {
+    // the files are formatted in memory during record(); if async they
+    // are written to disk by the AsyncStream writer threads
+    if (async)
+	theWriter = new AsyncStream(0, 16);
 }
 
 PVDRecorder::~PVDRecorder()
 {
+    // writes out any files still queued
+    if (theWriter != 0)
+	delete theWriter;
 }
 
 int
@@ -168,16 +181,9 @@ int
 PVDRecorder::pvd()
 {
     // open pvd file
-    theFile.close();
     std::string pvdname = filename+".pvd";
-
-    theFile.open(pvdname.c_str(), std::ios::trunc|std::ios::out);
-    if(theFile.fail()) {
-	opserr<<"WARNING: Failed to open file "<<pvdname.c_str()<<"\n";
+    if (this->openFile(pvdname) < 0)
 	return -1;
-    }
-    theFile.precision(precision);
-    theFile << std::scientific;
 
     // header
     theFile<<"<?xml version="<<quota<<"1.0"<<quota<<"?>\n";
@@ -216,7 +222,8 @@ PVDRecorder::pvd()
     this->indent();
     theFile<<"</VTKFile>\n";
 
-    theFile.close();
+    if (this->closeFile() < 0)
+	return -1;
 
     return 0;
 }
@@ -311,15 +318,9 @@ PVDRecorder::savePart0(int nodendf)
     ss >> spart >> stime;
     
     // open file
-    theFile.close();
     std::string vtuname = filename+'/'+filename+"_T"+stime+"_P"+spart+".vtu";
-    theFile.open(vtuname.c_str(), std::ios::trunc|std::ios::out);
-    if(theFile.fail()) {
-	opserr<<"WARNING: Failed to open file "<<vtuname.c_str()<<"\n";
+    if (this->openFile(vtuname) < 0)
 	return -1;
-    }
-    theFile.precision(precision);
-    theFile << std::scientific;
 
     // header
     theFile<<"<VTKFile type="<<quota<<"UnstructuredGrid"<<quota;
@@ -727,7 +728,8 @@ PVDRecorder::savePart0(int nodendf)
     this->indent();
     theFile<<"</VTKFile>\n";
 
-    theFile.close();
+    if (this->closeFile() < 0)
+	return -1;
 
     return 0;
 }
@@ -749,15 +751,9 @@ PVDRecorder::savePartParticle(int nodendf)
     ss >> spart >> stime;
     
     // open file
-    theFile.close();
     std::string vtuname = filename+'/'+filename+"_T"+stime+"_P"+spart+".vtu";
-    theFile.open(vtuname.c_str(), std::ios::trunc|std::ios::out);
-    if(theFile.fail()) {
-	opserr<<"WARNING: Failed to open file "<<vtuname.c_str()<<"\n";
+    if (this->openFile(vtuname) < 0)
 	return -1;
-    }
-    theFile.precision(precision);
-    theFile << std::scientific;
 
     // header
     theFile<<"<VTKFile type="<<quota<<"UnstructuredGrid"<<quota;
@@ -1113,7 +1109,8 @@ PVDRecorder::savePartParticle(int nodendf)
     this->indent();
     theFile<<"</VTKFile>\n";
 
-    theFile.close();
+    if (this->closeFile() < 0)
+	return -1;
 
     return 0;
 }
@@ -1135,15 +1132,9 @@ PVDRecorder::savePart(int partno, int ctag, int nodendf)
     ss >> spart >> stime;
     
     // open file
-    theFile.close();
     std::string vtuname = filename+'/'+filename+"_T"+stime+"_P"+spart+".vtu";
-    theFile.open(vtuname.c_str(), std::ios::trunc|std::ios::out);
-    if(theFile.fail()) {
-	opserr<<"WARNING: Failed to open file "<<vtuname.c_str()<<"\n";
+    if (this->openFile(vtuname) < 0)
 	return -1;
-    }
-    theFile.precision(precision);
-    theFile << std::scientific;
 
     // header
     theFile<<"<VTKFile type="<<quota<<"UnstructuredGrid"<<quota;
@@ -1627,7 +1618,42 @@ PVDRecorder::savePart(int partno, int ctag, int nodendf)
     this->indent();
     theFile<<"</VTKFile>\n";
 
-    theFile.close();
+    if (this->closeFile() < 0)
+	return -1;
+
+    return 0;
+}
+
+int
+PVDRecorder::openFile(const std::string& name)
+{
+    theFileName = name;
+    theFile.str("");
+    theFile.clear();
+    theFile.precision(precision);
+    theFile << std::scientific;
+
+    return 0;
+}
+
+int
+PVDRecorder::closeFile()
+{
+    if (theWriter != 0) {
+	if (theWriter->writeFile(theFileName.c_str(), theFile.str()) < 0) {
+	    opserr<<"WARNING: Failed to write a file queued before "<<theFileName.c_str()<<"\n";
+	    return -1;
+	}
+	return 0;
+    }
+
+    std::ofstream theOutput(theFileName.c_str(), std::ios::trunc|std::ios::out);
+    if(theOutput.fail()) {
+	opserr<<"WARNING: Failed to open file "<<theFileName.c_str()<<"\n";
+	return -1;
+    }
+    theOutput << theFile.str();
+    theOutput.close();
 
     return 0;
 }
@@ -32,6 +32,7 @@
 
 #include <string>
 #include <fstream>
+#include <sstream>
 #include <vector>
 #include <map>
 #include <ID.h>
@@ -39,6 +40,7 @@
 
 class Node;
 class Element;
+class AsyncStream;
 
 class PVDRecorder: public Recorder
 {
@@ -54,7 +56,8 @@ public:
     
 public:
     PVDRecorder(const char *filename, const NodeData& ndata,
-		const std::vector<EleData>& edata, int ind=2, int pre=10);
+		const std::vector<EleData>& edata, int ind=2, int pre=10,
+		bool async=false);
     ~PVDRecorder();
 
     int record(int commitTag, double timeStamp);
@@ -78,13 +81,17 @@ private:
     virtual int savePart(int partno, int ctag, int ndf);
     virtual int savePart0(int ndf);
     virtual int savePartParticle(int ndf);
+    int openFile(const std::string& name);
+    int closeFile();
     
 private:
     int indentsize, precision, indentlevel;
     std::string filename;
     std::vector<double> timestep;
     std::vector<ID> timeparts;
-    std::ofstream theFile;
+    std::ostringstream theFile;     // contents of the file being saved
+    std::string theFileName;
+    AsyncStream* theWriter;         // writes the files if async, else 0
     char quota;
     std::map<int,ID> parts;
     NodeData nodedata;
@@ -147,6 +147,8 @@ CompositeResponse::getResponse(void)
     if (otherType.theType == DoubleType || otherType.theType == VectorType) {
       if (otherType.theType == DoubleType)
 	(*myInfo.theVector)(currentLoc++) = otherType.theDouble;
+      else if (otherType.theVectorView == true)
+	currentLoc += otherType.theVector->Size(); // written there by the response
       else {
 	int otherSize = otherType.theVector->Size();
 	for (int i=0; i<otherSize; i++, currentLoc++) 
@@ -168,3 +170,26 @@ CompositeResponse::getResponse(void)
 }
 
 
+int
+CompositeResponse::setStorage(double *data, int size)
+{
+  if (this->Response::setStorage(data, size) != 0)
+    return -1;
+
+  //
+  // have the responses held write straight into their part of data
+  //
+
+  int currentLoc = 0;
+  for (int i=0; i<numResponses; i++) {
+    Information&otherType = theResponses[i]->getInformation();
+    int otherSize = 1;
+    if (otherType.theType == VectorType)
+      otherSize = otherType.theVector->Size();
+
+    theResponses[i]->setStorage(&data[currentLoc], otherSize);
+    currentLoc += otherSize;
+  }
+
+  return 0;
+}
@@ -28,6 +28,7 @@
 // Description: This file contains the Response class implementation
 
 #include <Response.h>
+#include <Vector.h>
 
 Response::Response(void)
  :myInfo()
@@ -93,3 +94,16 @@ Response::getInformation(void)
 {
   return myInfo;
 }
+
+int
+Response::setStorage(double *data, int size)
+{
+  InfoType theType = myInfo.theType;
+
+  if (theType == VectorType && myInfo.theVector != 0 && myInfo.theVector->Size() == size)
+    return myInfo.setStorage(data, size);
+  else if ((theType == DoubleType || theType == IntType) && size == 1)
+    return myInfo.setStorage(data, size);
+
+  return -1;
+}
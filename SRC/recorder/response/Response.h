@@ -53,6 +53,10 @@ class Response
   virtual int getResponseSensitivity(int gradNumber) {return 0;}
   virtual Information &getInformation(void);
 
+  // have the response written straight into size doubles at data, e.g. its
+  // columns of a recorder's output; returns 0 if it can be, -1 if not
+  virtual int setStorage(double *data, int size);
+
   virtual void Print(OPS_Stream &s, int flag = 0);
   virtual void Print(ofstream &s, int flag = 0);
 
@@ -43,6 +43,8 @@
 #include <Vector.h>
 #include <Matrix.h>
 #include <MatrixOperations.h>
+#include <SamplingWorkerPool.h>
+#include <ID.h>
 
 #include <math.h>
 #include <stdlib.h>
@@ -66,7 +68,8 @@ ImportanceSamplingAnalysis::ImportanceSamplingAnalysis(ReliabilityDomain *passed
 							long int passedNumberOfSimulations,
                             double passedTargetCOV, double passedSamplingStdv,
 							int passedPrintFlag, TCL_Char *passedFileName,
-							int passedAnalysisTypeTag)
+							int passedAnalysisTypeTag,
+							int passedNumWorkers)
 :ReliabilityAnalysis(), theReliabilityDomain(passedReliabilityDomain), 
 theOpenSeesDomain(passedOpenSeesDomain)
 {
@@ -80,6 +83,7 @@ theOpenSeesDomain(passedOpenSeesDomain)
 	printFlag = passedPrintFlag;
 	strcpy(fileName,passedFileName);
 	analysisTypeTag = passedAnalysisTypeTag;
+	numWorkers = passedNumWorkers;
 }
 
 
@@ -206,31 +210,39 @@ ImportanceSamplingAnalysis::analyze(void)
 	double govCov = 999.0;
 	//Vector temp1;
 	double temp2, denumerator;
-	bool FEconvergence;
 
 
 	// Prepare output file
 	ofstream resultsOutputFile( fileName, ios::out );
 
 
+	// The realizations are generated here, in the order of a serial
+	// analysis, and evaluated a batch at a time; one realization per
+	// worker process, or a single one when no workers are used
+	SamplingWorkerPool theWorkers(theReliabilityDomain, theOpenSeesDomain,
+				      theGFunEvaluator, numWorkers);
+	int batchSize = theWorkers.getNumWorkers();
+	if (batchSize < 1)
+		batchSize = 1;
+	Matrix uBatch(numRV, batchSize);
+	Matrix xBatch(numRV, batchSize);
+	Matrix gBatch(numLsf, batchSize);
+	ID statusBatch(batchSize);
+	ID seedBatch(batchSize);
+
 	bool isFirstSimulation = true;
 	while( ( k <= numberOfSimulations && govCov > targetCOV || k <= 2 ) ) {
 
-		// Keep the user posted
-		if (printFlag == 1 || printFlag == 2) {
-            sprintf(myString,"%li",k);
-			opserr << "Sample #" << myString << ":" << endln;
-		}
+	  for (int b = 0; b < batchSize; b++) {
 
-		
 		// Create array of standard normal random numbers
-		if (isFirstSimulation) {
+		if (isFirstSimulation && b == 0) {
 			result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV,seed);
 		}
 		else {
 			result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV);
 		}
-		seed = theRandomNumberGenerator->getSeed();
+		seedBatch(b) = theRandomNumberGenerator->getSeed();
 		if (result < 0) {
 			opserr << "ImportanceSamplingAnalysis::analyze() - could not generate" << endln
 				<< " random numbers for simulation." << endln;
@@ -249,34 +261,32 @@ ImportanceSamplingAnalysis::analyze(void)
 		  opserr << "ImportanceSamplingAnalysis::analyze() - could not transform u to x. " << endln;
 		  return -1;
 		}
-        
-        // update domain with new x values
-        for (int j = 0; j < numRV; j++) {
-            RandomVariable *theRV = theReliabilityDomain->getRandomVariablePtrFromIndex(j);
-            int param_indx = theReliabilityDomain->getParameterIndexFromRandomVariableIndex(j);
-            Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(param_indx);
-            
-            // now we should update the parameter value
-            theParam->update( x(j) );
-        }
-		
-        
-        // set values in the variable namespace
-        if (theGFunEvaluator->setVariables() < 0) {
-            opserr << "ImportanceSamplingAnalysis::analyze() - " << endln
-                << " could not set variables in namespace. " << endln;
-            return -1;
-        }
-        
-		// Evaluate limit-state function
-		FEconvergence = true;
-		if (theGFunEvaluator -> runAnalysis() < 0) {
-			// In this case a failure happened during the analysis
-			// Hence, register this as failure
-            opserr << "ERROR ImportanceSamplingAnalysis -- error running analysis" << endln;
-			FEconvergence = false;
+
+		for (int j = 0; j < numRV; j++) {
+			uBatch(j,b) = u(j);
+			xBatch(j,b) = x(j);
+		}
+	  }
+
+	  // update the domain with the new x values, run the analysis and
+	  // evaluate the limit-state functions
+	  if (theWorkers.evaluate(xBatch, gBatch, statusBatch) < 0) {
+		opserr << "ImportanceSamplingAnalysis::analyze() - " << endln
+			<< " could not evaluate the limit-state functions. " << endln;
+		return -1;
+	  }
+
+	  for (int b = 0; b < batchSize && ( k <= numberOfSimulations && govCov > targetCOV || k <= 2 ); b++) {
+
+		// Keep the user posted
+		if (printFlag == 1 || printFlag == 2) {
+            sprintf(myString,"%li",k);
+			opserr << "Sample #" << myString << ":" << endln;
 		}
 
+		for (int j = 0; j < numRV; j++)
+			u(j) = uBatch(j,b);
+		seed = seedBatch(b);
 
 		LimitStateFunctionIter &lsfIter = theReliabilityDomain->getLimitStateFunctions();
 		LimitStateFunction *theLimitStateFunction;
@@ -289,14 +299,8 @@ ImportanceSamplingAnalysis::analyze(void)
 			// Set tag of "active" limit-state function
 			theReliabilityDomain->setTagOfActiveLimitStateFunction(lsfTag);
 
-            // set and evaluate LSF
-            const char *lsfExpression = theLimitStateFunction->getExpression();
-            theGFunEvaluator->setExpression(lsfExpression);
-            
-            gFunctionValue = theGFunEvaluator->evaluateExpression();
-            if (!FEconvergence) {
-				gFunctionValue = -1.0;
-			}
+            // g-value of the realization
+            gFunctionValue = gBatch(lsf,b);
 
 			
 			// ESTIMATION OF FAILURE PROBABILITY
@@ -468,7 +472,7 @@ ImportanceSamplingAnalysis::analyze(void)
 		// Increment k (the simulation number counter)
 		k++;
 		isFirstSimulation = false;
-
+	  }
 	}
 
 	// Step 'k' back a step now that we went out
@@ -59,7 +59,8 @@ public:
 				   double samplingStdv,
 				   int printFlag,
 				   TCL_Char *fileName,
-				   int analysisTypeTag);
+				   int analysisTypeTag,
+				   int numWorkers = 0);
 	
 	~ImportanceSamplingAnalysis();
 	
@@ -80,6 +81,7 @@ private:
 	int printFlag;
 	char fileName[256];
 	int analysisTypeTag;
+	int numWorkers;
 };
 
 #endif
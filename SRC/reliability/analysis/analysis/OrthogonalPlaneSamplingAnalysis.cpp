@@ -296,6 +296,7 @@ int OrthogonalPlaneSamplingAnalysis::analyze(void)
 
 	bool isFirstSimulation = true;
 
+	// the samples are analyzed in turn, see SamplingAnalysis.h
 	while( (k<=numOfSimulations && cov>targetCOV || k<=2) ) {
 
 
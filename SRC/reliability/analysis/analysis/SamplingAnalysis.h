@@ -8,6 +8,15 @@
 
 #include "ReliabilityAnalysis.h"
 
+// SamplingAnalysis is the base of the sampling analyses that search each
+// sample for the limit state with a ZeroFindingAlgorithm, calling back
+// getSampledValue() (OrthogonalPlaneSamplingAnalysis). Unlike the 
+// ImportanceSamplingAnalysis these are not evaluated through a 
+// SamplingWorkerPool: each g-function evaluation of the search depends
+// on the previous one, and the number of samples follows from the cov of
+// those done so far, so there is no batch of independent realizations to
+// hand out and the samples are analyzed in turn.
+
 class SamplingAnalysis : public ReliabilityAnalysis  
 {
 public:
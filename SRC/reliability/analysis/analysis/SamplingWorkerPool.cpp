@@ -0,0 +1,423 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the implementation of SamplingWorkerPool.
+//
+// What: "@(#) SamplingWorkerPool.cpp, revA"
+
+#include <SamplingWorkerPool.h>
+#include <ReliabilityDomain.h>
+#include <LimitStateFunction.h>
+#include <FunctionEvaluator.h>
+#include <Domain.h>
+#include <Parameter.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <ID.h>
+
+#include <stdio.h>
+#include <iostream>
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+
+#ifndef _WIN32
+// read or write all of a message, pipes may transfer less at a time
+static int
+readAll(int fd, void *data, size_t numBytes)
+{
+  char *ptr = (char *)data;
+  while (numBytes > 0) {
+    ssize_t res = read(fd, ptr, numBytes);
+    if (res < 0 && errno == EINTR)
+      continue;
+    if (res <= 0)
+      return -1;
+    ptr += res;
+    numBytes -= res;
+  }
+  return 0;
+}
+
+static int
+writeAll(int fd, const void *data, size_t numBytes)
+{
+  const char *ptr = (const char *)data;
+  while (numBytes > 0) {
+    ssize_t res = write(fd, ptr, numBytes);
+    if (res < 0 && errno == EINTR)
+      continue;
+    if (res <= 0)
+      return -1;
+    ptr += res;
+    numBytes -= res;
+  }
+  return 0;
+}
+#endif
+
+SamplingWorkerPool::SamplingWorkerPool(ReliabilityDomain *passedReliabilityDomain,
+				       Domain *passedOpenSeesDomain,
+				       FunctionEvaluator *passedGFunEvaluator,
+				       int passedNumWorkers)
+  :theReliabilityDomain(passedReliabilityDomain),
+   theOpenSeesDomain(passedOpenSeesDomain),
+   theGFunEvaluator(passedGFunEvaluator),
+   numWorkers(passedNumWorkers), started(false),
+   requestFds(0), replyFds(0), pids(0)
+{
+#ifdef _WIN32
+  if (numWorkers > 0) {
+    opserr << "SamplingWorkerPool - worker processes are not available on this platform,";
+    opserr << " realizations are evaluated in turn\n";
+  }
+  numWorkers = 0;
+#endif
+  if (numWorkers < 0)
+    numWorkers = 0;
+}
+
+SamplingWorkerPool::~SamplingWorkerPool()
+{
+  this->stop();
+}
+
+int
+SamplingWorkerPool::getNumWorkers(void)
+{
+  return numWorkers;
+}
+
+int
+SamplingWorkerPool::evaluate(const Vector &x, Vector &g)
+{
+  // update the parameters mapped to the random variables
+  int numRV = x.Size();
+  for (int j = 0; j < numRV; j++) {
+    int param_indx = theReliabilityDomain->getParameterIndexFromRandomVariableIndex(j);
+    Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(param_indx);
+    theParam->update(x(j));
+  }
+
+  // set values in the variable namespace
+  if (theGFunEvaluator->setVariables() < 0) {
+    opserr << "SamplingWorkerPool::evaluate() - could not set variables in namespace\n";
+    return -2;
+  }
+
+  // run the analysis; a failed analysis is registered as failure
+  int res = 0;
+  if (theGFunEvaluator->runAnalysis() < 0) {
+    opserr << "ERROR SamplingWorkerPool -- error running analysis" << endln;
+    res = -1;
+  }
+
+  int numLsf = theReliabilityDomain->getNumberOfLimitStateFunctions();
+  for (int lsf = 0; lsf < numLsf; lsf++) {
+    LimitStateFunction *theLimitStateFunction = 
+      theReliabilityDomain->getLimitStateFunctionPtrFromIndex(lsf);
+    theReliabilityDomain->setTagOfActiveLimitStateFunction(theLimitStateFunction->getTag());
+
+    theGFunEvaluator->setExpression(theLimitStateFunction->getExpression());
+    g(lsf) = theGFunEvaluator->evaluateExpression();
+    if (res < 0)
+      g(lsf) = -1.0;
+  }
+
+  return res;
+}
+
+int
+SamplingWorkerPool::evaluate(const Matrix &X, Matrix &G, ID &status)
+{
+  int numRV = X.noRows();
+  int numLsf = G.noRows();
+  int n = X.noCols();
+
+  if (numWorkers > 0 && started == false) {
+    if (this->start() < 0) {
+      opserr << "SamplingWorkerPool - could not start the worker processes,";
+      opserr << " realizations are evaluated in turn\n";
+      this->stop();
+      numWorkers = 0;
+    }
+  }
+
+  // in the calling process
+  if (numWorkers == 0) {
+    Vector x(numRV);
+    Vector g(numLsf);
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < numRV; j++)
+	x(j) = X(j,i);
+      int res = this->evaluate(x, g);
+      if (res < -1)
+	return res;
+      status(i) = res;
+      for (int j = 0; j < numLsf; j++)
+	G(j,i) = g(j);
+    }
+    return 0;
+  }
+
+#ifndef _WIN32
+  // give every worker a realization, then hand out the next one to
+  // whichever worker replies first
+  int next = 0;
+  int numDone = 0;
+  int *current = new int[numWorkers];
+  struct pollfd *fds = new struct pollfd[numWorkers];
+  double *reply = new double[numLsf];
+  int res = 0;
+
+  for (int w = 0; w < numWorkers; w++) {
+    current[w] = -1;
+    if (next < n) {
+      if (this->sendRequest(w, next, X) < 0) {
+	res = -3;
+	break;
+      }
+      current[w] = next++;
+    }
+  }
+
+  while (res == 0 && numDone < n) {
+    for (int w = 0; w < numWorkers; w++) {
+      fds[w].fd = (current[w] >= 0) ? replyFds[w] : -1;
+      fds[w].events = POLLIN;
+      fds[w].revents = 0;
+    }
+    if (poll(fds, numWorkers, -1) < 0) {
+      if (errno == EINTR)
+	continue;
+      res = -3;
+      break;
+    }
+
+    for (int w = 0; w < numWorkers && res == 0; w++) {
+      if (current[w] < 0 || fds[w].revents == 0)
+	continue;
+
+      int header[2];
+      if (readAll(replyFds[w], header, sizeof(header)) < 0 ||
+	  readAll(replyFds[w], reply, numLsf*sizeof(double)) < 0) {
+	res = -3;
+	break;
+      }
+      if (header[1] < -1) {
+	res = header[1];
+	break;
+      }
+
+      int i = header[0];
+      status(i) = header[1];
+      for (int j = 0; j < numLsf; j++)
+	G(j,i) = reply[j];
+      numDone++;
+
+      current[w] = -1;
+      if (next < n) {
+	if (this->sendRequest(w, next, X) < 0) {
+	  res = -3;
+	  break;
+	}
+	current[w] = next++;
+      }
+    }
+  }
+
+  delete [] current;
+  delete [] fds;
+  delete [] reply;
+
+  if (res == -3) {
+    opserr << "SamplingWorkerPool::evaluate() - lost contact with a worker process\n";
+    this->stop();
+    return -1;
+  }
+
+  return res;
+#else
+  return -1;
+#endif
+}
+
+int
+SamplingWorkerPool::sendRequest(int worker, int index, const Matrix &X)
+{
+#ifndef _WIN32
+  int numRV = X.noRows();
+  static Vector x;
+  if (x.Size() != numRV)
+    x.resize(numRV);
+  for (int j = 0; j < numRV; j++)
+    x(j) = X(j,index);
+
+  if (writeAll(requestFds[worker], &index, sizeof(int)) < 0 ||
+      writeAll(requestFds[worker], &x(0), numRV*sizeof(double)) < 0)
+    return -1;
+  return 0;
+#else
+  return -1;
+#endif
+}
+
+int
+SamplingWorkerPool::start(void)
+{
+#ifndef _WIN32
+  requestFds = new int[numWorkers];
+  replyFds = new int[numWorkers];
+  pids = new int[numWorkers];
+  for (int w = 0; w < numWorkers; w++) {
+    requestFds[w] = -1;
+    replyFds[w] = -1;
+    pids[w] = -1;
+  }
+  started = true;
+
+  // a worker that died must show up as an error, not kill the parent
+  signal(SIGPIPE, SIG_IGN);
+
+  // output buffered now would be written again by every worker
+  fflush(0);
+  std::cout.flush();
+  std::cerr.flush();
+
+  for (int w = 0; w < numWorkers; w++) {
+    int request[2], reply[2];
+    if (pipe(request) < 0)
+      return -1;
+    if (pipe(reply) < 0) {
+      close(request[0]);
+      close(request[1]);
+      return -1;
+    }
+
+    pid_t pid = fork();
+    if (pid < 0) {
+      close(request[0]); close(request[1]);
+      close(reply[0]); close(reply[1]);
+      return -1;
+    }
+
+    if (pid == 0) {
+      // the worker keeps only its own ends of its own pipes
+      for (int v = 0; v < w; v++) {
+	close(requestFds[v]);
+	close(replyFds[v]);
+      }
+      close(request[1]);
+      close(reply[0]);
+      this->runWorker(request[0], reply[1]);
+      _exit(0);
+    }
+
+    close(request[0]);
+    close(reply[1]);
+    requestFds[w] = request[1];
+    replyFds[w] = reply[0];
+    pids[w] = pid;
+  }
+
+  return 0;
+#else
+  return -1;
+#endif
+}
+
+void
+SamplingWorkerPool::runWorker(int requestFd, int replyFd)
+{
+#ifndef _WIN32
+  int numRV = theReliabilityDomain->getNumberOfRandomVariables();
+  int numLsf = theReliabilityDomain->getNumberOfLimitStateFunctions();
+  Vector x(numRV);
+  Vector g(numLsf);
+
+  // evaluate realizations until the pipe is closed
+  int index;
+  while (readAll(requestFd, &index, sizeof(int)) == 0 && index >= 0) {
+    if (readAll(requestFd, &x(0), numRV*sizeof(double)) < 0)
+      break;
+
+    int header[2];
+    header[0] = index;
+    header[1] = this->evaluate(x, g);
+    if (header[1] < -1)
+      g.Zero();
+
+    if (writeAll(replyFd, header, sizeof(header)) < 0 ||
+	writeAll(replyFd, &g(0), numLsf*sizeof(double)) < 0)
+      break;
+  }
+
+  // the worker leaves by _exit(), so flush what it printed
+  fflush(0);
+  std::cout.flush();
+  std::cerr.flush();
+  close(requestFd);
+  close(replyFd);
+#endif
+}
+
+void
+SamplingWorkerPool::stop(void)
+{
+#ifndef _WIN32
+  if (started == false)
+    return;
+
+  // closing the request pipes ends the workers
+  for (int w = 0; w < numWorkers; w++) {
+    if (requestFds[w] >= 0)
+      close(requestFds[w]);
+    if (replyFds[w] >= 0)
+      close(replyFds[w]);
+  }
+  for (int w = 0; w < numWorkers; w++) {
+    if (pids[w] > 0) {
+      int wstatus;
+      while (waitpid(pids[w], &wstatus, 0) < 0 && errno == EINTR)
+	;
+    }
+  }
+
+  delete [] requestFds;
+  delete [] replyFds;
+  delete [] pids;
+  requestFds = 0;
+  replyFds = 0;
+  pids = 0;
+  started = false;
+  numWorkers = 0;
+#endif
+}
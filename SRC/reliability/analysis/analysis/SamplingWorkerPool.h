@@ -0,0 +1,87 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// SamplingWorkerPool. A SamplingWorkerPool evaluates the limit-state
+// functions of a ReliabilityDomain at given realizations of the random
+// variables, i.e. it updates the parameters, runs the finite element
+// analysis and evaluates the expressions. With numWorkers > 0 the process 
+// is forked when the first batch is evaluated; each worker process has its
+// own copy of the Domain, ReliabilityDomain and interpreter and the 
+// realizations of a batch are handed out over pipes to whichever worker is 
+// free. The realizations themselves are generated by the caller, so the
+// results do not depend on the number of workers. With numWorkers = 0, or
+// where fork() is not available, the realizations are evaluated in turn 
+// in the calling process.
+//
+// What: "@(#) SamplingWorkerPool.h, revA"
+
+#ifndef SamplingWorkerPool_h
+#define SamplingWorkerPool_h
+
+class ReliabilityDomain;
+class Domain;
+class FunctionEvaluator;
+class Vector;
+class Matrix;
+class ID;
+
+class SamplingWorkerPool
+{
+  public:
+    SamplingWorkerPool(ReliabilityDomain *theReliabilityDomain,
+		       Domain *theOpenSeesDomain,
+		       FunctionEvaluator *theGFunEvaluator,
+		       int numWorkers = 0);
+    ~SamplingWorkerPool();
+
+    int getNumWorkers(void);
+
+    // evaluate the realizations in the columns of X; column i of G is
+    // set to the g-values of realization i and status(i) to -1 if its
+    // finite element analysis failed (the g-values are then -1.0)
+    int evaluate(const Matrix &X, Matrix &G, ID &status);
+
+    // evaluate one realization in the calling process
+    int evaluate(const Vector &x, Vector &g);
+
+  private:
+    int start(void);
+    void stop(void);
+    void runWorker(int requestFd, int replyFd);
+    int sendRequest(int worker, int index, const Matrix &X);
+
+    ReliabilityDomain *theReliabilityDomain;
+    Domain *theOpenSeesDomain;
+    FunctionEvaluator *theGFunEvaluator;
+
+    int numWorkers;
+    bool started;
+    int *requestFds;	// parent ends of the pipes to the workers
+    int *replyFds;	// parent ends of the pipes from the workers
+    int *pids;
+};
+
+#endif
@@ -4129,8 +4129,11 @@ TclReliabilityModelBuilder_runImportanceSamplingAnalysis(ClientData clientData,
 	//     -print 1   (print to screen)
 	//     -print 2   (print to restart file)
 	//
+	//     -numWorkers 0  ....................... this is the default
+	//     -numWorkers n  (evaluate realizations in n forked processes)
+	//
 
-	if (argc!=2 && argc!=4 && argc!=6 && argc!=8 && argc!=10 && argc!=12) {
+	if (argc!=2 && argc!=4 && argc!=6 && argc!=8 && argc!=10 && argc!=12 && argc!=14) {
 		opserr << "ERROR: Wrong number of arguments to Sampling analysis" << endln;
 		return TCL_ERROR;
 	}
@@ -4142,6 +4145,7 @@ TclReliabilityModelBuilder_runImportanceSamplingAnalysis(ClientData clientData,
 	double samplingVariance	= 1.0;
 	int printFlag			= 0;
 	int analysisTypeTag		= 1;
+	int numWorkers			= 0;
 
 
 	for (int i=2; i<argc; i=i+2) {
@@ -4211,6 +4215,13 @@ TclReliabilityModelBuilder_runImportanceSamplingAnalysis(ClientData clientData,
 				return TCL_ERROR;
 			}
 		}
+		else if (strcmp(argv[i],"-numWorkers") == 0) {
+			// GET INPUT PARAMETER (integer)
+			if (Tcl_GetInt(interp, argv[i+1], &numWorkers) != TCL_OK || numWorkers < 0) {
+				opserr << "ERROR: invalid input: numWorkers \n";
+				return TCL_ERROR;
+			}
+		}
 		else {
 			opserr << "ERROR: invalid input to sampling analysis. " << endln;
 			return TCL_ERROR;
@@ -4234,7 +4245,8 @@ TclReliabilityModelBuilder_runImportanceSamplingAnalysis(ClientData clientData,
 							 numberOfSimulations, targetCOV, samplingVariance,
 							 printFlag,
 							 argv[1],
-							 analysisTypeTag);
+							 analysisTypeTag,
+							 numWorkers);
 
 	if (theImportanceSamplingAnalysis == 0) {
 		opserr << "ERROR: could not create theImportanceSamplingAnalysis \n";
@@ -0,0 +1,659 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the implementation of SymSparseEigenSOE.
+//
+// What: "@(#) SymSparseEigenSOE.cpp, revA"
+
+#include <SymSparseEigenSOE.h>
+#include <SymSparseEigenSolver.h>
+#include <Matrix.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <AnalysisModel.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <classTags.h>
+#include <string.h>
+#include <stdlib.h>
+#include <algorithm>
+
+// the symbolic factorization method defined in <symbolic.c> and the
+// numerical factorization and solve in <nmat.c>
+extern "C" int symFactorization(int *fxadj, int *adjncy, int neq, int LSPARSE, 
+				int **xblkMY, int **invpMY, int **rowblksMY, 
+				OFFDBLK ***begblkMY, OFFDBLK **firstMY, 
+				double ***penvMY, double **diagMY);
+
+extern "C" int pfsfct(int neqns, double *diag, double **penv, int nblks, int *xblk,
+		      OFFDBLK **begblk, OFFDBLK *first, int *rowblks);
+
+extern "C" void pfsslv(int neqns, double *diag, double **penv, int nblks,
+		       int *xblk, double *rhs, OFFDBLK **begblk);
+
+
+SymSparseEigenSOE::SymSparseEigenSOE(SymSparseEigenSolver &the_Solver, 
+				     AnalysisModel &aModel,
+				     int theBlockSize, int theNumThreads)
+:EigenSOE(the_Solver, EigenSOE_TAGS_SymSparseEigenSOE),
+ size(0), nnz(0), colA(0), rowStartA(0), colStart(0), rowIndex(0),
+ K(0), M(0), theModel(&aModel),
+ lambdaMin(0.0), lambdaMax(0.0), blockSize(0), numThreads(0), 
+ generalized(true),
+ nblks(0), xblk(0), invp(0), diag(0), penv(0), rowblks(0),
+ begblk(0), first(0), factorLoc(0),
+ Kfactored(0), Mfactored(0), factored(false), factorShift(0.0),
+ factorNumBelow(0), counted(false), countShift(0.0), countNumBelow(0)
+{
+    this->setBlockSize(theBlockSize);
+    this->setNumThreads(theNumThreads);
+    the_Solver.setEigenSOE(*this);
+}
+
+
+SymSparseEigenSOE::~SymSparseEigenSOE()
+{
+    this->freeFactor();
+
+    if (colA != 0) delete [] colA;
+    if (rowStartA != 0) delete [] rowStartA;
+    if (colStart != 0) delete [] colStart;
+    if (rowIndex != 0) delete [] rowIndex;
+    if (K != 0) delete [] K;
+    if (M != 0) delete [] M;
+    if (Kfactored != 0) delete [] Kfactored;
+    if (Mfactored != 0) delete [] Mfactored;
+}
+
+
+int
+SymSparseEigenSOE::getNumEqn(void) const
+{
+    return size;
+}
+
+
+int 
+SymSparseEigenSOE::setSize(Graph &theGraph)
+{
+    int newSize = theGraph.getNumVertex();
+
+    // form the adjacency, the columns of each vertex in order
+    Vertex *theVertex;
+    int newNNZ = 0;
+    VertexIter &theVertices = theGraph.getVertices();
+    while ((theVertex = theVertices()) != 0) {
+        const ID &theAdjacency = theVertex->getAdjacency();
+	newNNZ += theAdjacency.Size(); 
+    }
+
+    int *newRowStart = new int[newSize+1];
+    int *newCol = new int[newNNZ+1];
+
+    newRowStart[0] = 0;
+    for (int a=0; a<newSize; a++) {
+	theVertex = theGraph.getVertexPtr(a);
+	if (theVertex == 0) {
+	    opserr << "WARNING:SymSparseEigenSOE::setSize :";
+	    opserr << " vertex " << a << " not in graph! - size set to 0\n";
+	    delete [] newRowStart;
+	    delete [] newCol;
+	    this->freeFactor();
+	    size = 0;
+	    nnz = 0;
+	    return -1;
+	}
+
+	const ID &theAdjacency = theVertex->getAdjacency();
+	int idSize = theAdjacency.Size();
+	int *colPtr = newCol + newRowStart[a];
+	for (int i=0; i<idSize; i++)
+	    colPtr[i] = theAdjacency(i);
+	std::sort(colPtr, colPtr+idSize);
+	newRowStart[a+1] = newRowStart[a] + idSize;
+    }
+
+    // if the graph has not changed the storage, and with it any 
+    // factorization, is kept
+    if (rowStartA != 0 && newSize == size && 
+	memcmp(newRowStart, rowStartA, (size+1)*sizeof(int)) == 0 &&
+	memcmp(newCol, colA, newNNZ*sizeof(int)) == 0) {
+	delete [] newRowStart;
+	delete [] newCol;
+	return this->getSolver()->setSize();
+    }
+
+    this->freeFactor();
+    if (colA != 0) delete [] colA;
+    if (rowStartA != 0) delete [] rowStartA;
+    if (colStart != 0) delete [] colStart;
+    if (rowIndex != 0) delete [] rowIndex;
+    if (K != 0) delete [] K;
+    if (M != 0) delete [] M;
+    if (Kfactored != 0) delete [] Kfactored;
+    if (Mfactored != 0) delete [] Mfactored;
+    colStart = 0; rowIndex = 0;
+    K = 0; M = 0; Kfactored = 0; Mfactored = 0;
+
+    size = newSize;
+    rowStartA = newRowStart;
+    colA = newCol;
+    nnz = 0;
+
+    // the locations found by addA() and addM() are no longer valid
+    theKMap.clear();
+    theMMap.clear();
+    factored = false;
+    counted = false;
+
+    if (size == 0)
+	return this->getSolver()->setSize();
+
+    // call "C" function to order the equations and do the symbolic 
+    // factorization, on copies as the adjacency is modified by it
+    int *fxadj = new int[size+1];
+    int *adjncy = new int[newNNZ+1];
+    memcpy(fxadj, rowStartA, (size+1)*sizeof(int));
+    memcpy(adjncy, colA, newNNZ*sizeof(int));
+
+    int LSPARSE = 1; // minimum degree ordering
+    nblks = symFactorization(fxadj, adjncy, size, LSPARSE,
+			     &xblk, &invp, &rowblks, &begblk, &first, &penv, &diag);
+
+    delete [] fxadj;
+    delete [] adjncy;
+
+    // form the lower triangles of K and M in the permuted numbering, 
+    // the diagonal being the first entry of each column
+    colStart = new int[size+1];
+    for (int j=0; j<=size; j++)
+	colStart[j] = 0;
+
+    for (int a=0; a<size; a++) {
+	int col = invp[a];
+	colStart[col+1]++;
+	for (int i=rowStartA[a]; i<rowStartA[a+1]; i++)
+	    if (invp[colA[i]] > col)
+		colStart[col+1]++;
+    }
+    for (int j=0; j<size; j++)
+	colStart[j+1] += colStart[j];
+    nnz = colStart[size];
+
+    rowIndex = new int[nnz];
+    K = new double[nnz];
+    M = new double[nnz];
+    Kfactored = new double[nnz];
+    Mfactored = new double[nnz];
+    factorLoc = new double *[nnz];
+    if (rowIndex == 0 || K == 0 || M == 0 || Kfactored == 0 || Mfactored == 0 ||
+	factorLoc == 0) {
+	opserr << "WARNING SymSparseEigenSOE::setSize() -";
+	opserr << " ran out of memory for nnz = " << nnz << endln;
+	size = 0; nnz = 0;
+	return -1;
+    }
+
+    for (int a=0; a<size; a++) {
+	int col = invp[a];
+	int *rowPtr = rowIndex + colStart[col];
+	int numRows = 0;
+	rowPtr[numRows++] = col;
+	for (int i=rowStartA[a]; i<rowStartA[a+1]; i++) {
+	    int row = invp[colA[i]];
+	    if (row > col)
+		rowPtr[numRows++] = row;
+	}
+	std::sort(rowPtr+1, rowPtr+numRows);
+    }
+
+    for (int k=0; k<nnz; k++) {
+	K[k] = 0.0;
+	M[k] = 0.0;
+	Kfactored[k] = 0.0;
+	Mfactored[k] = 0.0;
+    }
+
+    // locate each entry in the factor storage: the diagonal, the envelope 
+    // of the diagonal blocks or a row segment. The row segments are linked
+    // in order of row and column, so the entries in them are located by
+    // going through the rows in order.
+    int *numInRow = new int[size+1];
+    for (int i=0; i<=size; i++)
+	numInRow[i] = 0;
+
+    for (int j=0; j<size; j++) {
+	factorLoc[colStart[j]] = &diag[j];
+	for (int k=colStart[j]+1; k<colStart[j+1]; k++) {
+	    int i = rowIndex[k];
+	    if (j >= xblk[rowblks[i]])  // diagonal block
+		factorLoc[k] = penv[i+1] - i + j;
+	    else {
+		factorLoc[k] = 0;
+		numInRow[i+1]++;
+	    }
+	}
+    }
+    for (int i=0; i<size; i++)
+	numInRow[i+1] += numInRow[i];
+
+    int numSegmentEntries = numInRow[size];
+    int *segmentEntry = new int[numSegmentEntries+1];
+    for (int j=0; j<size; j++) 
+	for (int k=colStart[j]+1; k<colStart[j+1]; k++) 
+	    if (factorLoc[k] == 0)
+		segmentEntry[numInRow[rowIndex[k]]++] = k;
+    for (int i=size; i>0; i--)
+	numInRow[i] = numInRow[i-1];
+    numInRow[0] = 0;
+
+    int result = 0;
+    OFFDBLK *ptr = first;
+    for (int i=0; i<size && result == 0; i++) {
+	for (int l=numInRow[i]; l<numInRow[i+1]; l++) {
+	    int k = segmentEntry[l];
+
+	    // the column of entry k
+	    int j = 0, hi = size;
+	    while (hi - j > 1) {
+		int mid = (j + hi)/2;
+		if (colStart[mid] <= k) j = mid; else hi = mid;
+	    }
+
+	    while (ptr->beg != size && 
+		   (ptr->row < i || 
+		    (ptr->row == i && j >= xblk[rowblks[ptr->beg]+1])))
+		ptr = ptr->next;
+
+	    if (ptr->beg == size || ptr->row != i || j < ptr->beg) {
+		opserr << "WARNING SymSparseEigenSOE::setSize() -";
+		opserr << " entry (" << i << "," << j << ") not in the factor\n";
+		result = -1;
+		break;
+	    }
+	    factorLoc[k] = &(ptr->nz[j - ptr->beg]);
+	}
+    }
+
+    delete [] numInRow;
+    delete [] segmentEntry;
+
+    if (result < 0) {
+	size = 0; nnz = 0;
+	return result;
+    }
+
+    // invoke setSize() on the Solver
+    EigenSolver *theSolvr = this->getSolver();
+    int solverOK = theSolvr->setSize();
+    if (solverOK < 0) {
+	opserr << "WARNING:SymSparseEigenSOE::setSize :";
+	opserr << " solver failed setSize()\n";
+	return solverOK;
+    } 
+
+    return result;
+}
+
+
+int 
+SymSparseEigenSOE::addA(const Matrix &m, const ID &id, double fact)
+{
+    return this->addMatrix(theKMap, K, m, id, fact);
+}
+
+
+int 
+SymSparseEigenSOE::addM(const Matrix &m, const ID &id, double fact)
+{
+    return this->addMatrix(theMMap, M, m, id, fact);
+}
+
+
+int
+SymSparseEigenSOE::addMatrix(ScatterMap &theMap, double *values,
+			     const Matrix &m, const ID &id, double fact)
+{
+    // check for a quick return 
+    if (fact == 0.0)  
+	return 0;
+
+    int idSize = id.Size();
+    if (idSize != m.noRows() && idSize != m.noCols()) {
+	opserr << "SymSparseEigenSOE::addA() ";
+	opserr << " - Matrix and ID not of similar sizes\n";
+	return -1;
+    }
+
+    // if the id has been seen, the locations of the entries are known
+    ScatterEntry *theEntry = theMap.getEntry(id);
+    if (theEntry != 0)
+	return theMap.addMatrix(*theEntry, m, fact);
+
+    // otherwise find them, the entries m(a,b) in the lower triangle
+    // (in the permuted numbering) being added
+    int numLocs = 0;
+    for (int a=0; a<idSize; a++) {
+	int rowA = id(a);
+	if (rowA < 0 || rowA >= size)
+	    continue;
+	for (int b=0; b<idSize; b++) {
+	    int rowB = id(b);
+	    if (rowB >= 0 && rowB < size && invp[rowA] >= invp[rowB])
+		numLocs++;
+	}
+    }
+    
+    theEntry = theMap.newEntry(id, numLocs);
+    numLocs = 0;
+    for (int a=0; a<idSize; a++) {
+	int rowA = id(a);
+	if (rowA < 0 || rowA >= size)
+	    continue;
+	int row = invp[rowA];
+	for (int b=0; b<idSize; b++) {
+	    int rowB = id(b);
+	    if (rowB < 0 || rowB >= size)
+		continue;
+	    int col = invp[rowB];
+	    if (row < col)
+		continue;
+
+	    int *colBegin = rowIndex + colStart[col];
+	    int *colEnd = rowIndex + colStart[col+1];
+	    int *loc = std::lower_bound(colBegin, colEnd, row);
+	    if (loc == colEnd || *loc != row) {
+		opserr << "SymSparseEigenSOE::addA() - entry (" << rowA << "," << rowB 
+		       << ") not in the graph\n";
+		theMap.removeEntry(id);
+		return -1;
+	    }
+	    theEntry->locs[numLocs] = values + (loc - rowIndex);
+	    theEntry->pos[numLocs] = b*idSize + a;
+	    numLocs++;
+	}
+    }
+    theEntry->numLocs = numLocs;
+
+    return theMap.addMatrix(*theEntry, m, fact);
+}
+
+
+void 
+SymSparseEigenSOE::zeroA(void)
+{
+    // the factorization is only discarded if K is found to have changed
+    if (K != 0)
+	memset(K, 0, nnz*sizeof(double));
+}
+
+	
+void 
+SymSparseEigenSOE::zeroM(void)
+{
+    if (M != 0)
+	memset(M, 0, nnz*sizeof(double));
+}
+
+
+int
+SymSparseEigenSOE::setWindow(double min, double max)
+{
+    lambdaMin = min;
+    lambdaMax = max;
+    return 0;
+}
+
+
+int
+SymSparseEigenSOE::setBlockSize(int theBlockSize)
+{
+    // 0 gives a block size of the number of threads
+    if (theBlockSize < 0) {
+	opserr << "WARNING SymSparseEigenSOE::setBlockSize() - block size " 
+	       << theBlockSize << " < 0, 0 assumed\n";
+	theBlockSize = 0;
+    }
+    blockSize = theBlockSize;
+    return 0;
+}
+
+
+int
+SymSparseEigenSOE::setNumThreads(int theNumThreads)
+{
+    numThreads = theNumThreads;
+    return 0;
+}
+
+
+// int checkValues(bool generalized);
+//	checks K and M against those last factored, the factorization and
+//	Sturm count being discarded if either has changed.
+
+int
+SymSparseEigenSOE::checkValues(bool isGeneralized)
+{
+    if (isGeneralized == generalized &&
+	memcmp(K, Kfactored, nnz*sizeof(double)) == 0 &&
+	(isGeneralized == false || memcmp(M, Mfactored, nnz*sizeof(double)) == 0))
+	return 0;
+
+    memcpy(Kfactored, K, nnz*sizeof(double));
+    if (isGeneralized == true)
+	memcpy(Mfactored, M, nnz*sizeof(double));
+    generalized = isGeneralized;
+    factored = false;
+    counted = false;
+
+    return 1;
+}
+
+
+// int factor(double shift);
+//	factors K - shift*M, or K - shift*I if the problem is not generalized,
+//	if it is not already factored. Returns the number of negative pivots,
+//	i.e. the number of eigenvalues below the shift, or -1 if the
+//	factorization failed.
+
+int
+SymSparseEigenSOE::factor(double shift)
+{
+    if (factored == true && shift == factorShift)
+	return factorNumBelow;
+
+    factored = false;
+
+    // zero the factor storage, including the fill in
+    memset(diag, 0, size*sizeof(double));
+
+    int profileSize = penv[size] - penv[0];
+    memset(penv[0], 0, profileSize*sizeof(double));
+    
+    OFFDBLK *blkPtr = first;
+    while (blkPtr->beg != size) {
+	int rLen = xblk[rowblks[blkPtr->beg]+1] - blkPtr->beg;
+	memset(blkPtr->nz, 0, rLen*sizeof(double));
+	blkPtr = blkPtr->next;
+    }
+
+    // add in the entries of K - shift*M
+    if (generalized == true) {
+	for (int k=0; k<nnz; k++)
+	    *(factorLoc[k]) += K[k] - shift*M[k];
+    } else {
+	for (int k=0; k<nnz; k++)
+	    *(factorLoc[k]) += K[k];
+	for (int j=0; j<size; j++)
+	    diag[j] -= shift;
+    }
+
+    int result = pfsfct(size, diag, penv, nblks, xblk, begblk, first, rowblks);
+    if (result > 0) {
+	opserr << "WARNING SymSparseEigenSOE::factor() - factorization of K - shift*M failed,";
+	opserr << " shift = " << shift << endln;
+	return -1;
+    }
+
+    int numBelow = 0;
+    for (int j=0; j<size; j++)
+	if (diag[j] < 0.0)
+	    numBelow++;
+
+    factored = true;
+    factorShift = shift;
+    factorNumBelow = numBelow;
+
+    return numBelow;
+}
+
+
+// int getNumBelow(double shift);
+//	returns the number of eigenvalues below shift, the Sturm count, 
+//	factoring K - shift*M if it has not been counted before.
+
+int
+SymSparseEigenSOE::getNumBelow(double shift)
+{
+    if (counted == true && shift == countShift)
+	return countNumBelow;
+
+    int numBelow = this->factor(shift);
+    if (numBelow < 0)
+	return -1;
+
+    counted = true;
+    countShift = shift;
+    countNumBelow = numBelow;
+
+    return numBelow;
+}
+
+
+// void solveShifted(double *x);
+//	overwrites x with the solution of (K - shift*M) y = x using the last
+//	factorization. Safe to invoke from several threads at once.
+
+void
+SymSparseEigenSOE::solveShifted(double *x)
+{
+    pfsslv(size, diag, penv, nblks, xblk, x, begblk);
+}
+
+
+// void multM(const double *x, double *y);
+//	sets y = M*x, or y = x if the problem is not generalized. Safe to 
+//	invoke from several threads at once.
+
+void
+SymSparseEigenSOE::multM(const double *x, double *y)
+{
+    if (generalized == false) {
+	memcpy(y, x, size*sizeof(double));
+	return;
+    }
+
+    for (int i=0; i<size; i++)
+	y[i] = 0.0;
+
+    for (int j=0; j<size; j++) {
+	int k = colStart[j];
+	double xj = x[j];
+	double yj = M[k] * xj;
+	for (k++; k<colStart[j+1]; k++) {
+	    int i = rowIndex[k];
+	    y[i] += M[k] * xj;
+	    yj += M[k] * x[i];
+	}
+	y[j] += yj;
+    }
+}
+
+
+void
+SymSparseEigenSOE::freeFactor(void)
+{
+    if (factorLoc != 0) delete [] factorLoc;
+    factorLoc = 0;
+
+    // free the diagonal and the diagonal blocks
+    if (diag != 0) free(diag);
+    if (penv != 0) {
+	if (penv[0] != 0)
+	    free(penv[0]);
+        free(penv);
+    } 
+    diag = 0;
+    penv = 0;
+
+    // free the row segments, the nz of the segments of a row being 
+    // allocated together
+    OFFDBLK *blkPtr = first;
+    int curRow = -1;
+    while (blkPtr != 0) {
+	if (blkPtr->next == blkPtr) {
+	    free(blkPtr);
+	    break;
+	}
+
+	OFFDBLK *tempBlk = blkPtr->next;
+	if (blkPtr->row != curRow) {
+	    if (blkPtr->nz != 0)
+		free(blkPtr->nz);
+	    curRow = blkPtr->row;
+	}
+	free(blkPtr);
+	blkPtr = tempBlk;
+    }
+    first = 0;
+
+    if (xblk != 0) free(xblk);
+    if (rowblks != 0) free(rowblks);
+    if (invp != 0) free(invp);
+    if (begblk != 0) free(begblk);
+    xblk = 0;
+    rowblks = 0;
+    invp = 0;
+    begblk = 0;
+    nblks = 0;
+
+    factored = false;
+    counted = false;
+}
+
+
+int 
+SymSparseEigenSOE::sendSelf(int cTag, Channel &theChannel)
+{
+    return 0;
+}
+
+
+int 
+SymSparseEigenSOE::recvSelf(int cTag, Channel &theChannel, 
+			    FEM_ObjectBroker &theBroker)
+{
+    return 0;
+}
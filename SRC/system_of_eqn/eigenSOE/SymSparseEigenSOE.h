@@ -0,0 +1,129 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// SymSparseEigenSOE. A SymSparseEigenSOE stores the lower triangles of the 
+// symmetric K and M in compressed sparse column form, ordered by the fill 
+// reducing permutation of the sparseSYM envelope LDL^T factorization. The
+// SymSparseEigenSolver, a shift-invert block Lanczos method, uses it to 
+// factor K - shift*M and to multiply by M. The factorization is kept and 
+// reused by later solve() calls for which K, M and the shift are unchanged,
+// so repeated eigen analyses of a model whose stiffness has not changed do
+// no factorization. The eigenvalues sought can be restricted to a window 
+// [lambdaMin, lambdaMax], the Sturm sequence count of the factorizations 
+// being used to check that none in the window are missed.
+//
+// What: "@(#) SymSparseEigenSOE.h, revA"
+
+#ifndef SymSparseEigenSOE_h
+#define SymSparseEigenSOE_h
+
+#include <EigenSOE.h>
+#include <ScatterMap.h>
+
+extern "C" {
+   #include <FeStructs.h>
+}
+
+class AnalysisModel;
+class SymSparseEigenSolver;
+
+class SymSparseEigenSOE : public EigenSOE
+{
+  public:
+    SymSparseEigenSOE(SymSparseEigenSolver &theSolver, AnalysisModel &theModel,
+		      int blockSize = 0, int numThreads = 0);
+
+    virtual ~SymSparseEigenSOE();
+
+    virtual int getNumEqn(void) const;
+    virtual int setSize(Graph &theGraph);
+    
+    virtual int addA(const Matrix &, const ID &, double fact = 1.0);
+    virtual int addM(const Matrix &, const ID &, double fact = 1.0);    
+      
+    virtual void zeroA(void);
+    virtual void zeroM(void);
+
+    // eigenvalues sought lie in [lambdaMin, lambdaMax], no upper bound if 
+    // lambdaMax <= lambdaMin
+    int setWindow(double lambdaMin, double lambdaMax);
+
+    // the block size of the Lanczos method, the number of threads if 0, 
+    // and the number of threads, the number of cores if 0
+    int setBlockSize(int blockSize);
+    int setNumThreads(int numThreads);
+    
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, 
+		 FEM_ObjectBroker &theBroker);
+
+    friend class SymSparseEigenSolver;
+
+  protected:
+    // invoked by the solver, vectors being in the permuted numbering
+    int checkValues(bool generalized);
+    int factor(double shift);
+    int getNumBelow(double shift);
+    void solveShifted(double *x);
+    void multM(const double *x, double *y);
+    
+  private:
+    int addMatrix(ScatterMap &theMap, double *values, 
+		  const Matrix &m, const ID &id, double fact);
+    void freeFactor(void);
+
+    int size;               // order of K and M
+    int nnz;                // number of non-zeros in their lower triangles
+    int *colA, *rowStartA;  // adjacency of the graph, (ADJNCY, XADJ) pair
+    int *colStart, *rowIndex; // lower triangles, permuted numbering
+    double *K, *M;
+    ScatterMap theKMap, theMMap;
+    AnalysisModel *theModel;
+
+    // the eigen problem
+    double lambdaMin, lambdaMax;
+    int blockSize, numThreads;
+    bool generalized;
+
+    // the envelope factorization of K - shift*M
+    int      nblks;
+    int      *xblk,  *invp;
+    double   *diag, **penv;
+    int      *rowblks;
+    OFFDBLK  **begblk;
+    OFFDBLK  *first;
+    double   **factorLoc;   // location in the factor of each entry of K, M
+
+    // the cached factorization and Sturm count
+    double *Kfactored, *Mfactored; // K and M they were formed for
+    bool factored;
+    double factorShift;
+    int factorNumBelow;
+    bool counted;
+    double countShift;
+    int countNumBelow;
+};
+
+#endif
@@ -0,0 +1,745 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the implementation of 
+// SymSparseEigenSolver.
+//
+// What: "@(#) SymSparseEigenSolver.cpp, revA"
+
+#include <SymSparseEigenSolver.h>
+#include <math.h>
+#include <string.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <vector>
+
+#ifdef _WIN32
+
+extern "C" int DSYEV(char *jobz, char *uplo, int *n, double *a, int *lda,
+		     double *w, double *work, int *lwork, int *info);
+
+extern "C" int DGEMV(char *trans, int *m, int *n, double *alpha, double *A, int *lda,
+		     double *x, int *incx, double *beta, double *y, int *incy);
+
+extern "C" int DGEMM(char *transA, char *transB, int *m, int *n, int *k, 
+		     double *alpha, double *A, int *lda, double *B, int *ldb,
+		     double *beta, double *C, int *ldc);
+
+#else
+
+extern "C" int dsyev_(char *jobz, char *uplo, int *n, double *a, int *lda,
+		      double *w, double *work, int *lwork, int *info);
+
+extern "C" int dgemv_(char *trans, int *m, int *n, double *alpha, double *A, int *lda,
+		      double *x, int *incx, double *beta, double *y, int *incy);
+
+extern "C" int dgemm_(char *transA, char *transB, int *m, int *n, int *k, 
+		      double *alpha, double *A, int *lda, double *B, int *ldb,
+		      double *beta, double *C, int *ldc);
+
+#endif
+
+// relative residual at which a Ritz pair is converged
+#define SYMSPARSE_EIGEN_TOL 1.0e-10
+
+// a team of numThreads-1 threads kept for the lifetime of a solve(), the
+// calling thread being the first of the team; run() hands f(0), ...,
+// f(numTasks-1) out the same way each time and returns when all are done
+class LanczosWorkers
+{
+  public:
+    LanczosWorkers(int numThreads);
+    ~LanczosWorkers();
+
+    void run(int numTasks, const std::function<void(int)> &f);
+
+  private:
+    void work(int t);
+
+    int numThreads;
+    std::vector<std::thread> theThreads;
+    std::mutex theMutex;
+    std::condition_variable startCondition, doneCondition;
+    const std::function<void(int)> *job;
+    int numTasks;
+    int jobNumber;
+    int numBusy;
+    bool stop;
+};
+
+LanczosWorkers::LanczosWorkers(int num)
+  :numThreads(num), job(0), numTasks(0), jobNumber(0), numBusy(0), stop(false)
+{
+  for (int t=1; t<numThreads; t++)
+    theThreads.push_back(std::thread(&LanczosWorkers::work, this, t));
+}
+
+LanczosWorkers::~LanczosWorkers()
+{
+  {
+    std::lock_guard<std::mutex> lock(theMutex);
+    stop = true;
+  }
+  startCondition.notify_all();
+  for (size_t t=0; t<theThreads.size(); t++)
+    theThreads[t].join();
+}
+
+void
+LanczosWorkers::run(int num, const std::function<void(int)> &f)
+{
+  if (numThreads <= 1 || num <= 1) {
+    for (int i=0; i<num; i++)
+      f(i);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(theMutex);
+    job = &f;
+    numTasks = num;
+    numBusy = numThreads-1;
+    jobNumber++;
+  }
+  startCondition.notify_all();
+
+  for (int i=0; i<num; i+=numThreads)
+    f(i);
+
+  std::unique_lock<std::mutex> lock(theMutex);
+  doneCondition.wait(lock, [this]{return numBusy == 0;});
+}
+
+void
+LanczosWorkers::work(int t)
+{
+  int lastJob = 0;
+  std::unique_lock<std::mutex> lock(theMutex);
+  while (true) {
+    startCondition.wait(lock, [&]{return stop == true || jobNumber != lastJob;});
+    if (stop == true)
+      return;
+
+    lastJob = jobNumber;
+    const std::function<void(int)> &f = *job;
+    int num = numTasks;
+    lock.unlock();
+
+    for (int i=t; i<num; i+=numThreads)
+      f(i);
+
+    lock.lock();
+    if (--numBusy == 0)
+      doneCondition.notify_one();
+  }
+}
+
+static double
+dot(const double *x, const double *y, int n)
+{
+  double result = 0.0;
+  for (int i=0; i<n; i++)
+    result += x[i]*y[i];
+  return result;
+}
+
+// fills x with uniform random numbers in [-1,1], the same on each solve()
+static void
+randomVector(double *x, int n, unsigned int &seed)
+{
+  for (int i=0; i<n; i++) {
+    seed = seed*1103515245u + 12345u;
+    x[i] = ((seed >> 8) & 0xFFFF)/32767.5 - 1.0;
+  }
+}
+
+
+SymSparseEigenSolver::SymSparseEigenSolver()
+:EigenSolver(EigenSOLVER_TAGS_SymSparseEigenSolver),
+ theSOE(0), numModes(0), eigenvalue(0), eigenvector(0), eigenV(0),
+ Q(0), maxNumVectors(0)
+{
+
+}
+
+
+SymSparseEigenSolver::~SymSparseEigenSolver()
+{
+  if (eigenvalue != 0)
+    delete [] eigenvalue;
+  if (eigenvector != 0)
+    delete [] eigenvector;
+  if (eigenV != 0)
+    delete eigenV;
+  if (Q != 0)
+    delete [] Q;
+}
+
+
+int
+SymSparseEigenSolver::solve(int nModes, bool generalized, bool findSmallest)
+{
+  if (theSOE == 0) {
+    opserr << "SymSparseEigenSolver::solve() -- no EigenSOE has been set yet\n";
+    return -1;
+  }
+
+  if (findSmallest == false) {
+    opserr << "SymSparseEigenSolver::solve() -- only the eigenvalues above the bottom ";
+    opserr << "of the window can be found, not the largest\n";
+    return -1;
+  }
+
+  int n = theSOE->size;
+  if (nModes < 1 || nModes > n) {
+    opserr << "SymSparseEigenSolver::solve() -- number of modes " << nModes 
+	   << " is out of range (1 - " << n << ")\n";
+    return -1;
+  }
+
+  if (eigenvalue == 0 || numModes != nModes) {
+    if (eigenvalue != 0)
+      delete [] eigenvalue;
+    if (eigenvector != 0)
+      delete [] eigenvector;
+    eigenvalue = new double[nModes];
+    eigenvector = new double[n*nModes];
+  }
+  numModes = nModes;
+
+  //
+  // factor K - shift*M, shift being the bottom of the window, reusing the 
+  // factorization of the last solve if K, M and the window are unchanged
+  //
+
+  theSOE->checkValues(generalized);
+
+  double lambdaMin = theSOE->lambdaMin;
+  double lambdaMax = theSOE->lambdaMax;
+  double shift = lambdaMin;
+  bool window = lambdaMax > lambdaMin;
+
+  int numBelowMax = 0;
+  if (window == true) {
+    numBelowMax = theSOE->getNumBelow(lambdaMax);
+    if (numBelowMax < 0)
+      return -2;
+  }
+  
+  int numBelowMin = theSOE->factor(shift);
+  if (numBelowMin < 0)
+    return -2;
+
+  if (n - numBelowMin < numModes) {
+    opserr << "SymSparseEigenSolver::solve() -- only " << n - numBelowMin
+	   << " eigenvalues above " << shift << ", " << numModes << " wanted\n";
+    return -1;
+  }
+
+  int numInWindow = numBelowMax - numBelowMin;
+  if (window == true && numInWindow < numModes) {
+    opserr << "WARNING SymSparseEigenSolver::solve() -- " << numInWindow 
+	   << " eigenvalues in the window [" << lambdaMin << "," << lambdaMax 
+	   << "], the " << numModes - numInWindow << " above it are also found\n";
+  }
+
+  //
+  // block Lanczos on (K - shift*M)^-1 M, the vectors being M-orthonormal 
+  // and in the numbering of the factorization. The projected matrix T is 
+  // block tridiagonal with the diagonal blocks A and off-diagonal blocks R,
+  // its eigenvalues theta giving lambda = shift + 1/theta.
+  //
+
+  int numThreads = theSOE->numThreads;
+  if (numThreads <= 0)
+    numThreads = std::thread::hardware_concurrency();
+  if (numThreads < 1)
+    numThreads = 1;
+  int blockSize = theSOE->blockSize;
+  if (blockSize <= 0)
+    blockSize = numThreads;
+  if (blockSize > n)
+    blockSize = n;
+
+  int maxVectors = 2*numModes;
+  if (maxVectors < numModes + 8*blockSize)
+    maxVectors = numModes + 8*blockSize;
+  maxVectors += blockSize;
+  if (maxVectors > n + blockSize)
+    maxVectors = n + blockSize;
+
+  if (Q == 0 || maxNumVectors < maxVectors) {
+    if (Q != 0)
+      delete [] Q;
+    Q = new double[(long)n*maxVectors];
+    maxNumVectors = maxVectors;
+  }
+
+  double *T = new double[maxNumVectors*maxNumVectors];
+  double *MQ = new double[n*blockSize];      // M times the current block
+  double *MQnext = new double[n*blockSize];
+  double *W = new double[n*blockSize];
+  double *MW = new double[n*blockSize];
+  double *H = new double[maxNumVectors*blockSize];
+  double *R = new double[blockSize*blockSize];
+  double *norms = new double[blockSize];
+
+  for (int i=0; i<maxNumVectors*maxNumVectors; i++)
+    T[i] = 0.0;
+
+  int tDim = maxNumVectors;
+  unsigned int seed = 7;
+
+  // the threads for the operations on the blocks, started once per solve()
+  LanczosWorkers theWorkers(numThreads < blockSize ? numThreads : blockSize);
+
+  // the start block, the operator applied to random vectors
+  for (int k=0; k<blockSize; k++)
+    randomVector(W+k*n, n, seed);
+
+  theWorkers.run(blockSize, [&](int k) {
+      double *w = W+k*n;
+      double *Mw = MW+k*n;
+      theSOE->multM(w, Mw);
+      memcpy(w, Mw, n*sizeof(double));
+      theSOE->solveShifted(w);
+      norms[k] = this->orthogonalize(w, Mw, 0, H+k*maxNumVectors);
+    });
+
+  int numW = blockSize;  // number of columns in W
+  int numVectors = 0;    // number in Q
+  int blockStart = 0;    // first of the current block
+  int bCur = 0;          // size of the current block
+  int bNext = 0;
+  bool converged = false;
+  int result = 0;
+
+  double *S = 0;         // eigenvectors of T
+  double *theta = 0;     // and its eigenvalues
+  int sDim = 0;
+  int numChecks = 0;
+  int checkInterval = numModes/(4*blockSize);
+  if (checkInterval < 1)
+    checkInterval = 1;
+
+  for (int step = 0; ; step++) {
+
+    //
+    // M-orthonormalize W into the next block, W = Qnext R
+    //
+
+    bNext = 0;
+    for (int k=0; k<numW; k++) {
+      double *w = W+k*n;
+      double *Mw = MW+k*n;
+
+      for (int l=0; l<bNext; l++) {
+	double r = dot(MQnext+l*n, w, n);
+	R[l*blockSize + k] = r;
+	double *q = Q+(long)(numVectors+l)*n;
+	double *Mq = MQnext+l*n;
+	for (int i=0; i<n; i++) {
+	  w[i] -= r*q[i];
+	  Mw[i] -= r*Mq[i];
+	}
+      }
+      for (int l=bNext; l<blockSize; l++)
+	R[l*blockSize + k] = 0.0;
+
+      double norm = dot(w, Mw, n);
+      norm = (norm > 0.0) ? sqrt(norm) : 0.0;
+
+      if (norm <= 1.0e-10*norms[k]) {
+	// w lies in the space already found, restart with a random vector
+	// orthogonal to it, unless that space is the whole space
+	if (numVectors + bNext >= n)
+	  continue;
+	randomVector(w, n, seed);
+	double normR = this->orthogonalize(w, Mw, numVectors+bNext, H+k*maxNumVectors);
+	norm = dot(w, Mw, n);
+	norm = (norm > 0.0) ? sqrt(norm) : 0.0;
+	if (norm <= 1.0e-10*normR)
+	  continue;
+      } else
+	R[bNext*blockSize + k] = norm;
+
+      double *q = Q+(long)(numVectors+bNext)*n;
+      double *Mq = MQnext+bNext*n;
+      for (int i=0; i<n; i++) {
+	q[i] = w[i]/norm;
+	Mq[i] = Mw[i]/norm;
+      }
+      bNext++;
+    }
+
+    // the off-diagonal block of T
+    if (step > 0) {
+      for (int l=0; l<bNext; l++)
+	for (int k=0; k<bCur; k++) {
+	  double r = R[l*blockSize + k];
+	  T[(blockStart+k)*tDim + numVectors+l] = r;
+	  T[(numVectors+l)*tDim + blockStart+k] = r;
+	}
+    }
+
+    //
+    // check the convergence of the wanted Ritz pairs, the largest theta, of
+    // the T formed so far; R couples it to the next block
+    //
+
+    bool exhausted = (bNext == 0);
+    if (step > 0 && numVectors >= numModes &&
+	(exhausted == true || numVectors + bNext > maxNumVectors - blockSize ||
+	 numChecks++ % checkInterval == 0)) {
+
+      if (sDim < numVectors) {
+	if (S != 0) delete [] S;
+	if (theta != 0) delete [] theta;
+	S = new double[numVectors*numVectors];
+	theta = new double[numVectors];
+	sDim = numVectors;
+      }
+
+      int d = numVectors;
+      for (int j=0; j<d; j++)
+	for (int i=0; i<d; i++)
+	  S[j*d+i] = T[j*tDim+i];
+
+      char jobz[] = "V";
+      char uplo[] = "L";
+      int lwork = 8*d;
+      double *work = new double[lwork];
+      int info = 0;
+#ifdef _WIN32
+      DSYEV(jobz, uplo, &d, S, &d, theta, work, &lwork, &info);
+#else
+      dsyev_(jobz, uplo, &d, S, &d, theta, work, &lwork, &info);
+#endif
+      delete [] work;
+
+      if (info != 0) {
+	opserr << "SymSparseEigenSolver::solve() -- LAPACK dsyev returned error " << info << endln;
+	result = -3;
+	break;
+      }
+
+      // the wanted are the numModes largest, all positive
+      converged = theta[d-numModes] > 0.0;
+      for (int m=d-1; m>=d-numModes && converged == true; m--) {
+	double *s = S + m*d + blockStart;
+	double res = 0.0;
+	for (int l=0; l<bNext; l++) {
+	  double rs = 0.0;
+	  for (int k=0; k<bCur; k++)
+	    rs += R[l*blockSize + k]*s[k];
+	  res += rs*rs;
+	}
+	if (sqrt(res) > SYMSPARSE_EIGEN_TOL*fabs(theta[m]))
+	  converged = false;
+      }
+
+      if (converged == true || exhausted == true)
+	break;
+    } else if (exhausted == true) {
+      opserr << "SymSparseEigenSolver::solve() -- only " << numVectors 
+	     << " Lanczos vectors could be found\n";
+      result = -3;
+      break;
+    }
+
+    numVectors += bNext;
+    blockStart = numVectors - bNext;
+    bCur = bNext;
+    double *temp = MQ; MQ = MQnext; MQnext = temp;
+
+    // make room for the next block
+    if (numVectors + bCur > maxNumVectors) {
+      int newMax = 2*maxNumVectors;
+      if (newMax > n + blockSize)
+	newMax = n + blockSize;
+
+      double *newQ = new double[(long)n*newMax];
+      memcpy(newQ, Q, (long)n*numVectors*sizeof(double));
+      delete [] Q;
+      Q = newQ;
+
+      double *newT = new double[newMax*newMax];
+      for (int i=0; i<newMax*newMax; i++)
+	newT[i] = 0.0;
+      for (int j=0; j<numVectors; j++)
+	for (int i=0; i<numVectors; i++)
+	  newT[j*newMax+i] = T[j*tDim+i];
+      delete [] T;
+      T = newT;
+      tDim = newMax;
+
+      delete [] H;
+      H = new double[newMax*blockSize];
+      maxNumVectors = newMax;
+    }
+
+    //
+    // apply the operator to the current block and orthogonalize the result
+    // against all the vectors; the coefficients for the current block give
+    // the diagonal block A of T
+    //
+
+    theWorkers.run(bCur, [&](int k) {
+	double *w = W+k*n;
+	memcpy(w, MQ+k*n, n*sizeof(double));
+	theSOE->solveShifted(w);
+	norms[k] = this->orthogonalize(w, MW+k*n, numVectors, H+k*maxNumVectors);
+      });
+    numW = bCur;
+
+    for (int k=0; k<bCur; k++)
+      for (int l=0; l<bCur; l++) {
+	double a = 0.5*(H[k*maxNumVectors + blockStart+l] + H[l*maxNumVectors + blockStart+k]);
+	T[(blockStart+k)*tDim + blockStart+l] = a;
+      }
+  }
+
+  //
+  // the eigenvalues and the eigenvectors, Q times those of T, in the
+  // original numbering
+  //
+
+  if (result == 0 && converged == false) {
+    opserr << "WARNING SymSparseEigenSolver::solve() -- the Lanczos iteration did not converge\n";
+    result = -3;
+  }
+
+  if (result == 0) {
+    int d = numVectors;
+    int *invp = theSOE->invp;
+
+    for (int m=0; m<numModes; m++)
+      eigenvalue[m] = shift + 1.0/theta[d-1-m];
+
+    double *Sw = new double[d*numModes];
+    for (int m=0; m<numModes; m++)
+      memcpy(Sw + m*d, S + (d-1-m)*d, d*sizeof(double));
+
+    double *X = new double[(long)n*numModes];
+    char transA[] = "N";
+    char transB[] = "N";
+    double alpha = 1.0;
+    double beta = 0.0;
+#ifdef _WIN32
+    DGEMM(transA, transB, &n, &numModes, &d, &alpha, Q, &n, Sw, &d, &beta, X, &n);
+#else
+    dgemm_(transA, transB, &n, &numModes, &d, &alpha, Q, &n, Sw, &d, &beta, X, &n);
+#endif
+
+    for (int m=0; m<numModes; m++) {
+      double *x = X + (long)m*n;
+      double *v = eigenvector + (long)m*n;
+      for (int i=0; i<n; i++)
+	v[i] = x[invp[i]];
+    }
+
+    delete [] Sw;
+    delete [] X;
+
+    // check none in the window have been missed
+    if (window == true) {
+      int numFound = 0;
+      for (int m=0; m<numModes; m++)
+	if (eigenvalue[m] < lambdaMax)
+	  numFound++;
+      int numWanted = (numInWindow < numModes) ? numInWindow : numModes;
+      if (numFound < numWanted) {
+	opserr << "WARNING SymSparseEigenSolver::solve() -- " << numWanted - numFound 
+	       << " eigenvalues in the window were missed, increase the block size\n";
+      }
+    }
+  }
+
+  delete [] T;
+  delete [] MQ;
+  delete [] MQnext;
+  delete [] W;
+  delete [] MW;
+  delete [] H;
+  delete [] R;
+  delete [] norms;
+  if (S != 0) delete [] S;
+  if (theta != 0) delete [] theta;
+
+  return result;
+}
+
+
+// double orthogonalize(double *w, double *Mw, int numVectors, double *h);
+//	M-orthogonalizes w against the first numVectors Lanczos vectors, 
+//	classical Gram-Schmidt applied twice, setting h to the coefficients 
+//	and Mw to M*w. Returns the M-norm of w before.
+
+double
+SymSparseEigenSolver::orthogonalize(double *w, double *Mw, int numVectors, double *h)
+{
+  int n = theSOE->size;
+
+  theSOE->multM(w, Mw);
+  double norm = dot(w, Mw, n);
+  norm = (norm > 0.0) ? sqrt(norm) : 0.0;
+
+  if (numVectors == 0)
+    return norm;
+
+  double *c = new double[numVectors];
+  for (int j=0; j<numVectors; j++)
+    h[j] = 0.0;
+
+  char trans[] = "T";
+  char noTrans[] = "N";
+  int inc = 1;
+  double one = 1.0;
+  double zero = 0.0;
+  double minusOne = -1.0;
+
+  for (int pass=0; pass<2; pass++) {
+    // c = Q'*M*w, w = w - Q*c
+#ifdef _WIN32
+    DGEMV(trans, &n, &numVectors, &one, Q, &n, Mw, &inc, &zero, c, &inc);
+    DGEMV(noTrans, &n, &numVectors, &minusOne, Q, &n, c, &inc, &one, w, &inc);
+#else
+    dgemv_(trans, &n, &numVectors, &one, Q, &n, Mw, &inc, &zero, c, &inc);
+    dgemv_(noTrans, &n, &numVectors, &minusOne, Q, &n, c, &inc, &one, w, &inc);
+#endif
+    for (int j=0; j<numVectors; j++)
+      h[j] += c[j];
+    theSOE->multM(w, Mw);
+  }
+
+  delete [] c;
+
+  return norm;
+}
+
+
+int
+SymSparseEigenSolver::setSize()
+{
+  int size = theSOE->size;    
+
+  if (eigenV == 0 || eigenV->Size() != size) {
+    if (eigenV != 0)
+      delete eigenV;
+    
+    eigenV = new Vector(size);
+    if (eigenV == 0 || eigenV->Size() != size) {
+      opserr << "SymSparseEigenSolver::setSize() -- ran out of memory for eigenvector of size " << size << endln;
+      return -2;	    
+    }
+
+    // the vectors of an old size are no longer of use
+    if (eigenvalue != 0)
+      delete [] eigenvalue;
+    if (eigenvector != 0)
+      delete [] eigenvector;
+    if (Q != 0)
+      delete [] Q;
+    eigenvalue = 0;
+    eigenvector = 0;
+    Q = 0;
+    numModes = 0;
+    maxNumVectors = 0;
+  }
+  
+  return 0;
+}
+
+
+int
+SymSparseEigenSolver::setEigenSOE(SymSparseEigenSOE &thisSOE)
+{
+  theSOE = &thisSOE;
+  return 0;
+}
+
+
+const Vector &
+SymSparseEigenSolver::getEigenvector(int mode)
+{
+  if (mode < 1 || mode > numModes) {
+    opserr << "SymSparseEigenSolver::getEigenVector() -- mode " << mode << " is out of range (1 - "
+	   << numModes << ")\n";
+
+    eigenV->Zero();
+    return *eigenV;  
+  }
+  
+  int size = theSOE->size;
+  int index = (mode - 1) * size;
+  
+  Vector &vec = *eigenV;
+  if (eigenvector != 0) {
+    for (int i = 0; i < size; i++) {
+      vec(i) = eigenvector[index++];
+    }	
+  }
+  else {
+    opserr << "SymSparseEigenSolver::getEigenVector() -- eigenvectors not yet computed\n";
+    eigenV->Zero();
+  }      
+  
+  return *eigenV;  
+}
+
+
+double
+SymSparseEigenSolver::getEigenvalue(int mode)
+{
+  if (mode < 1 || mode > numModes) {
+    opserr << "SymSparseEigenSolver::getEigenvalue() -- mode " << mode << " is out of range (1 - "
+	   << numModes << ")\n";
+
+    return 0.0;
+  }
+  
+  if (eigenvalue != 0)
+    return eigenvalue[mode-1];
+  else {
+    opserr << "SymSparseEigenSolver::getEigenvalue() -- eigenvalues not yet computed\n";
+    return 0.0;
+  }      
+}
+
+
+int    
+SymSparseEigenSolver::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+
+int
+SymSparseEigenSolver::recvSelf(int commitTag, Channel &theChannel, 
+			       FEM_ObjectBroker &theBroker)
+{
+  return 0;
+}
@@ -0,0 +1,75 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// SymSparseEigenSolver. A SymSparseEigenSolver finds the eigenvalues of
+// K x = lambda M x (or K x = lambda x) nearest above a shift, using a block
+// Lanczos method with full reorthogonalization on the shift-invert operator
+// (K - shift*M)^-1 M, the factorization being done by the 
+// SymSparseEigenSOE. The shift is the bottom of the eigenvalue window of the
+// SOE. The columns of a block are solved for, multiplied by M and 
+// reorthogonalized on separate threads.
+//
+// What: "@(#) SymSparseEigenSolver.h, revA"
+
+#ifndef SymSparseEigenSolver_h
+#define SymSparseEigenSolver_h
+
+#include <EigenSolver.h>
+#include <SymSparseEigenSOE.h>
+
+class SymSparseEigenSolver : public EigenSolver
+{
+  public:
+    SymSparseEigenSolver();    
+    virtual ~SymSparseEigenSolver();
+
+    virtual int solve(int numModes, bool generalized, bool findSmallest = true);
+    virtual int setSize(void);
+    virtual int setEigenSOE(SymSparseEigenSOE &theSOE);
+    
+    virtual const Vector &getEigenvector(int mode);
+    virtual double getEigenvalue(int mode);
+    
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, 
+		 FEM_ObjectBroker &theBroker);
+
+  protected:
+
+  private:
+    double orthogonalize(double *w, double *Mw, int numVectors, double *h);
+
+    SymSparseEigenSOE *theSOE;
+    int numModes;
+
+    double *eigenvalue;
+    double *eigenvector;
+    Vector *eigenV;
+
+    double *Q;       // the Lanczos vectors
+    int maxNumVectors;
+};
+
+#endif
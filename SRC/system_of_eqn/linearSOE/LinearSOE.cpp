@@ -32,6 +32,7 @@
 
 #include<LinearSOE.h>
 #include<LinearSOESolver.h>
+#include <Profiler.h>
 
 LinearSOE::LinearSOE(LinearSOESolver &theLinearSOESolver, int classtag)
     :MovableObject(classtag), theModel(0), theSolver(&theLinearSOESolver)
@@ -55,6 +56,8 @@ LinearSOE::~LinearSOE()
 int 
 LinearSOE::solve(void)
 {
+  OPS_PROFILE("LinearSOE::solve");
+
   if (theSolver != 0)
     return (theSolver->solve());
   else 
@@ -67,6 +70,18 @@ LinearSOE::formAp(const Vector &p, Vector &Ap)
   return 0;
 }
 
+int
+LinearSOE::saveA(void)
+{
+  return -1;
+}
+
+int
+LinearSOE::restoreA(void)
+{
+  return -1;
+}
+
 double
 LinearSOE::getDeterminant(void)
 {
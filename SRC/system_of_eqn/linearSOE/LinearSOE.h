@@ -74,6 +74,11 @@ class LinearSOE : public MovableObject
 
     virtual int formAp(const Vector &p, Vector &Ap);
 
+    // methods to keep a copy of A and to set A back to the copy, so 
+    // that a part of A need only be assembled once (-1 if not supported)
+    virtual int saveA(void);
+    virtual int restoreA(void);
+
     virtual const Vector &getX(void) = 0;
     virtual const Vector &getB(void) = 0;    
     virtual const Matrix *getA(void) {return 0;};    
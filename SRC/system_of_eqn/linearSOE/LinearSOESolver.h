@@ -49,6 +49,11 @@ class LinearSOESolver : public MovableObject
     virtual int solve(void) = 0;
     virtual int setSize(void) = 0;
     virtual double getDeterminant(void) {return 1.0;};
+
+    // number of factorizations that followed a new symbolic analysis and
+    // that reused the last one, -1 if the solver does not keep count
+    virtual int getNumFullFactorizations(void) {return -1;};
+    virtual int getNumNumericFactorizations(void) {return -1;};
     
   protected:
     
@@ -0,0 +1,145 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the implementation of ScatterMap.
+//
+// What: "@(#) ScatterMap.cpp, revA"
+
+#include <ScatterMap.h>
+#include <Matrix.h>
+
+ScatterEntry::ScatterEntry(const ID &id, int maxNumLocs)
+  :theID(id), numLocs(0), locs(0), pos(0)
+{
+  if (maxNumLocs > 0) {
+    locs = new double *[maxNumLocs];
+    pos = new int[maxNumLocs];
+  }
+}
+
+ScatterEntry::~ScatterEntry()
+{
+  if (locs != 0)
+    delete [] locs;
+  if (pos != 0)
+    delete [] pos;
+}
+
+
+ScatterMap::ScatterMap()
+{
+
+}
+
+ScatterMap::~ScatterMap()
+{
+  this->clear();
+}
+
+// ScatterEntry *getEntry(const ID &id);
+//	returns the entry formed for the ID, or 0 if there is none or the 
+//	contents of the ID have changed since the entry was formed.
+
+ScatterEntry *
+ScatterMap::getEntry(const ID &id)
+{
+  std::map<const ID *, ScatterEntry *>::iterator theEntry = theEntries.find(&id);
+  if (theEntry == theEntries.end())
+    return 0;
+
+  const ID &mappedID = theEntry->second->theID;
+  int idSize = id.Size();
+  if (mappedID.Size() != idSize)
+    return 0;
+
+  for (int i=0; i<idSize; i++)
+    if (mappedID(i) != id(i))
+      return 0;
+
+  return theEntry->second;
+}
+
+// ScatterEntry *newEntry(const ID &id, int maxNumLocs);
+//	creates a new entry for the ID, replacing any old one, with room for
+//	maxNumLocs locations. The caller fills in the locations.
+
+ScatterEntry *
+ScatterMap::newEntry(const ID &id, int maxNumLocs)
+{
+  this->removeEntry(id);
+
+  ScatterEntry *newEntry = new ScatterEntry(id, maxNumLocs);
+  theEntries[&id] = newEntry;
+
+  return newEntry;
+}
+
+// void removeEntry(const ID &id);
+//	removes the entry of the ID, if any; to be invoked when the entry 
+//	could not be completed so the ID is mapped again on the next call.
+
+void
+ScatterMap::removeEntry(const ID &id)
+{
+  std::map<const ID *, ScatterEntry *>::iterator theEntry = theEntries.find(&id);
+  if (theEntry != theEntries.end()) {
+    delete theEntry->second;
+    theEntries.erase(theEntry);
+  }
+}
+
+// int addMatrix(const ScatterEntry &theEntry, const Matrix &m, double fact);
+//	adds fact times the entries of m to the locations of the entry.
+
+int
+ScatterMap::addMatrix(const ScatterEntry &theEntry, const Matrix &m, double fact)
+{
+  int numLocs = theEntry.numLocs;
+  double **locs = theEntry.locs;
+  const int *pos = theEntry.pos;
+  const double *data = m.data;
+
+  if (fact == 1.0) { // do not need to multiply
+    for (int i=0; i<numLocs; i++)
+      *(locs[i]) += data[pos[i]];
+  } else {
+    for (int i=0; i<numLocs; i++)
+      *(locs[i]) += fact * data[pos[i]];
+  }
+
+  return 0;
+}
+
+// void clear(void);
+//	removes all the entries, to be invoked when the storage of A changes.
+
+void
+ScatterMap::clear(void)
+{
+  std::map<const ID *, ScatterEntry *>::iterator theEntry;
+  for (theEntry = theEntries.begin(); theEntry != theEntries.end(); theEntry++)
+    delete theEntry->second;
+
+  theEntries.clear();
+}
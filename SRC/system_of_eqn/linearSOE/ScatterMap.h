@@ -0,0 +1,73 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the class definition for ScatterMap.
+// A ScatterMap is used by the sparse LinearSOE classes to remember, for each
+// ID passed to addA(), where in their storage of A each entry of the matrix
+// is to be added. The map of an ID is formed the first time the ID is seen,
+// the search of the sparse storage then being skipped on later calls. The 
+// IDs are identified by their address, the contents being checked on each
+// call so an ID that has changed is mapped again. The maps are only valid 
+// for the storage of A they were formed for and must be cleared whenever 
+// that storage changes, i.e. in setSize().
+//
+// What: "@(#) ScatterMap.h, revA"
+
+#ifndef ScatterMap_h
+#define ScatterMap_h
+
+#include <ID.h>
+#include <map>
+
+class Matrix;
+
+class ScatterEntry
+{
+  public:
+    ScatterEntry(const ID &id, int maxNumLocs);
+    ~ScatterEntry();
+
+    ID theID;        // copy of the ID the entry was formed for
+    int numLocs;     // number of entries of the matrix to add
+    double **locs;   // location in A of each entry
+    int *pos;        // position of each entry in the matrix, col*noRows + row
+};
+
+class ScatterMap
+{
+  public:
+    ScatterMap();
+    ~ScatterMap();
+
+    ScatterEntry *getEntry(const ID &id);
+    ScatterEntry *newEntry(const ID &id, int maxNumLocs);
+    void removeEntry(const ID &id);
+    int addMatrix(const ScatterEntry &theEntry, const Matrix &m, double fact);
+    void clear(void);
+
+  private:
+    std::map<const ID *, ScatterEntry *> theEntries;
+};
+
+#endif
@@ -0,0 +1,261 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Written: agent
+// Created: Oct 2026
+//
+// Purpose: This file is a driver to test the ScatterMap used by the sparse
+// LinearSOE addA(). The element matrices of a grid of 4 node quads are
+// added to a SparseGenColLinSOE, the entries of A being compared, by a
+// linear search of the column storage, with a dense A assembled alongside.
+// It is done when the maps are formed, when they are used again, after the
+// contents of an ID change in place, for an ID at a new address and after
+// setSize() has moved the storage of A.
+//
+//   testScatterMap <numQuads in x> <numQuads in y>
+
+#include <stdlib.h>
+#include <math.h>
+
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+
+#include <SparseGenColLinSOE.h>
+#include <SparseGenColLinSolver.h>
+
+// global variables
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+double        ops_Dt = 0;
+Domain       *ops_TheActiveDomain = 0;
+Element      *ops_TheActiveElement = 0;
+
+// a solver that does nothing, only A is looked at
+class TestColSolver : public SparseGenColLinSolver
+{
+  public:
+    TestColSolver() :SparseGenColLinSolver(0) {}
+    int solve(void) {return 0;}
+    int setSize(void) {return 0;}
+    int sendSelf(int commitTag, Channel &theChannel) {return -1;}
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker) {return -1;}
+};
+
+// gives the entries of A, found by a linear search of the column
+class TestColSOE : public SparseGenColLinSOE
+{
+  public:
+    TestColSOE(SparseGenColLinSolver &theSolver) :SparseGenColLinSOE(theSolver) {}
+
+    // -1 if (row,col) is not stored
+    int getA(int row, int col, double &value) {
+      for (int k=colStartA[col]; k<colStartA[col+1]; k++)
+	if (rowA[k] == row) {
+	  value = A[k];
+	  return 0;
+	}
+      return -1;
+    }
+};
+
+static int nx = 4;
+static int ny = 3;
+static int numTests = 0;
+static int numFailed = 0;
+
+// the dof of the 4 nodes of quad e, the first node is fixed
+static void
+getQuadID(int e, ID &id)
+{
+  int i = e % nx;
+  int j = e / nx;
+  int nodes[4];
+  nodes[0] = j*(nx+1) + i;
+  nodes[1] = nodes[0] + 1;
+  nodes[2] = nodes[1] + nx+1;
+  nodes[3] = nodes[0] + nx+1;
+  for (int a=0; a<4; a++) {
+    id(2*a) = 2*nodes[a] - 2;
+    id(2*a+1) = 2*nodes[a] - 1;
+  }
+}
+
+// an unsymmetric matrix with entries differing from quad to quad
+static void
+getQuadMatrix(int e, Matrix &k)
+{
+  for (int a=0; a<8; a++)
+    for (int b=0; b<8; b++)
+      k(a,b) = 1.0 + e + 0.1*a + 0.01*b;
+}
+
+// the graph of the equations, with extra edges between nodes two apart
+// in x if extra is true, for the LinearSOE setSize()
+static void
+buildGraph(Graph &theGraph, int numEqn, ID *ids, bool extra)
+{
+  for (int i=0; i<numEqn; i++)
+    theGraph.addVertex(new Vertex(i, i), false);
+
+  for (int e=0; e<nx*ny; e++) {
+    ID &id = ids[e];
+    for (int a=0; a<8; a++)
+      for (int b=0; b<8; b++)
+	if (a != b && id(a) >= 0 && id(b) >= 0)
+	  theGraph.addEdge(id(a), id(b));
+  }
+
+  if (extra == true)
+    for (int i=0; i+4<numEqn; i++)
+      theGraph.addEdge(i, i+4);
+}
+
+// adds the quads through addA() and to the dense Aref
+static void
+addQuads(LinearSOE &theSOE, Matrix &Aref, ID *ids, double fact)
+{
+  Matrix k(8,8);
+  for (int e=0; e<nx*ny; e++) {
+    const ID &id = ids[e];
+    getQuadMatrix(e, k);
+    theSOE.addA(k, id, fact);
+    for (int a=0; a<8; a++)
+      for (int b=0; b<8; b++)
+	if (id(a) >= 0 && id(b) >= 0)
+	  Aref(id(a),id(b)) += fact*k(a,b);
+  }
+}
+
+// compares A of theSOE with Aref, every nonzero of Aref must be stored
+static void
+compare(TestColSOE &theSOE, const Matrix &Aref, const char *what)
+{
+  int numEqn = Aref.noRows();
+  double maxDiff = 0.0;
+  int numMissing = 0;
+  for (int i=0; i<numEqn; i++)
+    for (int j=0; j<numEqn; j++) {
+      double value;
+      if (theSOE.getA(i, j, value) < 0) {
+	if (Aref(i,j) != 0.0)
+	  numMissing++;
+      } else if (fabs(value - Aref(i,j)) > maxDiff)
+	maxDiff = fabs(value - Aref(i,j));
+    }
+
+  numTests++;
+  if (numMissing == 0 && maxDiff < 1.0e-12)
+    opserr << "PASS: " << what << endln;
+  else {
+    opserr << "FAIL: " << what << ", max difference " << maxDiff;
+    opserr << ", " << numMissing << " entries not stored\n";
+    numFailed++;
+  }
+}
+
+
+int main(int argc, char **argv)
+{
+  if (argc > 1)
+    nx = atoi(argv[1]);
+  if (argc > 2)
+    ny = atoi(argv[2]);
+  if (nx < 1 || ny < 1) {
+    opserr << "usage: testScatterMap <numQuads in x> <numQuads in y>\n";
+    return -1;
+  }
+
+  int numEqn = 2*(nx+1)*(ny+1) - 2;
+  int numEle = nx*ny;
+
+  // the IDs stay at the same address between calls, as in the FE_Elements
+  ID *ids = new ID[numEle];
+  for (int e=0; e<numEle; e++) {
+    ids[e].resize(8);
+    getQuadID(e, ids[e]);
+  }
+
+  TestColSolver *theSolver = new TestColSolver();
+  TestColSOE theSOE(*theSolver);
+  Matrix Aref(numEqn, numEqn);
+
+  Graph theGraph(numEqn);
+  buildGraph(theGraph, numEqn, ids, false);
+  theSOE.setSize(theGraph);
+
+  // the maps are formed
+  theSOE.zeroA();
+  addQuads(theSOE, Aref, ids, 1.0);
+  compare(theSOE, Aref, "A when the maps are formed");
+
+  // the maps are used, twice with different factors
+  theSOE.zeroA();
+  Aref.Zero();
+  addQuads(theSOE, Aref, ids, 1.0);
+  addQuads(theSOE, Aref, ids, -0.5);
+  compare(theSOE, Aref, "A when the maps are used again");
+
+  // an ID changed in place: two of its dofs swapped
+  int e = numEle/2;
+  int dof = ids[e](2);
+  ids[e](2) = ids[e](5);
+  ids[e](5) = dof;
+  theSOE.zeroA();
+  Aref.Zero();
+  addQuads(theSOE, Aref, ids, 1.0);
+  compare(theSOE, Aref, "A after an ID changes in place");
+
+  // the IDs copied to new addresses
+  ID *newIds = new ID[numEle];
+  for (int i=0; i<numEle; i++)
+    newIds[i] = ids[i];
+  theSOE.zeroA();
+  Aref.Zero();
+  addQuads(theSOE, Aref, newIds, 1.0);
+  addQuads(theSOE, Aref, ids, 2.0);
+  compare(theSOE, Aref, "A with the IDs at new addresses");
+
+  // setSize() with more entries moves the storage of A
+  Graph theNewGraph(numEqn);
+  buildGraph(theNewGraph, numEqn, ids, true);
+  theSOE.setSize(theNewGraph);
+  theSOE.zeroA();
+  Aref.Zero();
+  addQuads(theSOE, Aref, ids, 1.0);
+  addQuads(theSOE, Aref, ids, 3.0);
+  compare(theSOE, Aref, "A after setSize()");
+
+  delete [] newIds;
+  delete [] ids;
+
+  opserr << numTests - numFailed << " of " << numTests << " tests passed\n";
+
+  if (numFailed != 0)
+    return -1;
+
+  return 0;
+}
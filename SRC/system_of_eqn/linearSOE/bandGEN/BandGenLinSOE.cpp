@@ -44,7 +44,7 @@ using std::nothrow;
 BandGenLinSOE::BandGenLinSOE(BandGenLinSolver &theSolvr)
 :LinearSOE(theSolvr, LinSOE_TAGS_BandGenLinSOE),
  size(0), numSuperD(0), numSubD(0), A(0), B(0), X(0), 
- vectX(0), vectB(0), Asize(0), Bsize(0), factored(false)
+ vectX(0), vectB(0), Asize(0), Bsize(0), factored(false), Asaved(0)
 {
     theSolvr.setLinearSOE(*this);
 }
@@ -52,7 +52,7 @@ BandGenLinSOE::BandGenLinSOE(BandGenLinSolver &theSolvr)
 BandGenLinSOE::BandGenLinSOE()
 :LinearSOE(LinSOE_TAGS_BandGenLinSOE),
  size(0), numSuperD(0), numSubD(0), A(0), B(0), X(0), 
- vectX(0), vectB(0), Asize(0), Bsize(0), factored(false)
+ vectX(0), vectB(0), Asize(0), Bsize(0), factored(false), Asaved(0)
 {
 
 }
@@ -60,7 +60,7 @@ BandGenLinSOE::BandGenLinSOE()
 BandGenLinSOE::BandGenLinSOE(int classTag)
 :LinearSOE(classTag),
  size(0), numSuperD(0), numSubD(0), A(0), B(0), X(0), 
- vectX(0), vectB(0), Asize(0), Bsize(0), factored(false)
+ vectX(0), vectB(0), Asize(0), Bsize(0), factored(false), Asaved(0)
 {
 
 }
@@ -70,7 +70,7 @@ BandGenLinSOE::BandGenLinSOE(int N, int numSuperDiag, int numSubDiag,
 			     BandGenLinSolver &theSolvr)
 :LinearSOE(theSolvr, LinSOE_TAGS_BandGenLinSOE),
  size(N), numSuperD(numSuperDiag), numSubD(numSubDiag), A(0), B(0), 
- X(0), vectX(0), vectB(0), Asize(0), Bsize(0), factored(false)
+ X(0), vectX(0), vectB(0), Asize(0), Bsize(0), factored(false), Asaved(0)
 {
     Asize = N * (2*numSubD + numSuperD +1);
     A = new (nothrow)double[Asize];
@@ -128,6 +128,7 @@ BandGenLinSOE::~BandGenLinSOE()
     if (X != 0) delete [] X;
     if (vectX != 0) delete vectX;    
     if (vectB != 0) delete vectB;    
+    if (Asaved != 0) delete [] Asaved;
 }
 
 
@@ -138,6 +139,12 @@ BandGenLinSOE::setSize(Graph &theGraph)
     int result = 0;
     int oldSize = size;
     size = theGraph.getNumVertex();
+
+    // the saved A no longer fits
+    if (Asaved != 0) {
+	delete [] Asaved;
+	Asaved = 0;
+    }
     
     /*
      * determine the number of superdiagonals and subdiagonals
@@ -460,6 +467,36 @@ BandGenLinSOE::zeroA(void)
     
     factored = false;
 }
+
+int
+BandGenLinSOE::saveA(void)
+{
+    if (Asaved == 0) {
+	Asaved = new (nothrow) double[Asize];
+	if (Asaved == 0) {
+	    opserr << "WARNING BandGenLinSOE::saveA() - ran out of memory\n";
+	    return -1;
+	}
+    }
+
+    for (int i=0; i<Asize; i++)
+	Asaved[i] = A[i];
+
+    return 0;
+}
+
+int
+BandGenLinSOE::restoreA(void)
+{
+    if (Asaved == 0)
+	return -1;
+
+    for (int i=0; i<Asize; i++)
+	A[i] = Asaved[i];
+    
+    factored = false;
+    return 0;
+}
 	
 void 
 BandGenLinSOE::zeroB(void)
@@ -64,6 +64,9 @@ class BandGenLinSOE : public LinearSOE
     virtual void zeroA(void);
     virtual void zeroB(void);
 
+    virtual int saveA(void);
+    virtual int restoreA(void);
+
     virtual const Vector &getX(void);
     virtual const Vector &getB(void);
     virtual double normRHS(void);
@@ -84,6 +87,7 @@ class BandGenLinSOE : public LinearSOE
     Vector *vectB;
     int Asize, Bsize;
     bool factored;
+    double *Asaved;      // copy of A kept by saveA()
     
   private:
 };
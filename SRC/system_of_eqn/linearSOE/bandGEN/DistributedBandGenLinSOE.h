@@ -56,6 +56,10 @@ class DistributedBandGenLinSOE : public BandGenLinSOE
     const Vector &getB(void);
     int solve(void);
 
+    // A is combined with that of the other processes in solve()
+    int saveA(void) {return -1;}
+    int restoreA(void) {return -1;}
+
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
     friend class BandGenLinLapackSolver;
@@ -48,7 +48,7 @@ BandSPDLinSOE::BandSPDLinSOE(BandSPDLinSolver &the_Solver)
 :LinearSOE(the_Solver, LinSOE_TAGS_BandSPDLinSOE),
  size(0), half_band(0), A(0), B(0), X(0), vectX(0), vectB(0),
  Asize(0), Bsize(0),
- factored(false)
+ factored(false), Asaved(0)
 {
     the_Solver.setLinearSOE(*this);
 }
@@ -58,7 +58,7 @@ BandSPDLinSOE::BandSPDLinSOE(BandSPDLinSolver &the_Solver, int classTag)
 :LinearSOE(the_Solver, classTag),
  size(0), half_band(0), A(0), B(0), X(0), vectX(0), vectB(0),
  Asize(0), Bsize(0),
- factored(false)
+ factored(false), Asaved(0)
 {
 
 }
@@ -68,7 +68,7 @@ BandSPDLinSOE::BandSPDLinSOE(int classTag)
 :LinearSOE(classTag),
  size(0), half_band(0), A(0), B(0), X(0), vectX(0), vectB(0),
  Asize(0), Bsize(0),
- factored(false)
+ factored(false), Asaved(0)
 {
 
 }
@@ -79,7 +79,7 @@ BandSPDLinSOE::BandSPDLinSOE(int N, int numSuper,
 :LinearSOE(the_Solver, LinSOE_TAGS_BandSPDLinSOE),
  size(0), half_band(0), A(0), B(0), X(0), vectX(0), vectB(0),
  Asize(0), Bsize(0),
- factored(false)
+ factored(false), Asaved(0)
 {
     size = N;
     half_band = numSuper+1;
@@ -137,6 +137,7 @@ BandSPDLinSOE::~BandSPDLinSOE()
     if (X != 0) delete [] X;
     if (vectX != 0) delete vectX;    
     if (vectB != 0) delete vectB;        
+    if (Asaved != 0) delete [] Asaved;
 }
 
 
@@ -152,6 +153,13 @@ BandSPDLinSOE::setSize(Graph &theGraph)
     int result = 0;
     int oldSize = size;
     size = theGraph.getNumVertex();
+
+    // the saved A no longer fits
+    if (Asaved != 0) {
+	delete [] Asaved;
+	Asaved = 0;
+    }
+
     half_band = 0;
     
     Vertex *vertexPtr;
@@ -414,6 +422,36 @@ BandSPDLinSOE::zeroA(void)
     
     factored = false;
 }
+
+int
+BandSPDLinSOE::saveA(void)
+{
+    if (Asaved == 0) {
+	Asaved = new (nothrow) double[Asize];
+	if (Asaved == 0) {
+	    opserr << "WARNING BandSPDLinSOE::saveA() - ran out of memory\n";
+	    return -1;
+	}
+    }
+
+    for (int i=0; i<Asize; i++)
+	Asaved[i] = A[i];
+
+    return 0;
+}
+
+int
+BandSPDLinSOE::restoreA(void)
+{
+    if (Asaved == 0)
+	return -1;
+
+    for (int i=0; i<Asize; i++)
+	A[i] = Asaved[i];
+    
+    factored = false;
+    return 0;
+}
 	
 void 
 BandSPDLinSOE::zeroB(void)
@@ -65,6 +65,9 @@ class BandSPDLinSOE : public LinearSOE
     
     virtual void zeroA(void);
     virtual void zeroB(void);
+
+    virtual int saveA(void);
+    virtual int restoreA(void);
     
     virtual const Vector &getX(void);
     virtual const Vector &getB(void);    
@@ -89,6 +92,7 @@ class BandSPDLinSOE : public LinearSOE
     int Asize, Bsize;
     int aFactored;
     bool factored;
+    double *Asaved;      // copy of A kept by saveA()
     
   private:
 };
@@ -54,6 +54,11 @@ class DistributedProfileSPDLinSOE : public ProfileSPDLinSOE
     void zeroB(void);
     int setSize(Graph &theGraph);
     int solve(void);
+
+    // A is combined with that of the other processes in solve()
+    int saveA(void) {return -1;}
+    int restoreA(void) {return -1;}
+
     const Vector &getB(void);
 
     int sendSelf(int commitTag, Channel &theChannel);
@@ -48,7 +48,7 @@ ProfileSPDLinSOE::ProfileSPDLinSOE(ProfileSPDLinSolver &the_Solver)
 :LinearSOE(the_Solver, LinSOE_TAGS_ProfileSPDLinSOE),
  size(0), profileSize(0), A(0), B(0), X(0), vectX(0), vectB(0),
  iDiagLoc(0), Asize(0), Bsize(0), isAfactored(false), isAcondensed(false),
- numInt(0) 
+ numInt(0), Asaved(0)
 {
     the_Solver.setLinearSOE(*this);
 }
@@ -58,7 +58,7 @@ ProfileSPDLinSOE::ProfileSPDLinSOE(int classTag)
 :LinearSOE(classTag),
  size(0), profileSize(0), A(0), B(0), X(0), vectX(0), vectB(0),
  iDiagLoc(0), Asize(0), Bsize(0), isAfactored(false), isAcondensed(false),
- numInt(0) 
+ numInt(0), Asaved(0)
 {
 
 }
@@ -68,7 +68,7 @@ ProfileSPDLinSOE::ProfileSPDLinSOE(ProfileSPDLinSolver &the_Solver, int classTag
 :LinearSOE(the_Solver, classTag),
  size(0), profileSize(0), A(0), B(0), X(0), vectX(0), vectB(0),
  iDiagLoc(0), Asize(0), Bsize(0), isAfactored(false), isAcondensed(false),
- numInt(0) 
+ numInt(0), Asaved(0)
 {
     the_Solver.setLinearSOE(*this);
 }
@@ -79,7 +79,7 @@ ProfileSPDLinSOE::ProfileSPDLinSOE(int N, int *iLoc,
 :LinearSOE(the_Solver, LinSOE_TAGS_ProfileSPDLinSOE),
  size(0), profileSize(0), A(0), B(0), X(0), vectX(0), vectB(0),
  iDiagLoc(0), Asize(0), Bsize(0), isAfactored(false), isAcondensed(false),
- numInt(0)
+ numInt(0), Asaved(0)
 {
     size = N;
     profileSize = iLoc[N-1];
@@ -139,6 +139,7 @@ ProfileSPDLinSOE::~ProfileSPDLinSOE()
     if (iDiagLoc != 0) delete [] iDiagLoc;
     if (vectX != 0) delete vectX;    
     if (vectB != 0) delete vectB;    
+    if (Asaved != 0) delete [] Asaved;
 }
 
 
@@ -155,6 +156,12 @@ ProfileSPDLinSOE::setSize(Graph &theGraph)
     int result = 0;
     size = theGraph.getNumVertex();
 
+    // the saved A no longer fits
+    if (Asaved != 0) {
+	delete [] Asaved;
+	Asaved = 0;
+    }
+
     // check we have enough space in iDiagLoc and iLastCol
     // if not delete old and create new
     if (size > Bsize) { 
@@ -492,6 +499,36 @@ ProfileSPDLinSOE::zeroA(void)
     
     isAfactored = false;
 }
+
+int
+ProfileSPDLinSOE::saveA(void)
+{
+    if (Asaved == 0) {
+	Asaved = new (nothrow) double[Asize];
+	if (Asaved == 0) {
+	    opserr << "WARNING ProfileSPDLinSOE::saveA() - ran out of memory\n";
+	    return -1;
+	}
+    }
+
+    for (int i=0; i<Asize; i++)
+	Asaved[i] = A[i];
+
+    return 0;
+}
+
+int
+ProfileSPDLinSOE::restoreA(void)
+{
+    if (Asaved == 0)
+	return -1;
+
+    for (int i=0; i<Asize; i++)
+	A[i] = Asaved[i];
+    
+    isAfactored = false;
+    return 0;
+}
 	
 void 
 ProfileSPDLinSOE::zeroB(void)
@@ -60,6 +60,9 @@ class ProfileSPDLinSOE : public LinearSOE
     virtual void zeroA(void);
     virtual void zeroB(void);
 
+    virtual int saveA(void);
+    virtual int restoreA(void);
+
     virtual void setX(int loc, double value);
     virtual void setX(const Vector &x);
     
@@ -88,6 +91,7 @@ class ProfileSPDLinSOE : public LinearSOE
     int Asize, Bsize;
     bool isAfactored, isAcondensed;
     int numInt;
+    double *Asaved;     // copy of A kept by saveA()
     
   private:
 };
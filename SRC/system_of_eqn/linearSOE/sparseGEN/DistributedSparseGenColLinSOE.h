@@ -57,6 +57,10 @@ class DistributedSparseGenColLinSOE : public SparseGenColLinSOE
     void zeroB(void);
     int solve(void);
 
+    // A is combined with that of the other processes in solve()
+    int saveA(void) {return -1;}
+    int restoreA(void) {return -1;}
+
 
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
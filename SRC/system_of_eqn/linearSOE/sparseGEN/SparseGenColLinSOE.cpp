@@ -50,7 +50,7 @@ SparseGenColLinSOE::SparseGenColLinSOE(SparseGenColLinSolver &the_Solver)
  size(0), nnz(0), A(0), B(0), X(0), rowA(0), colStartA(0),
  vectX(0), vectB(0),
  Asize(0), Bsize(0),
- factored(false)
+ factored(false), Asaved(0)
 {
     the_Solver.setLinearSOE(*this);
 }
@@ -61,7 +61,7 @@ SparseGenColLinSOE::SparseGenColLinSOE()
  size(0), nnz(0), A(0), B(0), X(0), rowA(0), colStartA(0),
  vectX(0), vectB(0),
  Asize(0), Bsize(0),
- factored(false)
+ factored(false), Asaved(0)
 {
 
 }
@@ -71,7 +71,7 @@ SparseGenColLinSOE::SparseGenColLinSOE(int classTag)
  size(0), nnz(0), A(0), B(0), X(0), rowA(0), colStartA(0),
  vectX(0), vectB(0),
  Asize(0), Bsize(0),
- factored(false)
+ factored(false), Asaved(0)
 {
 
 }
@@ -82,7 +82,7 @@ SparseGenColLinSOE::SparseGenColLinSOE(SparseGenColLinSolver &the_Solver, int cl
    size(0), nnz(0), A(0), B(0), X(0), rowA(0), colStartA(0),
    vectX(0), vectB(0),
    Asize(0), Bsize(0),
-   factored(false)
+   factored(false), Asaved(0)
 {
   //    the_Solver.setLinearSOE(*this);
 }
@@ -95,7 +95,7 @@ SparseGenColLinSOE::SparseGenColLinSOE(int N, int NNZ, int *ColStartA, int *RowA
  rowA(RowA), colStartA(ColStartA), 
  vectX(0), vectB(0),
  Asize(0), Bsize(0),
- factored(false)
+ factored(false), Asaved(0)
 {
 
     A = new (nothrow) double[NNZ];
@@ -151,6 +151,7 @@ SparseGenColLinSOE::~SparseGenColLinSOE()
     if (rowA != 0) delete []rowA;
     if (vectX != 0) delete vectX;    
     if (vectB != 0) delete vectB;        
+    if (Asaved != 0) delete [] Asaved;
 }
 
 
@@ -168,6 +169,15 @@ SparseGenColLinSOE::setSize(Graph &theGraph)
     int oldSize = size;
     size = theGraph.getNumVertex();
 
+    // the saved A no longer fits
+    if (Asaved != 0) {
+	delete [] Asaved;
+	Asaved = 0;
+    }
+
+    // the locations found by addA() are no longer valid
+    theScatterMap.clear();
+
     // fist itearte through the vertices of the graph to get nnz
     Vertex *theVertex;
     int newNNZ = 0;
@@ -320,26 +330,11 @@ SparseGenColLinSOE::addA(const Matrix &m, const ID &id, double fact)
 	return -1;
     }
     
-    if (fact == 1.0) { // do not need to multiply 
-      for (int i=0; i<idSize; i++) {
-	int col = id(i);
-	if (col < size && col >= 0) {
-	  int startColLoc = colStartA[col];
-	  int endColLoc = colStartA[col+1];
-	  for (int j=0; j<idSize; j++) {
-	    int row = id(j);
-	    if (row <size && row >= 0) {
-	      // find place in A using rowA
-	      for (int k=startColLoc; k<endColLoc; k++)
-		if (rowA[k] == row) {
-		  A[k] += m(j,i);
-		  k = endColLoc;
-		}
-	    }
-	  }  // for j		
-	} 
-      }  // for i
-    } else {
+    // if the id has not been seen, find the location in A of each entry
+    ScatterEntry *theEntry = theScatterMap.getEntry(id);
+    if (theEntry == 0) {
+      theEntry = theScatterMap.newEntry(id, idSize*idSize);
+      int numLocs = 0;
       for (int i=0; i<idSize; i++) {
 	int col = id(i);
 	if (col < size && col >= 0) {
@@ -351,15 +346,19 @@ SparseGenColLinSOE::addA(const Matrix &m, const ID &id, double fact)
 	      // find place in A using rowA
 	      for (int k=startColLoc; k<endColLoc; k++)
 		if (rowA[k] == row) {
-		  A[k] += fact * m(j,i);
+		  theEntry->locs[numLocs] = &A[k];
+		  theEntry->pos[numLocs] = i*idSize + j; // m(j,i)
+		  numLocs++;
 		  k = endColLoc;
 		}
 	    }
 	  }  // for j		
 	} 
       }  // for i
+      theEntry->numLocs = numLocs;
     }
-    return 0;
+
+    return theScatterMap.addMatrix(*theEntry, m, fact);
 }
 
     
@@ -439,6 +438,36 @@ SparseGenColLinSOE::zeroA(void)
 
     factored = false;
 }
+
+int
+SparseGenColLinSOE::saveA(void)
+{
+    if (Asaved == 0) {
+	Asaved = new (nothrow) double[Asize];
+	if (Asaved == 0) {
+	    opserr << "WARNING SparseGenColLinSOE::saveA() - ran out of memory\n";
+	    return -1;
+	}
+    }
+
+    for (int i=0; i<Asize; i++)
+	Asaved[i] = A[i];
+
+    return 0;
+}
+
+int
+SparseGenColLinSOE::restoreA(void)
+{
+    if (Asaved == 0)
+	return -1;
+
+    for (int i=0; i<Asize; i++)
+	A[i] = Asaved[i];
+    
+    factored = false;
+    return 0;
+}
 	
 void 
 SparseGenColLinSOE::zeroB(void)
@@ -38,6 +38,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <ScatterMap.h>
 
 class SparseGenColLinSolver;
 
@@ -61,6 +62,9 @@ class SparseGenColLinSOE : public LinearSOE
     
     virtual void zeroA(void);
     virtual void zeroB(void);
+
+    virtual int saveA(void);
+    virtual int restoreA(void);
     
     virtual const Vector &getX(void);
     virtual const Vector &getB(void);    
@@ -96,6 +100,8 @@ class SparseGenColLinSOE : public LinearSOE
     Vector *vectB;    
     int Asize, Bsize;    // size of the 1d array holding A
     bool factored;
+    double *Asaved;      // copy of A kept by saveA()
+    ScatterMap theScatterMap; // locations in A of the entries added by addA()
     
   private:
 
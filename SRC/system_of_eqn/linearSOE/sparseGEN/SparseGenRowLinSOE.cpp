@@ -132,6 +132,9 @@ SparseGenRowLinSOE::setSize(Graph &theGraph)
     int oldSize = size;
     size = theGraph.getNumVertex();
 
+    // the locations found by addA() are no longer valid
+    theScatterMap.clear();
+
     // fist itearte through the vertices of the graph to get nnz
     Vertex *theVertex;
     int newNNZ = 0;
@@ -282,7 +285,11 @@ SparseGenRowLinSOE::addA(const Matrix &m, const ID &id, double fact)
 	return -1;
     }
     
-    if (fact == 1.0) { // do not need to multiply 
+    // if the id has not been seen, find the location in A of each entry
+    ScatterEntry *theEntry = theScatterMap.getEntry(id);
+    if (theEntry == 0) {
+	theEntry = theScatterMap.newEntry(id, idSize*idSize);
+	int numLocs = 0;
 	for (int i=0; i<idSize; i++) {
 	    int row = id(i);
 	    if (row < size && row >= 0) {
@@ -294,34 +301,19 @@ SparseGenRowLinSOE::addA(const Matrix &m, const ID &id, double fact)
 			// find place in A using colA
 			for (int k=startRowLoc; k<endRowLoc; k++)
 			    if (colA[k] == col) {
-				A[k] += m(i,j);
-				k = endRowLoc;
-			    }
-		     }
-		}  // for j		
-	    } 
-	}  // for i
-    } else {
-	for (int i=0; i<idSize; i++) {
-	    int row = id(i);
-	    if (row < size && row >= 0) {
-		int startRowLoc = rowStartA[row];
-		int endRowLoc = rowStartA[row+1];
-		for (int j=0; j<idSize; j++) {
-		    int col = id(j);
-		    if (col <size && col >= 0) {
-			// find place in A using colA
-			for (int k=startRowLoc; k<endRowLoc; k++)
-			    if (colA[k] == col) {
-				A[k] += fact * m(i,j);
+				theEntry->locs[numLocs] = &A[k];
+				theEntry->pos[numLocs] = j*idSize + i; // m(i,j)
+				numLocs++;
 				k = endRowLoc;
 			    }
 		     }
 		}  // for j		
 	    } 
 	}  // for i
+	theEntry->numLocs = numLocs;
     }
-    return 0;
+
+    return theScatterMap.addMatrix(*theEntry, m, fact);
 }
 
     
@@ -38,6 +38,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <ScatterMap.h>
 
 class SparseGenRowLinSolver;
 
@@ -71,6 +72,7 @@ class SparseGenRowLinSOE : public LinearSOE
     friend class CulaSparseSolverS4;    
     friend class CulaSparseSolverS5;    
 	friend class CuSPSolver;
+    friend class SparseKrylovSolver;
 
   protected:
     
@@ -83,6 +85,7 @@ class SparseGenRowLinSOE : public LinearSOE
     Vector *vectB;    
     int Asize, Bsize;    // size of the 1d array holding A
     bool factored;
+    ScatterMap theScatterMap; // locations in A of the entries added by addA()
 };
 
 
@@ -0,0 +1,978 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+                                                                        
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the implementation for SparseKrylovSolver
+//
+// What: "@(#) SparseKrylovSolver.cpp, revA"
+
+#include <SparseKrylovSolver.h>
+#include <SparseGenRowLinSOE.h>
+#include <math.h>
+#include <float.h>
+#include <string.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <elementAPI.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+void* OPS_SparseKrylovSolver()
+{
+    int method = KRYLOV_PCG;
+    int precond = KRYLOV_PRECOND_JACOBI;
+    double relTol = 1.0e-8;
+    double absTol = 0.0;
+    int maxIter = 0;
+    int restart = 30;
+    int blockSize = 1;
+    bool warmStart = true;
+    int numThreads = 0;
+    int numData = 1;
+
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char *type = OPS_GetString();
+	if (strcmp(type, "-method") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
+	    const char *name = OPS_GetString();
+	    if (strcmp(name, "PCG") == 0 || strcmp(name, "CG") == 0)
+		method = KRYLOV_PCG;
+	    else if (strcmp(name, "MINRES") == 0)
+		method = KRYLOV_MINRES;
+	    else if (strcmp(name, "GMRES") == 0)
+		method = KRYLOV_GMRES;
+	    else if (strcmp(name, "BiCGStab") == 0 || strcmp(name, "BICGSTAB") == 0)
+		method = KRYLOV_BICGSTAB;
+	    else {
+		opserr << "WARNING system Krylov -method " << name << " - unknown method\n";
+		return 0;
+	    }
+	} else if (strcmp(type, "-precond") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
+	    const char *name = OPS_GetString();
+	    if (strcmp(name, "none") == 0 || strcmp(name, "None") == 0)
+		precond = KRYLOV_PRECOND_NONE;
+	    else if (strcmp(name, "Jacobi") == 0)
+		precond = KRYLOV_PRECOND_JACOBI;
+	    else if (strcmp(name, "ILU") == 0 || strcmp(name, "IC") == 0)
+		precond = KRYLOV_PRECOND_ILU;
+	    else if (strcmp(name, "BlockJacobi") == 0)
+		precond = KRYLOV_PRECOND_BLOCK_JACOBI;
+	    else {
+		opserr << "WARNING system Krylov -precond " << name << " - unknown preconditioner\n";
+		return 0;
+	    }
+	} else if (strcmp(type, "-blockSize") == 0) {
+	    if (OPS_GetIntInput(&numData, &blockSize) < 0 || blockSize < 1) {
+		opserr << "WARNING system Krylov -blockSize n - invalid n\n";
+		return 0;
+	    }
+	} else if (strcmp(type, "-tol") == 0) {
+	    if (OPS_GetDoubleInput(&numData, &relTol) < 0) {
+		opserr << "WARNING system Krylov -tol tol - invalid tol\n";
+		return 0;
+	    }
+	} else if (strcmp(type, "-absTol") == 0) {
+	    if (OPS_GetDoubleInput(&numData, &absTol) < 0) {
+		opserr << "WARNING system Krylov -absTol tol - invalid tol\n";
+		return 0;
+	    }
+	} else if (strcmp(type, "-maxIter") == 0) {
+	    if (OPS_GetIntInput(&numData, &maxIter) < 0) {
+		opserr << "WARNING system Krylov -maxIter n - invalid n\n";
+		return 0;
+	    }
+	} else if (strcmp(type, "-restart") == 0) {
+	    if (OPS_GetIntInput(&numData, &restart) < 0 || restart < 1) {
+		opserr << "WARNING system Krylov -restart m - invalid m\n";
+		return 0;
+	    }
+	} else if (strcmp(type, "-coldStart") == 0) {
+	    warmStart = false;
+	} else if (strcmp(type, "-numThreads") == 0) {
+	    if (OPS_GetIntInput(&numData, &numThreads) < 0) {
+		opserr << "WARNING system Krylov -numThreads n - invalid n\n";
+		return 0;
+	    }
+	} else {
+	    opserr << "WARNING system Krylov - unknown option " << type << " or missing value\n";
+	    return 0;
+	}
+    }
+
+    // block Jacobi with blocks of one equation is Jacobi
+    if (precond == KRYLOV_PRECOND_BLOCK_JACOBI && blockSize == 1)
+	precond = KRYLOV_PRECOND_JACOBI;
+
+    SparseGenRowLinSolver *theSolver = 
+	new SparseKrylovSolver(method, precond, relTol, absTol, maxIter,
+			       restart, blockSize, warmStart, numThreads);
+    return new SparseGenRowLinSOE(*theSolver);
+}
+
+
+SparseKrylovSolver::SparseKrylovSolver(int meth, int pc,
+				       double rTol, double aTol,
+				       int maxIt, int m, int bSize,
+				       bool warm, int nThr)
+:SparseGenRowLinSolver(SOLVER_TAGS_SparseKrylovSolver),
+ method(meth), precond(pc), relTol(rTol), absTol(aTol),
+ maxIter(maxIt), restart(m), blockSize(bSize), warmStart(warm),
+ numThreads(nThr), nThreads(1), size(0), numIter(0),
+ work(0), H(0), invDiag(0), LU(0), diagLoc(0), colLoc(0), invBlocks(0),
+ precondType(KRYLOV_PRECOND_NONE)
+{
+    if (restart < 1)
+	restart = 1;
+    if (blockSize < 1)
+	blockSize = 1;
+}
+
+
+SparseKrylovSolver::~SparseKrylovSolver()
+{
+    this->clearAll();
+}
+
+
+void
+SparseKrylovSolver::clearAll(void)
+{
+    if (work != 0) delete [] work;
+    if (H != 0) delete [] H;
+    if (invDiag != 0) delete [] invDiag;
+    if (LU != 0) delete [] LU;
+    if (diagLoc != 0) delete [] diagLoc;
+    if (colLoc != 0) delete [] colLoc;
+    if (invBlocks != 0) delete [] invBlocks;
+    work = 0; H = 0; invDiag = 0; LU = 0; 
+    diagLoc = 0; colLoc = 0; invBlocks = 0;
+    size = 0;
+}
+
+
+int
+SparseKrylovSolver::setSize(void)
+{
+    this->clearAll();
+
+    int n = theSOE->size;
+    if (n <= 0)
+	return 0;
+
+    // the vectors of the method
+    int numVectors = 4;
+    if (method == KRYLOV_MINRES)
+	numVectors = 8;
+    else if (method == KRYLOV_BICGSTAB)
+	numVectors = 8;
+    else if (method == KRYLOV_GMRES)
+	numVectors = restart + 3;
+
+    work = new double[numVectors*n];
+    if (method == KRYLOV_GMRES)
+	H = new double[(restart+1)*restart + 3*(restart+1)];
+
+    // the preconditioner, the diagonal is kept as a fall back for the others
+    invDiag = new double[n];
+    if (precond == KRYLOV_PRECOND_ILU) {
+	LU = new double[theSOE->nnz];
+	diagLoc = new int[n];
+	colLoc = new int[n];
+	for (int i=0; i<n; i++)
+	    colLoc[i] = -1;
+    } else if (precond == KRYLOV_PRECOND_BLOCK_JACOBI) {
+	int numBlocks = (n + blockSize - 1)/blockSize;
+	invBlocks = new double[numBlocks*blockSize*blockSize];
+    }
+
+    size = n;
+    precondType = KRYLOV_PRECOND_NONE;
+
+#ifdef _OPENMP
+    nThreads = (numThreads > 0) ? numThreads : omp_get_max_threads();
+#else
+    nThreads = 1;
+#endif
+
+    return 0;
+}
+
+
+int
+SparseKrylovSolver::getNumIterations(void)
+{
+    return numIter;
+}
+
+
+int
+SparseKrylovSolver::solve(void)
+{
+    int n = theSOE->size;
+    if (n == 0)
+	return 0;
+
+    if (size != n) {
+	opserr << "WARNING SparseKrylovSolver::solve(void)- ";
+	opserr << " size of system has changed - has setSize() been called?\n";
+	return -1;
+    }
+
+    // new preconditioner only if A has changed
+    if (theSOE->factored == false) {
+	this->formPrecond();
+	theSOE->factored = true;
+    }
+
+    double *X = theSOE->X;
+    double normB = sqrt(this->dot(theSOE->B, theSOE->B));
+    if (normB == 0.0) {
+	for (int i=0; i<n; i++)
+	    X[i] = 0.0;
+	numIter = 0;
+	return 0;
+    }
+
+    // stop when |r| is small compared to the unbalance or below absTol
+    double tol = relTol*normB;
+    if (tol < absTol)
+	tol = absTol;
+
+    int result;
+    if (method == KRYLOV_MINRES)
+	result = this->solveMINRES(tol, normB);
+    else if (method == KRYLOV_GMRES)
+	result = this->solveGMRES(tol, normB);
+    else if (method == KRYLOV_BICGSTAB)
+	result = this->solveBiCGStab(tol, normB);
+    else
+	result = this->solvePCG(tol, normB);
+
+    if (result == -1) {
+	opserr << "WARNING SparseKrylovSolver::solve(void)- ";
+	opserr << " no convergence in " << numIter << " iterations\n";
+    }
+
+    return result;
+}
+
+
+int
+SparseKrylovSolver::formPrecond(void)
+{
+    int n = size;
+    int *rowStartA = theSOE->rowStartA;
+    int *colA = theSOE->colA;
+    double *A = theSOE->A;
+
+    // the inverse of the diagonal
+#pragma omp parallel for num_threads(nThreads) schedule(static)
+    for (int i=0; i<n; i++) {
+	double aii = 0.0;
+	for (int k=rowStartA[i]; k<rowStartA[i+1]; k++)
+	    if (colA[k] == i) {
+		aii = A[k];
+		break;
+	    }
+	invDiag[i] = (aii != 0.0) ? 1.0/aii : 1.0;
+    }
+
+    precondType = precond;
+
+    if (precond == KRYLOV_PRECOND_ILU) {
+
+	// if the factorization breaks down, factor A + shift*diag(A)
+	double shift = 0.0;
+	while (this->formILU(shift) < 0) {
+	    shift = (shift == 0.0) ? 1.0e-3 : 10.0*shift;
+	    if (shift > 1.0) {
+		opserr << "WARNING SparseKrylovSolver::formPrecond() - ";
+		opserr << "incomplete factorization failed, using Jacobi\n";
+		precondType = KRYLOV_PRECOND_JACOBI;
+		break;
+	    }
+	}
+
+    } else if (precond == KRYLOV_PRECOND_BLOCK_JACOBI) {
+	this->formBlockJacobi();
+    }
+
+    return 0;
+}
+
+
+int
+SparseKrylovSolver::formILU(double shift)
+{
+    int n = size;
+    int *rowStartA = theSOE->rowStartA;
+    int *colA = theSOE->colA;
+    double *A = theSOE->A;
+
+    // the symmetric methods need a positive definite preconditioner
+    bool posDef = (method == KRYLOV_PCG || method == KRYLOV_MINRES);
+
+    for (int k=0; k<rowStartA[n]; k++)
+	LU[k] = A[k];
+
+    // ILU(0): eliminate in the sparsity pattern of A
+    int result = 0;
+    for (int i=0; i<n && result == 0; i++) {
+	int startRow = rowStartA[i];
+	int endRow = rowStartA[i+1];
+	for (int k=startRow; k<endRow; k++)
+	    colLoc[colA[k]] = k;
+
+	diagLoc[i] = -1;
+	for (int k=startRow; k<endRow; k++) {
+	    int j = colA[k];
+	    if (j < i) {
+		double lij = LU[k]/LU[diagLoc[j]];
+		LU[k] = lij;
+		for (int m=diagLoc[j]+1; m<rowStartA[j+1]; m++) {
+		    int loc = colLoc[colA[m]];
+		    if (loc >= 0)
+			LU[loc] -= lij*LU[m];
+		}
+	    } else if (j == i) {
+		diagLoc[i] = k;
+		double aii = A[k];
+		double pivot = LU[k] + shift*fabs(aii);
+		LU[k] = pivot;
+		if ((posDef == true && pivot <= 0.0) || fabs(pivot) <= 1.0e-12*fabs(aii)
+		    || pivot != pivot)
+		    result = -1;
+		break;
+	    }
+	}
+	if (diagLoc[i] < 0)
+	    result = -1;
+
+	for (int k=startRow; k<endRow; k++)
+	    colLoc[colA[k]] = -1;
+    }
+
+    return result;
+}
+
+
+int
+SparseKrylovSolver::formBlockJacobi(void)
+{
+    int n = size;
+    int b = blockSize;
+    int *rowStartA = theSOE->rowStartA;
+    int *colA = theSOE->colA;
+    double *A = theSOE->A;
+    int numBlocks = (n + b - 1)/b;
+
+    // invert each diagonal block by Gauss-Jordan elimination with 
+    // partial pivoting, a singular block is replaced by its diagonal
+    double *aug = new double[2*b*b];
+    for (int blk=0; blk<numBlocks; blk++) {
+	int start = blk*b;
+	int nb = (start + b <= n) ? b : n - start;
+	int nc = 2*nb;
+	double *inv = &invBlocks[blk*b*b];
+
+	for (int i=0; i<nb*nc; i++)
+	    aug[i] = 0.0;
+	for (int i=0; i<nb; i++) {
+	    int row = start + i;
+	    for (int k=rowStartA[row]; k<rowStartA[row+1]; k++) {
+		int j = colA[k] - start;
+		if (j >= 0 && j < nb)
+		    aug[i*nc+j] = A[k];
+	    }
+	    aug[i*nc+nb+i] = 1.0;
+	}
+
+	bool singular = false;
+	for (int c=0; c<nb && singular == false; c++) {
+	    int p = c;
+	    for (int i=c+1; i<nb; i++)
+		if (fabs(aug[i*nc+c]) > fabs(aug[p*nc+c]))
+		    p = i;
+	    if (aug[p*nc+c] == 0.0) {
+		singular = true;
+		break;
+	    }
+	    if (p != c)
+		for (int j=0; j<nc; j++) {
+		    double tmp = aug[c*nc+j];
+		    aug[c*nc+j] = aug[p*nc+j];
+		    aug[p*nc+j] = tmp;
+		}
+	    double invPivot = 1.0/aug[c*nc+c];
+	    for (int j=0; j<nc; j++)
+		aug[c*nc+j] *= invPivot;
+	    for (int i=0; i<nb; i++)
+		if (i != c) {
+		    double f = aug[i*nc+c];
+		    if (f != 0.0)
+			for (int j=0; j<nc; j++)
+			    aug[i*nc+j] -= f*aug[c*nc+j];
+		}
+	}
+
+	for (int i=0; i<nb; i++)
+	    for (int j=0; j<nb; j++) {
+		if (singular == false)
+		    inv[i*nb+j] = aug[i*nc+nb+j];
+		else
+		    inv[i*nb+j] = (i == j) ? invDiag[start+i] : 0.0;
+	    }
+    }
+    delete [] aug;
+
+    return 0;
+}
+
+
+void
+SparseKrylovSolver::applyPrecond(const double *r, double *z)
+{
+    int n = size;
+
+    if (precondType == KRYLOV_PRECOND_JACOBI) {
+
+#pragma omp parallel for num_threads(nThreads) schedule(static)
+	for (int i=0; i<n; i++)
+	    z[i] = invDiag[i]*r[i];
+
+    } else if (precondType == KRYLOV_PRECOND_ILU) {
+
+	// forward and backward substitution, unit diagonal in L
+	int *rowStartA = theSOE->rowStartA;
+	int *colA = theSOE->colA;
+	for (int i=0; i<n; i++) {
+	    double sum = r[i];
+	    for (int k=rowStartA[i]; k<diagLoc[i]; k++)
+		sum -= LU[k]*z[colA[k]];
+	    z[i] = sum;
+	}
+	for (int i=n-1; i>=0; i--) {
+	    double sum = z[i];
+	    for (int k=diagLoc[i]+1; k<rowStartA[i+1]; k++)
+		sum -= LU[k]*z[colA[k]];
+	    z[i] = sum/LU[diagLoc[i]];
+	}
+
+    } else if (precondType == KRYLOV_PRECOND_BLOCK_JACOBI) {
+
+	int b = blockSize;
+	int numBlocks = (n + b - 1)/b;
+#pragma omp parallel for num_threads(nThreads) schedule(static)
+	for (int blk=0; blk<numBlocks; blk++) {
+	    int start = blk*b;
+	    int nb = (start + b <= n) ? b : n - start;
+	    const double *inv = &invBlocks[blk*b*b];
+	    for (int i=0; i<nb; i++) {
+		double sum = 0.0;
+		for (int j=0; j<nb; j++)
+		    sum += inv[i*nb+j]*r[start+j];
+		z[start+i] = sum;
+	    }
+	}
+
+    } else {
+
+#pragma omp parallel for num_threads(nThreads) schedule(static)
+	for (int i=0; i<n; i++)
+	    z[i] = r[i];
+    }
+}
+
+
+void
+SparseKrylovSolver::mult(const double *x, double *y)
+{
+    int n = size;
+    int *rowStartA = theSOE->rowStartA;
+    int *colA = theSOE->colA;
+    double *A = theSOE->A;
+
+#pragma omp parallel for num_threads(nThreads) schedule(static)
+    for (int i=0; i<n; i++) {
+	double sum = 0.0;
+	for (int k=rowStartA[i]; k<rowStartA[i+1]; k++)
+	    sum += A[k]*x[colA[k]];
+	y[i] = sum;
+    }
+}
+
+
+double
+SparseKrylovSolver::dot(const double *x, const double *y)
+{
+    int n = size;
+    double sum = 0.0;
+
+#pragma omp parallel for num_threads(nThreads) schedule(static) reduction(+:sum)
+    for (int i=0; i<n; i++)
+	sum += x[i]*y[i];
+
+    return sum;
+}
+
+
+void
+SparseKrylovSolver::axpy(double a, const double *x, double *y)
+{
+    int n = size;
+
+#pragma omp parallel for num_threads(nThreads) schedule(static)
+    for (int i=0; i<n; i++)
+	y[i] += a*x[i];
+}
+
+
+void
+SparseKrylovSolver::xpay(const double *x, double a, double *y)
+{
+    int n = size;
+
+    if (a == 0.0) {
+#pragma omp parallel for num_threads(nThreads) schedule(static)
+	for (int i=0; i<n; i++)
+	    y[i] = x[i];
+    } else {
+#pragma omp parallel for num_threads(nThreads) schedule(static)
+	for (int i=0; i<n; i++)
+	    y[i] = x[i] + a*y[i];
+    }
+}
+
+
+double
+SparseKrylovSolver::residual(const double *x, double *r)
+{
+    double *B = theSOE->B;
+
+    this->mult(x, r);
+    this->xpay(B, -1.0, r);
+
+    return sqrt(this->dot(r, r));
+}
+
+
+double
+SparseKrylovSolver::initResidual(double *r, double normB)
+{
+    int n = size;
+    double *X = theSOE->X;
+
+    // start from the last solution unless it is worse than a zero start
+    if (warmStart == true) {
+	double normR = this->residual(X, r);
+	if (normR < normB)
+	    return normR;
+    }
+
+    for (int i=0; i<n; i++) {
+	X[i] = 0.0;
+	r[i] = theSOE->B[i];
+    }
+
+    return normB;
+}
+
+
+int
+SparseKrylovSolver::solvePCG(double tol, double normB)
+{
+    int n = size;
+    int maxIt = (maxIter > 0) ? maxIter : n;
+    double *x = theSOE->X;
+    double *r = work;
+    double *z = work + n;
+    double *p = work + 2*n;
+    double *q = work + 3*n;
+
+    numIter = 0;
+    double normR = this->initResidual(r, normB);
+    if (normR <= tol)
+	return 0;
+
+    this->applyPrecond(r, z);
+    this->xpay(z, 0.0, p);
+    double rz = this->dot(r, z);
+
+    while (numIter < maxIt) {
+	this->mult(p, q);
+	double pq = this->dot(p, q);
+	if (pq <= 0.0) {
+	    opserr << "WARNING SparseKrylovSolver::solve(void)- ";
+	    opserr << " PCG breakdown, A is not positive definite\n";
+	    return -2;
+	}
+
+	double alpha = rz/pq;
+	this->axpy(alpha, p, x);
+	this->axpy(-alpha, q, r);
+	numIter++;
+
+	normR = sqrt(this->dot(r, r));
+	if (normR <= tol)
+	    return 0;
+
+	this->applyPrecond(r, z);
+	double rzNew = this->dot(r, z);
+	double beta = rzNew/rz;
+	rz = rzNew;
+	this->xpay(z, beta, p);
+    }
+
+    return -1;
+}
+
+
+int
+SparseKrylovSolver::solveMINRES(double tol, double normB)
+{
+    // preconditioned MINRES of Paige and Saunders
+    int n = size;
+    int maxIt = (maxIter > 0) ? maxIter : n;
+    double *x = theSOE->X;
+    double *r1 = work;
+    double *r2 = work + n;
+    double *y = work + 2*n;
+    double *v = work + 3*n;
+    double *w = work + 4*n;
+    double *w1 = work + 5*n;
+    double *w2 = work + 6*n;
+    double *res = work + 7*n;
+
+    numIter = 0;
+    double normR = this->initResidual(r1, normB);
+    if (normR <= tol)
+	return 0;
+
+    this->applyPrecond(r1, y);
+    double beta1 = this->dot(r1, y);
+    if (beta1 <= 0.0) {
+	opserr << "WARNING SparseKrylovSolver::solve(void)- ";
+	opserr << " MINRES needs a positive definite preconditioner\n";
+	return -2;
+    }
+    beta1 = sqrt(beta1);
+
+    for (int i=0; i<n; i++) {
+	r2[i] = r1[i];
+	w[i] = 0.0;
+	w2[i] = 0.0;
+    }
+
+    double oldb = 0.0;
+    double beta = beta1;
+    double dbar = 0.0;
+    double epsln = 0.0;
+    double phibar = beta1;
+    double cs = -1.0;
+    double sn = 0.0;
+
+    // phibar estimates the residual in the norm of the preconditioner,
+    // it is scaled to |r| and checked against the true residual
+    double scale = normR/beta1;
+
+    while (numIter < maxIt) {
+	double s = 1.0/beta;
+#pragma omp parallel for num_threads(nThreads) schedule(static)
+	for (int i=0; i<n; i++)
+	    v[i] = s*y[i];
+
+	this->mult(v, y);
+	if (numIter > 0)
+	    this->axpy(-beta/oldb, r1, y);
+	double alfa = this->dot(v, y);
+	this->axpy(-alfa/beta, r2, y);
+
+	double *tmp = r1;
+	r1 = r2;
+	r2 = y;
+	y = tmp;
+	this->applyPrecond(r2, y);
+
+	oldb = beta;
+	beta = this->dot(r2, y);
+	if (beta < 0.0) {
+	    opserr << "WARNING SparseKrylovSolver::solve(void)- ";
+	    opserr << " MINRES needs a positive definite preconditioner\n";
+	    return -2;
+	}
+	beta = sqrt(beta);
+
+	// apply the previous rotation and compute the next
+	double oldeps = epsln;
+	double delta = cs*dbar + sn*alfa;
+	double gbar = sn*dbar - cs*alfa;
+	epsln = sn*beta;
+	dbar = -cs*beta;
+
+	double gamma = sqrt(gbar*gbar + beta*beta);
+	if (gamma < DBL_EPSILON)
+	    gamma = DBL_EPSILON;
+	cs = gbar/gamma;
+	sn = beta/gamma;
+	double phi = cs*phibar;
+	phibar = sn*phibar;
+
+	// update the solution
+	tmp = w1;
+	w1 = w2;
+	w2 = w;
+	w = tmp;
+	double denom = 1.0/gamma;
+#pragma omp parallel for num_threads(nThreads) schedule(static)
+	for (int i=0; i<n; i++)
+	    w[i] = (v[i] - oldeps*w1[i] - delta*w2[i])*denom;
+	this->axpy(phi, w, x);
+	numIter++;
+
+	if (phibar*scale <= tol || beta == 0.0) {
+	    normR = this->residual(x, res);
+	    if (normR <= tol)
+		return 0;
+	    if (beta == 0.0 || phibar == 0.0)
+		return -1;
+	    scale = normR/phibar;
+	}
+    }
+
+    return -1;
+}
+
+
+int
+SparseKrylovSolver::solveGMRES(double tol, double normB)
+{
+    // restarted GMRES(m), right preconditioned, modified Gram-Schmidt
+    int n = size;
+    int m = restart;
+    int maxIt = (maxIter > 0) ? maxIter : n;
+    double *x = theSOE->X;
+    double *V = work;                // m+1 basis vectors
+    double *w = work + (m+1)*n;
+    double *z = work + (m+2)*n;
+    double *cs = H + (m+1)*m;
+    double *sn = cs + (m+1);
+    double *g = sn + (m+1);
+
+    numIter = 0;
+    double normR = this->initResidual(V, normB);
+    if (normR <= tol)
+	return 0;
+
+    while (numIter < maxIt) {
+
+	double s = 1.0/normR;
+#pragma omp parallel for num_threads(nThreads) schedule(static)
+	for (int i=0; i<n; i++)
+	    V[i] *= s;
+	g[0] = normR;
+	for (int i=1; i<=m; i++)
+	    g[i] = 0.0;
+
+	int j = 0;
+	while (j < m && numIter < maxIt) {
+	    double *vj1 = V + (j+1)*n;
+	    double *h = H + j*(m+1);
+
+	    this->applyPrecond(V + j*n, z);
+	    this->mult(z, vj1);
+	    for (int i=0; i<=j; i++) {
+		h[i] = this->dot(vj1, V + i*n);
+		this->axpy(-h[i], V + i*n, vj1);
+	    }
+	    h[j+1] = sqrt(this->dot(vj1, vj1));
+	    if (h[j+1] != 0.0) {
+		s = 1.0/h[j+1];
+#pragma omp parallel for num_threads(nThreads) schedule(static)
+		for (int i=0; i<n; i++)
+		    vj1[i] *= s;
+	    }
+
+	    // apply the previous rotations and compute the next
+	    for (int i=0; i<j; i++) {
+		double tmp = cs[i]*h[i] + sn[i]*h[i+1];
+		h[i+1] = -sn[i]*h[i] + cs[i]*h[i+1];
+		h[i] = tmp;
+	    }
+	    double denom = sqrt(h[j]*h[j] + h[j+1]*h[j+1]);
+	    if (denom == 0.0) {
+		opserr << "WARNING SparseKrylovSolver::solve(void)- ";
+		opserr << " GMRES breakdown, A is singular\n";
+		return -2;
+	    }
+	    cs[j] = h[j]/denom;
+	    sn[j] = h[j+1]/denom;
+	    h[j] = denom;
+	    h[j+1] = 0.0;
+	    g[j+1] = -sn[j]*g[j];
+	    g[j] = cs[j]*g[j];
+
+	    j++;
+	    numIter++;
+	    normR = fabs(g[j]);
+	    if (normR <= tol)
+		break;
+	}
+
+	// x += M^-1 * V * y, H * y = g
+	for (int i=j-1; i>=0; i--) {
+	    double sum = g[i];
+	    for (int k=i+1; k<j; k++)
+		sum -= H[k*(m+1)+i]*g[k];
+	    g[i] = sum/H[i*(m+1)+i];
+	}
+#pragma omp parallel for num_threads(nThreads) schedule(static)
+	for (int i=0; i<n; i++)
+	    w[i] = 0.0;
+	for (int i=0; i<j; i++)
+	    this->axpy(g[i], V + i*n, w);
+	this->applyPrecond(w, z);
+	this->axpy(1.0, z, x);
+
+	if (normR <= tol)
+	    return 0;
+
+	// restart from the true residual
+	normR = this->residual(x, V);
+	if (normR <= tol)
+	    return 0;
+    }
+
+    return -1;
+}
+
+
+int
+SparseKrylovSolver::solveBiCGStab(double tol, double normB)
+{
+    // BiCGStab of van der Vorst, right preconditioned
+    int n = size;
+    int maxIt = (maxIter > 0) ? maxIter : n;
+    double *x = theSOE->X;
+    double *r = work;
+    double *rhat = work + n;
+    double *p = work + 2*n;
+    double *v = work + 3*n;
+    double *phat = work + 4*n;
+    double *s = work + 5*n;
+    double *shat = work + 6*n;
+    double *t = work + 7*n;
+
+    numIter = 0;
+    double normR = this->initResidual(r, normB);
+    if (normR <= tol)
+	return 0;
+
+    for (int i=0; i<n; i++) {
+	rhat[i] = r[i];
+	p[i] = 0.0;
+	v[i] = 0.0;
+    }
+    double rho = 1.0;
+    double alpha = 1.0;
+    double omega = 1.0;
+
+    while (numIter < maxIt) {
+	double rhoNew = this->dot(rhat, r);
+	if (rhoNew == 0.0) {
+	    opserr << "WARNING SparseKrylovSolver::solve(void)- ";
+	    opserr << " BiCGStab breakdown, rho = 0\n";
+	    return -2;
+	}
+
+	double beta = (rhoNew/rho)*(alpha/omega);
+#pragma omp parallel for num_threads(nThreads) schedule(static)
+	for (int i=0; i<n; i++)
+	    p[i] = r[i] + beta*(p[i] - omega*v[i]);
+
+	this->applyPrecond(p, phat);
+	this->mult(phat, v);
+	double rv = this->dot(rhat, v);
+	if (rv == 0.0) {
+	    opserr << "WARNING SparseKrylovSolver::solve(void)- ";
+	    opserr << " BiCGStab breakdown, (rhat, v) = 0\n";
+	    return -2;
+	}
+	alpha = rhoNew/rv;
+
+#pragma omp parallel for num_threads(nThreads) schedule(static)
+	for (int i=0; i<n; i++)
+	    s[i] = r[i] - alpha*v[i];
+	numIter++;
+
+	double normS = sqrt(this->dot(s, s));
+	if (normS <= tol) {
+	    this->axpy(alpha, phat, x);
+	    return 0;
+	}
+
+	this->applyPrecond(s, shat);
+	this->mult(shat, t);
+	double tt = this->dot(t, t);
+	omega = (tt > 0.0) ? this->dot(t, s)/tt : 0.0;
+
+#pragma omp parallel for num_threads(nThreads) schedule(static)
+	for (int i=0; i<n; i++) {
+	    x[i] += alpha*phat[i] + omega*shat[i];
+	    r[i] = s[i] - omega*t[i];
+	}
+
+	normR = sqrt(this->dot(r, r));
+	if (normR <= tol)
+	    return 0;
+
+	if (omega == 0.0) {
+	    opserr << "WARNING SparseKrylovSolver::solve(void)- ";
+	    opserr << " BiCGStab breakdown, omega = 0\n";
+	    return -2;
+	}
+	rho = rhoNew;
+    }
+
+    return -1;
+}
+
+
+int
+SparseKrylovSolver::sendSelf(int cTag, Channel &theChannel)
+{
+    // nothing to do
+    return 0;
+}
+
+
+int
+SparseKrylovSolver::recvSelf(int ctag,
+			     Channel &theChannel, 
+			     FEM_ObjectBroker &theBroker)
+{
+    // nothing to do
+    return 0;
+}
@@ -0,0 +1,125 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+                                                                        
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the class definition for SparseKrylovSolver.
+// A SparseKrylovSolver object solves a SparseGenRowLinSOE by a preconditioned
+// Krylov method: conjugate gradients (PCG) or MINRES for symmetric matrices,
+// restarted GMRES(m) or BiCGStab for general matrices. The preconditioner,
+// built whenever A has changed, is one of: the diagonal (Jacobi), an ILU(0)
+// incomplete factorization (which is the incomplete L*D*L' Cholesky 
+// factorization when A is symmetric), or the inverse of the diagonal blocks
+// of blockSize consecutive equations, i.e. of the dofs of a node when the
+// numberer keeps them together (block Jacobi). The matrix vector products,
+// vector operations and Jacobi preconditioners are done by numThreads 
+// OpenMP threads. The iteration starts from the last solution held by the
+// SOE (unless it is worse than a zero start) and stops when the residual 
+// norm is below max(relTol*|B|, absTol), |B| being the norm of the 
+// unbalance used by the CTestNormUnbalance convergence test.
+//
+// What: "@(#) SparseKrylovSolver.h, revA"
+
+#ifndef SparseKrylovSolver_h
+#define SparseKrylovSolver_h
+
+#include <SparseGenRowLinSolver.h>
+
+// Krylov methods
+#define KRYLOV_PCG        0
+#define KRYLOV_MINRES     1
+#define KRYLOV_GMRES      2
+#define KRYLOV_BICGSTAB   3
+
+// preconditioners
+#define KRYLOV_PRECOND_NONE          0
+#define KRYLOV_PRECOND_JACOBI        1
+#define KRYLOV_PRECOND_ILU           2
+#define KRYLOV_PRECOND_BLOCK_JACOBI  3
+
+class SparseKrylovSolver : public SparseGenRowLinSolver
+{
+  public:
+    SparseKrylovSolver(int method = KRYLOV_PCG,
+		       int precond = KRYLOV_PRECOND_JACOBI,
+		       double relTol = 1.0e-8,
+		       double absTol = 0.0,
+		       int maxIter = 0,
+		       int restart = 30,
+		       int blockSize = 1,
+		       bool warmStart = true,
+		       int numThreads = 0);
+    ~SparseKrylovSolver();
+
+    int solve(void);
+    int setSize(void);
+
+    int getNumIterations(void);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
+    
+  protected:
+
+  private:
+    void clearAll(void);
+
+    int formPrecond(void);
+    int formILU(double shift);
+    int formBlockJacobi(void);
+    void applyPrecond(const double *r, double *z);
+
+    void mult(const double *x, double *y);           // y = A*x
+    double dot(const double *x, const double *y);
+    void axpy(double a, const double *x, double *y); // y += a*x
+    void xpay(const double *x, double a, double *y); // y = x + a*y
+    double residual(const double *x, double *r);     // r = B - A*x, returns |r|
+    double initResidual(double *r, double normB);    // r for the start x
+
+    int solvePCG(double tol, double normB);
+    int solveMINRES(double tol, double normB);
+    int solveGMRES(double tol, double normB);
+    int solveBiCGStab(double tol, double normB);
+
+    int method, precond;
+    double relTol, absTol;
+    int maxIter, restart, blockSize;
+    bool warmStart;
+    int numThreads;
+    int nThreads;        // threads actually used, set in setSize()
+
+    int size;            // order of the system the storage was set up for
+    int numIter;         // iterations done by the last solve()
+
+    double *work;        // the vectors of the Krylov method
+    double *H;           // GMRES: Hessenberg matrix, rotations and rhs
+    double *invDiag;     // Jacobi: inverse of the diagonal
+    double *LU;          // ILU: incomplete factors in the storage of A
+    int *diagLoc;        //   location in LU of the diagonal of each row
+    int *colLoc;         //   scratch, location in the row of each column
+    double *invBlocks;   // block Jacobi: inverse of the diagonal blocks
+    int precondType;     // preconditioner actually built for A
+};
+
+#endif
@@ -89,7 +89,8 @@ SuperLU::SuperLU(int perm,
 :SparseGenColLinSolver(SOLVER_TAGS_SuperLU),
  perm_r(0),perm_c(0), etree(0), sizePerm(0),
  relax(relx), permSpec(perm), panelSize(panel), 
- drop_tol(drop_tolerance), symmetric(symm)
+ drop_tol(drop_tolerance), symmetric(symm),
+ numFullFact(0), numNumericFact(0)
 {
   // set_default_options(&options);
   options.Fact = DOFACT;
@@ -234,6 +235,10 @@ SuperLU::solve(void)
 	  Destroy_CompCol_Matrix(&U);	  
 	}
 
+	// the column permutation and etree from setSize() are reused by
+	// all but the first factorization of a graph
+	bool fullFact = (options.Fact == DOFACT);
+
 	dgstrf(&options, &AC, relax, panelSize,
 	       etree, NULL, 0, perm_c, perm_r, &L, &U, &Glu, &stat, &info);
 
@@ -244,6 +249,11 @@ SuperLU::solve(void)
 	  return -info;
 	}
 
+	if (fullFact == true)
+	  numFullFact++;
+	else
+	  numNumericFact++;
+
 	if (symmetric == 'Y')
 	  options.Fact= SamePattern_SameRowPerm;
 	else
@@ -300,6 +310,23 @@ SuperLU::setSize()
 	sizePerm = n;
       }
 
+      // release the factors and matrices set up for the previous graph
+      if (AC.ncol != 0) {
+	if (L.ncol != 0) {
+	  Destroy_SuperNode_Matrix(&L);
+	  Destroy_CompCol_Matrix(&U);
+	  L.ncol = 0;
+	  U.ncol = 0;
+	}
+	NCPformat *ACstore = (NCPformat *)AC.Store;
+	SUPERLU_FREE(ACstore->colbeg);
+	SUPERLU_FREE(ACstore->colend);
+	SUPERLU_FREE(ACstore);
+	SUPERLU_FREE(A.Store);
+	SUPERLU_FREE(B.Store);
+	StatFree(&stat);
+      }
+
       // initialisation
       StatInit(&stat);
 
@@ -334,6 +361,18 @@ SuperLU::setSize()
     return 0;
 }
 
+int
+SuperLU::getNumFullFactorizations(void)
+{
+    return numFullFact;
+}
+
+int
+SuperLU::getNumNumericFactorizations(void)
+{
+    return numNumericFact;
+}
+
 int
 SuperLU::sendSelf(int cTag, Channel &theChannel)
 {
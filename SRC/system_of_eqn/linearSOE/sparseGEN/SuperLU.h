@@ -61,6 +61,9 @@ class SuperLU : public SparseGenColLinSolver
     int solve(void);
     int setSize(void);
 
+    int getNumFullFactorizations(void);
+    int getNumNumericFactorizations(void);
+
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
     
@@ -77,6 +80,8 @@ class SuperLU : public SparseGenColLinSolver
     char symmetric;
     superlu_options_t options;
     SuperLUStat_t stat;
+    int numFullFact;    // factorizations with options.Fact = DOFACT
+    int numNumericFact; // factorizations reusing perm_c, etree (SamePattern)
 };
 
 #endif
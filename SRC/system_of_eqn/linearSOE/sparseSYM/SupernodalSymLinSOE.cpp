@@ -0,0 +1,459 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the implementation for SupernodalSymLinSOE
+//
+// What: "@(#) SupernodalSymLinSOE.cpp, revA"
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <SupernodalSymLinSOE.h>
+#include <SupernodalSymLinSolver.h>
+#include <Matrix.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+
+#include <iostream>
+using std::nothrow;
+
+SupernodalSymLinSOE::SupernodalSymLinSOE(SupernodalSymLinSolver &the_Solver)
+:LinearSOE(the_Solver, LinSOE_TAGS_SupernodalSymLinSOE),
+ size(0), nnz(0), rowStartA(0), colA(0), B(0), X(0),
+ vectX(0), vectB(0), Bsize(0), factored(false),
+ perm(0), invp(0), nsuper(0), superStart(0), colSuper(0),
+ rowStart(0), rowInd(0), valStart(0), L(0)
+{
+    the_Solver.setLinearSOE(*this);
+}
+
+
+SupernodalSymLinSOE::~SupernodalSymLinSOE()
+{
+    this->clearFactor();
+
+    if (B != 0) delete [] B;
+    if (X != 0) delete [] X;
+    if (vectX != 0) delete vectX;    
+    if (vectB != 0) delete vectB;
+    if (rowStartA != 0) delete [] rowStartA;
+    if (colA != 0) delete [] colA;
+}
+
+
+// void clearFactor(void);
+//	releases the ordering, supernodal structure and panels set by the
+//	solver.
+
+void
+SupernodalSymLinSOE::clearFactor(void)
+{
+    if (perm != 0) delete [] perm;
+    if (invp != 0) delete [] invp;
+    if (superStart != 0) delete [] superStart;
+    if (colSuper != 0) delete [] colSuper;
+    if (rowStart != 0) delete [] rowStart;
+    if (rowInd != 0) delete [] rowInd;
+    if (valStart != 0) delete [] valStart;
+    if (L != 0) delete [] L;
+    perm = 0; invp = 0;
+    superStart = 0; colSuper = 0;
+    rowStart = 0; rowInd = 0;
+    valStart = 0; L = 0;
+    nsuper = 0;
+}
+
+
+int 
+SupernodalSymLinSOE::getNumEqn(void) const
+{
+    return size;
+}
+
+
+int 
+SupernodalSymLinSOE::setSize(Graph &theGraph)
+{
+    int result = 0;
+    int oldSize = size;
+    size = theGraph.getNumVertex();
+
+    // the locations found by addA() are no longer valid
+    theScatterMap.clear();
+
+    // first itearte through the vertices of the graph to get nnz
+    Vertex *theVertex;
+    int newNNZ = 0;
+    VertexIter &theVertices = theGraph.getVertices();
+    while ((theVertex = theVertices()) != 0) {
+	const ID &theAdjacency = theVertex->getAdjacency();
+	newNNZ += theAdjacency.Size(); 
+    }
+
+    if (newNNZ > nnz || colA == 0) {
+	if (colA != 0) delete [] colA;
+	colA = new (nothrow) int[newNNZ+1];
+	if (colA == 0) {
+	    opserr << "WARNING SupernodalSymLinSOE::setSize :";
+	    opserr << " ran out of memory for colA with nnz = ";
+	    opserr << newNNZ << " \n";
+	    size = 0; nnz = 0;
+	    return -1;
+	}
+    }
+    nnz = newNNZ;
+	
+    factored = false;
+    
+    if (size > Bsize) { // we have to get space for the vectors
+	
+	// delete the old	
+	if (B != 0) delete [] B;
+	if (X != 0) delete [] X;
+	if (rowStartA != 0) delete [] rowStartA;
+
+	// create the new
+	B = new (nothrow) double[size];
+	X = new (nothrow) double[size];
+	rowStartA = new (nothrow) int[size+1]; 
+	
+	if (B == 0 || X == 0 || rowStartA == 0) {
+	    opserr << "WARNING SupernodalSymLinSOE::setSize :";
+	    opserr << " ran out of memory for vectors (size) (";
+	    opserr << size << ") \n";
+	    size = 0; Bsize = 0;
+	    return -1;
+	} else {
+	    Bsize = size;
+	}
+    }
+
+    // zero the vectors
+    for (int j=0; j<size; j++) {
+	B[j] = 0;
+	X[j] = 0;
+    }
+    
+    // create new Vectors objects
+    if (size != oldSize) {
+	if (vectX != 0)
+	    delete vectX;
+
+	if (vectB != 0)
+	    delete vectB;
+	
+	vectX = new Vector(X,size);
+	vectB = new Vector(B,size);	
+    }
+
+    // fill in rowStartA and colA, the adjacency of each vertex in order
+    if (rowStartA != 0)
+	rowStartA[0] = 0;
+    int lastLoc = 0;
+    for (int a=0; a<size; a++) {
+	theVertex = theGraph.getVertexPtr(a);
+	if (theVertex == 0) {
+	    opserr << "WARNING:SupernodalSymLinSOE::setSize :";
+	    opserr << " vertex " << a << " not in graph! - size set to 0\n";
+	    size = 0;
+	    return -1;
+	}
+
+	const ID &theAdjacency = theVertex->getAdjacency();
+	int idSize = theAdjacency.Size();
+	int startLoc = lastLoc;
+	for (int i=0; i<idSize; i++) {
+	    int row = theAdjacency(i);
+	    if (row < 0 || row >= size || row == a)
+		continue;
+	    int j = lastLoc;
+	    while (j > startLoc && colA[j-1] > row) {
+		colA[j] = colA[j-1];
+		j--;
+	    }
+	    colA[j] = row;
+	    lastLoc++;
+	}
+	rowStartA[a+1] = lastLoc;
+    }
+    nnz = lastLoc;
+
+    // invoke setSize() on the Solver, which does the symbolic factorization
+    LinearSOESolver *the_Solver = this->getSolver();
+    int solverOK = the_Solver->setSize();
+    if (solverOK < 0) {
+	opserr << "WARNING:SupernodalSymLinSOE::setSize :";
+	opserr << " solver failed setSize()\n";
+	return solverOK;
+    }    
+
+    return result;
+}
+
+
+int 
+SupernodalSymLinSOE::addA(const Matrix &m, const ID &id, double fact)
+{
+    // check for a quick return
+    if (fact == 0.0)  
+	return 0;
+
+    int idSize = id.Size();
+    if (idSize == 0)  
+	return 0;
+
+    // check that m and id are of similar size
+    if (idSize != m.noRows() && idSize != m.noCols()) {
+	opserr << "SupernodalSymLinSOE::addA() ";
+	opserr << " - Matrix and ID not of similiar sizes\n";
+	return -1;
+    }
+
+    // if the id has been seen, the locations of the entries are known
+    ScatterEntry *theEntry = theScatterMap.getEntry(id);
+    if (theEntry != 0)
+	return theScatterMap.addMatrix(*theEntry, m, fact);
+
+    theEntry = theScatterMap.newEntry(id, idSize*(idSize+1)/2);
+    int numLocs = 0;
+
+    // locate the lower triangle entries in the panels
+    for (int i=0; i<idSize; i++) {
+	int iEq = id(i);
+	if (iEq < 0 || iEq >= size)
+	    continue;
+	int iNew = invp[iEq];
+
+	for (int j=0; j<=i; j++) {
+	    int jEq = id(j);
+	    if (jEq < 0 || jEq >= size)
+		continue;
+	    int jNew = invp[jEq];
+
+	    int row = (iNew > jNew) ? iNew : jNew;
+	    int col = (iNew > jNew) ? jNew : iNew;
+
+	    // find the row in the rows of the supernode of the column
+	    int s = colSuper[col];
+	    int lo = rowStart[s];
+	    int hi = rowStart[s+1] - 1;
+	    while (lo < hi) {
+		int mid = (lo + hi)/2;
+		if (rowInd[mid] < row)
+		    lo = mid + 1;
+		else
+		    hi = mid;
+	    }
+	    if (rowInd[lo] != row) {
+		opserr << "SupernodalSymLinSOE::addA() - entry " << iEq << " " << jEq;
+		opserr << " not in the structure of the factor\n";
+		theScatterMap.removeEntry(id);
+		return -1;
+	    }
+
+	    int nRows = rowStart[s+1] - rowStart[s];
+	    theEntry->locs[numLocs] = &L[valStart[s] + (col - superStart[s])*nRows + lo - rowStart[s]];
+	    theEntry->pos[numLocs] = j*idSize + i;
+	    numLocs++;
+	}
+    }
+    theEntry->numLocs = numLocs;
+
+    return theScatterMap.addMatrix(*theEntry, m, fact);
+}
+
+    
+int 
+SupernodalSymLinSOE::addB(const Vector &v, const ID &id, double fact)
+{
+    // check for a quick return 
+    if (fact == 0.0)  return 0;
+
+    int idSize = id.Size();    
+    // check that m and id are of similar size
+    if (idSize != v.Size() ) {
+	opserr << "SupernodalSymLinSOE::addB() ";
+	opserr << " - Vector and ID not of similar sizes\n";
+	return -1;
+    }    
+
+    if (fact == 1.0) { // do not need to multiply 
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0)
+		B[pos] += v(i);
+	}
+    } else if (fact == -1.0) {
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0)
+		B[pos] -= v(i);
+	}
+    } else {
+	for (int i=0; i<idSize; i++) {
+	    int pos = id(i);
+	    if (pos <size && pos >= 0)
+		B[pos] += v(i) * fact;
+	}
+    }	
+    return 0;
+}
+
+
+int
+SupernodalSymLinSOE::setB(const Vector &v, double fact)
+{
+    // check for a quick return 
+    if (fact == 0.0)  return 0;
+
+    if (v.Size() != size) {
+	opserr << "WARNING SupernodalSymLinSOE::setB() -";
+	opserr << " incomptable sizes " << size << " and " << v.Size() << endln;
+	return -1;
+    }
+    
+    if (fact == 1.0) { // do not need to multiply if fact == 1.0
+	for (int i=0; i<size; i++) {
+	    B[i] = v(i);
+	}
+    } else if (fact == -1.0) {
+	for (int i=0; i<size; i++) {
+	    B[i] = -v(i);
+	}
+    } else {
+	for (int i=0; i<size; i++) {
+	    B[i] = v(i) * fact;
+	}
+    }	
+    return 0;
+}
+
+
+void 
+SupernodalSymLinSOE::zeroA(void)
+{
+    if (L != 0 && valStart != 0)
+	memset(L, 0, valStart[nsuper]*sizeof(double));
+
+    factored = false;
+}
+	
+
+void 
+SupernodalSymLinSOE::zeroB(void)
+{
+    double *Bptr = B;
+    for (int i=0; i<size; i++)
+	*Bptr++ = 0;
+}
+
+
+void 
+SupernodalSymLinSOE::setX(int loc, double value)
+{
+    if (loc < size && loc >=0)
+	X[loc] = value;
+}
+
+
+void 
+SupernodalSymLinSOE::setX(const Vector &x)
+{
+    if (x.Size() == size && vectX != 0)
+	*vectX = x;
+}
+
+
+const Vector &
+SupernodalSymLinSOE::getX(void)
+{
+    if (vectX == 0) {
+	opserr << "FATAL SupernodalSymLinSOE::getX - vectX == 0";
+	exit(-1);
+    }
+    return *vectX;
+}
+
+
+const Vector &
+SupernodalSymLinSOE::getB(void)
+{
+    if (vectB == 0) {
+	opserr << "FATAL SupernodalSymLinSOE::getB - vectB == 0";
+	exit(-1);
+    }        
+    return *vectB;
+}
+
+
+double 
+SupernodalSymLinSOE::normRHS(void)
+{
+    double norm =0.0;
+    for (int i=0; i<size; i++) {
+	double Yi = B[i];
+	norm += Yi*Yi;
+    }
+    return sqrt(norm);
+}    
+
+
+int
+SupernodalSymLinSOE::setSupernodalSymSolver(SupernodalSymLinSolver &newSolver)
+{
+    newSolver.setLinearSOE(*this);
+    
+    if (size != 0) {
+	int solverOK = newSolver.setSize();
+	if (solverOK < 0) {
+	    opserr << "WARNING:SupernodalSymLinSOE::setSolver :";
+	    opserr << "the new solver could not setSeize() - staying with old\n";
+	    return -1;
+	}
+    }
+    
+    return this->LinearSOE::setSolver(newSolver);
+}
+
+
+int 
+SupernodalSymLinSOE::sendSelf(int cTag, Channel &theChannel)
+{
+    // not implemented.
+    return 0;
+}
+
+
+int 
+SupernodalSymLinSOE::recvSelf(int cTag, 
+			      Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+    // not implemented.
+    return 0;
+}
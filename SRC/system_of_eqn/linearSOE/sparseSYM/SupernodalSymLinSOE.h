@@ -0,0 +1,104 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// SupernodalSymLinSOE. It stores the symmetric matrix A in the supernodal
+// storage of its L*D*L' factorization: the rows of the nonzeros of the
+// columns of each supernode of L are stored once and its values as a
+// dense column-major panel. The ordering of the equations and the
+// supernodal structure are set by the SupernodalSymLinSolver when the 
+// size of the system is set; addA() adds directly into the panels, which
+// are then factored in place.
+//
+// What: "@(#) SupernodalSymLinSOE.h, revA"
+
+#ifndef SupernodalSymLinSOE_h
+#define SupernodalSymLinSOE_h
+
+#include <LinearSOE.h>
+#include <Vector.h>
+#include <ScatterMap.h>
+
+class SupernodalSymLinSolver;
+
+class SupernodalSymLinSOE : public LinearSOE
+{
+  public:
+    SupernodalSymLinSOE(SupernodalSymLinSolver &theSolver);        
+    ~SupernodalSymLinSOE();
+
+    int getNumEqn(void) const;
+    int setSize(Graph &theGraph);
+    int addA(const Matrix &, const ID &, double fact = 1.0);
+    int addB(const Vector &, const ID &, double fact = 1.0);    
+    int setB(const Vector &, double fact = 1.0);        
+    
+    void zeroA(void);
+    void zeroB(void);
+    
+    const Vector &getX(void);
+    const Vector &getB(void);    
+    double normRHS(void);
+
+    void setX(int loc, double value);        
+    void setX(const Vector &x);        
+    int setSupernodalSymSolver(SupernodalSymLinSolver &newSolver);    
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, 
+		 FEM_ObjectBroker &theBroker);
+
+    friend class SupernodalSymLinSolver;
+
+  protected:
+    
+  private:
+    void clearFactor(void);
+
+    int size;            // order of A
+    int nnz;             // number of off-diagonal entries of A (both halves)
+    int *rowStartA, *colA;  // adjacency of the equations (XADJ, ADJNCY)
+    double *B, *X;       // 1d arrays containing coefficients of B and X
+    Vector *vectX;
+    Vector *vectB;
+    int Bsize;
+    bool factored;
+
+    // set by the solver in its setSize()
+    int *perm, *invp;    // new to old and old to new equation numbers
+    int nsuper;          // number of supernodes
+    int *superStart;     // first column of each supernode, nsuper+1
+    int *colSuper;       // supernode of each column
+    int *rowStart;       // start of the rows of each supernode in rowInd, nsuper+1
+    int *rowInd;         // rows of each supernode, its own columns first
+    int *valStart;       // start of the panel of each supernode in L, nsuper+1
+    double *L;           // the panels; D stored on the diagonal
+
+    ScatterMap theScatterMap; // locations in the panels of the entries 
+                              // added by addA()
+};
+
+#endif
+
@@ -0,0 +1,717 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the implementation for 
+// SupernodalSymLinSolver
+//
+// What: "@(#) SupernodalSymLinSolver.cpp, revA"
+
+#include <SupernodalSymLinSOE.h>
+#include <SupernodalSymLinSolver.h>
+#include <string.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <elementAPI.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+extern "C" void METIS_NodeND(int *nvtxs, int *xadj, int *adjncy, int *numflag, 
+			     int *options, int *perm, int *iperm);
+
+void* OPS_SupernodalSymLinSolver()
+{
+    int numThreads = 0;
+    int numData = 1;
+
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char *type = OPS_GetString();
+	if (strcmp(type, "-numThreads") == 0) {
+	    if (OPS_GetNumRemainingInputArgs() < 1 ||
+		OPS_GetIntInput(&numData, &numThreads) < 0) {
+		opserr << "WARNING system Supernodal -numThreads n - invalid n\n";
+		return 0;
+	    }
+	} else
+	    opserr << "WARNING system Supernodal - unknown option " << type << " ignored\n";
+    }
+
+    SupernodalSymLinSolver *theSolver = new SupernodalSymLinSolver(numThreads);
+    return new SupernodalSymLinSOE(*theSolver);
+}
+
+
+SupernodalSymLinSolver::SupernodalSymLinSolver(int nThreads)
+:LinearSOESolver(SOLVER_TAGS_SupernodalSymLinSolver),
+ theSOE(0), numThreads(nThreads),
+ levelStart(0), levelSuper(0), numLevels(0),
+ updStart(0), updSuper(0), updPos(0),
+ maxWork(0), maxRows(0), Y(0)
+{
+
+}
+
+
+SupernodalSymLinSolver::~SupernodalSymLinSolver()
+{ 
+    this->clearAll();
+}
+
+
+void
+SupernodalSymLinSolver::clearAll(void)
+{
+    if (levelStart != 0) delete [] levelStart;
+    if (levelSuper != 0) delete [] levelSuper;
+    if (updStart != 0) delete [] updStart;
+    if (updSuper != 0) delete [] updSuper;
+    if (updPos != 0) delete [] updPos;
+    if (Y != 0) delete [] Y;
+    levelStart = 0; levelSuper = 0; numLevels = 0;
+    updStart = 0; updSuper = 0; updPos = 0;
+    maxWork = 0; maxRows = 0; Y = 0;
+}
+
+
+int
+SupernodalSymLinSolver::solve(void)
+{ 
+    if (theSOE == 0) {
+	opserr << "WARNING SupernodalSymLinSolver::solve(void)- ";
+	opserr << " No LinearSOE object has been set\n";
+	return -1;
+    }
+
+    int n = theSOE->size;
+
+    // check for quick return
+    if (n == 0)
+	return 0;
+
+    if (theSOE->L == 0) {
+	opserr << "WARNING SupernodalSymLinSolver::solve(void)- ";
+	opserr << " setSize() has not been called\n";
+	return -1;
+    }
+
+    // numerical factorization, the symbolic one from setSize() is reused
+    if (theSOE->factored == false) {
+	if (this->factor() < 0) {
+	    opserr << "WARNING SupernodalSymLinSolver::solve(void)- ";
+	    opserr << " zero pivot in the factorization\n";
+	    return -1;
+	}
+	theSOE->factored = true;
+    }
+
+    int nsuper = theSOE->nsuper;
+    int *perm = theSOE->perm;
+    int *superStart = theSOE->superStart;
+    int *rowStart = theSOE->rowStart;
+    int *rowInd = theSOE->rowInd;
+    int *valStart = theSOE->valStart;
+    double *L = theSOE->L;
+
+    // permute B into Y
+    double *B = theSOE->B;
+    for (int i=0; i<n; i++)
+	Y[i] = B[perm[i]];
+
+    // forward substitution, L z = b
+    for (int s=0; s<nsuper; s++) {
+	int f = superStart[s];
+	int nCols = superStart[s+1] - f;
+	int nRows = rowStart[s+1] - rowStart[s];
+	int *rows = &rowInd[rowStart[s]];
+	double *Ls = &L[valStart[s]];
+	for (int j=0; j<nCols; j++) {
+	    double yj = Y[f+j];
+	    if (yj != 0.0) {
+		double *Lcol = &Ls[j*nRows];
+		for (int i=j+1; i<nRows; i++)
+		    Y[rows[i]] -= Lcol[i] * yj;
+	    }
+	}
+    }
+
+    // diagonal, D y = z
+    for (int s=0; s<nsuper; s++) {
+	int f = superStart[s];
+	int nCols = superStart[s+1] - f;
+	int nRows = rowStart[s+1] - rowStart[s];
+	double *Ls = &L[valStart[s]];
+	for (int j=0; j<nCols; j++)
+	    Y[f+j] /= Ls[j*nRows + j];
+    }
+
+    // back substitution, L' x = y
+    for (int s=nsuper-1; s>=0; s--) {
+	int f = superStart[s];
+	int nCols = superStart[s+1] - f;
+	int nRows = rowStart[s+1] - rowStart[s];
+	int *rows = &rowInd[rowStart[s]];
+	double *Ls = &L[valStart[s]];
+	for (int j=nCols-1; j>=0; j--) {
+	    double *Lcol = &Ls[j*nRows];
+	    double yj = Y[f+j];
+	    for (int i=j+1; i<nRows; i++)
+		yj -= Lcol[i] * Y[rows[i]];
+	    Y[f+j] = yj;
+	}
+    }
+
+    // permute Y back into X
+    double *X = theSOE->X;
+    for (int i=0; i<n; i++)
+	X[perm[i]] = Y[i];
+
+    return 0;
+}
+
+
+// int factor(void);
+//	factors the panels in place. The supernodes of a level of the 
+//	supernodal elimination tree depend only on those of lower levels,
+//	so each level is shared among the threads. The updates of a 
+//	supernode are always applied in the same order, so the factor does 
+//	not depend on the number of threads.
+
+int
+SupernodalSymLinSolver::factor(void)
+{
+    int error = 0;
+
+#ifdef _OPENMP
+    int nThreads = (numThreads > 0) ? numThreads : omp_get_max_threads();
+#endif
+
+#pragma omp parallel num_threads(nThreads)
+    {
+	double *W = new double[maxWork > 0 ? maxWork : 1];
+	int *relInd = new int[maxRows > 0 ? maxRows : 1];
+
+	for (int lev=0; lev<numLevels; lev++) {
+#pragma omp for schedule(dynamic)
+	    for (int i=levelStart[lev]; i<levelStart[lev+1]; i++) {
+		if (this->factorSuper(levelSuper[i], W, relInd) < 0) {
+#pragma omp atomic
+		    error++;
+		}
+	    }
+	}
+
+	delete [] W;
+	delete [] relInd;
+    }
+
+    if (error != 0)
+	return -1;
+
+    return 0;
+}
+
+
+// int factorSuper(int s, double *W, int *relInd);
+//	applies to the panel of supernode s the updates from the supernodes
+//	that have rows in its columns, then factors it. W and relInd are work
+//	areas of size maxWork and maxRows.
+
+int
+SupernodalSymLinSolver::factorSuper(int s, double *W, int *relInd)
+{
+    int *superStart = theSOE->superStart;
+    int *rowStart = theSOE->rowStart;
+    int *rowInd = theSOE->rowInd;
+    int *valStart = theSOE->valStart;
+    double *L = theSOE->L;
+
+    int f = superStart[s];
+    int lastCol = superStart[s+1] - 1;
+    int nCols = lastCol - f + 1;
+    int nRows = rowStart[s+1] - rowStart[s];
+    int *rows = &rowInd[rowStart[s]];
+    double *Ls = &L[valStart[s]];
+
+    // updates from the descendants, Ls -= Ld * Dd * Ld(p:q,:)'
+    for (int u=updStart[s]; u<updStart[s+1]; u++) {
+	int d = updSuper[u];
+	int p = updPos[u];
+	int ncd = superStart[d+1] - superStart[d];
+	int nrd = rowStart[d+1] - rowStart[d];
+	int *rowsd = &rowInd[rowStart[d]];
+	double *Ld = &L[valStart[d]];
+
+	int q = p;
+	while (q < nrd && rowsd[q] <= lastCol)
+	    q++;
+	int m = nrd - p;
+	int k = q - p;
+
+	// form the lower part of the update in W (m x k)
+	for (int j=0; j<k; j++) {
+	    double *Wcol = &W[j*m];
+	    for (int i=j; i<m; i++)
+		Wcol[i] = 0.0;
+	    for (int c=0; c<ncd; c++) {
+		double *Ldcol = &Ld[c*nrd + p];
+		double sjc = Ldcol[j] * Ld[c*nrd + c];
+		if (sjc != 0.0)
+		    for (int i=j; i<m; i++)
+			Wcol[i] += Ldcol[i] * sjc;
+	    }
+	}
+
+	// rows of the update in the panel
+	int ri = 0;
+	for (int i=0; i<m; i++) {
+	    int row = rowsd[p+i];
+	    while (rows[ri] != row)
+		ri++;
+	    relInd[i] = ri;
+	}
+
+	for (int j=0; j<k; j++) {
+	    double *Lcol = &Ls[(rowsd[p+j] - f)*nRows];
+	    double *Wcol = &W[j*m];
+	    for (int i=j; i<m; i++)
+		Lcol[relInd[i]] -= Wcol[i];
+	}
+    }
+
+    // factor the panel, L*D*L' of the diagonal block and the rows below
+    for (int j=0; j<nCols; j++) {
+	double *Lj = &Ls[j*nRows];
+	for (int c=0; c<j; c++) {
+	    double *Lc = &Ls[c*nRows];
+	    double sjc = Lc[j] * Lc[c];
+	    if (sjc != 0.0)
+		for (int i=j; i<nRows; i++)
+		    Lj[i] -= Lc[i] * sjc;
+	}
+
+	double dj = Lj[j];
+	if (dj == 0.0)
+	    return -1;
+	double oneOverD = 1.0/dj;
+	for (int i=j+1; i<nRows; i++)
+	    Lj[i] *= oneOverD;
+    }
+
+    return 0;
+}
+
+
+// int setSize(void);
+//	the symbolic factorization. Orders the equations by nested dissection,
+//	postorders the elimination tree, finds the fundamental supernodes and
+//	their rows, and sets up the level schedule and the lists of updates
+//	for the numerical factorization.
+
+int
+SupernodalSymLinSolver::setSize(void)
+{
+    if (theSOE == 0) {
+	opserr << "WARNING SupernodalSymLinSolver::setSize(void)- ";
+	opserr << " No LinearSOE object has been set\n";
+	return -1;
+    }
+
+    this->clearAll();
+    theSOE->clearFactor();
+
+    int n = theSOE->size;
+    if (n == 0)
+	return 0;
+
+    int *xadj = theSOE->rowStartA;
+    int *adjncy = theSOE->colA;
+
+    //
+    // fill reducing ordering
+    //
+
+    int *ndPerm = new int[n];
+    int *ndInvp = new int[n];
+    if (theSOE->nnz > 0) {
+	int numflag = 0;
+	int options[8];
+	options[0] = 0;
+	METIS_NodeND(&n, xadj, adjncy, &numflag, options, ndPerm, ndInvp);
+    } else {
+	for (int i=0; i<n; i++) {
+	    ndPerm[i] = i;
+	    ndInvp[i] = i;
+	}
+    }
+
+    //
+    // elimination tree of the ordered matrix
+    //
+
+    int *parent = new int[n];
+    int *work = new int[3*n];
+    int *ancestor = work;
+    for (int k=0; k<n; k++) {
+	parent[k] = -1;
+	ancestor[k] = -1;
+	int old = ndPerm[k];
+	for (int a=xadj[old]; a<xadj[old+1]; a++) {
+	    int i = ndInvp[adjncy[a]];
+	    while (i != -1 && i < k) {
+		int next = ancestor[i];
+		ancestor[i] = k;
+		if (next == -1)
+		    parent[i] = k;
+		i = next;
+	    }
+	}
+    }
+
+    //
+    // postorder the tree, so the columns of a supernode are consecutive
+    //
+
+    int *head = work;
+    int *next = &work[n];
+    int *stack = &work[2*n];
+    int *post = new int[n];
+    for (int j=0; j<n; j++)
+	head[j] = -1;
+    for (int j=n-1; j>=0; j--) {
+	if (parent[j] != -1) {
+	    next[j] = head[parent[j]];
+	    head[parent[j]] = j;
+	}
+    }
+    int numPost = 0;
+    for (int j=0; j<n; j++) {
+	if (parent[j] != -1)
+	    continue;
+	int top = 0;
+	stack[0] = j;
+	while (top >= 0) {
+	    int pNode = stack[top];
+	    int child = head[pNode];
+	    if (child == -1) {
+		top--;
+		post[numPost++] = pNode;
+	    } else {
+		head[pNode] = next[child];
+		stack[++top] = child;
+	    }
+	}
+    }
+
+    int *perm = new int[n];
+    int *invp = new int[n];
+    int *postInv = work;
+    for (int k=0; k<n; k++) {
+	perm[k] = ndPerm[post[k]];
+	invp[perm[k]] = k;
+	postInv[post[k]] = k;
+    }
+    int *newParent = &work[n];
+    for (int k=0; k<n; k++) {
+	int pk = parent[post[k]];
+	newParent[k] = (pk == -1) ? -1 : postInv[pk];
+    }
+    for (int k=0; k<n; k++)
+	parent[k] = newParent[k];
+
+    delete [] ndPerm;
+    delete [] ndInvp;
+    delete [] post;
+
+    theSOE->perm = perm;
+    theSOE->invp = invp;
+
+    //
+    // column counts of L, by traversing the row subtrees
+    //
+
+    int *colCount = new int[n];
+    int *mark = work;
+    for (int k=0; k<n; k++) {
+	colCount[k] = 1;
+	mark[k] = -1;
+    }
+    for (int i=0; i<n; i++) {
+	mark[i] = i;
+	int old = perm[i];
+	for (int a=xadj[old]; a<xadj[old+1]; a++) {
+	    int k = invp[adjncy[a]];
+	    if (k > i)
+		continue;
+	    while (mark[k] != i) {
+		colCount[k]++;
+		mark[k] = i;
+		k = parent[k];
+	    }
+	}
+    }
+
+    //
+    // fundamental supernodes
+    //
+
+    int *numChild = &work[n];
+    for (int k=0; k<n; k++)
+	numChild[k] = 0;
+    for (int k=0; k<n; k++)
+	if (parent[k] != -1)
+	    numChild[parent[k]]++;
+
+    int *colSuper = new int[n];
+    int nsuper = 1;
+    colSuper[0] = 0;
+    for (int k=1; k<n; k++) {
+	if (parent[k-1] != k || colCount[k-1] != colCount[k]+1 || numChild[k] != 1)
+	    nsuper++;
+	colSuper[k] = nsuper-1;
+    }
+
+    int *superStart = new int[nsuper+1];
+    for (int k=n-1; k>=0; k--)
+	superStart[colSuper[k]] = k;
+    superStart[nsuper] = n;
+
+    int *rowStart = new int[nsuper+1];
+    int *valStart = new int[nsuper+1];
+    rowStart[0] = 0;
+    valStart[0] = 0;
+    maxRows = 0;
+    for (int s=0; s<nsuper; s++) {
+	int nRows = colCount[superStart[s]];
+	int nCols = superStart[s+1] - superStart[s];
+	rowStart[s+1] = rowStart[s] + nRows;
+	valStart[s+1] = valStart[s] + nRows*nCols;
+	if (nRows > maxRows)
+	    maxRows = nRows;
+    }
+    delete [] colCount;
+
+    //
+    // rows of the supernodes: their own columns, the rows of A below them
+    // and the rows of their children below them
+    //
+
+    int *superParent = new int[nsuper];
+    int *childHead = &work[n];    
+    int *childNext = &work[2*n];
+    for (int s=0; s<nsuper; s++)
+	childHead[s] = -1;
+    for (int s=nsuper-1; s>=0; s--) {
+	int pCol = parent[superStart[s+1]-1];
+	superParent[s] = (pCol == -1) ? -1 : colSuper[pCol];
+	if (superParent[s] != -1) {
+	    childNext[s] = childHead[superParent[s]];
+	    childHead[superParent[s]] = s;
+	}
+    }
+
+    int *rowInd = new int[rowStart[nsuper]];
+    for (int k=0; k<n; k++)
+	mark[k] = -1;
+
+    for (int s=0; s<nsuper; s++) {
+	int f = superStart[s];
+	int l = superStart[s+1] - 1;
+	int *rows = &rowInd[rowStart[s]];
+	int nRows = 0;
+	for (int k=f; k<=l; k++) {
+	    rows[nRows++] = k;
+	    mark[k] = s;
+	}
+	for (int k=f; k<=l; k++) {
+	    int old = perm[k];
+	    for (int a=xadj[old]; a<xadj[old+1]; a++) {
+		int r = invp[adjncy[a]];
+		if (r > l && mark[r] != s) {
+		    mark[r] = s;
+		    rows[nRows++] = r;
+		}
+	    }
+	}
+	for (int t=childHead[s]; t!=-1; t=childNext[t]) {
+	    int *rowsT = &rowInd[rowStart[t]];
+	    int nRowsT = rowStart[t+1] - rowStart[t];
+	    for (int i=superStart[t+1]-superStart[t]; i<nRowsT; i++) {
+		int r = rowsT[i];
+		if (r > l && mark[r] != s) {
+		    mark[r] = s;
+		    rows[nRows++] = r;
+		}
+	    }
+	}
+
+	if (nRows != rowStart[s+1] - rowStart[s]) {
+	    opserr << "WARNING SupernodalSymLinSolver::setSize(void)- ";
+	    opserr << " inconsistent structure of the factor\n";
+	    delete [] work; delete [] parent; delete [] superParent;
+	    delete [] superStart; delete [] colSuper;
+	    delete [] rowStart; delete [] rowInd; delete [] valStart;
+	    this->clearAll();
+	    theSOE->clearFactor();
+	    return -1;
+	}
+
+	// sort the rows below the supernode
+	int nCols = l - f + 1;
+	for (int i=nCols+1; i<nRows; i++) {
+	    int r = rows[i];
+	    int j = i;
+	    while (j > nCols && rows[j-1] > r) {
+		rows[j] = rows[j-1];
+		j--;
+	    }
+	    rows[j] = r;
+	}
+    }
+
+    //
+    // level of each supernode in the supernodal tree, leaves at level 0
+    //
+
+    int *level = &work[n];
+    for (int s=0; s<nsuper; s++)
+	level[s] = 0;
+    numLevels = 0;
+    for (int s=0; s<nsuper; s++) {
+	int sp = superParent[s];
+	if (sp != -1 && level[sp] < level[s]+1)
+	    level[sp] = level[s]+1;
+	if (level[s]+1 > numLevels)
+	    numLevels = level[s]+1;
+    }
+
+    levelStart = new int[numLevels+1];
+    levelSuper = new int[nsuper];
+    for (int lev=0; lev<=numLevels; lev++)
+	levelStart[lev] = 0;
+    for (int s=0; s<nsuper; s++)
+	levelStart[level[s]+1]++;
+    for (int lev=0; lev<numLevels; lev++)
+	levelStart[lev+1] += levelStart[lev];
+    int *fill = &work[2*n];
+    for (int lev=0; lev<numLevels; lev++)
+	fill[lev] = levelStart[lev];
+    for (int s=0; s<nsuper; s++)
+	levelSuper[fill[level[s]]++] = s;
+
+    //
+    // the supernodes updating each supernode, with the position of the 
+    // first row in its columns; a row block in d below its own columns 
+    // updates the supernode of the first row in the block
+    //
+
+    updStart = new int[nsuper+1];
+    for (int s=0; s<=nsuper; s++)
+	updStart[s] = 0;
+    maxWork = 0;
+    for (int pass=0; pass<2; pass++) {
+	for (int d=0; d<nsuper; d++) {
+	    int nCols = superStart[d+1] - superStart[d];
+	    int nRows = rowStart[d+1] - rowStart[d];
+	    int *rows = &rowInd[rowStart[d]];
+	    int p = nCols;
+	    while (p < nRows) {
+		int t = colSuper[rows[p]];
+		int q = p;
+		while (q < nRows && rows[q] < superStart[t+1])
+		    q++;
+		if (pass == 0) {
+		    updStart[t+1]++;
+		    int size = (nRows - p)*(q - p);
+		    if (size > maxWork)
+			maxWork = size;
+		} else {
+		    updSuper[fill[t]] = d;
+		    updPos[fill[t]] = p;
+		    fill[t]++;
+		}
+		p = q;
+	    }
+	}
+	if (pass == 0) {
+	    for (int s=0; s<nsuper; s++)
+		updStart[s+1] += updStart[s];
+	    updSuper = new int[updStart[nsuper]+1];
+	    updPos = new int[updStart[nsuper]+1];
+	    for (int s=0; s<nsuper; s++)
+		fill[s] = updStart[s];
+	}
+    }
+
+    delete [] work;
+    delete [] parent;
+    delete [] superParent;
+
+    //
+    // storage for the panels
+    //
+
+    double *L = new double[valStart[nsuper]];
+    for (int i=0; i<valStart[nsuper]; i++)
+	L[i] = 0.0;
+
+    Y = new double[n];
+
+    theSOE->nsuper = nsuper;
+    theSOE->superStart = superStart;
+    theSOE->colSuper = colSuper;
+    theSOE->rowStart = rowStart;
+    theSOE->rowInd = rowInd;
+    theSOE->valStart = valStart;
+    theSOE->L = L;
+    theSOE->factored = false;
+
+    return 0;
+}
+
+
+int
+SupernodalSymLinSolver::setLinearSOE(SupernodalSymLinSOE &theLinearSOE)
+{
+    theSOE = &theLinearSOE;
+    return 0;
+}
+
+
+int
+SupernodalSymLinSolver::sendSelf(int cTag, Channel &theChannel)
+{
+    // doing nothing
+    return 0;
+}
+
+
+int
+SupernodalSymLinSolver::recvSelf(int cTag,
+				 Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+    // nothing to do
+    return 0;
+}
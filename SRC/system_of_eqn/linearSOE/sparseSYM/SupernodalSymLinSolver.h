@@ -0,0 +1,84 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// SupernodalSymLinSolver. It solves the SupernodalSymLinSOE by a left
+// looking supernodal L*D*L' factorization. The symbolic phase, done in 
+// setSize(), orders the equations by nested dissection (METIS_NodeND),
+// forms the elimination tree and the supernodes; it is reused for every
+// numerical factorization until the size of the system changes. The 
+// supernodes of each level of the supernodal elimination tree are 
+// factored concurrently by numThreads OpenMP threads. No pivoting is 
+// done, so the matrix must be positive definite or have a stable L*D*L'
+// factorization (e.g. quasi-definite) in the nested dissection order.
+//
+// What: "@(#) SupernodalSymLinSolver.h, revA"
+
+#ifndef SupernodalSymLinSolver_h
+#define SupernodalSymLinSolver_h
+
+#include <LinearSOESolver.h>
+
+class SupernodalSymLinSOE;
+
+class SupernodalSymLinSolver : public LinearSOESolver
+{
+  public:
+    SupernodalSymLinSolver(int numThreads = 0);     
+    ~SupernodalSymLinSolver();
+
+    int solve(void);
+    int setSize(void);
+
+    int setLinearSOE(SupernodalSymLinSOE &theSOE); 
+	
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, 
+		 FEM_ObjectBroker &theBroker);
+  protected:
+
+  private:
+    void clearAll(void);
+    int factor(void);
+    int factorSuper(int s, double *W, int *relInd);
+
+    SupernodalSymLinSOE *theSOE;
+    int numThreads;      // number of threads used in the factorization, 0 for default
+
+    int *levelStart;     // supernodes of each level of the supernodal tree,
+    int *levelSuper;     //   leaves first
+    int numLevels;
+
+    int *updStart;       // for each supernode the supernodes updating it
+    int *updSuper;       //   and the position in their rows of the first
+    int *updPos;         //   row in its columns
+    
+    int maxWork;         // largest update of one supernode by another
+    int maxRows;         // largest number of rows in a supernode
+    double *Y;           // permuted right hand side and solution
+};
+
+#endif
+
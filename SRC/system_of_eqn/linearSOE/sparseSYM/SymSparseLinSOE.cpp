@@ -126,6 +126,9 @@ int SymSparseLinSOE::setSize(Graph &theGraph)
     int oldSize = size;
     size = theGraph.getNumVertex();
 
+    // the locations found by addA() are no longer valid
+    theScatterMap.clear();
+
     // first itearte through the vertices of the graph to get nnz
     Vertex *theVertex;
     int newNNZ = 0;
@@ -258,34 +261,32 @@ int SymSparseLinSOE::addA(const Matrix &in_m, const ID &in_id, double fact)
        return -1;
    }
 
-   // construct m and id based on non-negative id values.
+   // if the id has been seen, the locations of the entries are known
+   ScatterEntry *theEntry = theScatterMap.getEntry(in_id);
+   if (theEntry != 0)
+       return theScatterMap.addMatrix(*theEntry, in_m, fact);
+
+   // construct id based on non-negative id values, keeping the position
+   // in in_id of each for locating the entries of in_m.
+   int inSize = idSize;
    int newPt = 0;
    int *id = new (nothrow) int[idSize];
+   int *inPos = new (nothrow) int[idSize];
    
    for (int jj = 0; jj < idSize; jj++) {
        if (in_id(jj) >= 0 && in_id(jj) < size) {
 	   id[newPt] = in_id(jj);
+	   inPos[newPt] = jj;
 	   newPt++;
        }
    }
 
    idSize = newPt;
-   if (idSize == 0)  return 0;
-   double *m = new (nothrow) double[idSize*idSize];
-
-   int newII = 0;
-   for (int ii = 0; ii < in_id.Size(); ii++) {
-       if (in_id(ii) >= 0 && in_id(ii) < size) {
-
-	   int newJJ = 0;
-	   for (int jj = 0; jj < in_id.Size(); jj++) {
-	       if (in_id(jj) >= 0 && in_id(jj) < size) {
-		   m[newII*idSize + newJJ] = in_m(ii, jj);
-		   newJJ++;
-	       }
-	   }
-	   newII++;
-       }
+   theEntry = theScatterMap.newEntry(in_id, idSize*(idSize+1)/2);
+   if (idSize == 0) {
+       delete [] id;
+       delete [] inPos;
+       return 0;
    }
 
    // forming the new id based on invp.
@@ -295,6 +296,7 @@ int SymSparseLinSOE::addA(const Matrix &in_m, const ID &in_id, double fact)
    if (newID == 0 || isort ==0) {
        opserr << "WARNING SymSparseLinSOE::SymSparseLinSOE :";
        opserr << " ran out of memory for vectors (newID, isort)";
+       theScatterMap.removeEntry(in_id);
        return -1;
    }
 
@@ -312,6 +314,7 @@ int SymSparseLinSOE::addA(const Matrix &in_m, const ID &in_id, double fact)
    OFFDBLK  *ptr;
    OFFDBLK  *saveblk;
    double  *fpt, *iloc, *loc;
+   int numLocs = 0;
 
    nee = idSize;
    lnee = nee;
@@ -349,7 +352,7 @@ int SymSparseLinSOE::addA(const Matrix &in_m, const ID &in_id, double fact)
       k = rowblks[newID[ipos]] ;
       saveblk  = begblk[k] ;
 
-      /* iterate through the element stiffness matrix, assemble each entry */
+      /* iterate through the element stiffness matrix, locate each entry */
       for (i=0; i<lnee; i++)
       { 
 	 ipos = isort[i] ;
@@ -376,25 +379,33 @@ int SymSparseLinSOE::addA(const Matrix &in_m, const ID &in_id, double fact)
 	    if (j_eq >= xblk[iblk]) /* diagonal block (profile) */
 	    {  
 	        loc = iloc + j_eq ;
-		*loc += m[it*idSize + jt] * fact;
             } 
 	    else /* row segment */
 	    { 
 	        while((j_eq >= (ptr->next)->beg) && ((ptr->next)->row == i_eq))
 		    ptr = ptr->next ;
 		fpt = ptr->nz ;
-		fpt[j_eq - ptr->beg] += m[it*idSize + jt] * fact;
+		loc = &fpt[j_eq - ptr->beg];
             }
+
+	    /* m(it,jt) of the reduced matrix */
+	    theEntry->locs[numLocs] = loc;
+	    theEntry->pos[numLocs] = inPos[jt]*inSize + inPos[it];
+	    numLocs++;
          }
-	 diag[i_eq] += m[ipos*idSize + ipos] * fact; /* diagonal element */
+	 /* diagonal element */
+	 theEntry->locs[numLocs] = &diag[i_eq];
+	 theEntry->pos[numLocs] = inPos[ipos]*inSize + inPos[ipos];
+	 numLocs++;
       }
+      theEntry->numLocs = numLocs;
   	  
     delete [] newID;
     delete [] isort;
-    delete [] m;
+    delete [] inPos;
     delete [] id;
 
-    return 0;
+    return theScatterMap.addMatrix(*theEntry, in_m, fact);
 }
 
     
@@ -21,6 +21,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <ScatterMap.h>
 
 extern "C" {
    #include <FeStructs.h>
@@ -81,6 +82,9 @@ class SymSparseLinSOE : public LinearSOE
     OFFDBLK  **begblk;
     OFFDBLK  *first;
 
+    ScatterMap theScatterMap; // locations in the factor storage of the 
+                              // entries added by addA()
+
 };
 
 #endif
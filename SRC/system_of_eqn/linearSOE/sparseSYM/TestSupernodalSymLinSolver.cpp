@@ -0,0 +1,256 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Written: agent
+// Created: Oct 2026
+//
+// Purpose: This file is a driver to test the SupernodalSymLinSolver. It
+// assembles the system of a grid of 4 node quads, two dof per node,
+// solves it with the supernodal LDL' factorization and checks the
+// residual, then solves the same system with the ProfileSPD and UmfPack
+// solvers, checks the solutions agree and prints the times of each.
+//
+//   testSupernodal <numQuads in x> <numQuads in y> <numThreads>
+
+#include <stdlib.h>
+#include <math.h>
+
+#include <OPS_Globals.h>
+#include <StandardStream.h>
+#include <Timer.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+
+#include <SupernodalSymLinSOE.h>
+#include <SupernodalSymLinSolver.h>
+#include <ProfileSPDLinSOE.h>
+#include <ProfileSPDLinDirectSolver.h>
+#include <UmfpackGenLinSOE.h>
+#include <UmfpackGenLinSolver.h>
+
+// global variables
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+double        ops_Dt = 0;
+Domain       *ops_TheActiveDomain = 0;
+Element      *ops_TheActiveElement = 0;
+
+static int nx = 20;
+static int ny = 20;
+
+// the dof of the 4 nodes of quad e
+static void
+getQuadID(int e, ID &id)
+{
+  int i = e % nx;
+  int j = e / nx;
+  int nodes[4];
+  nodes[0] = j*(nx+1) + i;
+  nodes[1] = nodes[0] + 1;
+  nodes[2] = nodes[1] + nx+1;
+  nodes[3] = nodes[0] + nx+1;
+  for (int a=0; a<4; a++) {
+    id(2*a) = 2*nodes[a];
+    id(2*a+1) = 2*nodes[a]+1;
+  }
+}
+
+// a symmetric stiffness for quad e, varying from quad to quad, with
+// springs on the diagonal so the assembled matrix is positive definite
+static void
+getQuadStiff(int e, Matrix &k)
+{
+  static const double lap[4][4] = {{ 4.0, -1.0, -2.0, -1.0},
+				   {-1.0,  4.0, -1.0, -2.0},
+				   {-2.0, -1.0,  4.0, -1.0},
+				   {-1.0, -2.0, -1.0,  4.0}};
+  double E = 1.0 + 0.5*sin(0.1*e);
+  k.Zero();
+  for (int a=0; a<4; a++)
+    for (int b=0; b<4; b++) {
+      k(2*a,2*b) = E*lap[a][b];
+      k(2*a+1,2*b+1) = 2.0*E*lap[a][b];
+      k(2*a,2*b+1) = 0.25*E*lap[a][b];
+      k(2*a+1,2*b) = 0.25*E*lap[a][b];
+    }
+  for (int a=0; a<8; a++)
+    k(a,a) += 0.01;
+}
+
+// the graph of the equations, for the LinearSOE setSize()
+static void
+buildGraph(Graph &theGraph, int numEqn)
+{
+  for (int i=0; i<numEqn; i++)
+    theGraph.addVertex(new Vertex(i, i), false);
+
+  ID id(8);
+  for (int e=0; e<nx*ny; e++) {
+    getQuadID(e, id);
+    for (int a=0; a<8; a++)
+      for (int b=0; b<8; b++)
+	if (a != b)
+	  theGraph.addEdge(id(a), id(b));
+  }
+}
+
+// sets up, assembles and solves theSOE, returning the time of the solve
+static double
+solve(LinearSOE &theSOE, int numEqn, Vector &x)
+{
+  Graph theGraph(numEqn);
+  buildGraph(theGraph, numEqn);
+  theSOE.setSize(theGraph);
+
+  ID id(8);
+  Matrix k(8,8);
+  Vector p(8);
+  for (int e=0; e<nx*ny; e++) {
+    getQuadID(e, id);
+    getQuadStiff(e, k);
+    theSOE.addA(k, id);
+    for (int a=0; a<8; a++)
+      p(a) = 1.0 + 0.01*id(a);
+    theSOE.addB(p, id);
+  }
+
+  Timer theTimer;
+  theTimer.start();
+  int res = theSOE.solve();
+  theTimer.pause();
+  if (res < 0)
+    opserr << "WARNING solve() failed\n";
+
+  x = theSOE.getX();
+  return theTimer.getReal();
+}
+
+
+int main(int argc, char **argv)
+{
+  int numThreads = 0;
+  if (argc > 1)
+    nx = atoi(argv[1]);
+  if (argc > 2)
+    ny = atoi(argv[2]);
+  if (argc > 3)
+    numThreads = atoi(argv[3]);
+  if (nx < 1 || ny < 1) {
+    opserr << "usage: testSupernodal <numQuads in x> <numQuads in y> <numThreads>\n";
+    return -1;
+  }
+
+  int numEqn = 2*(nx+1)*(ny+1);
+  int numTests = 0;
+  int numFailed = 0;
+
+  opserr << "SupernodalSymLinSolver: " << nx << " x " << ny << " quads, ";
+  opserr << numEqn << " equations\n";
+
+  //
+  // supernodal LDL', check the residual
+  //
+
+  SupernodalSymLinSolver *theSupernodalSolver = new SupernodalSymLinSolver(numThreads);
+  SupernodalSymLinSOE theSupernodalSOE(*theSupernodalSolver);
+  Vector x(numEqn);
+  double tSupernodal = solve(theSupernodalSOE, numEqn, x);
+
+  Vector r(numEqn);
+  ID id(8);
+  Matrix k(8,8);
+  Vector xe(8);
+  Vector p(8);
+  for (int e=0; e<nx*ny; e++) {
+    getQuadID(e, id);
+    for (int a=0; a<8; a++)
+      r(id(a)) += 1.0 + 0.01*id(a);
+  }
+  double normB = r.Norm();
+  for (int e=0; e<nx*ny; e++) {
+    getQuadID(e, id);
+    getQuadStiff(e, k);
+    for (int a=0; a<8; a++)
+      p(a) = x(id(a));
+    xe.addMatrixVector(0.0, k, p, 1.0);
+    for (int a=0; a<8; a++)
+      r(id(a)) -= xe(a);
+  }
+
+  numTests++;
+  double relResidual = r.Norm()/normB;
+  if (relResidual < 1.0e-10)
+    opserr << "PASS: |b - A x|/|b| = " << relResidual << endln;
+  else {
+    opserr << "FAIL: |b - A x|/|b| = " << relResidual << endln;
+    numFailed++;
+  }
+
+  //
+  // the same system with the ProfileSPD and UmfPack solvers
+  //
+
+  ProfileSPDLinSolver *theProfileSolver = new ProfileSPDLinDirectSolver();
+  ProfileSPDLinSOE theProfileSOE(*theProfileSolver);
+  Vector xProfile(numEqn);
+  double tProfile = solve(theProfileSOE, numEqn, xProfile);
+
+  UmfpackGenLinSolver *theUmfpackSolver = new UmfpackGenLinSolver();
+  UmfpackGenLinSOE theUmfpackSOE(*theUmfpackSolver);
+  Vector xUmfpack(numEqn);
+  double tUmfpack = solve(theUmfpackSOE, numEqn, xUmfpack);
+
+  numTests++;
+  xProfile -= x;
+  double relDiff = xProfile.Norm()/x.Norm();
+  if (relDiff < 1.0e-8)
+    opserr << "PASS: ProfileSPD solution agrees, " << relDiff << endln;
+  else {
+    opserr << "FAIL: ProfileSPD solution differs, " << relDiff << endln;
+    numFailed++;
+  }
+
+  numTests++;
+  xUmfpack -= x;
+  relDiff = xUmfpack.Norm()/x.Norm();
+  if (relDiff < 1.0e-8)
+    opserr << "PASS: UmfPack solution agrees, " << relDiff << endln;
+  else {
+    opserr << "FAIL: UmfPack solution differs, " << relDiff << endln;
+    numFailed++;
+  }
+
+  opserr << "factor and solve times (real seconds):\n";
+  opserr << "  Supernodal: " << tSupernodal << endln;
+  opserr << "  ProfileSPD: " << tProfile << endln;
+  opserr << "  UmfPack:    " << tUmfpack << endln;
+
+  opserr << numTests - numFailed << " of " << numTests << " tests passed\n";
+
+  if (numFailed != 0)
+    return -1;
+
+  return 0;
+}
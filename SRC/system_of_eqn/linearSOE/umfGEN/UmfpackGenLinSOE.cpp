@@ -48,14 +48,14 @@
 #include <ID.h>
 
 UmfpackGenLinSOE::UmfpackGenLinSOE(UmfpackGenLinSolver &the_Solver)
-    :LinearSOE(the_Solver, LinSOE_TAGS_UmfpackGenLinSOE), X(), B(), Ap(), Ai(), Ax()
+    :LinearSOE(the_Solver, LinSOE_TAGS_UmfpackGenLinSOE), X(), B(), Ap(), Ai(), Ax(), factored(false)
 {
     the_Solver.setLinearSOE(*this);
 }
 
 
 UmfpackGenLinSOE::UmfpackGenLinSOE()
-    :LinearSOE(LinSOE_TAGS_UmfpackGenLinSOE), X(), B(), Ap(), Ai(), Ax()
+    :LinearSOE(LinSOE_TAGS_UmfpackGenLinSOE), X(), B(), Ap(), Ai(), Ax(), factored(false)
 {
 }
 
@@ -89,7 +89,16 @@ UmfpackGenLinSOE::setSize(Graph &theGraph)
 	nnz += theAdjacency.Size() +1; // the +1 is for the diag entry
     }
 
+    // the locations found by addA() are no longer valid
+    theScatterMap.clear();
+    factored = false;
+
+    // the saved Ax no longer fits
+    Axsaved.clear();
+
     // resize A, B, X
+    Ap.clear();
+    Ai.clear();
     Ap.reserve(size+1);
     Ai.reserve(nnz);
     Ax.resize(nnz,0.0);
@@ -158,8 +167,12 @@ UmfpackGenLinSOE::addA(const Matrix &m, const ID &id, double fact)
 	return -1;
     }
 
-    int size = X.Size();
-    if (fact == 1.0) { // do not need to multiply
+    // if the id has not been seen, find the location in Ax of each entry
+    ScatterEntry *theEntry = theScatterMap.getEntry(id);
+    if (theEntry == 0) {
+	theEntry = theScatterMap.newEntry(id, idSize*idSize);
+	int size = X.Size();
+	int numLocs = 0;
 	for (int j=0; j<idSize; j++) {
 	    int col = id(j);
 	    if (col<0 || col>=size) {
@@ -174,36 +187,18 @@ UmfpackGenLinSOE::addA(const Matrix &m, const ID &id, double fact)
 		// find place in A
 		for (int k=Ap[col]; k<Ap[col+1]; k++) {
 		    if (Ai[k] == row) {
-			Ax[k] += m(i,j);
-			break;
-		    }
-		}
-	    }
-	}
-    } else {
-	for (int j=0; j<idSize; j++) {
-	    int col = id(j);
-	    if (col<0 || col>=X.Size()) {
-		continue;
-	    }
-	    for (int i=0; i<idSize; i++) {
-		int row = id(i);
-		if (row<0 || row>=X.Size()) {
-		    continue;
-		}
-
-		// find place in A
-		for (int k=Ap[col]; k<Ap[col+1]; k++) {
-		    if (Ai[k] == row) {
-			Ax[k] += fact*m(i,j);
+			theEntry->locs[numLocs] = &Ax[k];
+			theEntry->pos[numLocs] = j*idSize + i; // m(i,j)
+			numLocs++;
 			break;
 		    }
 		}
 	    }
 	}
+	theEntry->numLocs = numLocs;
     }
 
-    return 0;
+    return theScatterMap.addMatrix(*theEntry, m, fact);
 }
 
 
@@ -280,6 +275,25 @@ void
 UmfpackGenLinSOE::zeroA(void)
 {
     Ax.assign(Ax.size(),0.0);
+    factored = false;
+}
+
+int
+UmfpackGenLinSOE::saveA(void)
+{
+    Axsaved = Ax;
+    return 0;
+}
+
+int
+UmfpackGenLinSOE::restoreA(void)
+{
+    if (Axsaved.empty() || Axsaved.size() != Ax.size())
+	return -1;
+
+    Ax = Axsaved;
+    factored = false;
+    return 0;
 }
 
 void
@@ -337,6 +351,7 @@ UmfpackGenLinSOE::setUmfpackGenLinSolver(UmfpackGenLinSolver &newSolver)
 	    return -1;
 	}
     }
+    factored = false;
     return this->LinearSOE::setSolver(newSolver);
 }
 
@@ -37,6 +37,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <ScatterMap.h>
 #include <vector>
 
 class UmfpackGenLinSolver;
@@ -57,6 +58,9 @@ public:
     
     void zeroA(void);
     void zeroB(void);
+
+    int saveA(void);
+    int restoreA(void);
     
     const Vector &getX(void);
     const Vector &getB(void);    
@@ -78,6 +82,9 @@ private:
     Vector X,B;
     std::vector<int> Ap, Ai;
     std::vector<double> Ax;
+    ScatterMap theScatterMap; // locations in Ax of the entries added by addA()
+    bool factored;            // true if the solver holds the factors of Ax
+    std::vector<double> Axsaved; // copy of Ax kept by saveA()
 };
 
 
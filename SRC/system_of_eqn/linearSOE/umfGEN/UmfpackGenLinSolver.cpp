@@ -46,13 +46,17 @@ void* OPS_UmfpackGenLinSolver()
 
 UmfpackGenLinSolver::
 UmfpackGenLinSolver()
-    :LinearSOESolver(SOLVER_TAGS_UmfpackGenLinSolver), Symbolic(0), theSOE(0)
+    :LinearSOESolver(SOLVER_TAGS_UmfpackGenLinSolver), Symbolic(0), Numeric(0), newSymbolic(false),
+     numFullFact(0), numNumericFact(0), theSOE(0)
 {
 }
 
 
 UmfpackGenLinSolver::~UmfpackGenLinSolver()
 {
+    if (Numeric != 0) {
+	umfpack_di_free_numeric(&Numeric);
+    }
     if (Symbolic != 0) {
 	umfpack_di_free_symbolic(&Symbolic);
     }
@@ -77,24 +81,35 @@ UmfpackGenLinSolver::solve(void)
 	return -1;
     }
     
-    // numerical analysis
-    void* Numeric = 0;
-    int status = umfpack_di_numeric(Ap,Ai,Ax,Symbolic,&Numeric,Control,Info);
-
-    // check error
-    if (status!=UMFPACK_OK) {
-	opserr<<"WARNING: numeric analysis returns "<<status<<" -- Umfpackgenlinsolver::solve\n";
-	return -1;
+    // numerical analysis, only if Ax has changed since the last one; the
+    // symbolic analysis done in setSize() is reused for the whole graph
+    int status;
+    if (theSOE->factored == false || Numeric == 0) {
+	if (Numeric != 0) {
+	    umfpack_di_free_numeric(&Numeric);
+	}
+	status = umfpack_di_numeric(Ap,Ai,Ax,Symbolic,&Numeric,Control,Info);
+
+	// check error
+	if (status!=UMFPACK_OK) {
+	    opserr<<"WARNING: numeric analysis returns "<<status<<" -- Umfpackgenlinsolver::solve\n";
+	    if (Numeric != 0) {
+		umfpack_di_free_numeric(&Numeric);
+	    }
+	    return -1;
+	}
+
+	if (newSymbolic == true)
+	    numFullFact++;
+	else
+	    numNumericFact++;
+	newSymbolic = false;
+	theSOE->factored = true;
     }
 
     // solve
     status = umfpack_di_solve(UMFPACK_A,Ap,Ai,Ax,X,B,Numeric,Control,Info);
 
-    // delete Numeric
-    if (Numeric != 0) {
-	umfpack_di_free_numeric(&Numeric);
-    }
-    
     // check error
     if (status!=UMFPACK_OK) {
 	opserr<<"WARNING: solving returns "<<status<<" -- Umfpackgenlinsolver::solve\n";
@@ -120,7 +135,10 @@ UmfpackGenLinSolver::setSize()
     int* Ai = &(theSOE->Ai[0]);
     double* Ax = &(theSOE->Ax[0]);
 
-    // symbolic analysis
+    // symbolic analysis, the factors of the old graph are no longer valid
+    if (Numeric != 0) {
+	umfpack_di_free_numeric(&Numeric);
+    }
     if (Symbolic != 0) {
 	umfpack_di_free_symbolic(&Symbolic);
     }
@@ -132,9 +150,23 @@ UmfpackGenLinSolver::setSize()
 	Symbolic = 0;
 	return -1;
     }
+    newSymbolic = true;
+
     return 0;
 }
 
+int
+UmfpackGenLinSolver::getNumFullFactorizations(void)
+{
+    return numFullFact;
+}
+
+int
+UmfpackGenLinSolver::getNumNumericFactorizations(void)
+{
+    return numNumericFact;
+}
+
 int
 UmfpackGenLinSolver::setLinearSOE(UmfpackGenLinSOE &theLinearSOE)
 {
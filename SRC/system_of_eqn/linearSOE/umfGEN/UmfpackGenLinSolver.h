@@ -49,6 +49,9 @@ class UmfpackGenLinSolver : public LinearSOESolver
     int solve(void);
     int setSize(void);
 
+    int getNumFullFactorizations(void);
+    int getNumNumericFactorizations(void);
+
     int setLinearSOE(UmfpackGenLinSOE &theSOE);
     
     int sendSelf(int commitTag, Channel &theChannel);
@@ -59,6 +62,10 @@ class UmfpackGenLinSolver : public LinearSOESolver
 
   private:
     void *Symbolic;
+    void *Numeric;      // factors of the last Ax, kept until Ax changes
+    bool newSymbolic;   // true if no numeric factorization since setSize()
+    int numFullFact;    // numeric factorizations following a new symbolic analysis
+    int numNumericFact; // numeric factorizations reusing the symbolic analysis
     double Control[UMFPACK_CONTROL], Info[UMFPACK_INFO];
     UmfpackGenLinSOE *theSOE;
 };
@@ -74,26 +74,21 @@ MapOfTaggedObjects::setSize(int newSize)
 bool 
 MapOfTaggedObjects::addComponent(TaggedObject *newComponent)
 {
-    MAP_TAGGED_ITERATOR theEle;
     int tag = newComponent->getTag();
 
-    // check if the ele already in map, if not we add
-    theEle = theMap.find(tag);
-    if (theEle == theMap.end()) {
-	theMap.insert(MAP_TAGGED_TYPE(tag,newComponent));
-		      
-	// check if sucessfully added 
-	theEle = theMap.find(tag);
-	if (theEle == theMap.end()) {
-	  opserr << "MapOfTaggedObjects::addComponent - map STL failed to add object with tag : " << 
-	    newComponent->getTag() << "\n";
-	  return false;
-	}
+    // models are mostly built in increasing tag order, so try the end of
+    // the map first; otherwise a single insert which fails for a duplicate
+    bool added;
+    if (theMap.empty() || tag > theMap.rbegin()->first) {
+	theMap.insert(theMap.end(), MAP_TAGGED_TYPE(tag,newComponent));
+	added = true;
+    } else {
+	added = theMap.insert(MAP_TAGGED_TYPE(tag,newComponent)).second;
     }
-    
+
     // if ele already there map cannot add even if allowMultiple is true
     // as the map template does not allow multiple entries wih the same tag
-    else {	
+    if (added == false) {
       opserr << "MapOfTaggedObjects::addComponent - not adding as one with similar tag exists, tag: " <<
 	newComponent->getTag() << "\n";
       return false;
@@ -0,0 +1,405 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the implementation of Profiler.
+//
+// What: "@(#) Profiler.cpp, revA"
+
+#include <Profiler.h>
+#include <OPS_Globals.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <mutex>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+// the maximum number of trace events a thread keeps
+#define MAX_NUM_TRACE_EVENTS 2000000
+
+// the node under which the regions of the other threads are reported
+#define OTHER_THREADS "(other threads)"
+
+bool Profiler::enabled = false;
+bool Profiler::tracing = false;
+
+namespace {
+
+  struct Region {
+    std::string name;
+    bool isClass;
+  };
+
+  // a node of the tree of regions of a thread, node 0 is the root
+  struct ProfileNode {
+    int region;
+    int parent;
+    int firstChild;
+    int next;
+    long count;
+    double time;
+  };
+
+  struct TraceEvent {
+    int region;
+    double start;
+    double duration;
+  };
+
+  struct ProfileThread {
+    int id;
+    std::vector<ProfileNode> nodes;
+    std::vector<double> starts;
+    std::vector<TraceEvent> events;
+    int current;
+  };
+
+  std::mutex theMutex;
+  std::vector<Region> theRegions;
+  std::map<std::string, int> theRegionIndex;
+  std::vector<ProfileThread *> theThreads;
+  std::chrono::steady_clock::time_point theStartTime = std::chrono::steady_clock::now();
+
+  // the data of each thread outlives it, it is reported after the threads
+  // of a parallel region have joined
+  thread_local ProfileThread *theThread = 0;
+  thread_local std::unordered_map<const char *, int> theClassCache;
+
+  void
+  clearThread(ProfileThread &theData)
+  {
+    ProfileNode root = {-1, -1, -1, -1, 0, 0.0};
+    theData.nodes.clear();
+    theData.nodes.push_back(root);
+    theData.starts.clear();
+    theData.events.clear();
+    theData.current = 0;
+  }
+
+  ProfileThread *
+  getThread(void)
+  {
+    if (theThread == 0) {
+      std::lock_guard<std::mutex> lock(theMutex);
+      theThread = new ProfileThread;
+      theThread->id = theThreads.size();
+      clearThread(*theThread);
+      theThreads.push_back(theThread);
+    }
+    return theThread;
+  }
+
+  double
+  getTime(void)
+  {
+    std::chrono::duration<double> t = std::chrono::steady_clock::now() - theStartTime;
+    return t.count();
+  }
+
+  int
+  addRegion(const char *name, bool isClass)
+  {
+    std::lock_guard<std::mutex> lock(theMutex);
+    std::map<std::string, int>::iterator it = theRegionIndex.find(name);
+    if (it != theRegionIndex.end())
+      return it->second;
+
+    Region theRegion;
+    theRegion.name = name;
+    theRegion.isClass = isClass;
+    int index = theRegions.size();
+    theRegions.push_back(theRegion);
+    theRegionIndex[theRegion.name] = index;
+    return index;
+  }
+
+  // the child of node for region, added if not there
+  int
+  getChild(std::vector<ProfileNode> &nodes, int node, int region)
+  {
+    int child = nodes[node].firstChild;
+    int last = -1;
+    while (child >= 0) {
+      if (nodes[child].region == region)
+	return child;
+      last = child;
+      child = nodes[child].next;
+    }
+
+    ProfileNode newNode = {region, node, -1, -1, 0, 0.0};
+    child = nodes.size();
+    nodes.push_back(newNode);
+    if (last < 0)
+      nodes[node].firstChild = child;
+    else
+      nodes[last].next = child;
+    return child;
+  }
+
+  // add the subtree of node of a thread under to of the merged tree
+  void
+  mergeTree(const std::vector<ProfileNode> &nodes, int node,
+	    std::vector<ProfileNode> &merged, int to)
+  {
+    for (int child = nodes[node].firstChild; child >= 0; child = nodes[child].next) {
+      int toChild = getChild(merged, to, nodes[child].region);
+      merged[toChild].count += nodes[child].count;
+      merged[toChild].time += nodes[child].time;
+      mergeTree(nodes, child, merged, toChild);
+    }
+  }
+
+  void
+  printTree(OPS_Stream &s, const std::vector<ProfileNode> &nodes, int node,
+	    int depth, double totalTime)
+  {
+    for (int child = nodes[node].firstChild; child >= 0; child = nodes[child].next) {
+      const ProfileNode &theNode = nodes[child];
+      double childTime = 0.0;
+      for (int c = theNode.firstChild; c >= 0; c = nodes[c].next)
+	childTime += nodes[c].time;
+
+      std::ostringstream line;
+      std::string name(2*depth, ' ');
+      name += theRegions[theNode.region].name;
+      line << std::left << std::setw(48) << name << std::right
+	   << std::setw(12) << theNode.count
+	   << std::fixed << std::setprecision(4)
+	   << std::setw(12) << theNode.time
+	   << std::setw(12) << theNode.time - childTime
+	   << std::setprecision(1)
+	   << std::setw(8) << ((totalTime > 0.0) ? 100.0*theNode.time/totalTime : 0.0)
+	   << "\n";
+      s << line.str().c_str();
+
+      printTree(s, nodes, child, depth+1, totalTime);
+    }
+  }
+
+  void
+  writeName(std::ofstream &theFile, const std::string &name)
+  {
+    for (size_t i=0; i<name.size(); i++) {
+      char c = name[i];
+      if (c == '"' || c == '\\')
+	theFile << '\\';
+      theFile << c;
+    }
+  }
+}
+
+void
+Profiler::start(bool trace)
+{
+  Profiler::reset();
+  tracing = trace;
+  enabled = true;
+}
+
+void
+Profiler::stop(void)
+{
+  enabled = false;
+}
+
+// void reset(void);
+//	Clears the times of all threads. It must not be invoked while a 
+//	thread is in a region.
+
+void
+Profiler::reset(void)
+{
+  std::lock_guard<std::mutex> lock(theMutex);
+  for (size_t i=0; i<theThreads.size(); i++)
+    clearThread(*theThreads[i]);
+  theStartTime = std::chrono::steady_clock::now();
+}
+
+int
+Profiler::getRegion(const char *name)
+{
+  return addRegion(name, false);
+}
+
+int
+Profiler::getClassRegion(const char *className)
+{
+  // the class types are mostly string literals, so the thread keeps the
+  // region of each pointer
+  std::unordered_map<const char *, int>::iterator it = theClassCache.find(className);
+  if (it != theClassCache.end())
+    return it->second;
+
+  int region = addRegion(className, true);
+  theClassCache[className] = region;
+  return region;
+}
+
+void
+Profiler::enter(int region)
+{
+  ProfileThread *theData = getThread();
+  theData->current = getChild(theData->nodes, theData->current, region);
+  theData->starts.push_back(getTime());
+}
+
+void
+Profiler::leave(void)
+{
+  ProfileThread *theData = getThread();
+  if (theData->starts.empty() == true)
+    return;
+
+  double startTime = theData->starts.back();
+  double duration = getTime() - startTime;
+  theData->starts.pop_back();
+
+  ProfileNode &theNode = theData->nodes[theData->current];
+  theNode.count++;
+  theNode.time += duration;
+
+  if (tracing == true && theData->events.size() < MAX_NUM_TRACE_EVENTS) {
+    TraceEvent theEvent = {theNode.region, startTime, duration};
+    theData->events.push_back(theEvent);
+  }
+
+  theData->current = theNode.parent;
+}
+
+int
+Profiler::report(OPS_Stream &s)
+{
+  std::lock_guard<std::mutex> lock(theMutex);
+
+  // merge the trees of the threads; the first thread to enter a region 
+  // is the one running the analysis, regions entered by the others (the
+  // elements formed in threaded loops) are placed under a node of their
+  // own, which is not part of the total
+  std::vector<ProfileNode> merged;
+  ProfileNode root = {-1, -1, -1, -1, 0, 0.0};
+  merged.push_back(root);
+  if (theThreads.size() > 0)
+    mergeTree(theThreads[0]->nodes, 0, merged, 0);
+
+  double totalTime = 0.0;
+  for (int child = merged[0].firstChild; child >= 0; child = merged[child].next)
+    totalTime += merged[child].time;
+
+  int others = -1;
+  for (size_t i=1; i<theThreads.size(); i++) {
+    if (theThreads[i]->nodes.size() > 1) {
+      if (others < 0) {
+	int region = theRegionIndex.count(OTHER_THREADS) ? theRegionIndex[OTHER_THREADS] : -1;
+	if (region < 0) {
+	  Region theRegion;
+	  theRegion.name = OTHER_THREADS;
+	  theRegion.isClass = false;
+	  region = theRegions.size();
+	  theRegions.push_back(theRegion);
+	  theRegionIndex[theRegion.name] = region;
+	}
+	others = getChild(merged, 0, region);
+      }
+      mergeTree(theThreads[i]->nodes, 0, merged, others);
+    }
+  }
+  if (others >= 0)
+    for (int child = merged[others].firstChild; child >= 0; child = merged[child].next)
+      merged[others].time += merged[child].time;
+
+  std::ostringstream header;
+  header << std::left << std::setw(48) << "Region" << std::right 
+	 << std::setw(12) << "Calls" << std::setw(12) << "Total(s)"
+	 << std::setw(12) << "Self(s)" << std::setw(8) << "%" << "\n";
+  s << header.str().c_str();
+  printTree(s, merged, 0, 0, totalTime);
+
+  // the time of the element classes, wherever they were entered
+  std::vector<long> classCount(theRegions.size(), 0);
+  std::vector<double> classTime(theRegions.size(), 0.0);
+  bool haveClasses = false;
+  for (size_t i=1; i<merged.size(); i++) {
+    int region = merged[i].region;
+    if (theRegions[region].isClass == true) {
+      classCount[region] += merged[i].count;
+      classTime[region] += merged[i].time;
+      haveClasses = true;
+    }
+  }
+
+  if (haveClasses == true) {
+    std::ostringstream classHeader;
+    classHeader << "\n" << std::left << std::setw(48) << "Class" << std::right
+		<< std::setw(12) << "Calls" << std::setw(12) << "Total(s)" << "\n";
+    s << classHeader.str().c_str();
+    for (size_t i=0; i<theRegions.size(); i++) {
+      if (theRegions[i].isClass == true && classCount[i] > 0) {
+	std::ostringstream line;
+	line << std::left << std::setw(48) << theRegions[i].name << std::right
+	     << std::setw(12) << classCount[i]
+	     << std::fixed << std::setprecision(4) << std::setw(12) << classTime[i] << "\n";
+	s << line.str().c_str();
+      }
+    }
+  }
+
+  return 0;
+}
+
+int
+Profiler::writeTrace(const char *fileName)
+{
+  std::ofstream theFile(fileName);
+  if (theFile.bad() == true || theFile.is_open() == false) {
+    opserr << "WARNING Profiler::writeTrace() - could not open file " << fileName << endln;
+    return -1;
+  }
+
+  std::lock_guard<std::mutex> lock(theMutex);
+
+  theFile << "{\"traceEvents\":[\n";
+  bool first = true;
+  for (size_t i=0; i<theThreads.size(); i++) {
+    const std::vector<TraceEvent> &events = theThreads[i]->events;
+    for (size_t j=0; j<events.size(); j++) {
+      if (first == false)
+	theFile << ",\n";
+      first = false;
+      theFile << "{\"name\":\"";
+      writeName(theFile, theRegions[events[j].region].name);
+      theFile << "\",\"cat\":\"" << (theRegions[events[j].region].isClass ? "class" : "region")
+	      << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << theThreads[i]->id
+	      << std::fixed << std::setprecision(3)
+	      << ",\"ts\":" << 1.0e6*events[j].start
+	      << ",\"dur\":" << 1.0e6*events[j].duration << "}";
+    }
+  }
+  theFile << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  theFile.close();
+
+  return 0;
+}
@@ -0,0 +1,93 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// Written: agent
+// Created: Oct 2026
+// Revision: A
+//
+// Description: This file contains the class definition for Profiler.
+// Profiler times named regions of the code, nested as they are entered,
+// e.g. the element state determination within Domain::update within 
+// the solution of a step. A region is timed by declaring OPS_PROFILE(name)
+// at the start of the block of code; the time spent in the elements of
+// each class is obtained with OPS_PROFILE_CLASS(theEle) around the call 
+// on the element. While the Profiler is not started a region costs a 
+// test of a flag. Each thread keeps its own tree of regions; report() 
+// merges them, summing the times of a region entered by several threads,
+// and lists the times of the element classes. With tracing on each 
+// region entered is also kept (up to a limit) for writeTrace(), which 
+// writes the Chrome trace event format (chrome://tracing, Perfetto).
+//
+// What: "@(#) Profiler.h, revA"
+
+#ifndef Profiler_h
+#define Profiler_h
+
+class OPS_Stream;
+
+class Profiler
+{
+  public:
+    static void start(bool trace = false);
+    static void stop(void);
+    static void reset(void);
+    static bool isEnabled(void) {return enabled;}
+
+    // the index of the region with the given name
+    static int getRegion(const char *name);
+    static int getClassRegion(const char *className);
+
+    static void enter(int region);
+    static void leave(void);
+
+    static int report(OPS_Stream &s);
+    static int writeTrace(const char *fileName);
+
+  private:
+    static bool enabled;
+    static bool tracing;
+};
+
+class ProfileScope
+{
+  public:
+    ProfileScope(int region)
+      :active(Profiler::isEnabled() && region >= 0)
+      {if (active == true) Profiler::enter(region);}
+    ~ProfileScope()
+      {if (active == true) Profiler::leave();}
+
+  private:
+    bool active;
+};
+
+#define OPS_PROFILE_JOIN2(a,b) a##b
+#define OPS_PROFILE_JOIN(a,b) OPS_PROFILE_JOIN2(a,b)
+
+#define OPS_PROFILE(name) \
+  static const int OPS_PROFILE_JOIN(opsProfileRegion,__LINE__) = Profiler::getRegion(name); \
+  ProfileScope OPS_PROFILE_JOIN(opsProfileScope,__LINE__)(OPS_PROFILE_JOIN(opsProfileRegion,__LINE__))
+
+#define OPS_PROFILE_CLASS(theObject) \
+  ProfileScope OPS_PROFILE_JOIN(opsProfileScope,__LINE__)( \
+    (Profiler::isEnabled() && (theObject) != 0) ? \
+    Profiler::getClassRegion((theObject)->getClassType()) : -1)
+
+#endif